@@ -12,24 +12,31 @@ BUILD_DIR = build
 HAL_DIR = $(SRC_DIR)/hal
 SAI_DIR = $(SRC_DIR)/sai
 INTERRUPT_DIR = $(SRC_DIR)/interrupts
+COMMON_DIR = $(SRC_DIR)/common
 TESTS_DIR = $(SRC_DIR)/tests
+BENCH_DIR = $(SRC_DIR)/benchmarks
 
 # Source files
-HAL_SOURCES = $(HAL_DIR)/sonic_hal_controller.cpp
-SAI_SOURCES = $(SAI_DIR)/sonic_sai_controller.cpp
-INTERRUPT_SOURCES = $(INTERRUPT_DIR)/sonic_interrupt_controller.cpp
+HAL_SOURCES = $(HAL_DIR)/sonic_hal_controller.cpp $(HAL_DIR)/sensor_sampler.cpp
+SAI_SOURCES = $(SAI_DIR)/sonic_sai_controller.cpp $(SAI_DIR)/counter_poller.cpp $(SAI_DIR)/acl_classifier.cpp $(SAI_DIR)/lag_manager.cpp
+INTERRUPT_SOURCES = $(INTERRUPT_DIR)/sonic_interrupt_controller.cpp $(INTERRUPT_DIR)/port_table_subscriber.cpp $(INTERRUPT_DIR)/event_dispatcher.cpp $(INTERRUPT_DIR)/event_history.cpp $(INTERRUPT_DIR)/flap_dampener.cpp $(INTERRUPT_DIR)/port_state_table.cpp $(INTERRUPT_DIR)/link_waiter_registry.cpp $(INTERRUPT_DIR)/event_trace.cpp $(INTERRUPT_DIR)/sfp_info_cache.cpp
+COMMON_SOURCES = $(COMMON_DIR)/logger.cpp $(COMMON_DIR)/redis_client.cpp $(COMMON_DIR)/string_interner.cpp $(COMMON_DIR)/port_registry.cpp $(COMMON_DIR)/redis_table_watcher.cpp $(COMMON_DIR)/ip_prefix.cpp $(COMMON_DIR)/event_loop.cpp $(COMMON_DIR)/fdb_table.cpp $(COMMON_DIR)/metrics.cpp $(COMMON_DIR)/startup_orchestrator.cpp $(COMMON_DIR)/cli_executor.cpp $(COMMON_DIR)/actuator_queue.cpp
 TEST_SOURCES = $(TESTS_DIR)/sonic_functional_tests.cpp
 MAIN_SOURCE = $(TESTS_DIR)/main_test_runner.cpp
+BENCH_INTERRUPT_SOURCE = $(BENCH_DIR)/interrupt_event_bench.cpp
 
 # Object files
-HAL_OBJECTS = $(BUILD_DIR)/sonic_hal_controller.o
-SAI_OBJECTS = $(BUILD_DIR)/sonic_sai_controller.o
-INTERRUPT_OBJECTS = $(BUILD_DIR)/sonic_interrupt_controller.o
+HAL_OBJECTS = $(BUILD_DIR)/sonic_hal_controller.o $(BUILD_DIR)/sensor_sampler.o
+SAI_OBJECTS = $(BUILD_DIR)/sonic_sai_controller.o $(BUILD_DIR)/counter_poller.o $(BUILD_DIR)/acl_classifier.o $(BUILD_DIR)/lag_manager.o
+INTERRUPT_OBJECTS = $(BUILD_DIR)/sonic_interrupt_controller.o $(BUILD_DIR)/port_table_subscriber.o $(BUILD_DIR)/event_dispatcher.o $(BUILD_DIR)/event_history.o $(BUILD_DIR)/flap_dampener.o $(BUILD_DIR)/port_state_table.o $(BUILD_DIR)/link_waiter_registry.o $(BUILD_DIR)/event_trace.o $(BUILD_DIR)/sfp_info_cache.o
+COMMON_OBJECTS = $(BUILD_DIR)/logger.o $(BUILD_DIR)/redis_client.o $(BUILD_DIR)/string_interner.o $(BUILD_DIR)/port_registry.o $(BUILD_DIR)/redis_table_watcher.o $(BUILD_DIR)/ip_prefix.o $(BUILD_DIR)/event_loop.o $(BUILD_DIR)/fdb_table.o $(BUILD_DIR)/metrics.o $(BUILD_DIR)/startup_orchestrator.o $(BUILD_DIR)/cli_executor.o $(BUILD_DIR)/actuator_queue.o
 TEST_OBJECTS = $(BUILD_DIR)/sonic_functional_tests.o
 MAIN_OBJECT = $(BUILD_DIR)/main_test_runner.o
+BENCH_INTERRUPT_OBJECT = $(BUILD_DIR)/interrupt_event_bench.o
 
 # Target executable
 TARGET = $(BUILD_DIR)/sonic_functional_tests
+BENCH_INTERRUPT_TARGET = $(BUILD_DIR)/bench_interrupts
 
 # Default target
 all: $(TARGET)
@@ -39,16 +46,20 @@ $(BUILD_DIR):
 	mkdir -p $(BUILD_DIR)
 
 # Compile HAL controller
-$(HAL_OBJECTS): $(HAL_SOURCES) $(HAL_DIR)/sonic_hal_controller.h | $(BUILD_DIR)
-	$(CXX) $(CXXFLAGS) $(INCLUDES) -c $(HAL_SOURCES) -o $(HAL_OBJECTS)
+$(HAL_OBJECTS): $(BUILD_DIR)/%.o: $(HAL_DIR)/%.cpp $(wildcard $(HAL_DIR)/*.h) $(wildcard $(COMMON_DIR)/*.h) | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) $(INCLUDES) -c $< -o $@
 
 # Compile SAI controller
-$(SAI_OBJECTS): $(SAI_SOURCES) $(SAI_DIR)/sonic_sai_controller.h | $(BUILD_DIR)
-	$(CXX) $(CXXFLAGS) $(INCLUDES) -c $(SAI_SOURCES) -o $(SAI_OBJECTS)
+$(SAI_OBJECTS): $(BUILD_DIR)/%.o: $(SAI_DIR)/%.cpp $(wildcard $(SAI_DIR)/*.h) $(wildcard $(COMMON_DIR)/*.h) | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) $(INCLUDES) -c $< -o $@
 
 # Compile Interrupt controller
-$(INTERRUPT_OBJECTS): $(INTERRUPT_SOURCES) $(INTERRUPT_DIR)/sonic_interrupt_controller.h | $(BUILD_DIR)
-	$(CXX) $(CXXFLAGS) $(INCLUDES) -c $(INTERRUPT_SOURCES) -o $(INTERRUPT_OBJECTS)
+$(INTERRUPT_OBJECTS): $(BUILD_DIR)/%.o: $(INTERRUPT_DIR)/%.cpp $(wildcard $(INTERRUPT_DIR)/*.h) $(wildcard $(COMMON_DIR)/*.h) | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) $(INCLUDES) -c $< -o $@
+
+# Compile shared Redis client
+$(COMMON_OBJECTS): $(BUILD_DIR)/%.o: $(COMMON_DIR)/%.cpp $(wildcard $(COMMON_DIR)/*.h) | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) $(INCLUDES) -c $< -o $@
 
 # Compile test framework
 $(TEST_OBJECTS): $(TEST_SOURCES) $(TESTS_DIR)/sonic_functional_tests.h | $(BUILD_DIR)
@@ -59,11 +70,18 @@ $(MAIN_OBJECT): $(MAIN_SOURCE) $(TESTS_DIR)/sonic_functional_tests.h | $(BUILD_D
 	$(CXX) $(CXXFLAGS) $(INCLUDES) -c $(MAIN_SOURCE) -o $(MAIN_OBJECT)
 
 # Link final executable
-$(TARGET): $(HAL_OBJECTS) $(SAI_OBJECTS) $(INTERRUPT_OBJECTS) $(TEST_OBJECTS) $(MAIN_OBJECT)
-	$(CXX) $(CXXFLAGS) $(HAL_OBJECTS) $(SAI_OBJECTS) $(INTERRUPT_OBJECTS) $(TEST_OBJECTS) $(MAIN_OBJECT) $(LIBS) -o $(TARGET)
+$(TARGET): $(HAL_OBJECTS) $(SAI_OBJECTS) $(INTERRUPT_OBJECTS) $(COMMON_OBJECTS) $(TEST_OBJECTS) $(MAIN_OBJECT)
+	$(CXX) $(CXXFLAGS) $(HAL_OBJECTS) $(SAI_OBJECTS) $(INTERRUPT_OBJECTS) $(COMMON_OBJECTS) $(TEST_OBJECTS) $(MAIN_OBJECT) $(LIBS) -o $(TARGET)
 	@echo "Build completed successfully!"
 	@echo "Executable: $(TARGET)"
 
+# Interrupt dispatch benchmark
+$(BENCH_INTERRUPT_OBJECT): $(BENCH_INTERRUPT_SOURCE) $(wildcard $(INTERRUPT_DIR)/*.h) | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) $(INCLUDES) -c $(BENCH_INTERRUPT_SOURCE) -o $(BENCH_INTERRUPT_OBJECT)
+
+$(BENCH_INTERRUPT_TARGET): $(INTERRUPT_OBJECTS) $(COMMON_OBJECTS) $(BENCH_INTERRUPT_OBJECT)
+	$(CXX) $(CXXFLAGS) $(INTERRUPT_OBJECTS) $(COMMON_OBJECTS) $(BENCH_INTERRUPT_OBJECT) $(LIBS) -o $(BENCH_INTERRUPT_TARGET)
+
 # Individual component builds
 hal: $(HAL_OBJECTS)
 	@echo "HAL controller compiled successfully"
@@ -157,6 +175,12 @@ benchmark: $(TARGET)
 	@echo "Running performance benchmarks..."
 	time ./$(TARGET) --stress-tests --quiet
 
+# Event-storm benchmark; override e.g. BENCH_ARGS="--rate 0 --ports 64"
+BENCH_ARGS ?=
+bench-interrupts: $(BENCH_INTERRUPT_TARGET)
+	@echo "Running interrupt event-storm benchmark..."
+	./$(BENCH_INTERRUPT_TARGET) --output $(BUILD_DIR)/bench_interrupts.json $(BENCH_ARGS)
+
 # Memory testing (requires valgrind)
 memcheck: $(TARGET)
 	@echo "Running memory check..."
@@ -228,6 +252,7 @@ help:
 	@echo "  memcheck     - Run memory leak detection"
 	@echo "  coverage     - Generate code coverage report"
 	@echo "  benchmark    - Run performance benchmarks"
+	@echo "  bench-interrupts - Interrupt event-storm benchmark (JSON in build/)"
 	@echo ""
 	@echo "Maintenance:"
 	@echo "  clean        - Remove build artifacts"
@@ -240,7 +265,7 @@ help:
 .PHONY: all hal sai tests debug release analyze format docs clean clean-all help
 .PHONY: run-tests run-quick run-hal run-sai run-integration run-stress
 .PHONY: test-stop-on-failure test-quiet test-with-output
-.PHONY: validate-hal validate-sai validate-all benchmark memcheck coverage
+.PHONY: validate-hal validate-sai validate-all benchmark bench-interrupts memcheck coverage
 .PHONY: install uninstall
 
 # Default target
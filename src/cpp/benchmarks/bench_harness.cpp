@@ -0,0 +1,276 @@
+#include "bench_harness.h"
+#include "../common/json.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <streambuf>
+#include <thread>
+#include <pthread.h>
+#include <sched.h>
+
+namespace sonic {
+namespace bench {
+
+namespace {
+
+constexpr uint64_t MAX_ITERATIONS = 1000000000ULL;
+
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+// Silences std::cout for the lifetime of the object
+class StdoutSilencer {
+public:
+    explicit StdoutSilencer(bool enabled) : m_saved(nullptr) {
+        if (enabled) {
+            std::cout.flush();
+            m_saved = std::cout.rdbuf(&m_null);
+        }
+    }
+    ~StdoutSilencer() {
+        if (m_saved) {
+            std::cout.rdbuf(m_saved);
+        }
+    }
+
+private:
+    NullBuffer m_null;
+    std::streambuf* m_saved;
+};
+
+double perItemNs(const State& state) {
+    double items = static_cast<double>(state.iterations() * state.itemsPerIteration());
+    return std::chrono::duration<double, std::nano>(state.elapsed()).count() / items;
+}
+
+std::string readFirstLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+// Quoted and escaped
+std::string jsonString(const std::string& text) {
+    std::string out;
+    common::JsonWriter::appendEscaped(out, text);
+    return out;
+}
+
+} // anonymous namespace
+
+void Runner::add(const std::string& name, Function function) {
+    m_benchmarks.push_back({name, std::move(function)});
+}
+
+std::vector<std::string> Runner::names() const {
+    std::vector<std::string> result;
+    for (const auto& benchmark : m_benchmarks) {
+        result.push_back(benchmark.name);
+    }
+    return result;
+}
+
+bool Runner::pinToCpu(int cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (rc != 0) {
+        std::cerr << "[BENCH] Cannot pin to CPU " << cpu << " (error " << rc << ")" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+State Runner::runOnce(const Benchmark& benchmark, uint64_t iterations, bool quiet) {
+    State state(iterations);
+    StdoutSilencer silencer(quiet);
+    benchmark.function(state);
+    return state;
+}
+
+Result Runner::measure(const Benchmark& benchmark, const Options& options) {
+    Result result;
+    result.name = benchmark.name;
+
+    // Grow the iteration count until one run lasts min_time_s; this doubles as warmup
+    uint64_t iterations = 1;
+    for (;;) {
+        State state = runOnce(benchmark, iterations, options.quiet);
+        if (state.skipped()) {
+            result.skip_reason = state.skipReason();
+            return result;
+        }
+        double seconds = std::chrono::duration<double>(state.elapsed()).count();
+        if (seconds >= options.min_time_s || iterations >= MAX_ITERATIONS) {
+            break;
+        }
+        double scale = seconds > 0 ? options.min_time_s * 1.2 / seconds : 10.0;
+        uint64_t next = static_cast<uint64_t>(iterations * std::min(std::max(scale, 1.5), 10.0));
+        iterations = std::min(std::max(next, iterations + 1), MAX_ITERATIONS);
+    }
+
+    std::vector<double> samples;
+    uint64_t items_per_iteration = 1;
+    for (int i = 0; i < std::max(1, options.repetitions); ++i) {
+        State state = runOnce(benchmark, iterations, options.quiet);
+        if (state.skipped()) {
+            result.skip_reason = state.skipReason();
+            return result;
+        }
+        items_per_iteration = state.itemsPerIteration();
+        samples.push_back(perItemNs(state));
+    }
+
+    std::sort(samples.begin(), samples.end());
+    size_t middle = samples.size() / 2;
+    result.median_ns = samples.size() % 2 ? samples[middle] : (samples[middle - 1] + samples[middle]) / 2;
+    result.min_ns = samples.front();
+    result.max_ns = samples.back();
+    double mean = 0;
+    for (double sample : samples) {
+        mean += sample;
+    }
+    mean /= samples.size();
+    double variance = 0;
+    for (double sample : samples) {
+        variance += (sample - mean) * (sample - mean);
+    }
+    result.stddev_ns = std::sqrt(variance / samples.size());
+    result.iterations = iterations;
+    result.items = iterations * items_per_iteration;
+    return result;
+}
+
+std::vector<Result> Runner::run(const Options& options) {
+    if (options.cpu >= 0 && pinToCpu(options.cpu)) {
+        std::cout << "[BENCH] Pinned to CPU " << options.cpu << std::endl;
+    }
+    std::string governor = readFirstLine("/sys/devices/system/cpu/cpu" + std::to_string(std::max(options.cpu, 0)) +
+                                         "/cpufreq/scaling_governor");
+    if (!governor.empty() && governor != "performance") {
+        std::cout << "[BENCH] CPU frequency governor is '" << governor
+                  << "'; results vary more than with 'performance'" << std::endl;
+    }
+
+    std::vector<Result> results;
+    std::cout << std::left << std::setw(44) << "Benchmark" << std::right << std::setw(12) << "median ns"
+              << std::setw(12) << "min ns" << std::setw(12) << "max ns" << std::setw(8) << "cv %"
+              << std::setw(14) << "items" << std::endl;
+    for (const auto& benchmark : m_benchmarks) {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        Result result = measure(benchmark, options);
+        std::cout << std::left << std::setw(44) << result.name << std::right;
+        if (!result.skip_reason.empty()) {
+            std::cout << "  skipped: " << result.skip_reason << std::endl;
+        } else {
+            double cv = result.median_ns > 0 ? 100.0 * result.stddev_ns / result.median_ns : 0;
+            std::cout << std::fixed << std::setprecision(1) << std::setw(12) << result.median_ns
+                      << std::setw(12) << result.min_ns << std::setw(12) << result.max_ns << std::setw(8) << cv
+                      << std::setw(14) << result.items << std::defaultfloat << std::setprecision(6) << std::endl;
+        }
+        results.push_back(result);
+    }
+    return results;
+}
+
+std::string Runner::toJson(const Options& options, const std::vector<Result>& results) {
+    char date[32] = "";
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+#ifdef NDEBUG
+    const char* build = "release";
+#else
+    const char* build = "debug";
+#endif
+
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\n"
+         << "  \"context\": {\"date\": \"" << date << "\", \"build\": \"" << build << "\", \"cpu\": " << options.cpu
+         << ", \"host_cpus\": " << std::thread::hardware_concurrency() << ", \"repetitions\": "
+         << options.repetitions << ", \"min_time_s\": " << options.min_time_s << "},\n"
+         << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        json << (i ? ",\n" : "\n") << "    {\"name\": " << jsonString(result.name);
+        if (!result.skip_reason.empty()) {
+            json << ", \"skipped\": " << jsonString(result.skip_reason) << "}";
+            continue;
+        }
+        json << ", \"median_ns\": " << result.median_ns << ", \"min_ns\": " << result.min_ns
+             << ", \"max_ns\": " << result.max_ns << ", \"stddev_ns\": " << result.stddev_ns
+             << ", \"iterations\": " << result.iterations << ", \"items\": " << result.items << "}";
+    }
+    json << "\n  ]\n}\n";
+    return json.str();
+}
+
+bool Runner::writeJson(const std::string& path, const Options& options, const std::vector<Result>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "[BENCH] Cannot write " << path << std::endl;
+        return false;
+    }
+    out << toJson(options, results);
+    return static_cast<bool>(out);
+}
+
+bool Runner::compareToBaseline(const std::string& path, const std::vector<Result>& results,
+                               double threshold_pct) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "[BENCH] Cannot read baseline " << path << std::endl;
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string text = buffer.str();
+
+    common::JsonDocument document;
+    if (!document.parse(text)) {
+        std::cerr << "[BENCH] Baseline " << path << " is not valid JSON: " << document.error() << std::endl;
+        return false;
+    }
+    std::map<std::string, double> baseline;
+    common::JsonDocument::Value benchmarks = document.root()["benchmarks"];
+    for (auto entry = benchmarks.firstChild(); entry.valid(); entry = entry.next()) {
+        double median = 0;
+        if (entry["median_ns"].getDouble(median)) {
+            baseline[entry["name"].asString()] = median;
+        }
+    }
+
+    bool ok = true;
+    std::cout << std::fixed << std::setprecision(1) << "[BENCH] Compared to " << path << " (fail above +"
+              << threshold_pct << "%):" << std::endl;
+    for (const auto& result : results) {
+        auto it = baseline.find(result.name);
+        if (!result.skip_reason.empty() || it == baseline.end() || it->second <= 0) {
+            continue;
+        }
+        double change_pct = 100.0 * (result.median_ns - it->second) / it->second;
+        bool regressed = change_pct > threshold_pct;
+        ok &= !regressed;
+        std::cout << "  " << std::left << std::setw(44) << result.name << std::right << std::setw(12) << it->second << " -> " << std::setw(12)
+                  << result.median_ns << std::showpos << std::setw(9) << change_pct << "%" << std::noshowpos
+                  << (regressed ? "  REGRESSION" : "") << std::endl;
+    }
+    std::cout << std::defaultfloat << std::setprecision(6);
+    return ok;
+}
+
+} // namespace bench
+} // namespace sonic
@@ -0,0 +1,152 @@
+#ifndef SONIC_BENCH_HARNESS_H
+#define SONIC_BENCH_HARNESS_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace sonic {
+namespace bench {
+
+// Keep a value alive so the compiler cannot drop the work that produced it
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void clobberMemory() {
+    asm volatile("" : : : "memory");
+}
+
+// Handed to each benchmark body. The timed region is the loop
+//     while (state.keepRunning()) { ... }
+// Setup before the loop and teardown after it are not timed.
+class State {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit State(uint64_t iterations)
+        : m_iterations(iterations), m_remaining(iterations), m_items_per_iteration(1),
+          m_elapsed(Clock::duration::zero()), m_started(false), m_timing(false) {}
+
+    bool keepRunning() {
+        if (m_remaining > 0) {
+            if (!m_started) {
+                m_started = true;
+                resumeTiming();
+            }
+            --m_remaining;
+            return true;
+        }
+        if (m_timing) {
+            pauseTiming();
+        }
+        return false;
+    }
+
+    // Exclude periodic housekeeping (e.g. draining a full table) from the measurement
+    void pauseTiming() {
+        m_elapsed += Clock::now() - m_start;
+        m_timing = false;
+    }
+
+    void resumeTiming() {
+        m_timing = true;
+        m_start = Clock::now();
+    }
+
+    // Results are reported per item, for bodies that do a batch per iteration
+    void setItemsPerIteration(uint64_t items) { m_items_per_iteration = items ? items : 1; }
+
+    // Mark the benchmark as not runnable here (e.g. no Redis); it is reported as skipped
+    void skip(const std::string& reason) {
+        m_skip_reason = reason;
+        m_remaining = 0;
+    }
+
+    uint64_t iterations() const { return m_iterations; }
+    // Zero-based index of the iteration in progress
+    uint64_t index() const { return m_iterations - m_remaining - 1; }
+    uint64_t itemsPerIteration() const { return m_items_per_iteration; }
+    Clock::duration elapsed() const { return m_elapsed; }
+    bool skipped() const { return !m_skip_reason.empty(); }
+    const std::string& skipReason() const { return m_skip_reason; }
+
+private:
+    uint64_t m_iterations;
+    uint64_t m_remaining;
+    uint64_t m_items_per_iteration;
+    Clock::time_point m_start;
+    Clock::duration m_elapsed;
+    bool m_started;
+    bool m_timing;
+    std::string m_skip_reason;
+};
+
+struct Options {
+    std::string filter;             // Substring of benchmark names to run; empty runs all
+    int repetitions = 5;
+    double min_time_s = 0.2;        // Per repetition
+    int cpu = 0;                    // CPU to pin to, -1 leaves affinity alone
+    bool quiet = true;              // Discard stdout written by the code under test
+    std::string output_file;
+    std::string baseline_file;
+    double threshold_pct = 10.0;    // Median slowdown vs. the baseline that fails the run
+};
+
+struct Result {
+    std::string name;
+    uint64_t iterations = 0;        // Per repetition
+    uint64_t items = 0;             // Per repetition
+    double median_ns = 0;           // Per item, over repetitions
+    double min_ns = 0;
+    double max_ns = 0;
+    double stddev_ns = 0;
+    std::string skip_reason;        // Non-empty when the benchmark did not run
+};
+
+// Registry and driver for the in-house microbenchmarks. Each benchmark is
+// calibrated until one repetition lasts min_time_s, then repeated with that
+// iteration count so every repetition does identical work. The median per
+// item is the figure to compare across runs.
+class Runner {
+public:
+    using Function = std::function<void(State&)>;
+
+    void add(const std::string& name, Function function);
+
+    std::vector<std::string> names() const;
+
+    // Pin, run every benchmark matching the filter and print a table
+    std::vector<Result> run(const Options& options);
+
+    // Stable, line-per-benchmark JSON so successive runs diff cleanly
+    static std::string toJson(const Options& options, const std::vector<Result>& results);
+    static bool writeJson(const std::string& path, const Options& options, const std::vector<Result>& results);
+
+    // Print the change per benchmark against a file written by writeJson();
+    // false when any median got slower than threshold_pct or the file is unreadable
+    static bool compareToBaseline(const std::string& path, const std::vector<Result>& results,
+                                  double threshold_pct);
+
+    // Restrict the calling thread, and threads it starts later, to one CPU
+    static bool pinToCpu(int cpu);
+
+private:
+    struct Benchmark {
+        std::string name;
+        Function function;
+    };
+
+    static State runOnce(const Benchmark& benchmark, uint64_t iterations, bool quiet);
+    static Result measure(const Benchmark& benchmark, const Options& options);
+
+    std::vector<Benchmark> m_benchmarks;
+};
+
+} // namespace bench
+} // namespace sonic
+
+#endif // SONIC_BENCH_HARNESS_H
@@ -0,0 +1,305 @@
+#include "interrupts/sonic_interrupt_controller.h"
+#include "interrupts/event_trace.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <getopt.h>
+
+using namespace sonic::interrupts;
+
+namespace {
+
+struct BenchConfig {
+    uint64_t rate = 200000;         // Events/sec across all producers, 0 = unthrottled
+    int ports = 32;
+    int producers = 2;
+    double duration_s = 5.0;
+    std::string output_file = "build/bench_interrupts.json";
+    std::string record_file;        // Trace the injected events
+    std::string replay_file;        // Replay a trace instead of generating events
+    double speed = 1.0;             // Replay speed, 0 = as fast as possible
+};
+
+struct LatencySummary {
+    double mean_us = 0;
+    double p50_us = 0;
+    double p99_us = 0;
+    double p999_us = 0;
+    double max_us = 0;
+};
+
+void printUsage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " [OPTIONS]\n"
+              << "\nInjects link events straight into the interrupt dispatch path (no Redis)\n"
+              << "and reports throughput and inject-to-handler latency.\n"
+              << "\nOptions:\n"
+              << "  -h, --help              Show this help message\n"
+              << "  -r, --rate N            Target events/sec, 0 = as fast as possible (default: 200000)\n"
+              << "  -p, --ports M           Number of ports events are spread across (default: 32)\n"
+              << "  -j, --producers N       Injecting threads (default: 2)\n"
+              << "  -d, --duration SECONDS  Injection time (default: 5)\n"
+              << "  -o, --output FILE       JSON results file (default: build/bench_interrupts.json)\n"
+              << "  -R, --record FILE       Record the injected events as a binary trace\n"
+              << "  -P, --replay FILE       Replay a recorded trace instead of generating events\n"
+              << "  -s, --speed X           Replay at X times recorded speed, 0 = as fast as possible (default: 1)\n"
+              << std::endl;
+}
+
+double percentile(const std::vector<int64_t>& sorted_ns, double pct) {
+    if (sorted_ns.empty()) {
+        return 0;
+    }
+    size_t index = static_cast<size_t>(pct / 100.0 * (sorted_ns.size() - 1) + 0.5);
+    return sorted_ns[std::min(index, sorted_ns.size() - 1)] / 1000.0;
+}
+
+LatencySummary summarize(std::vector<int64_t>& latencies_ns) {
+    LatencySummary summary;
+    if (latencies_ns.empty()) {
+        return summary;
+    }
+    std::sort(latencies_ns.begin(), latencies_ns.end());
+    double total = 0;
+    for (int64_t ns : latencies_ns) {
+        total += ns;
+    }
+    summary.mean_us = total / latencies_ns.size() / 1000.0;
+    summary.p50_us = percentile(latencies_ns, 50.0);
+    summary.p99_us = percentile(latencies_ns, 99.0);
+    summary.p999_us = percentile(latencies_ns, 99.9);
+    summary.max_us = latencies_ns.back() / 1000.0;
+    return summary;
+}
+
+void producerLoop(SONiCInterruptController& controller, const BenchConfig& config, int producer_id,
+                  std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point stop,
+                  std::atomic<uint64_t>& injected) {
+    // Each producer owns a disjoint slice of ports so per-port ordering stays meaningful
+    std::vector<std::string> ports;
+    for (int i = producer_id; i < config.ports; i += config.producers) {
+        ports.push_back("Ethernet" + std::to_string(i * 4));
+    }
+    if (ports.empty()) {
+        return;
+    }
+
+    std::vector<LinkStatus> status(ports.size(), LinkStatus::UP);
+    double per_producer_rate = config.rate / static_cast<double>(config.producers);
+    uint64_t sent = 0;
+
+    while (true) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= stop) {
+            break;
+        }
+        if (config.rate != 0) {
+            auto due = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(sent / per_producer_rate));
+            if (now < due) {
+                if (due - now > std::chrono::microseconds(200)) {
+                    std::this_thread::sleep_until(due);
+                }
+                continue;
+            }
+        }
+
+        size_t index = sent % ports.size();
+        PortEvent event;
+        event.port_name = ports[index];
+        event.old_status = status[index];
+        event.new_status = (status[index] == LinkStatus::UP) ? LinkStatus::DOWN : LinkStatus::UP;
+        event.event_type = (event.new_status == LinkStatus::UP) ? CableEvent::LINK_UP : CableEvent::LINK_DOWN;
+        event.speed_mbps = 100000;
+        event.duplex = "full";
+        event.additional_info = "bench";
+        status[index] = event.new_status;
+
+        // Latency is measured from this timestamp to handler entry
+        event.timestamp = std::chrono::system_clock::now();
+        controller.injectEvent(event);
+        sent++;
+    }
+    injected.fetch_add(sent);
+}
+
+std::string toJson(const BenchConfig& config, double elapsed_s, uint64_t injected, uint64_t handled,
+                   const std::map<std::string, uint64_t>& stats, const LatencySummary& latency,
+                   const ReplayStats* replay) {
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\n"
+         << "  \"benchmark\": \"interrupt_event_dispatch\",\n";
+    if (replay) {
+        json << "  \"config\": {\"replay\": \"" << config.replay_file << "\", \"speed\": " << config.speed << "},\n"
+             << "  \"replay\": {\"records\": " << replay->records << ", \"trace_span_s\": " << replay->trace_span_s
+             << ", \"mean_lag_us\": " << replay->mean_lag_us << ", \"max_lag_us\": " << replay->max_lag_us
+             << ", \"truncated\": " << (replay->truncated ? "true" : "false") << "},\n";
+    } else {
+        json << "  \"config\": {\"rate\": " << config.rate << ", \"ports\": " << config.ports
+             << ", \"producers\": " << config.producers << ", \"duration_s\": " << config.duration_s << "},\n";
+    }
+    json
+         << "  \"elapsed_s\": " << elapsed_s << ",\n"
+         << "  \"injected\": " << injected << ",\n"
+         << "  \"handled\": " << handled << ",\n"
+         << "  \"dropped\": " << (stats.count("dispatch_dropped") ? stats.at("dispatch_dropped") : 0) << ",\n"
+         << "  \"throughput_eps\": " << (elapsed_s > 0 ? handled / elapsed_s : 0) << ",\n"
+         << "  \"latency_us\": {\"mean\": " << latency.mean_us << ", \"p50\": " << latency.p50_us
+         << ", \"p99\": " << latency.p99_us << ", \"p999\": " << latency.p999_us
+         << ", \"max\": " << latency.max_us << "}\n"
+         << "}\n";
+    return json.str();
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+
+    static struct option long_options[] = {
+        {"help", no_argument, 0, 'h'},
+        {"rate", required_argument, 0, 'r'},
+        {"ports", required_argument, 0, 'p'},
+        {"producers", required_argument, 0, 'j'},
+        {"duration", required_argument, 0, 'd'},
+        {"output", required_argument, 0, 'o'},
+        {"record", required_argument, 0, 'R'},
+        {"replay", required_argument, 0, 'P'},
+        {"speed", required_argument, 0, 's'},
+        {0, 0, 0, 0}
+    };
+
+    int option_index = 0;
+    int c;
+    while ((c = getopt_long(argc, argv, "hr:p:j:d:o:R:P:s:", long_options, &option_index)) != -1) {
+        switch (c) {
+            case 'h':
+                printUsage(argv[0]);
+                return 0;
+            case 'r':
+                config.rate = std::stoull(optarg);
+                break;
+            case 'p':
+                config.ports = std::max(1, std::stoi(optarg));
+                break;
+            case 'j':
+                config.producers = std::max(1, std::stoi(optarg));
+                break;
+            case 'd':
+                config.duration_s = std::stod(optarg);
+                break;
+            case 'o':
+                config.output_file = optarg;
+                break;
+            case 'R':
+                config.record_file = optarg;
+                break;
+            case 'P':
+                config.replay_file = optarg;
+                break;
+            case 's':
+                config.speed = std::max(0.0, std::stod(optarg));
+                break;
+            default:
+                printUsage(argv[0]);
+                return 1;
+        }
+    }
+
+    SONiCInterruptController controller;
+    controller.setEventLogging(false);
+
+    // Preallocate so handlers never allocate; events past the reservation are counted, not sampled
+    size_t reserve = config.rate ? static_cast<size_t>(config.rate * config.duration_s * 1.1) + 1024 : (1u << 24);
+    std::vector<int64_t> latencies_ns(reserve);
+    std::atomic<uint64_t> handled(0);
+
+    controller.registerGlobalEventHandler([&latencies_ns, &handled](const PortEvent& event) {
+        int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now() - event.timestamp).count();
+        uint64_t slot = handled.fetch_add(1, std::memory_order_relaxed);
+        if (slot < latencies_ns.size()) {
+            latencies_ns[slot] = ns;
+        }
+    });
+
+    if (!config.record_file.empty() && !controller.startTrace(config.record_file)) {
+        std::cerr << "[BENCH] Cannot record to " << config.record_file << std::endl;
+        return 1;
+    }
+
+    std::atomic<uint64_t> injected(0);
+    double elapsed_s = 0;
+    ReplayStats replay_stats;
+    bool replaying = !config.replay_file.empty();
+
+    if (replaying) {
+        std::cout << "[BENCH] Replaying " << config.replay_file << " at "
+                  << (config.speed > 0 ? std::to_string(config.speed) + "x" : std::string("max speed")) << std::endl;
+        EventReplayer replayer(controller);
+        ReplayOptions options;
+        options.speed = config.speed;
+        if (!replayer.replay(config.replay_file, options, replay_stats)) {
+            return 1;
+        }
+        injected.store(replay_stats.events_injected);
+        elapsed_s = replay_stats.elapsed_s;
+    } else {
+        std::cout << "[BENCH] Injecting " << (config.rate ? std::to_string(config.rate) : std::string("unthrottled"))
+                  << " events/sec across " << config.ports << " ports with " << config.producers
+                  << " producers for " << config.duration_s << " s" << std::endl;
+
+        auto start = std::chrono::steady_clock::now();
+        auto stop = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(config.duration_s));
+
+        std::vector<std::thread> producers;
+        for (int i = 0; i < config.producers; ++i) {
+            producers.emplace_back(producerLoop, std::ref(controller), std::cref(config), i, start, stop,
+                                   std::ref(injected));
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+        controller.flushEvents(10000);
+        elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    controller.stopTrace();
+
+    uint64_t handled_count = handled.load();
+    std::vector<int64_t> samples(latencies_ns.begin(),
+                                 latencies_ns.begin() + std::min<uint64_t>(handled_count, latencies_ns.size()));
+    LatencySummary latency = summarize(samples);
+    auto stats = controller.getEventStatistics();
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "[BENCH] Injected:   " << injected.load() << "\n"
+              << "[BENCH] Handled:    " << handled_count << " (dropped " << stats["dispatch_dropped"] << ")\n"
+              << "[BENCH] Throughput: " << (elapsed_s > 0 ? handled_count / elapsed_s : 0) << " events/sec\n"
+              << "[BENCH] Latency us: mean " << latency.mean_us << "  p50 " << latency.p50_us
+              << "  p99 " << latency.p99_us << "  p999 " << latency.p999_us << "  max " << latency.max_us
+              << std::endl;
+    if (replaying) {
+        std::cout << "[BENCH] Replay:     " << replay_stats.records << " records over " << replay_stats.trace_span_s
+                  << " s recorded, schedule lag mean " << replay_stats.mean_lag_us << " us, max "
+                  << replay_stats.max_lag_us << " us" << std::endl;
+    }
+
+    std::ofstream out(config.output_file);
+    if (!out) {
+        std::cerr << "[BENCH] Cannot write " << config.output_file << std::endl;
+        return 1;
+    }
+    out << toJson(config, elapsed_s, injected.load(), handled_count, stats, latency,
+                 replaying ? &replay_stats : nullptr);
+    std::cout << "[BENCH] Results written to " << config.output_file << std::endl;
+    return 0;
+}
@@ -0,0 +1,536 @@
+#include "bench_harness.h"
+#include "sai/sai_adapter.h"
+#include "sai/sai_vlan_manager.h"
+#include "sai/sai_command.h"
+#include "interrupts/sonic_interrupt_controller.h"
+#include "syncd/syncd.h"
+#include "common/logger.h"
+#include "common/port_registry.h"
+#include "common/redis_client.h"
+#include <arpa/inet.h>
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <getopt.h>
+
+using namespace sonic;
+using sonic::bench::State;
+
+namespace {
+
+constexpr int BENCH_PORTS = 32;
+constexpr uint16_t BENCH_VLAN_BASE = 3900;     // Clear of the VLANs the demos and tests use
+constexpr int STATE_DB = 6;
+const char* const REDIS_KEY = "SONIC_BENCH|roundtrip";
+
+std::string benchPort(int index) {
+    return "Ethernet" + std::to_string(index * 4);
+}
+
+// Objects shared by the benchmarks, built on first use so a filtered run
+// only pays for what it touches
+struct Fixtures {
+    std::unique_ptr<sai::SAIVLANManager> vlan_manager;
+    std::unique_ptr<interrupts::SONiCInterruptController> controller;
+    std::atomic<uint64_t> handled{0};
+    std::unique_ptr<common::RedisClient> redis;
+    bool redis_checked = false;
+    std::unique_ptr<syncd::Syncd> syncd_engine;
+
+    sai::SAIVLANManager& vlans() {
+        if (!vlan_manager) {
+            vlan_manager.reset(new sai::SAIVLANManager());
+            // Mock OIDs; the mock SAI does not check the bridge port of a member
+            for (int i = 0; i < BENCH_PORTS; ++i) {
+                if (common::portRegistry().findPort(benchPort(i)) == common::INVALID_PORT_ID) {
+                    common::portRegistry().addPort(benchPort(i), 0x1000000000000ULL + i + 1);
+                }
+            }
+        }
+        return *vlan_manager;
+    }
+
+    interrupts::SONiCInterruptController& interrupts() {
+        if (!controller) {
+            controller.reset(new interrupts::SONiCInterruptController());
+            controller->setEventLogging(false);
+            controller->registerGlobalEventHandler([this](const interrupts::PortEvent&) {
+                handled.fetch_add(1, std::memory_order_release);
+            });
+        }
+        return *controller;
+    }
+
+    // nullptr when no Redis server answers; never falls back to redis-cli
+    common::RedisClient* redisClient() {
+        if (!redis_checked) {
+            redis_checked = true;
+            common::RedisConfig config = common::RedisConfig::fromEnvironment("localhost");
+            config.shell_fallback = false;
+            redis.reset(new common::RedisClient(config));
+            common::RedisReply reply;
+            if (!redis->command(STATE_DB, {"PING"}, reply)) {
+                redis.reset();
+            }
+        }
+        return redis.get();
+    }
+
+    // Frames are handed to processFrame() directly; ASIC_DB is never touched
+    syncd::Syncd* syncd() {
+        if (!syncd_engine) {
+            syncd_engine.reset(new syncd::Syncd(common::RedisConfig::fromEnvironment("localhost")));
+            if (!syncd_engine->initialize()) {
+                syncd_engine.reset();
+            }
+        }
+        return syncd_engine.get();
+    }
+};
+
+Fixtures& fixtures() {
+    static Fixtures* instance = new Fixtures();
+    return *instance;
+}
+
+interrupts::PortEvent linkEvent(int port_index, bool up) {
+    interrupts::PortEvent event;
+    event.port_name = benchPort(port_index);
+    event.old_status = up ? interrupts::LinkStatus::DOWN : interrupts::LinkStatus::UP;
+    event.new_status = up ? interrupts::LinkStatus::UP : interrupts::LinkStatus::DOWN;
+    event.event_type = up ? interrupts::CableEvent::LINK_UP : interrupts::CableEvent::LINK_DOWN;
+    event.speed_mbps = 100000;
+    event.duplex = "full";
+    event.additional_info = "bench";
+    event.timestamp = std::chrono::system_clock::now();
+    return event;
+}
+
+// ---- SAIVLANManager ----
+
+void benchVLANCreateDelete(State& state) {
+    sai::SAIVLANManager& vlans = fixtures().vlans();
+    while (state.keepRunning()) {
+        bench::doNotOptimize(vlans.createVLAN(BENCH_VLAN_BASE, "BenchVlan"));
+        bench::doNotOptimize(vlans.deleteVLAN(BENCH_VLAN_BASE));
+    }
+}
+
+void benchVLANAddRemovePort(State& state) {
+    sai::SAIVLANManager& vlans = fixtures().vlans();
+    const uint16_t vlan_id = BENCH_VLAN_BASE + 1;
+    if (!vlans.createVLAN(vlan_id, "BenchVlan")) {
+        state.skip("cannot create VLAN " + std::to_string(vlan_id));
+        return;
+    }
+    std::vector<std::string> ports;
+    for (int i = 0; i < BENCH_PORTS; ++i) {
+        ports.push_back(benchPort(i));
+    }
+    while (state.keepRunning()) {
+        const std::string& port = ports[state.index() % ports.size()];
+        bench::doNotOptimize(vlans.addPortToVLAN(vlan_id, port, true));
+        bench::doNotOptimize(vlans.removePortFromVLAN(vlan_id, port));
+    }
+    vlans.deleteVLAN(vlan_id);
+}
+
+void benchVLANBulkMembers(State& state) {
+    sai::SAIVLANManager& vlans = fixtures().vlans();
+    const uint16_t vlan_id = BENCH_VLAN_BASE + 2;
+    if (!vlans.createVLAN(vlan_id, "BenchVlan")) {
+        state.skip("cannot create VLAN " + std::to_string(vlan_id));
+        return;
+    }
+    std::vector<sai::VLANMemberRequest> requests;
+    for (int i = 0; i < BENCH_PORTS; ++i) {
+        requests.push_back({vlan_id, benchPort(i), true});
+    }
+    state.setItemsPerIteration(requests.size());
+    while (state.keepRunning()) {
+        bench::doNotOptimize(vlans.addPortsToVLANs(requests));
+        bench::doNotOptimize(vlans.removePortsFromVLANs(requests));
+    }
+    vlans.deleteVLAN(vlan_id);
+}
+
+void benchVLANMembershipLookup(State& state) {
+    sai::SAIVLANManager& vlans = fixtures().vlans();
+    const uint16_t vlan_id = BENCH_VLAN_BASE + 3;
+    if (!vlans.createVLAN(vlan_id, "BenchVlan")) {
+        state.skip("cannot create VLAN " + std::to_string(vlan_id));
+        return;
+    }
+    std::vector<std::string> ports;
+    for (int i = 0; i < BENCH_PORTS; ++i) {
+        ports.push_back(benchPort(i));
+        if (i % 2 == 0) {
+            vlans.addPortToVLAN(vlan_id, ports.back(), false);
+        }
+    }
+    while (state.keepRunning()) {
+        bench::doNotOptimize(vlans.isPortInVLAN(vlan_id, ports[state.index() % ports.size()]));
+    }
+    vlans.deleteVLAN(vlan_id);
+}
+
+// ---- Mock SAI object store ----
+
+void benchMockCreateRemoveVLAN(State& state) {
+    fixtures().vlans();     // Initializes the adapter and the switch object
+    sai::SAIAdapter* adapter = sai::SAIAdapter::getInstance();
+    sai_vlan_api_t* api = adapter->getVLANAPI();
+    sai_object_id_t switch_id = adapter->getSwitchId();
+    sai_attribute_t attr;
+    attr.id = SAI_VLAN_ATTR_VLAN_ID;
+    attr.value.u16 = BENCH_VLAN_BASE + 4;
+    while (state.keepRunning()) {
+        sai_object_id_t oid = SAI_NULL_OBJECT_ID;
+        api->create_vlan(&oid, switch_id, 1, &attr);
+        api->remove_vlan(oid);
+    }
+}
+
+void benchMockCreateRemoveMemberLoaded(State& state) {
+    fixtures().vlans();
+    sai::SAIAdapter* adapter = sai::SAIAdapter::getInstance();
+    sai_vlan_api_t* api = adapter->getVLANAPI();
+    sai_object_id_t switch_id = adapter->getSwitchId();
+
+    // Keep 4096 live members so lookups hit a populated store, as on a busy switch
+    sai_attribute_t attrs[3];
+    attrs[0].id = SAI_VLAN_MEMBER_ATTR_VLAN_ID;
+    attrs[0].value.oid = 0;
+    attrs[1].id = SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID;
+    attrs[1].value.oid = 0x1000000000001ULL;
+    attrs[2].id = SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE;
+    attrs[2].value.s32 = SAI_VLAN_TAGGING_MODE_TAGGED;
+    std::vector<sai_object_id_t> background(4096, SAI_NULL_OBJECT_ID);
+    for (auto& oid : background) {
+        api->create_vlan_member(&oid, switch_id, 3, attrs);
+    }
+    while (state.keepRunning()) {
+        sai_object_id_t oid = SAI_NULL_OBJECT_ID;
+        api->create_vlan_member(&oid, switch_id, 3, attrs);
+        api->remove_vlan_member(oid);
+    }
+    for (auto oid : background) {
+        api->remove_vlan_member(oid);
+    }
+}
+
+// ---- Interrupt dispatch ----
+
+void benchTriggerEvent(State& state) {
+    interrupts::SONiCInterruptController& controller = fixtures().interrupts();
+    std::vector<interrupts::PortEvent> events;
+    for (int i = 0; i < BENCH_PORTS; ++i) {
+        events.push_back(linkEvent(i, false));
+        events.push_back(linkEvent(i, true));
+    }
+    while (state.keepRunning()) {
+        controller.injectEvent(events[state.index() % events.size()]);
+        // Drain before the dispatch queue can fill, so no event is measured as a cheap drop
+        if ((state.index() & 255) == 255) {
+            state.pauseTiming();
+            controller.flushEvents(1000);
+            state.resumeTiming();
+        }
+    }
+    controller.flushEvents(1000);
+}
+
+void benchTriggerEventRoundTrip(State& state) {
+    Fixtures& shared = fixtures();
+    interrupts::SONiCInterruptController& controller = shared.interrupts();
+    controller.flushEvents(1000);
+    std::vector<interrupts::PortEvent> events;
+    for (int i = 0; i < BENCH_PORTS; ++i) {
+        events.push_back(linkEvent(i, false));
+        events.push_back(linkEvent(i, true));
+    }
+    while (state.keepRunning()) {
+        uint64_t before = shared.handled.load(std::memory_order_acquire);
+        controller.injectEvent(events[state.index() % events.size()]);
+        while (shared.handled.load(std::memory_order_acquire) == before) {
+            std::this_thread::yield();      // The worker may share the pinned CPU
+        }
+    }
+}
+
+// ---- JSON command parsing ----
+
+void benchParseCommand(State& state) {
+    sai::SAICommandParser parser;
+    sai::SAICommand command;
+    const std::string json =
+        R"({"action": "add_vlan_member", "vlan_id": 100, "port": "Ethernet12", "tagging_mode": "tagged"})";
+    while (state.keepRunning()) {
+        bench::doNotOptimize(parser.parse(json, command));
+    }
+}
+
+void benchParseBatch(State& state) {
+    constexpr int BATCH = 32;
+    std::string json = R"({"action": "batch", "commands": [)";
+    for (int i = 0; i < BATCH; ++i) {
+        json += (i ? ", " : "");
+        json += R"({"action": "add_vlan_member", "vlan_id": )" + std::to_string(100 + i) + R"(, "port": ")" +
+                benchPort(i) + R"(", "tagged": true})";
+    }
+    json += "]}";
+
+    sai::SAICommandParser parser;
+    sai::SAICommand command;
+    state.setItemsPerIteration(BATCH);
+    while (state.keepRunning()) {
+        bench::doNotOptimize(parser.parse(json, command));
+    }
+}
+
+// ---- syncd ----
+
+constexpr int SYNCD_ROUTES = 1024;
+
+// SYNCD_ROUTES /24 route creates or removes over one next hop
+syncd::AsicBatch routeBatch(syncd::AsicOp op, sai_object_id_t next_hop) {
+    syncd::AsicBatch batch;
+    batch.ops.resize(SYNCD_ROUTES);
+    for (int i = 0; i < SYNCD_ROUTES; ++i) {
+        syncd::AsicOperation& route = batch.ops[i];
+        route.op = op;
+        route.object_type = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+        std::memset(&route.route_entry, 0, sizeof(route.route_entry));
+        route.route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        route.route_entry.destination.addr.ip4 = htonl(0x0a000000 | (i << 8));
+        route.route_entry.destination.mask.ip4 = htonl(0xffffff00);
+        if (op == syncd::AsicOp::CREATE) {
+            sai_attribute_t attrs[2];
+            std::memset(attrs, 0, sizeof(attrs));
+            attrs[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+            attrs[0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+            attrs[1].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+            attrs[1].value.oid = next_hop;
+            route.attrs.assign(attrs, attrs + 2);
+        }
+    }
+    return batch;
+}
+
+void benchSyncdCodec(State& state) {
+    syncd::AsicBatch batch = routeBatch(syncd::AsicOp::CREATE, 0x0400000000000001ULL);
+    syncd::AsicBatch decoded;
+    std::string frame;
+    state.setItemsPerIteration(SYNCD_ROUTES);
+    while (state.keepRunning()) {
+        syncd::AsicBatchCodec::encode(batch, frame);
+        bench::doNotOptimize(syncd::AsicBatchCodec::decode(frame, decoded));
+    }
+}
+
+void benchSyncdApplyRoutes(State& state) {
+    syncd::Syncd* engine = fixtures().syncd();
+    if (!engine) {
+        state.skip("SAI adapter did not initialize");
+        return;
+    }
+    // A RID next hop; the mock SAI does not resolve it
+    std::string create_frame;
+    std::string remove_frame;
+    syncd::AsicBatchCodec::encode(routeBatch(syncd::AsicOp::CREATE, 0x0400000000000001ULL), create_frame);
+    syncd::AsicBatchCodec::encode(routeBatch(syncd::AsicOp::REMOVE, SAI_NULL_OBJECT_ID), remove_frame);
+    std::string reply_key;
+    std::string reply_frame;
+    state.setItemsPerIteration(2 * SYNCD_ROUTES);
+    while (state.keepRunning()) {
+        engine->processFrame(create_frame, reply_key, reply_frame);
+        engine->processFrame(remove_frame, reply_key, reply_frame);
+    }
+}
+
+// ---- Redis client ----
+
+void benchRedisPing(State& state) {
+    common::RedisClient* redis = fixtures().redisClient();
+    if (!redis) {
+        state.skip("no Redis server");
+        return;
+    }
+    common::RedisReply reply;
+    const std::vector<std::string> ping = {"PING"};
+    while (state.keepRunning()) {
+        bench::doNotOptimize(redis->command(STATE_DB, ping, reply));
+    }
+}
+
+void benchRedisHsetHget(State& state) {
+    common::RedisClient* redis = fixtures().redisClient();
+    if (!redis) {
+        state.skip("no Redis server");
+        return;
+    }
+    std::string value;
+    while (state.keepRunning()) {
+        bench::doNotOptimize(redis->hset(STATE_DB, REDIS_KEY, "oper_status", "up"));
+        bench::doNotOptimize(redis->hget(STATE_DB, REDIS_KEY, "oper_status", value));
+    }
+    redis->del(STATE_DB, REDIS_KEY);
+}
+
+void benchRedisPipeline(State& state) {
+    common::RedisClient* redis = fixtures().redisClient();
+    if (!redis) {
+        state.skip("no Redis server");
+        return;
+    }
+    std::vector<std::vector<std::string>> commands;
+    for (int i = 0; i < BENCH_PORTS; ++i) {
+        commands.push_back({"HSET", REDIS_KEY, benchPort(i), "up"});
+    }
+    std::vector<common::RedisReply> replies;
+    state.setItemsPerIteration(commands.size());
+    while (state.keepRunning()) {
+        bench::doNotOptimize(redis->pipeline(STATE_DB, commands, replies));
+    }
+    redis->del(STATE_DB, REDIS_KEY);
+}
+
+void registerBenchmarks(bench::Runner& runner) {
+    runner.add("sai_vlan_manager/create_delete_vlan", benchVLANCreateDelete);
+    runner.add("sai_vlan_manager/add_remove_port", benchVLANAddRemovePort);
+    runner.add("sai_vlan_manager/bulk_add_remove_port", benchVLANBulkMembers);
+    runner.add("sai_vlan_manager/is_port_in_vlan", benchVLANMembershipLookup);
+    runner.add("mock_sai/create_remove_vlan", benchMockCreateRemoveVLAN);
+    runner.add("mock_sai/create_remove_vlan_member_4k_live", benchMockCreateRemoveMemberLoaded);
+    runner.add("interrupts/trigger_event", benchTriggerEvent);
+    runner.add("interrupts/trigger_event_to_handler", benchTriggerEventRoundTrip);
+    runner.add("sai_command/parse", benchParseCommand);
+    runner.add("sai_command/parse_batch", benchParseBatch);
+    runner.add("syncd/encode_decode_route_batch", benchSyncdCodec);
+    runner.add("syncd/apply_route_batch", benchSyncdApplyRoutes);
+    runner.add("redis/ping", benchRedisPing);
+    runner.add("redis/hset_hget", benchRedisHsetHget);
+    runner.add("redis/pipeline_hset", benchRedisPipeline);
+}
+
+void printUsage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " [OPTIONS]\n"
+              << "\nMicrobenchmarks for the SAI adapter, VLAN manager, mock SAI, interrupt dispatch,\n"
+              << "SAI command parsing and the Redis client. Redis benchmarks are skipped when no\n"
+              << "server answers on REDIS_HOST/REDIS_PORT.\n"
+              << "\nOptions:\n"
+              << "  -h, --help              Show this help message\n"
+              << "  -l, --list              List benchmark names and exit\n"
+              << "  -f, --filter TEXT       Run only benchmarks whose name contains TEXT\n"
+              << "  -r, --repetitions N     Timed repetitions per benchmark (default: 5)\n"
+              << "  -t, --min-time SECONDS  Minimum duration of one repetition (default: 0.2)\n"
+              << "  -c, --cpu N             CPU to pin to, -1 to not pin (default: 0)\n"
+              << "  -o, --output FILE       JSON results file (default: sonic_bench.json)\n"
+              << "  -b, --baseline FILE     Compare medians with an earlier JSON results file\n"
+              << "  -T, --threshold PCT     Slowdown vs. the baseline that fails the run (default: 10)\n"
+              << "  -v, --verbose           Keep the output of the code under test\n"
+              << "\nExit status is 2 when a benchmark regressed past the threshold.\n"
+              << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    bench::Options options;
+    options.output_file = "sonic_bench.json";
+    bool list_only = false;
+
+    static struct option long_options[] = {
+        {"help", no_argument, 0, 'h'},
+        {"list", no_argument, 0, 'l'},
+        {"filter", required_argument, 0, 'f'},
+        {"repetitions", required_argument, 0, 'r'},
+        {"min-time", required_argument, 0, 't'},
+        {"cpu", required_argument, 0, 'c'},
+        {"output", required_argument, 0, 'o'},
+        {"baseline", required_argument, 0, 'b'},
+        {"threshold", required_argument, 0, 'T'},
+        {"verbose", no_argument, 0, 'v'},
+        {0, 0, 0, 0}
+    };
+
+    int option_index = 0;
+    int c;
+    try {
+        while ((c = getopt_long(argc, argv, "hlf:r:t:c:o:b:T:v", long_options, &option_index)) != -1) {
+            switch (c) {
+                case 'h':
+                    printUsage(argv[0]);
+                    return 0;
+                case 'l':
+                    list_only = true;
+                    break;
+                case 'f':
+                    options.filter = optarg;
+                    break;
+                case 'r':
+                    options.repetitions = std::max(1, std::stoi(optarg));
+                    break;
+                case 't':
+                    options.min_time_s = std::stod(optarg);
+                    break;
+                case 'c':
+                    options.cpu = std::stoi(optarg);
+                    break;
+                case 'o':
+                    options.output_file = optarg;
+                    break;
+                case 'b':
+                    options.baseline_file = optarg;
+                    break;
+                case 'T':
+                    options.threshold_pct = std::stod(optarg);
+                    break;
+                case 'v':
+                    options.quiet = false;
+                    break;
+                default:
+                    printUsage(argv[0]);
+                    return 1;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[BENCH] Invalid option value: " << e.what() << std::endl;
+        return 1;
+    }
+
+    bench::Runner runner;
+    registerBenchmarks(runner);
+    if (list_only) {
+        for (const auto& name : runner.names()) {
+            std::cout << name << std::endl;
+        }
+        return 0;
+    }
+
+    if (options.quiet) {
+        common::Logger::setLevel(common::LogLevel::WARN);
+    }
+    std::vector<bench::Result> results = runner.run(options);
+    common::Logger::flush();
+    if (results.empty()) {
+        std::cerr << "[BENCH] No benchmark matches '" << options.filter << "'" << std::endl;
+        return 1;
+    }
+
+    if (!options.output_file.empty()) {
+        if (!bench::Runner::writeJson(options.output_file, options, results)) {
+            return 1;
+        }
+        std::cout << "[BENCH] Results written to " << options.output_file << std::endl;
+    }
+    if (!options.baseline_file.empty() &&
+        !bench::Runner::compareToBaseline(options.baseline_file, results, options.threshold_pct)) {
+        return 2;
+    }
+    return 0;
+}
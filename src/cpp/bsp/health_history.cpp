@@ -0,0 +1,265 @@
+/**
+ * @file health_history.cpp
+ * @brief SONiC BSP Health History Store Implementation
+ */
+
+#include "health_history.h"
+#include "../common/json.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace sonic {
+namespace bsp {
+
+namespace {
+
+int64_t floorTo(int64_t time, int64_t period) {
+    int64_t start = time - time % period;
+    return start > time ? start - period : start;   // Times before the epoch round down too
+}
+
+void appendU32(std::string& out, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        out.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+void appendI64(std::string& out, int64_t value) {
+    uint64_t bits = static_cast<uint64_t>(value);
+    for (int shift = 0; shift < 64; shift += 8) {
+        out.push_back(static_cast<char>((bits >> shift) & 0xFF));
+    }
+}
+
+void appendF32(std::string& out, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    appendU32(out, bits);
+}
+
+} // anonymous namespace
+
+void HealthHistory::Ring::push(const Bucket& bucket) {
+    if (slots.empty()) {
+        return;
+    }
+    if (count < slots.size()) {
+        slots[(head + count) % slots.size()] = bucket;
+        count++;
+    } else {
+        slots[head] = bucket;   // Overwrite the oldest
+        head = (head + 1) % slots.size();
+    }
+}
+
+size_t HealthHistory::Ring::lowerBound(int64_t time) const {
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (at(mid).start < time) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+HealthHistory::HealthHistory(size_t raw_capacity, size_t minute_capacity, size_t hour_capacity) {
+    raw_.slots.resize(raw_capacity);
+    minutes_.slots.resize(minute_capacity);
+    hours_.slots.resize(hour_capacity);
+}
+
+const char* HealthHistory::metricName(HealthMetric metric) {
+    switch (metric) {
+        case HealthMetric::CPU_TEMPERATURE: return "cpu_temperature";
+        case HealthMetric::FAN_SPEED_MIN: return "fan_speed_min";
+        case HealthMetric::POWER_CONSUMPTION: return "power_consumption";
+        case HealthMetric::MEMORY_USAGE: return "memory_usage";
+        default: return "unknown";
+    }
+}
+
+int64_t HealthHistory::periodSeconds(HistoryResolution resolution) {
+    switch (resolution) {
+        case HistoryResolution::MINUTE: return 60;
+        case HistoryResolution::HOUR: return 3600;
+        default: return 0;  // Raw samples have no fixed period
+    }
+}
+
+void HealthHistory::fold(Bucket& bucket, const Values& values) {
+    for (size_t i = 0; i < HEALTH_METRIC_COUNT; ++i) {
+        if (std::isnan(values[i])) {
+            continue;   // Metric not available in this sample
+        }
+        Stat& stat = bucket.stats[i];
+        stat.min = std::min(stat.min, values[i]);
+        stat.max = std::max(stat.max, values[i]);
+        stat.sum += values[i];
+        stat.count++;
+    }
+}
+
+HistorySample HealthHistory::toSample(const Bucket& bucket, size_t metric) {
+    const Stat& stat = bucket.stats[metric];
+    HistorySample sample;
+    sample.time = bucket.start;
+    sample.count = stat.count;
+    if (stat.count > 0) {
+        sample.min = stat.min;
+        sample.max = stat.max;
+        sample.avg = static_cast<float>(stat.sum / stat.count);
+    }
+    return sample;
+}
+
+void HealthHistory::record(int64_t time, const Values& values) {
+    if (has_open_ && time < last_time_) {
+        time = last_time_;      // Clock stepped back; keep the rings ordered
+    }
+    last_time_ = time;
+
+    Bucket empty;
+    for (auto& stat : empty.stats) {
+        stat.min = std::numeric_limits<float>::infinity();
+        stat.max = -std::numeric_limits<float>::infinity();
+        stat.sum = 0.0;
+        stat.count = 0;
+    }
+
+    Bucket sample = empty;
+    sample.start = time;
+    fold(sample, values);
+    raw_.push(sample);
+
+    int64_t minute = floorTo(time, 60);
+    int64_t hour = floorTo(time, 3600);
+    if (!has_open_) {
+        open_minute_ = empty;
+        open_minute_.start = minute;
+        open_hour_ = empty;
+        open_hour_.start = hour;
+        has_open_ = true;
+    }
+    if (minute != open_minute_.start) {
+        minutes_.push(open_minute_);
+        open_minute_ = empty;
+        open_minute_.start = minute;
+    }
+    if (hour != open_hour_.start) {
+        hours_.push(open_hour_);
+        open_hour_ = empty;
+        open_hour_.start = hour;
+    }
+    fold(open_minute_, values);
+    fold(open_hour_, values);
+}
+
+template <typename Fn>
+void HealthHistory::forEachBucket(HistoryResolution resolution, int64_t from, int64_t to, Fn&& fn) const {
+    const Ring& ring = resolution == HistoryResolution::RAW ? raw_
+                     : resolution == HistoryResolution::MINUTE ? minutes_ : hours_;
+    for (size_t i = ring.lowerBound(from); i < ring.count && ring.at(i).start <= to; ++i) {
+        fn(ring.at(i));
+    }
+    if (has_open_ && resolution != HistoryResolution::RAW) {
+        const Bucket& open = resolution == HistoryResolution::MINUTE ? open_minute_ : open_hour_;
+        if (open.start >= from && open.start <= to) {
+            fn(open);
+        }
+    }
+}
+
+std::vector<HistorySample> HealthHistory::query(HealthMetric metric, HistoryResolution resolution,
+                                                int64_t from, int64_t to) const {
+    std::vector<HistorySample> result;
+    size_t index = static_cast<size_t>(metric);
+    if (index >= HEALTH_METRIC_COUNT) {
+        return result;
+    }
+    forEachBucket(resolution, from, to, [&](const Bucket& bucket) { result.push_back(toSample(bucket, index)); });
+    return result;
+}
+
+void HealthHistory::exportJSON(HistoryResolution resolution, int64_t from, int64_t to,
+                               common::JsonWriter& writer) const {
+    writer.beginObject();
+    writer.key("resolution").value(static_cast<long long>(periodSeconds(resolution)));
+    writer.key("time").beginArray();
+    forEachBucket(resolution, from, to, [&](const Bucket& bucket) {
+        writer.value(static_cast<long long>(bucket.start));
+    });
+    writer.endArray();
+
+    // Columns are written by walking the ring again rather than copying it out
+    for (size_t metric = 0; metric < HEALTH_METRIC_COUNT; ++metric) {
+        writer.key(metricName(static_cast<HealthMetric>(metric))).beginObject();
+        const char* fields[] = {"min", "max", "avg"};
+        for (size_t field = 0; field < 3; ++field) {
+            writer.key(fields[field]).beginArray();
+            forEachBucket(resolution, from, to, [&](const Bucket& bucket) {
+                HistorySample sample = toSample(bucket, metric);
+                if (sample.count == 0) {
+                    writer.null();
+                    return;
+                }
+                float value = field == 0 ? sample.min : field == 1 ? sample.max : sample.avg;
+                writer.value(static_cast<double>(value));
+            });
+            writer.endArray();
+        }
+        writer.endObject();
+    }
+    writer.endObject();
+}
+
+void HealthHistory::exportBinary(HistoryResolution resolution, int64_t from, int64_t to, std::string& out) const {
+    out.clear();
+    out.append("SHH1", 4);
+    appendU32(out, static_cast<uint32_t>(periodSeconds(resolution)));
+    appendU32(out, static_cast<uint32_t>(HEALTH_METRIC_COUNT));
+    size_t count_offset = out.size();
+    appendU32(out, 0);
+
+    uint32_t periods = 0;
+    forEachBucket(resolution, from, to, [&](const Bucket& bucket) {
+        appendI64(out, bucket.start);
+        for (size_t metric = 0; metric < HEALTH_METRIC_COUNT; ++metric) {
+            HistorySample sample = toSample(bucket, metric);
+            appendF32(out, sample.min);
+            appendF32(out, sample.max);
+            appendF32(out, sample.avg);
+            appendU32(out, sample.count);
+        }
+        periods++;
+    });
+
+    for (int i = 0; i < 4; ++i) {
+        out[count_offset + i] = static_cast<char>((periods >> (8 * i)) & 0xFF);
+    }
+}
+
+size_t HealthHistory::size(HistoryResolution resolution) const {
+    switch (resolution) {
+        case HistoryResolution::RAW: return raw_.count;
+        case HistoryResolution::MINUTE: return minutes_.count + (has_open_ ? 1 : 0);
+        case HistoryResolution::HOUR: return hours_.count + (has_open_ ? 1 : 0);
+    }
+    return 0;
+}
+
+void HealthHistory::clear() {
+    raw_.head = raw_.count = 0;
+    minutes_.head = minutes_.count = 0;
+    hours_.head = hours_.count = 0;
+    has_open_ = false;
+    last_time_ = 0;
+}
+
+} // namespace bsp
+} // namespace sonic
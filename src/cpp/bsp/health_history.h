@@ -0,0 +1,151 @@
+/**
+ * @file health_history.h
+ * @brief SONiC BSP Health History Store Header
+ *
+ * Fixed-memory time series for the platform health metrics. Every sample is
+ * kept in a raw ring and folded into 1-minute and 1-hour rollups (min, max,
+ * average), each with its own ring, so hours to weeks of history cost a
+ * constant amount of memory decided at construction.
+ */
+
+#ifndef SONIC_BSP_HEALTH_HISTORY_H
+#define SONIC_BSP_HEALTH_HISTORY_H
+
+#include <string>
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace sonic {
+namespace common {
+class JsonWriter;
+}
+
+namespace bsp {
+
+/**
+ * @brief Metrics kept in the history, in storage order
+ */
+enum class HealthMetric : size_t {
+    CPU_TEMPERATURE,    ///< °C
+    FAN_SPEED_MIN,      ///< Slowest fan, RPM
+    POWER_CONSUMPTION,  ///< W
+    MEMORY_USAGE,       ///< %
+    COUNT
+};
+
+constexpr size_t HEALTH_METRIC_COUNT = static_cast<size_t>(HealthMetric::COUNT);
+
+/**
+ * @brief Resolution of a history query
+ */
+enum class HistoryResolution {
+    RAW,        ///< Every recorded sample
+    MINUTE,     ///< 1-minute rollups
+    HOUR        ///< 1-hour rollups
+};
+
+/**
+ * @brief One metric over one sample or rollup period
+ */
+struct HistorySample {
+    int64_t time = 0;           ///< Sample time or period start, Unix seconds
+    float min = 0.0f;
+    float max = 0.0f;
+    float avg = 0.0f;
+    uint32_t count = 0;         ///< Raw samples folded in
+};
+
+/**
+ * @brief Multi-resolution ring store (not thread-safe)
+ */
+class HealthHistory {
+public:
+    using Values = std::array<float, HEALTH_METRIC_COUNT>;
+
+    /**
+     * @param raw_capacity Raw samples kept (one hour at 1 s by default)
+     * @param minute_capacity 1-minute rollups kept (one day by default)
+     * @param hour_capacity 1-hour rollups kept (30 days by default)
+     */
+    explicit HealthHistory(size_t raw_capacity = 3600, size_t minute_capacity = 1440, size_t hour_capacity = 720);
+
+    /**
+     * @brief Add one sample; times earlier than the last one are treated as the last one
+     */
+    void record(int64_t time, const Values& values);
+
+    /**
+     * @brief Samples of one metric with from <= time <= to, oldest first
+     *
+     * Rollups include the periods still being filled.
+     */
+    std::vector<HistorySample> query(HealthMetric metric, HistoryResolution resolution,
+                                     int64_t from, int64_t to) const;
+
+    /**
+     * @brief Write all metrics for a time range as columnar JSON
+     *
+     * {"resolution":60,"time":[...],"cpu_temperature":{"min":[...],"max":[...],"avg":[...]},...}
+     */
+    void exportJSON(HistoryResolution resolution, int64_t from, int64_t to, common::JsonWriter& writer) const;
+
+    /**
+     * @brief Write all metrics for a time range in a packed binary form
+     *
+     * "SHH1", resolution seconds (u32), metric count (u32), period count (u32), then
+     * per period: start (i64) and per metric min, max, avg (f32) and count (u32),
+     * all little-endian. out is overwritten but keeps its capacity.
+     */
+    void exportBinary(HistoryResolution resolution, int64_t from, int64_t to, std::string& out) const;
+
+    size_t size(HistoryResolution resolution) const;
+    void clear();
+
+    static const char* metricName(HealthMetric metric);
+    static int64_t periodSeconds(HistoryResolution resolution);
+
+private:
+    struct Stat {
+        float min;
+        float max;
+        double sum;
+        uint32_t count;
+    };
+
+    struct Bucket {
+        int64_t start = 0;
+        std::array<Stat, HEALTH_METRIC_COUNT> stats;
+    };
+
+    // Fixed-size ring of buckets ordered by start time
+    struct Ring {
+        std::vector<Bucket> slots;
+        size_t head = 0;        // Oldest bucket
+        size_t count = 0;
+
+        void push(const Bucket& bucket);
+        const Bucket& at(size_t index) const { return slots[(head + index) % slots.size()]; }
+        size_t lowerBound(int64_t time) const;  // First bucket with start >= time
+    };
+
+    static void fold(Bucket& bucket, const Values& values);
+    static HistorySample toSample(const Bucket& bucket, size_t metric);
+
+    template <typename Fn>
+    void forEachBucket(HistoryResolution resolution, int64_t from, int64_t to, Fn&& fn) const;
+
+    Ring raw_;
+    Ring minutes_;
+    Ring hours_;
+    Bucket open_minute_;        // Current minute and hour, not yet in their rings
+    Bucket open_hour_;
+    bool has_open_ = false;
+    int64_t last_time_ = 0;
+};
+
+} // namespace bsp
+} // namespace sonic
+
+#endif // SONIC_BSP_HEALTH_HISTORY_H
@@ -4,23 +4,126 @@
  */
 
 #include "led_controller.h"
-#include <iostream>
+#include "../common/logger.h"
+#include <algorithm>
+#include <fstream>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 namespace sonic {
 namespace bsp {
 
-LEDController::LEDController() {
-    // Initialize LED controller
+LEDController::LEDController(const std::string& sysfs_class_root, int frame_ms)
+    : leds_root_(sysfs_class_root + "/leds") {
+    queue_.reset(new common::ActuatorQueue(
+        [this](const common::ActuatorQueue::Batch& batch, std::vector<bool>& rejected) {
+            return applyFrame(batch, rejected);
+        }, frame_ms));
+    queue_->start();
 }
 
 LEDController::~LEDController() {
-    // Cleanup
+    // Apply what is still queued while the sink's members are alive
+    queue_.reset();
 }
 
 bool LEDController::setLED(const std::string& led_name, const std::string& state, const std::string& color) {
-    std::cout << "Setting LED " << led_name << " to " << state << " " << color << std::endl;
+    if (state != "on" && state != "off" && state != "blinking") {
+        SONIC_LOG_ERROR("BSP", "Unknown LED state '" << state << "' for " << led_name);
+        return false;
+    }
+    queue_->set(led_name, state + "," + color);
     return true;
 }
 
+bool LEDController::flush() {
+    return queue_->flush();
+}
+
+common::ActuatorQueue::Stats LEDController::stats() const {
+    return queue_->stats();
+}
+
+bool LEDController::applyFrame(const common::ActuatorQueue::Batch& batch, std::vector<bool>& rejected) {
+    // sysfs write failures do not heal by retrying, so they are rejected per LED rather than
+    // failing the frame; a rejected LED keeps its old written state and is rewritten on its next set
+    for (size_t i = 0; i < batch.size(); ++i) {
+        const std::string& value = batch[i].second;
+        size_t comma = value.find(',');
+        rejected[i] = !applyLED(batch[i].first, value.substr(0, comma), value.substr(comma + 1));
+    }
+    return true;
+}
+
+std::vector<std::string> LEDController::findNodes(const std::string& led_name) const {
+    std::vector<std::string> nodes;
+    DIR* dir = opendir(leds_root_.c_str());
+    if (!dir) {
+        return nodes;
+    }
+    std::string color_prefix = led_name + ":";
+    while (struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name == led_name || name.compare(0, color_prefix.size(), color_prefix) == 0) {
+            nodes.push_back(name);
+        }
+    }
+    closedir(dir);
+    std::sort(nodes.begin(), nodes.end());
+    return nodes;
+}
+
+bool LEDController::applyLED(const std::string& led_name, const std::string& state, const std::string& color) {
+    std::vector<std::string> nodes = findNodes(led_name);
+    if (nodes.empty()) {
+        SONIC_LOG_WARN("BSP", "No LED class device for " << led_name << " under " << leds_root_);
+        return false;
+    }
+
+    std::string target = nodes.front();
+    if (!color.empty() && std::find(nodes.begin(), nodes.end(), led_name + ":" + color) != nodes.end()) {
+        target = led_name + ":" + color;
+    } else if (std::find(nodes.begin(), nodes.end(), led_name) != nodes.end()) {
+        target = led_name;
+    }
+
+    bool ok = true;
+    for (const auto& node : nodes) {
+        if (node != target) {
+            ok &= writeAttribute(node, "trigger", "none") && writeAttribute(node, "brightness", "0");
+        }
+    }
+    if (state == "blinking") {
+        // The timer trigger blinks at its default 500 ms on/off
+        ok &= writeAttribute(target, "trigger", "timer");
+    } else {
+        std::string brightness = "0";
+        if (state == "on") {
+            std::ifstream max_file(leds_root_ + "/" + target + "/max_brightness");
+            if (!std::getline(max_file, brightness) || brightness.empty()) {
+                brightness = "1";
+            }
+        }
+        ok &= writeAttribute(target, "trigger", "none") && writeAttribute(target, "brightness", brightness);
+    }
+    if (!ok) {
+        SONIC_LOG_WARN("BSP", "Failed to set LED " << target << " " << state);
+    }
+    return ok;
+}
+
+bool LEDController::writeAttribute(const std::string& node, const std::string& attribute,
+                                   const std::string& value) const {
+    std::string path = leds_root_ + "/" + node + "/" + attribute;
+    int fd = ::open(path.c_str(), O_WRONLY);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = ::write(fd, value.data(), value.size()) == static_cast<ssize_t>(value.size());
+    ::close(fd);
+    return ok;
+}
+
 } // namespace bsp
 } // namespace sonic
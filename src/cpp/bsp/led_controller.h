@@ -1,25 +1,63 @@
 /**
  * @file led_controller.h
  * @brief SONiC BSP LED Controller Header
+ *
+ * Drives status and port LEDs through the kernel LED class (/sys/class/leds).
+ * During a port-event storm an LED can be set hundreds of times a second, so
+ * setLED() only records the wanted state; a flusher applies the latest state
+ * of each LED once per frame and leaves LEDs already showing it untouched.
  */
 
 #ifndef SONIC_BSP_LED_CONTROLLER_H
 #define SONIC_BSP_LED_CONTROLLER_H
 
+#include "../common/actuator_queue.h"
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace sonic {
 namespace bsp {
 
 class LEDController {
 public:
-    LEDController();
+    static constexpr int DEFAULT_FRAME_MS = 50;
+
+    /**
+     * @param sysfs_class_root Directory holding leds/
+     * @param frame_ms How often queued states are applied
+     */
+    explicit LEDController(const std::string& sysfs_class_root = "/sys/class", int frame_ms = DEFAULT_FRAME_MS);
     ~LEDController();
-    
+
+    LEDController(const LEDController&) = delete;
+    LEDController& operator=(const LEDController&) = delete;
+
+    /**
+     * @brief Queue an LED state; the latest one per LED is applied on the next frame
+     * @param state "on", "off" or "blinking"
+     * @param color Picks the <led_name>:<color> node on boards with one node per color;
+     *              the LED's other color nodes are switched off
+     * @return false for an unknown state
+     */
     bool setLED(const std::string& led_name, const std::string& state, const std::string& color = "");
 
+    /**
+     * @brief Apply queued states now instead of on the next frame
+     */
+    bool flush();
+
+    common::ActuatorQueue::Stats stats() const;
+
 private:
-    // Implementation details
+    bool applyFrame(const common::ActuatorQueue::Batch& batch, std::vector<bool>& rejected);
+    // false if any of the LED's nodes could not be written
+    bool applyLED(const std::string& led_name, const std::string& state, const std::string& color);
+    std::vector<std::string> findNodes(const std::string& led_name) const;
+    bool writeAttribute(const std::string& node, const std::string& attribute, const std::string& value) const;
+
+    std::string leds_root_;
+    std::unique_ptr<common::ActuatorQueue> queue_;  ///< Keyed by LED name, value "<state>,<color>"
 };
 
 } // namespace bsp
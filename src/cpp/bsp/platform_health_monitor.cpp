@@ -6,6 +6,9 @@
  */
 
 #include "platform_health_monitor.h"
+#include "../common/redis_client.h"
+#include "../common/logger.h"
+#include "../common/metrics.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -14,18 +17,40 @@
 #include <iomanip>
 #include <ctime>
 #include <random>
+#include <cmath>
+#include <algorithm>
+#include <limits>
 
 namespace sonic {
 namespace bsp {
 
+namespace {
+
+// The history gets the latest readings once a second whatever each class's period
+constexpr auto HISTORY_INTERVAL = std::chrono::seconds(1);
+
+} // anonymous namespace
+
 PlatformHealthMonitor::PlatformHealthMonitor() 
-    : running_(false), monitoring_thread_(nullptr) {
+    : running_(false), monitoring_thread_(nullptr),
+      redis_(new common::RedisClient(common::RedisConfig::fromEnvironment("localhost"))) {
     
     // Initialize thresholds
     thresholds_.cpu_temp_max = 80.0f;
     thresholds_.fan_speed_min = 2000;
     thresholds_.power_max = 200.0f;
     thresholds_.memory_usage_max = 85.0f;
+
+    // Initialize sampling policy
+    sampling_policy_.min_interval_ms = 1000;
+    sampling_policy_.max_interval_ms = 30000;
+    sampling_policy_.approach_fraction = 0.1f;
+    sampling_policy_.spike_fraction = 0.02f;
+    sampling_policy_.cpu_temp_deadband = 1.0f;
+    sampling_policy_.fan_speed_deadband = 100;
+    sampling_policy_.power_deadband = 5.0f;
+    sampling_policy_.memory_usage_deadband = 2.0f;
+    sampling_policy_.publish_refresh_s = 30;
     
     // Initialize platform interface
     initializePlatform();
@@ -36,16 +61,14 @@ PlatformHealthMonitor::~PlatformHealthMonitor() {
 }
 
 bool PlatformHealthMonitor::initializePlatform() {
-    // Initialize platform-specific hardware interfaces
-    // In a real implementation, this would initialize:
-    // - Temperature sensors
-    // - Fan controllers
-    // - Power monitoring units
-    // - Memory monitoring
-    
     std::cout << "Initializing platform health monitoring..." << std::endl;
     
-    // Simulate platform initialization
+    // Discover the sensor map once; classes without a sensor fall back to simulation
+    if (!sensors_.discover()) {
+        std::cout << "No platform sensors found, using simulated health data" << std::endl;
+    } else {
+        std::cout << "Platform sensors: " << sensors_.describe() << std::endl;
+    }
     platform_initialized_ = true;
     
     std::cout << "Platform health monitor initialized successfully" << std::endl;
@@ -110,31 +133,138 @@ HealthThresholds PlatformHealthMonitor::getThresholds() const {
     return thresholds_;
 }
 
+bool PlatformHealthMonitor::setSamplingPolicy(const SamplingPolicy& policy) {
+    if (policy.min_interval_ms == 0 || policy.min_interval_ms > policy.max_interval_ms) {
+        std::cerr << "Invalid sampling intervals " << policy.min_interval_ms << "-"
+                  << policy.max_interval_ms << " ms" << std::endl;
+        return false;
+    }
+    if (policy.publish_refresh_s == 0) {
+        std::cerr << "Invalid publish refresh interval" << std::endl;
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(thresholds_mutex_);
+    sampling_policy_ = policy;
+    std::cout << "Sampling policy updated" << std::endl;
+    return true;
+}
+
+SamplingPolicy PlatformHealthMonitor::getSamplingPolicy() const {
+    std::lock_guard<std::mutex> lock(thresholds_mutex_);
+    return sampling_policy_;
+}
+
+std::vector<HistorySample> PlatformHealthMonitor::getHistory(HealthMetric metric, HistoryResolution resolution,
+                                                            int64_t from, int64_t to) const {
+    std::lock_guard<std::mutex> lock(history_mutex_);
+    return history_.query(metric, resolution, from, to);
+}
+
+void PlatformHealthMonitor::exportHistoryJSON(HistoryResolution resolution, int64_t from, int64_t to,
+                                              common::JsonWriter& writer) const {
+    std::lock_guard<std::mutex> lock(history_mutex_);
+    history_.exportJSON(resolution, from, to, writer);
+}
+
+void PlatformHealthMonitor::exportHistoryBinary(HistoryResolution resolution, int64_t from, int64_t to,
+                                                std::string& out) const {
+    std::lock_guard<std::mutex> lock(history_mutex_);
+    history_.exportBinary(resolution, from, to, out);
+}
+
+void PlatformHealthMonitor::recordHistory(const HealthData& health) {
+    HealthHistory::Values values;
+    values[static_cast<size_t>(HealthMetric::CPU_TEMPERATURE)] = health.cpu_temperature;
+    values[static_cast<size_t>(HealthMetric::POWER_CONSUMPTION)] = health.power_consumption;
+    values[static_cast<size_t>(HealthMetric::MEMORY_USAGE)] = health.memory_usage;
+
+    values[static_cast<size_t>(HealthMetric::FAN_SPEED_MIN)] = slowestFanSpeed(health);
+
+    int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    std::lock_guard<std::mutex> lock(history_mutex_);
+    history_.record(now, values);
+}
+
+float PlatformHealthMonitor::slowestFanSpeed(const HealthData& health) {
+    float slowest = std::numeric_limits<float>::quiet_NaN();
+    for (const auto& fan : health.fan_speeds) {
+        if (std::isnan(slowest) || fan.second < slowest) {
+            slowest = static_cast<float>(fan.second);
+        }
+    }
+    return slowest;
+}
+
 void PlatformHealthMonitor::monitoringLoop() {
     std::cout << "Health monitoring loop started" << std::endl;
     
+    // Every class is due immediately so the first pass reads all sensors
+    Clock::time_point now = Clock::now();
+    for (auto& schedule : schedules_) {
+        schedule = SensorSchedule();
+        schedule.next_due = now;
+    }
+    Clock::time_point next_history = now;
+    Clock::time_point last_publish = now;
+    SystemStatus published_status = SystemStatus::UNKNOWN;
+    bool ever_published = false;
+    HealthData health;
+
     while (running_) {
         try {
-            // Collect health data
-            HealthData health = collectHealthData();
+            HealthThresholds thresholds = getThresholds();
+            SamplingPolicy policy = getSamplingPolicy();
+            now = Clock::now();
+
+            // Read the sensor classes that are due
+            bool changed = false;
+            for (size_t i = 0; i < SENSOR_CLASS_COUNT; ++i) {
+                if (now >= schedules_[i].next_due) {
+                    changed |= sampleSensorClass(static_cast<SensorClass>(i), health, thresholds, policy, now);
+                }
+            }
+            health.timestamp = getCurrentTimestamp();
+            health.system_status = determineSystemStatus(health);
             
             // Update current health
             {
                 std::lock_guard<std::mutex> lock(health_mutex_);
                 current_health_ = health;
             }
-            
-            // Check thresholds and generate alerts
-            checkThresholds(health);
-
-            // Log health data
-            logHealthData(health);
+            if (now >= next_history) {
+                recordHistory(health);
+                next_history = now + HISTORY_INTERVAL;
+            }
 
-            // Publish health data to Redis for Python API
-            publishHealthData(health);
+            // Publish only on a change beyond the deadband, a status change, or to refresh the key
+            bool refresh_due = !ever_published ||
+                               now - last_publish >= std::chrono::seconds(policy.publish_refresh_s);
+            if (changed || health.system_status != published_status || refresh_due) {
+                // Check thresholds and generate alerts
+                checkThresholds(health);
+
+                // Log health data
+                logHealthData(health);
+
+                // Publish health data to Redis for Python API
+                publishHealthData(health);
+
+                for (auto& schedule : schedules_) {
+                    schedule.published_value = schedule.last_value;
+                    schedule.published = schedule.sampled;
+                }
+                published_status = health.system_status;
+                last_publish = now;
+                ever_published = true;
+            }
             
-            // Sleep for monitoring interval
-            std::this_thread::sleep_for(std::chrono::seconds(30));
+            // Sleep until the next class or history sample is due
+            Clock::time_point wake = next_history;
+            for (const auto& schedule : schedules_) {
+                wake = std::min(wake, schedule.next_due);
+            }
+            std::this_thread::sleep_until(wake);
             
         } catch (const std::exception& e) {
             std::cerr << "Error in monitoring loop: " << e.what() << std::endl;
@@ -145,30 +275,80 @@ void PlatformHealthMonitor::monitoringLoop() {
     std::cout << "Health monitoring loop stopped" << std::endl;
 }
 
-HealthData PlatformHealthMonitor::collectHealthData() {
-    HealthData health;
-    health.timestamp = getCurrentTimestamp();
-    
-    // Read CPU temperature
-    health.cpu_temperature = readCPUTemperature();
-    
-    // Read fan speeds
-    health.fan_speeds = readFanSpeeds();
-    
-    // Read power consumption
-    health.power_consumption = readPowerConsumption();
-    
-    // Read memory usage
-    health.memory_usage = readMemoryUsage();
-    
-    // Determine overall system status
-    health.system_status = determineSystemStatus(health);
-    
-    return health;
+bool PlatformHealthMonitor::sampleSensorClass(SensorClass sensor, HealthData& health,
+                                              const HealthThresholds& thresholds,
+                                              const SamplingPolicy& policy, Clock::time_point now) {
+    SONIC_SCOPED_TIMER("sonic_bsp_sensor_read_seconds", "Time to read one sensor class");
+    float value = 0.0f;
+    float threshold = 0.0f;
+    float headroom = 0.0f;      // Distance left before the threshold is crossed
+    float deadband = 0.0f;
+
+    switch (sensor) {
+        case SensorClass::CPU_TEMPERATURE:
+            health.cpu_temperature = readCPUTemperature();
+            value = health.cpu_temperature;
+            threshold = thresholds.cpu_temp_max;
+            headroom = threshold - value;
+            deadband = policy.cpu_temp_deadband;
+            break;
+        case SensorClass::FANS:
+            readFanSpeeds(health.fan_speeds);
+            value = slowestFanSpeed(health);
+            threshold = static_cast<float>(thresholds.fan_speed_min);
+            headroom = value - threshold;
+            deadband = static_cast<float>(policy.fan_speed_deadband);
+            break;
+        case SensorClass::POWER:
+            health.power_consumption = readPowerConsumption();
+            value = health.power_consumption;
+            threshold = thresholds.power_max;
+            headroom = threshold - value;
+            deadband = policy.power_deadband;
+            break;
+        case SensorClass::MEMORY:
+            health.memory_usage = readMemoryUsage();
+            value = health.memory_usage;
+            threshold = thresholds.memory_usage_max;
+            headroom = threshold - value;
+            deadband = policy.memory_usage_deadband;
+            break;
+        default:
+            return false;
+    }
+
+    SensorSchedule& schedule = schedules_[static_cast<size_t>(sensor)];
+    uint32_t interval = policy.min_interval_ms;
+    if (schedule.sampled) {
+        double elapsed = std::chrono::duration<double>(now - schedule.last_sample).count();
+        float delta = std::fabs(value - schedule.last_value);
+        bool near_threshold = threshold > 0.0f && headroom < policy.approach_fraction * threshold;
+        bool spike = threshold > 0.0f && elapsed > 0.0 && delta / elapsed > policy.spike_fraction * threshold;
+        if (near_threshold || spike) {
+            interval = policy.min_interval_ms;
+        } else if (delta <= deadband) {
+            interval = std::min(std::max(schedule.interval_ms * 2, policy.min_interval_ms),
+                                policy.max_interval_ms);     // Stable, back off
+        } else {
+            interval = std::min(std::max(schedule.interval_ms, policy.min_interval_ms), policy.max_interval_ms);
+        }
+    }
+
+    schedule.interval_ms = interval;
+    schedule.last_value = value;
+    schedule.last_sample = now;
+    schedule.next_due = now + std::chrono::milliseconds(interval);
+    schedule.sampled = true;
+
+    return !schedule.published || std::fabs(value - schedule.published_value) > deadband;
 }
 
 float PlatformHealthMonitor::readCPUTemperature() {
-    // In a real implementation, this would read from hardware sensors
+    float celsius = 0.0f;
+    if (sensors_.readCPUTemperature(celsius)) {
+        return celsius;
+    }
+
     // For simulation, generate realistic temperature values
     
     static std::random_device rd;
@@ -186,10 +366,11 @@ float PlatformHealthMonitor::readCPUTemperature() {
     return temperature;
 }
 
-std::map<std::string, uint32_t> PlatformHealthMonitor::readFanSpeeds() {
-    std::map<std::string, uint32_t> fan_speeds;
-    
-    // In a real implementation, this would read from fan controllers
+void PlatformHealthMonitor::readFanSpeeds(std::map<std::string, uint32_t>& fan_speeds) {
+    if (sensors_.readFanSpeeds(fan_speeds)) {
+        return;
+    }
+
     // For simulation, generate realistic fan speed values
     
     static std::random_device rd;
@@ -207,12 +388,14 @@ std::map<std::string, uint32_t> PlatformHealthMonitor::readFanSpeeds() {
         
         fan_speeds[fan_name] = speed;
     }
-    
-    return fan_speeds;
 }
 
 float PlatformHealthMonitor::readPowerConsumption() {
-    // In a real implementation, this would read from power monitoring units
+    float watts = 0.0f;
+    if (sensors_.readPowerConsumption(watts)) {
+        return watts;
+    }
+
     // For simulation, generate realistic power consumption values
     
     static std::random_device rd;
@@ -223,7 +406,11 @@ float PlatformHealthMonitor::readPowerConsumption() {
 }
 
 float PlatformHealthMonitor::readMemoryUsage() {
-    // In a real implementation, this would read actual memory usage
+    float percent = 0.0f;
+    if (sensors_.readMemoryUsage(percent)) {
+        return percent;
+    }
+
     // For simulation, generate realistic memory usage values
     
     static std::random_device rd;
@@ -312,7 +499,7 @@ void PlatformHealthMonitor::checkThresholds(const HealthData& health) {
             alerts_.push_back(alert);
             
             // Log alert
-            std::cout << "[ALERT] " << alert.message << std::endl;
+            SONIC_LOG_WARN("ALERT", alert.message);
         }
         
         // Keep only last 100 alerts
@@ -324,11 +511,11 @@ void PlatformHealthMonitor::checkThresholds(const HealthData& health) {
 
 void PlatformHealthMonitor::logHealthData(const HealthData& health) {
     // Log to console (in real implementation, this would go to syslog)
-    std::cout << "[HEALTH] " << health.timestamp 
-              << " CPU=" << std::fixed << std::setprecision(1) << health.cpu_temperature << "°C"
-              << " Power=" << std::fixed << std::setprecision(1) << health.power_consumption << "W"
-              << " Memory=" << std::fixed << std::setprecision(1) << health.memory_usage << "%"
-              << " Status=" << systemStatusToString(health.system_status) << std::endl;
+    SONIC_LOG_INFO("HEALTH", health.timestamp
+                   << " CPU=" << std::fixed << std::setprecision(1) << health.cpu_temperature << "°C"
+                   << " Power=" << std::fixed << std::setprecision(1) << health.power_consumption << "W"
+                   << " Memory=" << std::fixed << std::setprecision(1) << health.memory_usage << "%"
+                   << " Status=" << systemStatusToString(health.system_status));
 }
 
 std::string PlatformHealthMonitor::getCurrentTimestamp() {
@@ -351,44 +538,33 @@ std::string PlatformHealthMonitor::systemStatusToString(SystemStatus status) {
 }
 
 void PlatformHealthMonitor::publishHealthData(const HealthData& health) {
-    // In a real implementation, this would use a Redis C++ client like hiredis
-    // For this POC, we'll use a simple system call to redis-cli
-
+    SONIC_SCOPED_TIMER("sonic_bsp_health_publish_seconds", "Time to publish health data to Redis");
     try {
-        std::ostringstream json_stream;
-        json_stream << "{"
-                   << "\"timestamp\":\"" << health.timestamp << "\","
-                   << "\"cpu_temperature\":" << health.cpu_temperature << ","
-                   << "\"fan_speeds\":{";
-
-        bool first_fan = true;
+        common::JsonWriter& json = publish_writer_;
+        json.clear();
+        json.beginObject()
+            .key("timestamp").value(health.timestamp)
+            .key("cpu_temperature").value(static_cast<double>(health.cpu_temperature))
+            .key("fan_speeds").beginObject();
         for (const auto& fan : health.fan_speeds) {
-            if (!first_fan) json_stream << ",";
-            json_stream << "\"" << fan.first << "\":" << fan.second;
-            first_fan = false;
+            json.key(fan.first).value(static_cast<unsigned long long>(fan.second));
         }
-
-        json_stream << "},"
-                   << "\"power_consumption\":" << health.power_consumption << ","
-                   << "\"memory_usage\":" << health.memory_usage << ","
-                   << "\"system_status\":\"" << systemStatusToString(health.system_status) << "\","
-                   << "\"source\":\"cpp_component\""
-                   << "}";
-
-        std::string json_data = json_stream.str();
-
-        // Use redis-cli to set the data (in production, use hiredis library)
-        std::string redis_cmd = "redis-cli -h localhost -p 6379 SETEX sonic:bsp:health:current 60 '" + json_data + "'";
-        int result = system(redis_cmd.c_str());
-
-        if (result == 0) {
-            std::cout << "Published health data to Redis successfully" << std::endl;
+        json.endObject()
+            .key("power_consumption").value(static_cast<double>(health.power_consumption))
+            .key("memory_usage").value(static_cast<double>(health.memory_usage))
+            .key("system_status").value(systemStatusToString(health.system_status))
+            .key("source").value("cpp_component")
+            .endObject();
+
+        if (redis_->setex(0, "sonic:bsp:health:current", 60, json.str())) {
+            SONIC_LOG_DEBUG("BSP", "Published health data to Redis successfully");
         } else {
-            std::cerr << "Failed to publish health data to Redis" << std::endl;
+            SONIC_LOG_ERROR("BSP", "Failed to publish health data to Redis");
+            SONIC_COUNTER_INC("sonic_bsp_health_publish_failures_total", "Health publishes Redis rejected");
         }
 
     } catch (const std::exception& e) {
-        std::cerr << "Error publishing health data: " << e.what() << std::endl;
+        SONIC_LOG_ERROR("BSP", "Error publishing health data: " << e.what());
     }
 }
 
@@ -15,8 +15,17 @@
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <array>
+#include <chrono>
+#include "health_history.h"
+#include "platform_sensors.h"
+#include "../common/json.h"
 
 namespace sonic {
+namespace common {
+class RedisClient;
+}
+
 namespace bsp {
 
 /**
@@ -59,6 +68,39 @@ struct HealthThresholds {
     float memory_usage_max;    ///< Maximum memory usage (%)
 };
 
+/**
+ * @brief Sensor classes, each sampled on its own schedule
+ */
+enum class SensorClass {
+    CPU_TEMPERATURE,
+    FANS,
+    POWER,
+    MEMORY,
+    COUNT
+};
+
+constexpr size_t SENSOR_CLASS_COUNT = static_cast<size_t>(SensorClass::COUNT);
+
+/**
+ * @brief Adaptive sampling and publish policy
+ *
+ * Each sensor class starts at min_interval_ms and doubles its period up to
+ * max_interval_ms while successive readings stay within its deadband. It drops
+ * back to min_interval_ms when a reading comes within approach_fraction of its
+ * threshold or changes faster than spike_fraction of the threshold per second.
+ */
+struct SamplingPolicy {
+    uint32_t min_interval_ms;       ///< Fastest sampling period (ms)
+    uint32_t max_interval_ms;       ///< Slowest sampling period (ms)
+    float approach_fraction;        ///< Headroom, as a fraction of the threshold, that counts as near
+    float spike_fraction;           ///< Change per second, as a fraction of the threshold, that counts as a spike
+    float cpu_temp_deadband;        ///< CPU temperature change that is published (°C)
+    uint32_t fan_speed_deadband;    ///< Slowest-fan change that is published (RPM)
+    float power_deadband;           ///< Power change that is published (W)
+    float memory_usage_deadband;    ///< Memory usage change that is published (%)
+    uint32_t publish_refresh_s;     ///< Republish unchanged data this often; the Redis key expires after 60 s
+};
+
 /**
  * @brief Health data structure
  */
@@ -144,7 +186,57 @@ public:
      */
     HealthThresholds getThresholds() const;
 
+    /**
+     * @brief Set the adaptive sampling policy
+     * @param policy New policy; intervals must be nonzero with min <= max
+     * @return true if applied, false if the policy is invalid
+     */
+    bool setSamplingPolicy(const SamplingPolicy& policy);
+
+    /**
+     * @brief Get the adaptive sampling policy
+     * @return Current policy
+     */
+    SamplingPolicy getSamplingPolicy() const;
+
+    /**
+     * @brief Recorded history of one metric
+     * @param from Earliest sample or period start, Unix seconds
+     * @param to Latest sample or period start, Unix seconds
+     * @return Samples oldest first
+     */
+    std::vector<HistorySample> getHistory(HealthMetric metric, HistoryResolution resolution,
+                                          int64_t from, int64_t to) const;
+
+    /**
+     * @brief Write all metrics for a time range as columnar JSON
+     * @param writer Caller-owned writer; its buffer is reused across calls
+     */
+    void exportHistoryJSON(HistoryResolution resolution, int64_t from, int64_t to,
+                           common::JsonWriter& writer) const;
+
+    /**
+     * @brief Write all metrics for a time range in the HealthHistory binary format
+     * @param out Overwritten; its capacity is reused across calls
+     */
+    void exportHistoryBinary(HistoryResolution resolution, int64_t from, int64_t to, std::string& out) const;
+
 private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Sampling state of one sensor class, owned by the monitoring thread
+     */
+    struct SensorSchedule {
+        Clock::time_point next_due;
+        Clock::time_point last_sample;
+        uint32_t interval_ms = 0;
+        float last_value = 0.0f;        ///< Scalar tracked for the class (slowest fan for FANS)
+        float published_value = 0.0f;
+        bool sampled = false;
+        bool published = false;
+    };
+
     /**
      * @brief Initialize platform hardware interfaces
      * @return true if successful, false otherwise
@@ -157,31 +249,43 @@ private:
     void monitoringLoop();
     
     /**
-     * @brief Collect health data from hardware
-     * @return Health data structure
+     * @brief Read one sensor class into health and reschedule it
+     * @param sensor Sensor class to read
+     * @param health Working health data updated in place
+     * @param thresholds Thresholds the readings approach
+     * @param policy Sampling policy in effect
+     * @param now Time of the reading
+     * @return true if the reading moved beyond its deadband since the last publish
      */
-    HealthData collectHealthData();
+    bool sampleSensorClass(SensorClass sensor, HealthData& health, const HealthThresholds& thresholds,
+                           const SamplingPolicy& policy, Clock::time_point now);
+
+    /**
+     * @brief Slowest fan in health data
+     * @return Speed in RPM, NaN if no fans are reported
+     */
+    static float slowestFanSpeed(const HealthData& health);
     
     /**
-     * @brief Read CPU temperature
+     * @brief Read CPU temperature, simulated when the platform has no sensor
      * @return Temperature in Celsius
      */
     float readCPUTemperature();
     
     /**
-     * @brief Read fan speeds
-     * @return Map of fan names to speeds (RPM)
+     * @brief Read fan speeds, simulated when the platform has no fan sensors
+     * @param fan_speeds Map of fan names to speeds (RPM), updated in place
      */
-    std::map<std::string, uint32_t> readFanSpeeds();
+    void readFanSpeeds(std::map<std::string, uint32_t>& fan_speeds);
     
     /**
-     * @brief Read power consumption
+     * @brief Read power consumption, simulated when the platform has no sensor
      * @return Power consumption in Watts
      */
     float readPowerConsumption();
     
     /**
-     * @brief Read memory usage
+     * @brief Read memory usage, simulated when /proc/meminfo is unreadable
      * @return Memory usage percentage
      */
     float readMemoryUsage();
@@ -199,6 +303,12 @@ private:
      */
     void checkThresholds(const HealthData& health);
     
+    /**
+     * @brief Add a sample to the history store
+     * @param health Health data to record
+     */
+    void recordHistory(const HealthData& health);
+
     /**
      * @brief Log health data
      * @param health Health data to log
@@ -228,6 +338,9 @@ private:
     std::atomic<bool> running_;
     bool platform_initialized_;
     std::unique_ptr<std::thread> monitoring_thread_;
+
+    // Sensor files discovered by initializePlatform, read by the monitoring thread
+    PlatformSensors sensors_;
     
     // Thread-safe data storage
     mutable std::mutex health_mutex_;
@@ -236,8 +349,19 @@ private:
     mutable std::mutex alerts_mutex_;
     std::vector<HealthAlert> alerts_;
     
-    mutable std::mutex thresholds_mutex_;
+    mutable std::mutex thresholds_mutex_;   // Guards thresholds_ and sampling_policy_
     HealthThresholds thresholds_;
+    SamplingPolicy sampling_policy_;
+    std::array<SensorSchedule, SENSOR_CLASS_COUNT> schedules_;
+
+    mutable std::mutex history_mutex_;
+    HealthHistory history_;
+
+    // Reused by publishHealthData on every cycle
+    common::JsonWriter publish_writer_;
+
+    // Persistent connection used by publishHealthData
+    std::unique_ptr<common::RedisClient> redis_;
     
     // Disable copy constructor and assignment operator
     PlatformHealthMonitor(const PlatformHealthMonitor&) = delete;
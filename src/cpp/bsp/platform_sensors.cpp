@@ -0,0 +1,264 @@
+/**
+ * @file platform_sensors.cpp
+ * @brief SONiC BSP Platform Sensor Readers Implementation
+ */
+
+#include "platform_sensors.h"
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <string_view>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace sonic {
+namespace bsp {
+
+namespace {
+
+// hwmon drivers whose temperature inputs are CPU sensors
+const char* const CPU_HWMON_NAMES[] = {"coretemp", "k10temp", "zenpower", "cpu_thermal"};
+
+// Substrings of thermal zone types that are CPU sensors
+const char* const CPU_ZONE_TYPES[] = {"x86_pkg_temp", "cpu", "soc"};
+
+struct Entry {
+    long index;
+    std::string name;
+};
+
+/**
+ * @brief Entries named <prefix><index><suffix>, ordered by index
+ */
+std::vector<Entry> listIndexed(const std::string& dir_path, const std::string& prefix, const std::string& suffix) {
+    std::vector<Entry> entries;
+    DIR* dir = opendir(dir_path.c_str());
+    if (!dir) {
+        return entries;
+    }
+    while (struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.size() <= prefix.size() + suffix.size() || name.compare(0, prefix.size(), prefix) != 0 ||
+            name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+            continue;
+        }
+        const char* first = name.data() + prefix.size();
+        const char* last = name.data() + name.size() - suffix.size();
+        long index = 0;
+        auto result = std::from_chars(first, last, index);
+        if (result.ec == std::errc() && result.ptr == last) {
+            entries.push_back({index, name});
+        }
+    }
+    closedir(dir);
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.index < b.index; });
+    return entries;
+}
+
+std::string readLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+/**
+ * @brief Value of a "Key:   123 kB" line in /proc/meminfo text
+ */
+bool findMeminfoField(std::string_view text, std::string_view key, int64_t& value) {
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        std::string_view line = text.substr(pos, end - pos);
+        if (line.size() > key.size() && line.compare(0, key.size(), key) == 0 && line[key.size()] == ':') {
+            size_t digits = line.find_first_not_of(' ', key.size() + 1);
+            if (digits == std::string_view::npos) {
+                return false;
+            }
+            return std::from_chars(line.data() + digits, line.data() + line.size(), value).ec == std::errc();
+        }
+        pos = end + 1;
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+PlatformSensors::PlatformSensors(const std::string& sysfs_class_root, const std::string& proc_root)
+    : sysfs_class_root_(sysfs_class_root), proc_root_(proc_root), meminfo_fd_(-1) {}
+
+PlatformSensors::~PlatformSensors() {
+    close();
+}
+
+void PlatformSensors::close() {
+    for (auto* sensors : {&cpu_temps_, &fans_, &power_}) {
+        for (const auto& sensor : *sensors) {
+            ::close(sensor.fd);
+        }
+        sensors->clear();
+    }
+    if (meminfo_fd_ >= 0) {
+        ::close(meminfo_fd_);
+        meminfo_fd_ = -1;
+    }
+}
+
+bool PlatformSensors::openSensor(const std::string& path, const std::string& name, std::vector<Sensor>& into) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    int64_t value = 0;
+    if (!readInteger(fd, value)) {
+        ::close(fd);    // Present but unreadable, e.g. a fan slot with nothing fitted
+        return false;
+    }
+    into.push_back({fd, name});
+    return true;
+}
+
+bool PlatformSensors::discover() {
+    close();
+    discoverHwmon();
+    discoverThermalZones();
+    meminfo_fd_ = ::open((proc_root_ + "/meminfo").c_str(), O_RDONLY | O_CLOEXEC);
+    return hasCPUTemperature() || hasFans() || hasPower() || hasMemory();
+}
+
+void PlatformSensors::discoverHwmon() {
+    std::string hwmon_root = sysfs_class_root_ + "/hwmon";
+    for (const auto& device : listIndexed(hwmon_root, "hwmon", "")) {
+        std::string dir = hwmon_root + "/" + device.name;
+        std::string driver = readLine(dir + "/name");
+        bool cpu_driver = std::find(std::begin(CPU_HWMON_NAMES), std::end(CPU_HWMON_NAMES), driver) !=
+                          std::end(CPU_HWMON_NAMES);
+
+        if (cpu_driver) {
+            for (const auto& input : listIndexed(dir, "temp", "_input")) {
+                openSensor(dir + "/" + input.name, driver + "/" + input.name, cpu_temps_);
+            }
+        }
+        for (const auto& input : listIndexed(dir, "fan", "_input")) {
+            openSensor(dir + "/" + input.name, "fan_" + std::to_string(fans_.size() + 1), fans_);
+        }
+        for (const auto& input : listIndexed(dir, "power", "_input")) {
+            openSensor(dir + "/" + input.name, driver + "/" + input.name, power_);
+        }
+    }
+}
+
+void PlatformSensors::discoverThermalZones() {
+    std::string thermal_root = sysfs_class_root_ + "/thermal";
+    std::vector<Entry> zones = listIndexed(thermal_root, "thermal_zone", "");
+    for (const auto& zone : zones) {
+        std::string dir = thermal_root + "/" + zone.name;
+        std::string type = readLine(dir + "/type");
+        for (const char* cpu_type : CPU_ZONE_TYPES) {
+            if (type.find(cpu_type) != std::string::npos) {
+                openSensor(dir + "/temp", type, cpu_temps_);
+                break;
+            }
+        }
+    }
+
+    // Boards that label nothing as CPU usually put it in the first zone
+    if (cpu_temps_.empty() && !zones.empty()) {
+        std::string dir = thermal_root + "/" + zones.front().name;
+        openSensor(dir + "/temp", readLine(dir + "/type"), cpu_temps_);
+    }
+}
+
+bool PlatformSensors::readInteger(int fd, int64_t& value) {
+    char buffer[32];
+    ssize_t length = ::pread(fd, buffer, sizeof(buffer), 0);
+    if (length <= 0) {
+        return false;
+    }
+    const char* first = buffer;
+    const char* last = buffer + length;
+    while (first < last && *first == ' ') {
+        ++first;
+    }
+    return std::from_chars(first, last, value).ec == std::errc();
+}
+
+bool PlatformSensors::readCPUTemperature(float& celsius) const {
+    bool found = false;
+    int64_t hottest = 0;
+    for (const auto& sensor : cpu_temps_) {
+        int64_t millidegrees = 0;
+        if (readInteger(sensor.fd, millidegrees) && (!found || millidegrees > hottest)) {
+            hottest = millidegrees;
+            found = true;
+        }
+    }
+    if (found) {
+        celsius = static_cast<float>(hottest) / 1000.0f;
+    }
+    return found;
+}
+
+bool PlatformSensors::readFanSpeeds(std::map<std::string, uint32_t>& speeds) const {
+    bool found = false;
+    for (const auto& sensor : fans_) {
+        int64_t rpm = 0;
+        if (readInteger(sensor.fd, rpm) && rpm >= 0) {
+            speeds[sensor.name] = static_cast<uint32_t>(rpm);
+            found = true;
+        }
+    }
+    return found;
+}
+
+bool PlatformSensors::readPowerConsumption(float& watts) const {
+    bool found = false;
+    int64_t total = 0;
+    for (const auto& sensor : power_) {
+        int64_t microwatts = 0;
+        if (readInteger(sensor.fd, microwatts)) {
+            total += microwatts;
+            found = true;
+        }
+    }
+    if (found) {
+        watts = static_cast<float>(total) / 1000000.0f;
+    }
+    return found;
+}
+
+bool PlatformSensors::readMemoryUsage(float& percent) const {
+    if (meminfo_fd_ < 0) {
+        return false;
+    }
+    char buffer[4096];      // MemTotal, MemFree and MemAvailable are the first three lines
+    ssize_t length = ::pread(meminfo_fd_, buffer, sizeof(buffer), 0);
+    if (length <= 0) {
+        return false;
+    }
+    std::string_view text(buffer, static_cast<size_t>(length));
+
+    int64_t total = 0;
+    int64_t available = 0;
+    if (!findMeminfoField(text, "MemTotal", total) || total <= 0) {
+        return false;
+    }
+    if (!findMeminfoField(text, "MemAvailable", available) &&
+        !findMeminfoField(text, "MemFree", available)) {   // Kernels before 3.14
+        return false;
+    }
+    percent = 100.0f * static_cast<float>(total - available) / static_cast<float>(total);
+    return true;
+}
+
+std::string PlatformSensors::describe() const {
+    return std::to_string(cpu_temps_.size()) + " CPU temperature, " + std::to_string(fans_.size()) + " fan, " +
+           std::to_string(power_.size()) + " power sensor(s), meminfo " + (hasMemory() ? "available" : "missing");
+}
+
+} // namespace bsp
+} // namespace sonic
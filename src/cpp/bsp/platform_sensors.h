@@ -0,0 +1,107 @@
+/**
+ * @file platform_sensors.h
+ * @brief SONiC BSP Platform Sensor Readers Header
+ *
+ * Reads CPU temperature, fan speeds and power from hwmon and thermal zones
+ * in sysfs and memory usage from /proc/meminfo. The sensor map is discovered
+ * once; afterwards every attribute file stays open and each read is a pread
+ * into a stack buffer parsed with from_chars, so sampling neither opens files
+ * nor allocates.
+ */
+
+#ifndef SONIC_BSP_PLATFORM_SENSORS_H
+#define SONIC_BSP_PLATFORM_SENSORS_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+namespace sonic {
+namespace bsp {
+
+/**
+ * @brief Open sysfs and procfs sensor files of one platform (not thread-safe)
+ */
+class PlatformSensors {
+public:
+    /**
+     * @param sysfs_class_root Directory holding hwmon/ and thermal/
+     * @param proc_root Directory holding meminfo
+     */
+    explicit PlatformSensors(const std::string& sysfs_class_root = "/sys/class",
+                             const std::string& proc_root = "/proc");
+    ~PlatformSensors();
+
+    PlatformSensors(const PlatformSensors&) = delete;
+    PlatformSensors& operator=(const PlatformSensors&) = delete;
+
+    /**
+     * @brief Find and open the sensors of this platform, closing any opened before
+     * @return true if at least one sensor was found
+     */
+    bool discover();
+
+    bool hasCPUTemperature() const { return !cpu_temps_.empty(); }
+    bool hasFans() const { return !fans_.empty(); }
+    bool hasPower() const { return !power_.empty(); }
+    bool hasMemory() const { return meminfo_fd_ >= 0; }
+
+    /**
+     * @brief Hottest CPU sensor
+     * @param celsius Set on success
+     * @return false if no CPU sensor could be read
+     */
+    bool readCPUTemperature(float& celsius) const;
+
+    /**
+     * @brief Speed of every fan, keyed fan_1, fan_2, ... in discovery order
+     * @param speeds Updated in place, so a map already holding the keys is not reallocated
+     * @return false if no fan could be read
+     */
+    bool readFanSpeeds(std::map<std::string, uint32_t>& speeds) const;
+
+    /**
+     * @brief Sum of all power sensors
+     * @param watts Set on success
+     * @return false if no power sensor could be read
+     */
+    bool readPowerConsumption(float& watts) const;
+
+    /**
+     * @brief Share of memory not available to new allocations
+     * @param percent Set on success
+     * @return false if /proc/meminfo could not be read
+     */
+    bool readMemoryUsage(float& percent) const;
+
+    /**
+     * @brief One-line summary of what discover() found
+     */
+    std::string describe() const;
+
+private:
+    struct Sensor {
+        int fd;
+        std::string name;
+    };
+
+    bool openSensor(const std::string& path, const std::string& name, std::vector<Sensor>& into);
+    void discoverHwmon();
+    void discoverThermalZones();
+    void close();
+
+    static bool readInteger(int fd, int64_t& value);
+
+    std::string sysfs_class_root_;
+    std::string proc_root_;
+    std::vector<Sensor> cpu_temps_;     // Millidegrees Celsius
+    std::vector<Sensor> fans_;          // RPM
+    std::vector<Sensor> power_;         // Microwatts
+    int meminfo_fd_;
+};
+
+} // namespace bsp
+} // namespace sonic
+
+#endif // SONIC_BSP_PLATFORM_SENSORS_H
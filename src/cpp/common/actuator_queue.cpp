@@ -0,0 +1,178 @@
+/**
+ * @file actuator_queue.cpp
+ * @brief SONiC Common Coalescing Actuator Queue Implementation
+ */
+
+#include "actuator_queue.h"
+#include "metrics.h"
+#include <algorithm>
+#include <chrono>
+
+namespace sonic {
+namespace common {
+
+ActuatorQueue::ActuatorQueue(Sink sink, int frame_ms)
+    : sink_(std::move(sink)), frame_ms_(frame_ms > 0 ? frame_ms : 1), running_(false) {
+}
+
+ActuatorQueue::~ActuatorQueue() {
+    stop();
+    flush();
+}
+
+void ActuatorQueue::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    thread_ = std::thread(&ActuatorQueue::flushLoop, this);
+}
+
+void ActuatorQueue::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    flush();
+}
+
+bool ActuatorQueue::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+bool ActuatorQueue::set(const std::string& key, const std::string& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.updates;
+    Entry& entry = entries_[key];
+    if (entry.dirty) {
+        if (entry.value == value) {
+            ++stats_.skipped;
+            SONIC_COUNTER_INC("sonic_actuator_skipped_total", "Actuator updates equal to the value already written");
+            return false;
+        }
+        ++stats_.coalesced;
+        SONIC_COUNTER_INC("sonic_actuator_coalesced_total", "Actuator updates replaced before being written");
+        entry.value = value;
+        return true;
+    }
+    if (entry.has_written && entry.written == value) {
+        ++stats_.skipped;
+        SONIC_COUNTER_INC("sonic_actuator_skipped_total", "Actuator updates equal to the value already written");
+        return false;
+    }
+    entry.value = value;
+    entry.dirty = true;
+    dirty_.push_back(key);
+    return true;
+}
+
+bool ActuatorQueue::flush() {
+    std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+    Batch batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch.reserve(dirty_.size());
+        for (const auto& key : dirty_) {
+            Entry& entry = entries_[key];
+            entry.dirty = false;
+            // Set away and back within one frame: nothing to write
+            if (entry.has_written && entry.written == entry.value) {
+                ++stats_.skipped;
+                continue;
+            }
+            batch.emplace_back(key, entry.value);
+        }
+        dirty_.clear();
+    }
+    if (batch.empty()) {
+        return true;
+    }
+
+    bool ok = false;
+    std::vector<bool> rejected(batch.size(), false);
+    {
+        SONIC_SCOPED_TIMER("sonic_actuator_flush_seconds", "Time to write one frame of actuator updates");
+        ok = sink_(batch, rejected);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.batches;
+    if (!ok) {
+        ++stats_.failed_batches;
+        SONIC_COUNTER_INC("sonic_actuator_failed_batches_total", "Actuator frames the sink rejected");
+        // Retry next frame unless a newer value already made the entry dirty again
+        for (const auto& update : batch) {
+            Entry& entry = entries_[update.first];
+            if (!entry.dirty) {
+                entry.dirty = true;
+                dirty_.push_back(update.first);
+            }
+        }
+        return false;
+    }
+    bool all_written = true;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (rejected[i]) {
+            ++stats_.rejected;
+            SONIC_COUNTER_INC("sonic_actuator_rejected_total", "Actuator updates the sink could not write");
+            all_written = false;
+            continue;
+        }
+        ++stats_.writes;
+        Entry& entry = entries_[batch[i].first];
+        entry.written = batch[i].second;
+        entry.has_written = true;
+    }
+    return all_written;
+}
+
+bool ActuatorQueue::written(const std::string& key, std::string& value) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end() || !it->second.has_written) {
+        return false;
+    }
+    value = it->second.written;
+    return true;
+}
+
+size_t ActuatorQueue::pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dirty_.size();
+}
+
+ActuatorQueue::Stats ActuatorQueue::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void ActuatorQueue::flushLoop() {
+    auto next = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        next += std::chrono::milliseconds(frame_ms_);
+        if (cv_.wait_until(lock, next, [this]() { return !running_; })) {
+            break;
+        }
+        if (dirty_.empty()) {
+            continue;
+        }
+        lock.unlock();
+        flush();
+        lock.lock();
+        // A slow sink must not make the flusher try to catch up on missed frames
+        next = std::max(next, std::chrono::steady_clock::now() - std::chrono::milliseconds(frame_ms_));
+    }
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,122 @@
+/**
+ * @file actuator_queue.h
+ * @brief SONiC Common Coalescing Actuator Queue Header
+ *
+ * LED and fan settings are state, not commands: only the latest value of
+ * each actuator matters. Callers set values at whatever rate events arrive;
+ * the queue keeps the last value per key and a flusher writes the dirty keys
+ * once per frame as one batch. Values equal to the one last written are
+ * dropped, so an event storm costs at most one write per actuator per frame.
+ * An entry the sink rejects keeps its old written value, so setting the same
+ * value again writes it again.
+ */
+
+#ifndef SONIC_COMMON_ACTUATOR_QUEUE_H
+#define SONIC_COMMON_ACTUATOR_QUEUE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sonic {
+namespace common {
+
+/**
+ * @brief Last-writer-wins per-key update queue flushed at a fixed rate
+ */
+class ActuatorQueue {
+public:
+    typedef std::vector<std::pair<std::string, std::string>> Batch;
+
+    /**
+     * @brief Applies one frame of updates
+     * @param rejected Sized to the batch, all false; set rejected[i] when entry i
+     *        could not be written. Rejected entries are not retried.
+     * @return false to keep every entry of the batch dirty for the next frame
+     */
+    typedef std::function<bool(const Batch& batch, std::vector<bool>& rejected)> Sink;
+
+    struct Stats {
+        uint64_t updates = 0;           ///< set() calls
+        uint64_t coalesced = 0;         ///< Replaced a value not yet written
+        uint64_t skipped = 0;           ///< Matched the value already written or pending
+        uint64_t writes = 0;            ///< Entries the sink wrote
+        uint64_t rejected = 0;          ///< Entries the sink could not write
+        uint64_t batches = 0;
+        uint64_t failed_batches = 0;
+    };
+
+    /**
+     * @param frame_ms Flush period once started
+     */
+    ActuatorQueue(Sink sink, int frame_ms);
+    ~ActuatorQueue();
+
+    ActuatorQueue(const ActuatorQueue&) = delete;
+    ActuatorQueue& operator=(const ActuatorQueue&) = delete;
+
+    /**
+     * @brief Start the flusher; updates set before start are written on its first frame
+     */
+    void start();
+
+    /**
+     * @brief Stop the flusher after writing whatever is still dirty
+     */
+    void stop();
+    bool isRunning() const;
+
+    /**
+     * @brief Record the wanted value of an actuator
+     * @return false if the value was already written or pending, so nothing changes
+     */
+    bool set(const std::string& key, const std::string& value);
+
+    /**
+     * @brief Write the dirty entries now, from the calling thread
+     * @return false if the sink failed, leaving the entries dirty, or rejected any entry
+     */
+    bool flush();
+
+    /**
+     * @brief Value most recently written for key
+     */
+    bool written(const std::string& key, std::string& value) const;
+
+    size_t pending() const;
+    Stats stats() const;
+
+private:
+    struct Entry {
+        std::string value;          ///< Latest value set
+        std::string written;        ///< Value the sink last accepted
+        bool has_written = false;
+        bool dirty = false;
+    };
+
+    void flushLoop();
+
+    Sink sink_;
+    const int frame_ms_;
+
+    std::mutex flush_mutex_;        ///< One flush at a time, so batches reach the sink in order
+    mutable std::mutex mutex_;      ///< Guards everything below
+    std::condition_variable cv_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::vector<std::string> dirty_;    ///< Keys of dirty entries, in first-dirtied order
+    Stats stats_;
+    bool running_;
+
+    std::thread thread_;
+};
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_ACTUATOR_QUEUE_H
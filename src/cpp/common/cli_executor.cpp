@@ -0,0 +1,232 @@
+/**
+ * @file cli_executor.cpp
+ * @brief SONiC Common Asynchronous CLI Executor Implementation
+ */
+
+#include "cli_executor.h"
+#include "metrics.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/wait.h>
+
+namespace sonic {
+namespace common {
+
+namespace {
+
+constexpr size_t DEFAULT_CONCURRENCY = 8;
+constexpr int DEFAULT_CACHE_TTL_MS = 2000;
+
+// Set once shared() builds its executor, so Redis writes never start one just to clear it
+std::atomic<CliExecutor*> g_shared{nullptr};
+
+int envInt(const char* name, int default_value) {
+    const char* value = std::getenv(name);
+    if (value && *value) {
+        int parsed = std::atoi(value);
+        if (parsed >= 0) {
+            return parsed;
+        }
+    }
+    return default_value;
+}
+
+// First word of one pipeline stage, empty if the stage is blank
+std::string stageVerb(const std::string& command, size_t begin, size_t end) {
+    begin = command.find_first_not_of(' ', begin);
+    if (begin == std::string::npos || begin >= end) {
+        return "";
+    }
+    size_t verb_end = std::min(command.find(' ', begin), end);
+    return command.substr(begin, verb_end - begin);
+}
+
+} // anonymous namespace
+
+CliExecutor& CliExecutor::shared() {
+    static CliExecutor executor(static_cast<size_t>(envInt("SONIC_CLI_CONCURRENCY", DEFAULT_CONCURRENCY)),
+                                envInt("SONIC_CLI_CACHE_TTL_MS", DEFAULT_CACHE_TTL_MS));
+    g_shared.store(&executor, std::memory_order_release);
+    return executor;
+}
+
+void CliExecutor::invalidateShared() {
+    if (CliExecutor* executor = g_shared.load(std::memory_order_acquire)) {
+        executor->invalidate();
+    }
+}
+
+CliExecutor::CliExecutor(size_t max_concurrency, int cache_ttl_ms)
+    : cache_ttl_(cache_ttl_ms > 0 ? cache_ttl_ms : 0), generation_(0), stopping_(false) {
+    if (max_concurrency == 0) {
+        max_concurrency = 1;
+    }
+    workers_.reserve(max_concurrency);
+    for (size_t i = 0; i < max_concurrency; ++i) {
+        workers_.emplace_back(&CliExecutor::workerLoop, this);
+    }
+}
+
+CliExecutor::~CliExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+    // Whatever never ran still owes its waiters a result
+    for (auto& job : queue_) {
+        job.promise.set_value(CliResult());
+    }
+}
+
+CliExecutor::Future CliExecutor::submit(const std::string& command, bool cacheable) {
+    cacheable = cacheable && cache_ttl_.count() > 0;
+    Job job;
+    job.command = command;
+    job.cacheable = cacheable;
+    Future future = job.promise.get_future().share();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            job.promise.set_value(CliResult());
+            return future;
+        }
+        if (cacheable) {
+            auto now = std::chrono::steady_clock::now();
+            auto it = cache_.find(command);
+            if (it != cache_.end()) {
+                if (!it->second.done) {
+                    ++stats_.deduplicated;
+                    SONIC_COUNTER_INC("sonic_cli_deduplicated_total", "CLI commands that joined one in flight");
+                    return it->second.future;
+                }
+                if (now < it->second.expires) {
+                    ++stats_.cache_hits;
+                    SONIC_COUNTER_INC("sonic_cli_cache_hits_total", "CLI commands served from the result cache");
+                    return it->second.future;
+                }
+                cache_.erase(it);
+            }
+            if (cache_.size() >= CACHE_SWEEP_THRESHOLD) {
+                sweepExpiredUnsafe(now);
+            }
+            CacheEntry& entry = cache_[command];
+            entry.future = future;
+            entry.done = false;
+            entry.generation = generation_;
+        }
+        job.generation = generation_;
+        queue_.push_back(std::move(job));
+    }
+    cv_.notify_one();
+    return future;
+}
+
+void CliExecutor::invalidate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++generation_;
+    cache_.clear();
+}
+
+bool CliExecutor::isReadOnlyCommand(const std::string& command) {
+    // Redirections, command lists and substitutions could write whatever the verb is
+    if (command.find_first_of(">;&`\n") != std::string::npos || command.find("$(") != std::string::npos ||
+        command.find("<(") != std::string::npos) {
+        return false;
+    }
+
+    // Every stage after a pipe must be a filter that cannot write, run anything or
+    // wait forever; awk, sort and tail are left out (system(), sort -o, tail -f)
+    size_t begin = 0;
+    for (bool first = true; ; first = false) {
+        size_t end = command.find('|', begin);
+        std::string verb = stageVerb(command, begin, end == std::string::npos ? command.size() : end);
+        bool allowed = first ? (verb == "show" || verb == "cat")
+                             : (verb == "grep" || verb == "head" || verb == "wc" || verb == "cut");
+        // A blank stage also catches ||
+        if (!allowed) {
+            return false;
+        }
+        if (end == std::string::npos) {
+            return true;
+        }
+        begin = end + 1;
+    }
+}
+
+CliExecutor::Stats CliExecutor::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+CliResult CliExecutor::execute(const std::string& command) {
+    SONIC_SCOPED_TIMER("sonic_cli_command_seconds", "Time to run a CLI command line");
+    CliResult result;
+    FILE* pipe = popen(command.c_str(), "r");
+    if (!pipe) {
+        return result;
+    }
+
+    char buffer[256];
+    while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+        result.output += buffer;
+    }
+
+    int status = pclose(pipe);
+    if (status != -1 && WIFEXITED(status)) {
+        result.exit_status = WEXITSTATUS(status);
+    }
+    result.ok = (status == 0);
+    return result;
+}
+
+void CliExecutor::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+        if (stopping_) {
+            return;
+        }
+        Job job = std::move(queue_.front());
+        queue_.pop_front();
+        ++stats_.executed;
+        lock.unlock();
+
+        CliResult result = execute(job.command);
+
+        lock.lock();
+        if (job.cacheable) {
+            auto it = cache_.find(job.command);
+            if (it != cache_.end() && it->second.generation == job.generation && !it->second.done) {
+                if (result.ok) {
+                    it->second.done = true;
+                    it->second.expires = std::chrono::steady_clock::now() + cache_ttl_;
+                } else {
+                    // Failures are not worth remembering; the next caller retries
+                    cache_.erase(it);
+                }
+            }
+        }
+        lock.unlock();
+        job.promise.set_value(std::move(result));
+        lock.lock();
+    }
+}
+
+void CliExecutor::sweepExpiredUnsafe(std::chrono::steady_clock::time_point now) {
+    for (auto it = cache_.begin(); it != cache_.end();) {
+        if (it->second.done && it->second.expires <= now) {
+            it = cache_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,141 @@
+/**
+ * @file cli_executor.h
+ * @brief SONiC Common Asynchronous CLI Executor Header
+ *
+ * Every SONiC CLI query is a docker exec that costs hundreds of
+ * milliseconds, almost all of it spent waiting on the container. The
+ * executor runs command lines on a fixed pool of worker threads and hands
+ * back futures, so a query over many ports costs about as much as its
+ * slowest command instead of the sum. Identical read-only commands share
+ * one process while in flight and reuse its output for a short TTL; any
+ * write through RedisClient or the CLI drops the cached output.
+ */
+
+#ifndef SONIC_COMMON_CLI_EXECUTOR_H
+#define SONIC_COMMON_CLI_EXECUTOR_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace sonic {
+namespace common {
+
+/**
+ * @brief Outcome of one command line
+ */
+struct CliResult {
+    bool ok = false;            ///< Ran and exited with status 0
+    int exit_status = -1;       ///< -1 if the command could not be started or was killed
+    std::string output;         ///< stdout
+};
+
+/**
+ * @brief Bounded pool of workers running shell command lines
+ */
+class CliExecutor {
+public:
+    typedef std::shared_future<CliResult> Future;
+
+    struct Stats {
+        uint64_t executed = 0;
+        uint64_t deduplicated = 0;      ///< Joined a command already in flight
+        uint64_t cache_hits = 0;        ///< Served from a finished result within the TTL
+    };
+
+    /**
+     * @brief Process-wide executor shared by the controllers, so the limit holds across all of them
+     *
+     * Sized by SONIC_CLI_CONCURRENCY (default 8) and SONIC_CLI_CACHE_TTL_MS (default 2000).
+     */
+    static CliExecutor& shared();
+
+    /**
+     * @param max_concurrency Commands running at once; at least 1
+     * @param cache_ttl_ms How long a successful read-only result is reused; 0 disables caching
+     */
+    CliExecutor(size_t max_concurrency, int cache_ttl_ms);
+    ~CliExecutor();
+
+    CliExecutor(const CliExecutor&) = delete;
+    CliExecutor& operator=(const CliExecutor&) = delete;
+
+    /**
+     * @brief Queue a command line
+     * @param cacheable The command only reads state: dedup it in flight and cache its result
+     */
+    Future submit(const std::string& command, bool cacheable);
+
+    /**
+     * @brief Queue a command line and wait for it
+     */
+    CliResult run(const std::string& command, bool cacheable) { return submit(command, cacheable).get(); }
+
+    /**
+     * @brief Forget cached results, e.g. after a command changed what they describe
+     *
+     * Callers already waiting on an in-flight command still get its result.
+     */
+    void invalidate();
+
+    /**
+     * @brief invalidate() the shared() executor, if one was ever created; called by RedisClient writes
+     */
+    static void invalidateShared();
+
+    /**
+     * @brief Whether a SONiC command only reads state: show or cat, optionally piped into
+     *        grep, head, wc or cut, with no redirection, command list or substitution
+     *
+     * echo is left out: it is the container liveness probe, and a cached probe proves nothing.
+     */
+    static bool isReadOnlyCommand(const std::string& command);
+
+    size_t maxConcurrency() const { return workers_.size(); }
+    Stats stats() const;
+
+private:
+    static constexpr size_t CACHE_SWEEP_THRESHOLD = 1024;
+
+    struct Job {
+        std::string command;
+        std::promise<CliResult> promise;
+        bool cacheable;
+        uint64_t generation;
+    };
+
+    struct CacheEntry {
+        Future future;
+        bool done;
+        std::chrono::steady_clock::time_point expires;
+        uint64_t generation;
+    };
+
+    static CliResult execute(const std::string& command);
+    void workerLoop();
+    void sweepExpiredUnsafe(std::chrono::steady_clock::time_point now);
+
+    const std::chrono::milliseconds cache_ttl_;
+
+    mutable std::mutex mutex_;      ///< Guards everything below
+    std::condition_variable cv_;
+    std::deque<Job> queue_;
+    std::unordered_map<std::string, CacheEntry> cache_;     ///< Cacheable commands by command line
+    uint64_t generation_;                                   ///< Bumped by invalidate()
+    Stats stats_;
+    bool stopping_;
+
+    std::vector<std::thread> workers_;
+};
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_CLI_EXECUTOR_H
@@ -0,0 +1,116 @@
+/**
+ * @file event_loop.cpp
+ * @brief SONiC Common epoll Event Loop Implementation
+ */
+
+#include "event_loop.h"
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace sonic {
+namespace common {
+
+EventLoop::EventLoop() : epoll_fd_(-1), wake_fd_(-1) {
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0) {
+        std::cerr << "Failed to create epoll instance: " << std::strerror(errno) << std::endl;
+        return;
+    }
+
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_fd_ < 0) {
+        std::cerr << "Failed to create event loop wakeup fd: " << std::strerror(errno) << std::endl;
+        return;
+    }
+    struct epoll_event event;
+    std::memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = wake_fd_;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &event) != 0) {
+        std::cerr << "Failed to watch event loop wakeup fd: " << std::strerror(errno) << std::endl;
+    }
+}
+
+EventLoop::~EventLoop() {
+    if (wake_fd_ >= 0) {
+        ::close(wake_fd_);
+    }
+    if (epoll_fd_ >= 0) {
+        ::close(epoll_fd_);
+    }
+}
+
+bool EventLoop::add(int fd, Handler handler) {
+    if (epoll_fd_ < 0 || fd < 0) {
+        return false;
+    }
+
+    struct epoll_event event;
+    std::memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    int op = handlers_.count(fd) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    if (epoll_ctl(epoll_fd_, op, fd, &event) != 0) {
+        std::cerr << "Failed to watch fd " << fd << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    handlers_[fd] = std::move(handler);
+    return true;
+}
+
+bool EventLoop::remove(int fd) {
+    auto it = handlers_.find(fd);
+    if (it == handlers_.end()) {
+        return false;
+    }
+    handlers_.erase(it);
+    // Fails harmlessly when fd was already closed, which drops it from the epoll set
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    return true;
+}
+
+int EventLoop::runOnce(int timeout_ms) {
+    if (epoll_fd_ < 0) {
+        return -1;
+    }
+
+    struct epoll_event events[MAX_EVENTS];
+    int count = epoll_wait(epoll_fd_, events, MAX_EVENTS, timeout_ms);
+    if (count < 0) {
+        return errno == EINTR ? 0 : -1;
+    }
+
+    int dispatched = 0;
+    for (int i = 0; i < count; ++i) {
+        int fd = events[i].data.fd;
+        if (fd == wake_fd_) {
+            uint64_t value;
+            while (read(wake_fd_, &value, sizeof(value)) > 0) {
+            }
+            continue;
+        }
+        // A handler may remove other fds, so look each one up again
+        auto it = handlers_.find(fd);
+        if (it != handlers_.end()) {
+            Handler handler = it->second;
+            handler(events[i].events);
+            dispatched++;
+        }
+    }
+    return dispatched;
+}
+
+void EventLoop::wakeup() {
+    if (wake_fd_ >= 0) {
+        uint64_t value = 1;
+        ssize_t ignored = write(wake_fd_, &value, sizeof(value));
+        (void)ignored;
+    }
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,66 @@
+/**
+ * @file event_loop.h
+ * @brief SONiC Common epoll Event Loop Header
+ *
+ * Minimal level-triggered reactor: file descriptors are registered with a
+ * handler, runOnce() blocks in epoll_wait until one is readable, the timeout
+ * expires or another thread calls wakeup(). An idle loop costs no CPU.
+ */
+
+#ifndef SONIC_COMMON_EVENT_LOOP_H
+#define SONIC_COMMON_EVENT_LOOP_H
+
+#include <functional>
+#include <map>
+#include <cstdint>
+
+namespace sonic {
+namespace common {
+
+/**
+ * @brief epoll reactor; add/remove/runOnce belong to one thread, wakeup() is thread-safe
+ */
+class EventLoop {
+public:
+    /// Called with the epoll event mask (EPOLLIN, EPOLLHUP, ...)
+    typedef std::function<void(uint32_t events)> Handler;
+
+    EventLoop();
+    ~EventLoop();
+
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    bool isValid() const { return epoll_fd_ >= 0 && wake_fd_ >= 0; }
+
+    /**
+     * @brief Watch fd for readability; replaces the handler if fd is already registered
+     */
+    bool add(int fd, Handler handler);
+    bool remove(int fd);
+    size_t size() const { return handlers_.size(); }
+
+    /**
+     * @brief Wait for events and dispatch them
+     * @param timeout_ms -1 waits forever, 0 only polls
+     * @return Handlers run, 0 on timeout or wakeup, -1 on error
+     */
+    int runOnce(int timeout_ms);
+
+    /**
+     * @brief Make a blocked runOnce() return
+     */
+    void wakeup();
+
+private:
+    static constexpr int MAX_EVENTS = 32;
+
+    int epoll_fd_;
+    int wake_fd_;
+    std::map<int, Handler> handlers_;
+};
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_EVENT_LOOP_H
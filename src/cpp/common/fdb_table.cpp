@@ -0,0 +1,356 @@
+/**
+ * @file fdb_table.cpp
+ * @brief SONiC Common Forwarding Database Table Implementation
+ */
+
+#include "fdb_table.h"
+#include <cstdio>
+
+namespace sonic {
+namespace common {
+
+namespace {
+
+constexpr int MIN_INDEX_BITS = 4;
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+} // anonymous namespace
+
+FdbTable::FdbTable()
+    : vlan_heads_(MAX_VLAN_ID + 1, NONE), vlan_counts_(MAX_VLAN_ID + 1, 0), size_(0), index_bits_(0) {
+    rehash(size_t(1) << MIN_INDEX_BITS);
+}
+
+bool FdbTable::parseMac(const std::string& text, uint64_t& mac) {
+    if (text.size() != 17) {
+        return false;
+    }
+    char separator = text[2];
+    if (separator != ':' && separator != '-') {
+        return false;
+    }
+    uint64_t value = 0;
+    for (size_t octet = 0; octet < 6; ++octet) {
+        size_t pos = octet * 3;
+        int high = hexValue(text[pos]);
+        int low = hexValue(text[pos + 1]);
+        if (high < 0 || low < 0 || (octet < 5 && text[pos + 2] != separator)) {
+            return false;
+        }
+        value = (value << 8) | static_cast<uint64_t>((high << 4) | low);
+    }
+    mac = value;
+    return true;
+}
+
+std::string FdbTable::formatMac(uint64_t mac, char separator) {
+    char buffer[18];
+    std::snprintf(buffer, sizeof(buffer), "%02x%c%02x%c%02x%c%02x%c%02x%c%02x",
+                  static_cast<unsigned>((mac >> 40) & 0xFF), separator,
+                  static_cast<unsigned>((mac >> 32) & 0xFF), separator,
+                  static_cast<unsigned>((mac >> 24) & 0xFF), separator,
+                  static_cast<unsigned>((mac >> 16) & 0xFF), separator,
+                  static_cast<unsigned>((mac >> 8) & 0xFF), separator,
+                  static_cast<unsigned>(mac & 0xFF));
+    return buffer;
+}
+
+size_t FdbTable::bucketFor(uint64_t key) const {
+    // Fibonacci hashing; MACs from one vendor share their top 24 bits
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> (64 - index_bits_));
+}
+
+size_t FdbTable::findBucket(uint64_t key) const {
+    size_t mask = index_.size() - 1;
+    for (size_t bucket = bucketFor(key);; bucket = (bucket + 1) & mask) {
+        if (index_[bucket] == NONE) {
+            return index_.size();
+        }
+        if (keys_[bucket] == key) {
+            return bucket;
+        }
+    }
+}
+
+void FdbTable::rehash(size_t buckets) {
+    index_.assign(buckets, NONE);
+    keys_.assign(buckets, 0);
+    index_bits_ = 0;
+    while ((size_t(1) << index_bits_) < buckets) {
+        index_bits_++;
+    }
+
+    size_t mask = buckets - 1;
+    for (uint32_t i = 0; i < records_.size(); ++i) {
+        if (!records_[i].live) {
+            continue;
+        }
+        uint64_t key = makeKey(records_[i].record.mac, records_[i].record.vlan_id);
+        size_t bucket = bucketFor(key);
+        while (index_[bucket] != NONE) {
+            bucket = (bucket + 1) & mask;
+        }
+        index_[bucket] = i;
+        keys_[bucket] = key;
+    }
+}
+
+void FdbTable::reserve(size_t count) {
+    size_t buckets = size_t(1) << MIN_INDEX_BITS;
+    while (buckets < count * 2) {
+        buckets <<= 1;
+    }
+    if (buckets > index_.size()) {
+        rehash(buckets);
+    }
+    records_.reserve(count);
+}
+
+void FdbTable::clear() {
+    records_.clear();
+    free_records_.clear();
+    vlan_heads_.assign(MAX_VLAN_ID + 1, NONE);
+    vlan_counts_.assign(MAX_VLAN_ID + 1, 0);
+    port_heads_.clear();
+    size_ = 0;
+    rehash(size_t(1) << MIN_INDEX_BITS);
+}
+
+const FdbRecord* FdbTable::find(uint64_t mac, uint16_t vlan_id) const {
+    size_t bucket = findBucket(makeKey(mac, vlan_id));
+    return bucket != index_.size() ? &records_[index_[bucket]].record : nullptr;
+}
+
+bool FdbTable::learn(uint64_t mac, uint16_t vlan_id, PortId port, FdbEntryType type, uint32_t now,
+                     uint8_t flags) {
+    if (vlan_id > MAX_VLAN_ID) {
+        return false;
+    }
+    uint64_t key = makeKey(mac, vlan_id);
+    size_t bucket = findBucket(key);
+    if (bucket != index_.size()) {
+        uint32_t i = index_[bucket];
+        FdbRecord& record = records_[i].record;
+        if (record.type == FdbEntryType::STATIC && type == FdbEntryType::DYNAMIC) {
+            return false;
+        }
+        record.last_seen = now;
+        bool changed = record.port != port || record.type != type || record.flags != flags;
+        if (record.port != port) {
+            unlinkPort(i);
+            record.port = port;
+            linkPort(i);
+        }
+        record.type = type;
+        record.flags = flags;
+        return changed;
+    }
+
+    if ((size_ + 1) * 2 > index_.size()) {
+        rehash(index_.size() * 2);
+    }
+
+    uint32_t i;
+    if (!free_records_.empty()) {
+        i = free_records_.back();
+        free_records_.pop_back();
+    } else {
+        records_.emplace_back();
+        i = static_cast<uint32_t>(records_.size() - 1);
+    }
+    Slot& slot = records_[i];
+    slot = Slot();
+    slot.live = true;
+    slot.record.mac = mac & 0xFFFFFFFFFFFFULL;
+    slot.record.vlan_id = vlan_id;
+    slot.record.type = type;
+    slot.record.flags = flags;
+    slot.record.port = port;
+    slot.record.last_seen = now;
+    linkVLAN(i);
+    linkPort(i);
+
+    size_t mask = index_.size() - 1;
+    bucket = bucketFor(key);
+    while (index_[bucket] != NONE) {
+        bucket = (bucket + 1) & mask;
+    }
+    index_[bucket] = i;
+    keys_[bucket] = key;
+    size_++;
+    return true;
+}
+
+bool FdbTable::remove(uint64_t mac, uint16_t vlan_id) {
+    size_t bucket = findBucket(makeKey(mac, vlan_id));
+    if (bucket == index_.size()) {
+        return false;
+    }
+    eraseRecord(index_[bucket]);
+    return true;
+}
+
+size_t FdbTable::apply(const std::vector<FdbNotification>& batch, uint32_t now) {
+    size_t changed = 0;
+    for (const auto& event : batch) {
+        switch (event.op) {
+            case FdbOp::LEARN:
+                changed += learn(event.mac, event.vlan_id, event.port, event.type, now, event.flags) ? 1 : 0;
+                break;
+            case FdbOp::MOVE: {
+                size_t bucket = findBucket(makeKey(event.mac, event.vlan_id));
+                if (bucket == index_.size()) {
+                    break;
+                }
+                uint32_t i = index_[bucket];
+                if (records_[i].record.port != event.port) {
+                    unlinkPort(i);
+                    records_[i].record.port = event.port;
+                    linkPort(i);
+                    changed++;
+                }
+                records_[i].record.last_seen = now;
+                break;
+            }
+            case FdbOp::AGE: {
+                const FdbRecord* record = find(event.mac, event.vlan_id);
+                if (record && record->type == FdbEntryType::DYNAMIC) {
+                    changed += remove(event.mac, event.vlan_id) ? 1 : 0;
+                }
+                break;
+            }
+            case FdbOp::REMOVE:
+                changed += remove(event.mac, event.vlan_id) ? 1 : 0;
+                break;
+        }
+    }
+    return changed;
+}
+
+size_t FdbTable::flushVLAN(uint16_t vlan_id, bool include_static) {
+    if (vlan_id > MAX_VLAN_ID) {
+        return 0;
+    }
+    return flushList(vlan_heads_[vlan_id], [this](uint32_t i) { return records_[i].vlan_next; }, include_static);
+}
+
+size_t FdbTable::flushPort(PortId port, bool include_static) {
+    if (port >= port_heads_.size()) {
+        return 0;
+    }
+    return flushList(port_heads_[port], [this](uint32_t i) { return records_[i].port_next; }, include_static);
+}
+
+size_t FdbTable::flushAll(bool include_static) {
+    if (include_static) {
+        size_t removed = size_;
+        clear();
+        return removed;
+    }
+    size_t removed = 0;
+    for (uint32_t i = 0; i < records_.size(); ++i) {
+        if (records_[i].live && records_[i].record.type != FdbEntryType::STATIC) {
+            eraseRecord(i);
+            removed++;
+        }
+    }
+    return removed;
+}
+
+void FdbTable::eraseRecord(uint32_t record) {
+    Slot& slot = records_[record];
+    size_t mask = index_.size() - 1;
+    size_t hole = findBucket(makeKey(slot.record.mac, slot.record.vlan_id));
+
+    // Backward-shift deletion keeps probe chains intact without tombstones
+    for (size_t next = (hole + 1) & mask; index_[next] != NONE; next = (next + 1) & mask) {
+        size_t home = bucketFor(keys_[next]);
+        bool movable = (hole <= next) ? (home <= hole || home > next) : (home <= hole && home > next);
+        if (movable) {
+            index_[hole] = index_[next];
+            keys_[hole] = keys_[next];
+            hole = next;
+        }
+    }
+    index_[hole] = NONE;
+
+    unlinkVLAN(record);
+    unlinkPort(record);
+    slot.live = false;
+    free_records_.push_back(record);
+    size_--;
+}
+
+void FdbTable::linkVLAN(uint32_t record) {
+    Slot& slot = records_[record];
+    uint32_t& head = vlan_heads_[slot.record.vlan_id];
+    slot.vlan_prev = NONE;
+    slot.vlan_next = head;
+    if (head != NONE) {
+        records_[head].vlan_prev = record;
+    }
+    head = record;
+    vlan_counts_[slot.record.vlan_id]++;
+}
+
+void FdbTable::unlinkVLAN(uint32_t record) {
+    Slot& slot = records_[record];
+    if (slot.vlan_prev != NONE) {
+        records_[slot.vlan_prev].vlan_next = slot.vlan_next;
+    } else {
+        vlan_heads_[slot.record.vlan_id] = slot.vlan_next;
+    }
+    if (slot.vlan_next != NONE) {
+        records_[slot.vlan_next].vlan_prev = slot.vlan_prev;
+    }
+    slot.vlan_prev = slot.vlan_next = NONE;
+    vlan_counts_[slot.record.vlan_id]--;
+}
+
+void FdbTable::linkPort(uint32_t record) {
+    Slot& slot = records_[record];
+    PortId port = slot.record.port;
+    slot.port_prev = slot.port_next = NONE;
+    if (port == INVALID_PORT_ID) {
+        return;
+    }
+    if (port >= port_heads_.size()) {
+        port_heads_.resize(port + 1, NONE);
+    }
+    slot.port_next = port_heads_[port];
+    if (slot.port_next != NONE) {
+        records_[slot.port_next].port_prev = record;
+    }
+    port_heads_[port] = record;
+}
+
+void FdbTable::unlinkPort(uint32_t record) {
+    Slot& slot = records_[record];
+    if (slot.record.port == INVALID_PORT_ID) {
+        return;
+    }
+    if (slot.port_prev != NONE) {
+        records_[slot.port_prev].port_next = slot.port_next;
+    } else {
+        port_heads_[slot.record.port] = slot.port_next;
+    }
+    if (slot.port_next != NONE) {
+        records_[slot.port_next].port_prev = slot.port_prev;
+    }
+    slot.port_prev = slot.port_next = NONE;
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,204 @@
+/**
+ * @file fdb_table.h
+ * @brief SONiC Common Forwarding Database Table
+ *
+ * Packed MAC table keyed by (48-bit MAC, VLAN) folded into one 64-bit key.
+ * Records live in a flat vector; an open-addressing index with linear
+ * probing finds them in O(1), and intrusive per-VLAN and per-port lists let
+ * flushes touch only the entries they remove.
+ */
+
+#ifndef SONIC_COMMON_FDB_TABLE_H
+#define SONIC_COMMON_FDB_TABLE_H
+
+#include "string_interner.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace sonic {
+namespace common {
+
+enum class FdbEntryType : uint8_t {
+    DYNAMIC,
+    STATIC
+};
+
+/**
+ * @brief One MAC entry as stored in the table
+ */
+struct FdbRecord {
+    uint64_t mac = 0;           ///< Low 48 bits, first octet most significant
+    uint16_t vlan_id = 0;
+    FdbEntryType type = FdbEntryType::DYNAMIC;
+    uint8_t flags = 0;          ///< Caller-defined bits, kept across learns
+    PortId port = INVALID_PORT_ID;
+    uint32_t last_seen = 0;     ///< Caller clock, usually seconds
+};
+
+enum class FdbOp : uint8_t {
+    LEARN,      ///< Add or refresh; moves a dynamic entry that shows up on another port
+    MOVE,       ///< Change the port of an existing entry
+    AGE,        ///< Remove a dynamic entry
+    REMOVE      ///< Remove an entry of any type
+};
+
+/**
+ * @brief Learn/age/move event handed to FdbTable::apply()
+ */
+struct FdbNotification {
+    FdbOp op = FdbOp::LEARN;
+    uint64_t mac = 0;
+    uint16_t vlan_id = 0;
+    PortId port = INVALID_PORT_ID;
+    FdbEntryType type = FdbEntryType::DYNAMIC;
+    uint8_t flags = 0;
+};
+
+/**
+ * @brief MAC table with O(1) lookup and O(entries) per-VLAN/per-port flush (not thread-safe)
+ */
+class FdbTable {
+public:
+    static constexpr uint16_t MAX_VLAN_ID = 4095;
+
+    FdbTable();
+
+    /**
+     * @brief Parse "00:11:22:33:44:55" or "00-11-22-33-44-55"
+     */
+    static bool parseMac(const std::string& text, uint64_t& mac);
+
+    /**
+     * @brief Format as lower-case hex octets joined by separator
+     */
+    static std::string formatMac(uint64_t mac, char separator = ':');
+
+    /**
+     * @brief Add or refresh an entry; a dynamic learn never replaces a static entry
+     * @return true if the table changed (new entry, new port, type or flags)
+     */
+    bool learn(uint64_t mac, uint16_t vlan_id, PortId port, FdbEntryType type, uint32_t now = 0,
+               uint8_t flags = 0);
+
+    /**
+     * @brief Remove one entry
+     * @return false if it was not present
+     */
+    bool remove(uint64_t mac, uint16_t vlan_id);
+
+    const FdbRecord* find(uint64_t mac, uint16_t vlan_id) const;
+
+    /**
+     * @brief Apply a batch of notifications in order
+     * @return Number of notifications that changed the table
+     */
+    size_t apply(const std::vector<FdbNotification>& batch, uint32_t now = 0);
+
+    /**
+     * @brief Remove the entries of one VLAN, one port or the whole table
+     * @param include_static Static entries are kept unless this is set
+     * @return Number of entries removed
+     */
+    size_t flushVLAN(uint16_t vlan_id, bool include_static = false);
+    size_t flushPort(PortId port, bool include_static = false);
+    size_t flushAll(bool include_static = false);
+
+    /**
+     * @brief Visit entries as fn(const FdbRecord&); the table must not change during the walk
+     */
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (const auto& slot : records_) {
+            if (slot.live) {
+                fn(static_cast<const FdbRecord&>(slot.record));
+            }
+        }
+    }
+
+    template <typename Fn>
+    void forEachInVLAN(uint16_t vlan_id, Fn&& fn) const {
+        if (vlan_id > MAX_VLAN_ID) {
+            return;
+        }
+        for (uint32_t i = vlan_heads_[vlan_id]; i != NONE; i = records_[i].vlan_next) {
+            fn(static_cast<const FdbRecord&>(records_[i].record));
+        }
+    }
+
+    template <typename Fn>
+    void forEachOnPort(PortId port, Fn&& fn) const {
+        if (port >= port_heads_.size()) {
+            return;
+        }
+        for (uint32_t i = port_heads_[port]; i != NONE; i = records_[i].port_next) {
+            fn(static_cast<const FdbRecord&>(records_[i].record));
+        }
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t vlanSize(uint16_t vlan_id) const { return vlan_id <= MAX_VLAN_ID ? vlan_counts_[vlan_id] : 0; }
+
+    /**
+     * @brief Pre-size for count entries so a bulk load does not rehash
+     */
+    void reserve(size_t count);
+    void clear();
+
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    struct Slot {
+        FdbRecord record;
+        uint32_t vlan_prev = NONE;
+        uint32_t vlan_next = NONE;
+        uint32_t port_prev = NONE;
+        uint32_t port_next = NONE;
+        bool live = false;
+    };
+
+    static uint64_t makeKey(uint64_t mac, uint16_t vlan_id) {
+        return (mac & 0xFFFFFFFFFFFFULL) | (static_cast<uint64_t>(vlan_id) << 48);
+    }
+
+    size_t bucketFor(uint64_t key) const;
+    size_t findBucket(uint64_t key) const;  // index_.size() when absent
+    void rehash(size_t buckets);
+
+    void linkVLAN(uint32_t record);
+    void unlinkVLAN(uint32_t record);
+    void linkPort(uint32_t record);
+    void unlinkPort(uint32_t record);
+    void eraseRecord(uint32_t record);
+
+    template <typename Next>
+    size_t flushList(uint32_t head, Next next, bool include_static) {
+        size_t removed = 0;
+        for (uint32_t i = head; i != NONE;) {
+            uint32_t following = next(i);
+            if (include_static || records_[i].record.type != FdbEntryType::STATIC) {
+                eraseRecord(i);
+                removed++;
+            }
+            i = following;
+        }
+        return removed;
+    }
+
+    std::vector<uint32_t> index_;       // Record index per bucket, NONE when empty
+    std::vector<uint64_t> keys_;        // Key per bucket, probed without touching records_
+    std::vector<Slot> records_;
+    std::vector<uint32_t> free_records_;
+    std::vector<uint32_t> vlan_heads_;
+    std::vector<uint32_t> vlan_counts_;
+    std::vector<uint32_t> port_heads_;
+    size_t size_;
+    int index_bits_;
+};
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_FDB_TABLE_H
@@ -0,0 +1,59 @@
+/**
+ * @file ip_prefix.cpp
+ * @brief SONiC Common IP Prefix Implementation
+ */
+
+#include "ip_prefix.h"
+#include <arpa/inet.h>
+#include <cstdlib>
+
+namespace sonic {
+namespace common {
+
+bool IpPrefix::parse(const std::string& text, IpPrefix& prefix) {
+    size_t slash = text.find('/');
+    std::string address = text.substr(0, slash);
+    prefix = IpPrefix();
+    prefix.v6 = address.find(':') != std::string::npos;
+
+    unsigned char bytes[16] = {0};
+    if (inet_pton(prefix.v6 ? AF_INET6 : AF_INET, address.c_str(), bytes) != 1) {
+        return false;
+    }
+    size_t byte_count = prefix.v6 ? 16 : 4;
+    for (size_t i = 0; i < byte_count; ++i) {
+        prefix.address |= uint128(bytes[i]) << (120 - 8 * i);
+    }
+
+    prefix.length = prefix.maxLength();
+    if (slash != std::string::npos) {
+        std::string length = text.substr(slash + 1);
+        char* end = nullptr;
+        unsigned long value = std::strtoul(length.c_str(), &end, 10);
+        if (length.empty() || *end != '\0' || value > prefix.maxLength()) {
+            return false;
+        }
+        prefix.length = static_cast<uint8_t>(value);
+    }
+    prefix.address = mask(prefix.address, prefix.length);
+    return true;
+}
+
+std::string IpPrefix::addressString() const {
+    unsigned char bytes[16];
+    for (size_t i = 0; i < 16; ++i) {
+        bytes[i] = static_cast<unsigned char>(address >> (120 - 8 * i));
+    }
+    char buffer[INET6_ADDRSTRLEN];
+    if (!inet_ntop(v6 ? AF_INET6 : AF_INET, bytes, buffer, sizeof(buffer))) {
+        return "";
+    }
+    return buffer;
+}
+
+std::string IpPrefix::toString() const {
+    return addressString() + "/" + std::to_string(length);
+}
+
+} // namespace common
+} // namespace sonic
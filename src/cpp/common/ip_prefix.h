@@ -0,0 +1,66 @@
+/**
+ * @file ip_prefix.h
+ * @brief SONiC Common IP Prefix Header
+ *
+ * Binary IPv4/IPv6 prefix used as the key of RouteTable. Addresses are kept
+ * left-aligned in a 128-bit integer so bit 0 of the prefix is the top bit
+ * for both families.
+ */
+
+#ifndef SONIC_COMMON_IP_PREFIX_H
+#define SONIC_COMMON_IP_PREFIX_H
+
+#include <string>
+#include <cstdint>
+
+namespace sonic {
+namespace common {
+
+// GCC/Clang extension; __extension__ keeps -pedantic quiet
+__extension__ typedef unsigned __int128 uint128;
+
+/**
+ * @brief Parsed "address/length" prefix; host bits are always zero
+ */
+struct IpPrefix {
+    uint128 address = 0;
+    uint8_t length = 0;
+    bool v6 = false;
+
+    /**
+     * @brief Parse "10.0.0.0/24", "2001:db8::/32" or a bare address (host prefix)
+     * @return false on malformed input; host bits set in the input are cleared
+     */
+    static bool parse(const std::string& text, IpPrefix& prefix);
+
+    /**
+     * @brief Address part only ("10.0.0.0" or "2001:db8::")
+     */
+    std::string addressString() const;
+
+    std::string toString() const;
+
+    uint8_t maxLength() const { return v6 ? 128 : 32; }
+
+    /**
+     * @brief Bit i of the address, counted from the most significant bit
+     */
+    bool bit(uint8_t i) const { return (address >> (127 - i)) & 1; }
+
+    /**
+     * @brief address with everything past length bits cleared
+     */
+    static uint128 mask(uint128 address, uint8_t length) {
+        return length == 0 ? 0 : address & (~uint128(0) << (128 - length));
+    }
+
+    bool operator==(const IpPrefix& other) const {
+        return v6 == other.v6 && length == other.length && address == other.address;
+    }
+    bool operator!=(const IpPrefix& other) const { return !(*this == other); }
+};
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_IP_PREFIX_H
@@ -0,0 +1,589 @@
+/**
+ * @file json.cpp
+ * @brief SONiC Common JSON Reader/Writer Implementation
+ */
+
+#include "json.h"
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace sonic {
+namespace common {
+
+namespace {
+
+void appendUtf8(std::string& out, uint32_t code_point) {
+    if (code_point < 0x80) {
+        out += static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+        out += static_cast<char>(0xC0 | (code_point >> 6));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+        out += static_cast<char>(0xE0 | (code_point >> 12));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (code_point >> 18));
+        out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+bool parseHex4(std::string_view raw, size_t pos, uint32_t& value) {
+    if (pos + 4 > raw.size()) {
+        return false;
+    }
+    auto result = std::from_chars(raw.data() + pos, raw.data() + pos + 4, value, 16);
+    return result.ec == std::errc() && result.ptr == raw.data() + pos + 4;
+}
+
+bool isHighSurrogate(uint32_t code_point) { return code_point >= 0xD800 && code_point <= 0xDBFF; }
+bool isLowSurrogate(uint32_t code_point) { return code_point >= 0xDC00 && code_point <= 0xDFFF; }
+
+// Length of the \uXXXX escape at raw[pos], or 0 when malformed. Surrogates
+// must come as a high/low pair, which is decoded into one code point.
+size_t unicodeEscapeLength(std::string_view raw, size_t pos, uint32_t& code_point) {
+    if (!parseHex4(raw, pos + 2, code_point) || isLowSurrogate(code_point)) {
+        return 0;
+    }
+    if (!isHighSurrogate(code_point)) {
+        return 6;
+    }
+    uint32_t low = 0;
+    if (pos + 8 > raw.size() || raw[pos + 6] != '\\' || raw[pos + 7] != 'u' ||
+        !parseHex4(raw, pos + 8, low) || !isLowSurrogate(low)) {
+        return 0;
+    }
+    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+    return 12;
+}
+
+} // anonymous namespace
+
+// ---------------------------------------------------------------------------
+// JsonDocument
+// ---------------------------------------------------------------------------
+
+bool JsonDocument::parse(std::string_view input) {
+    nodes_.clear();
+    error_.clear();
+    input_ = input;
+    pos_ = 0;
+
+    uint32_t root_index = addNode();
+    skipWhitespace();
+    if (!parseValue(root_index, 0)) {
+        nodes_.clear();
+        return false;
+    }
+    skipWhitespace();
+    if (pos_ != input_.size()) {
+        nodes_.clear();
+        return fail("trailing characters after JSON value");
+    }
+    return true;
+}
+
+uint32_t JsonDocument::addNode() {
+    nodes_.emplace_back();
+    return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+bool JsonDocument::fail(const char* message) {
+    error_ = std::string(message) + " at offset " + std::to_string(pos_);
+    return false;
+}
+
+void JsonDocument::skipWhitespace() {
+    while (pos_ < input_.size()) {
+        char c = input_[pos_];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+            break;
+        }
+        ++pos_;
+    }
+}
+
+bool JsonDocument::parseValue(uint32_t index, int depth) {
+    if (depth > MAX_DEPTH) {
+        return fail("nesting too deep");
+    }
+    if (pos_ >= input_.size()) {
+        return fail("unexpected end of input");
+    }
+
+    char c = input_[pos_];
+    if (c == '{' || c == '[') {
+        bool is_object = (c == '{');
+        char close = is_object ? '}' : ']';
+        nodes_[index].type = is_object ? JsonType::OBJECT : JsonType::ARRAY;
+        ++pos_;
+        skipWhitespace();
+        if (pos_ < input_.size() && input_[pos_] == close) {
+            ++pos_;
+            return true;
+        }
+
+        uint32_t last_child = JsonNode::NONE;
+        while (true) {
+            std::string_view key;
+            bool key_escaped = false;
+            if (is_object) {
+                if (pos_ >= input_.size() || input_[pos_] != '"') {
+                    return fail("expected member name");
+                }
+                if (!parseString(key, key_escaped)) {
+                    return false;
+                }
+                skipWhitespace();
+                if (pos_ >= input_.size() || input_[pos_] != ':') {
+                    return fail("expected ':'");
+                }
+                ++pos_;
+                skipWhitespace();
+            }
+
+            // nodes_ may reallocate below, so refer to nodes by index only
+            uint32_t child = addNode();
+            nodes_[child].key = key;
+            nodes_[child].key_escaped = key_escaped;
+            if (last_child == JsonNode::NONE) {
+                nodes_[index].first_child = child;
+            } else {
+                nodes_[last_child].next_sibling = child;
+            }
+            last_child = child;
+            nodes_[index].size++;
+
+            if (!parseValue(child, depth + 1)) {
+                return false;
+            }
+            skipWhitespace();
+            if (pos_ >= input_.size()) {
+                return fail("unexpected end of input");
+            }
+            if (input_[pos_] == ',') {
+                ++pos_;
+                skipWhitespace();
+                continue;
+            }
+            if (input_[pos_] == close) {
+                ++pos_;
+                return true;
+            }
+            return fail(is_object ? "expected ',' or '}'" : "expected ',' or ']'");
+        }
+    }
+
+    if (c == '"') {
+        nodes_[index].type = JsonType::STRING;
+        std::string_view text;
+        bool escaped = false;
+        if (!parseString(text, escaped)) {
+            return false;
+        }
+        nodes_[index].text = text;
+        nodes_[index].escaped = escaped;
+        return true;
+    }
+    if (c == 't' || c == 'f') {
+        nodes_[index].type = JsonType::BOOL;
+        nodes_[index].boolean = (c == 't');
+        return parseLiteral(c == 't' ? "true" : "false");
+    }
+    if (c == 'n') {
+        nodes_[index].type = JsonType::NUL;
+        return parseLiteral("null");
+    }
+    if (c == '-' || (c >= '0' && c <= '9')) {
+        nodes_[index].type = JsonType::NUMBER;
+        return parseNumber(nodes_[index].text);
+    }
+    return fail("unexpected character");
+}
+
+bool JsonDocument::parseString(std::string_view& text, bool& escaped) {
+    size_t start = ++pos_;   // Skip the opening quote
+    escaped = false;
+    while (pos_ < input_.size()) {
+        char c = input_[pos_];
+        if (c == '"') {
+            text = input_.substr(start, pos_ - start);
+            ++pos_;
+            return true;
+        }
+        if (c == '\\') {
+            escaped = true;
+            if (pos_ + 1 >= input_.size()) {
+                break;
+            }
+            char kind = input_[pos_ + 1];
+            if (kind == 'u') {
+                uint32_t code_point = 0;
+                size_t length = unicodeEscapeLength(input_, pos_, code_point);
+                if (length == 0) {
+                    return fail("invalid \\u escape in string");
+                }
+                pos_ += length;
+            } else if (kind == '"' || kind == '\\' || kind == '/' || kind == 'b' || kind == 'f' ||
+                       kind == 'n' || kind == 'r' || kind == 't') {
+                pos_ += 2;
+            } else {
+                return fail("invalid escape in string");
+            }
+            continue;
+        }
+        if (static_cast<unsigned char>(c) < 0x20) {
+            return fail("control character in string");
+        }
+        ++pos_;
+    }
+    return fail("unterminated string");
+}
+
+bool JsonDocument::parseNumber(std::string_view& text) {
+    // -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    size_t start = pos_;
+    auto digits = [this]() {
+        size_t first = pos_;
+        while (pos_ < input_.size() && input_[pos_] >= '0' && input_[pos_] <= '9') {
+            ++pos_;
+        }
+        return pos_ > first;
+    };
+    auto at = [this](const char* set) {
+        return pos_ < input_.size() && input_[pos_] != '\0' && std::strchr(set, input_[pos_]) != nullptr;
+    };
+
+    if (at("-")) {
+        ++pos_;
+    }
+    if (at("0")) {
+        ++pos_;
+    } else if (!digits()) {
+        return fail("invalid number");
+    }
+    if (at(".")) {
+        ++pos_;
+        if (!digits()) {
+            return fail("invalid number");
+        }
+    }
+    if (at("eE")) {
+        ++pos_;
+        if (at("+-")) {
+            ++pos_;
+        }
+        if (!digits()) {
+            return fail("invalid number");
+        }
+    }
+    text = input_.substr(start, pos_ - start);
+    return true;
+}
+
+bool JsonDocument::parseLiteral(const char* literal) {
+    size_t length = std::strlen(literal);
+    if (input_.compare(pos_, length, literal) != 0) {
+        return fail("invalid literal");
+    }
+    pos_ += length;
+    return true;
+}
+
+bool JsonDocument::unescape(std::string_view raw, std::string& out) {
+    out.clear();
+    out.reserve(raw.size());
+    for (size_t i = 0; i < raw.size(); ++i) {
+        char c = raw[i];
+        if (c != '\\') {
+            out += c;
+            continue;
+        }
+        if (++i >= raw.size()) {
+            return false;
+        }
+        switch (raw[i]) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                uint32_t code_point = 0;
+                size_t length = unicodeEscapeLength(raw, i - 1, code_point);
+                if (length == 0) {
+                    return false;
+                }
+                i += length - 2;
+                appendUtf8(out, code_point);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// JsonDocument::Value
+// ---------------------------------------------------------------------------
+
+JsonDocument::Value JsonDocument::Value::operator[](std::string_view key) const {
+    if (!isObject()) {
+        return Value();
+    }
+    for (uint32_t child = node().first_child; child != JsonNode::NONE; child = doc_->nodes_[child].next_sibling) {
+        const JsonNode& member = doc_->nodes_[child];
+        if (!member.key_escaped) {
+            if (member.key == key) {
+                return Value(doc_, child);
+            }
+            continue;
+        }
+        std::string decoded;
+        if (JsonDocument::unescape(member.key, decoded) && decoded == key) {
+            return Value(doc_, child);
+        }
+    }
+    return Value();
+}
+
+JsonDocument::Value JsonDocument::Value::at(size_t index) const {
+    Value child = firstChild();
+    for (size_t i = 0; i < index && child.valid(); ++i) {
+        child = child.next();
+    }
+    return child;
+}
+
+JsonDocument::Value JsonDocument::Value::firstChild() const {
+    return valid() ? Value(doc_, node().first_child) : Value();
+}
+
+JsonDocument::Value JsonDocument::Value::next() const {
+    return valid() ? Value(doc_, node().next_sibling) : Value();
+}
+
+bool JsonDocument::Value::getInt(int64_t& out) const {
+    if (!isString() && !isNumber()) {
+        return false;
+    }
+    // Python callers sometimes send numeric fields as strings
+    std::string_view text = node().text;
+    int64_t parsed = 0;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), parsed);
+    if (result.ec == std::errc() && result.ptr == text.data() + text.size()) {
+        out = parsed;
+        return true;
+    }
+    if (isString()) {
+        return false;
+    }
+    // Fractions, exponents and overflow; the cast is undefined outside int64's range
+    double number = 0;
+    if (!getDouble(number) || !std::isfinite(number) || std::trunc(number) != number ||
+        number < -9223372036854775808.0 || number >= 9223372036854775808.0) {
+        return false;
+    }
+    out = static_cast<int64_t>(number);
+    return true;
+}
+
+bool JsonDocument::Value::getDouble(double& out) const {
+    if (!isNumber()) {
+        return false;
+    }
+    std::string_view text = node().text;
+    char buffer[64];
+    if (text.size() >= sizeof(buffer)) {
+        return false;
+    }
+    std::memcpy(buffer, text.data(), text.size());
+    buffer[text.size()] = '\0';
+    char* end = nullptr;
+    out = std::strtod(buffer, &end);
+    return end == buffer + text.size();
+}
+
+bool JsonDocument::Value::getBool(bool& out) const {
+    if (type() == JsonType::BOOL) {
+        out = node().boolean;
+        return true;
+    }
+    if (isString()) {
+        std::string_view text = node().text;
+        if (text == "true") { out = true; return true; }
+        if (text == "false") { out = false; return true; }
+    }
+    return false;
+}
+
+bool JsonDocument::Value::getString(std::string& out) const {
+    if (!isString()) {
+        return false;
+    }
+    if (!node().escaped) {
+        out.assign(node().text.data(), node().text.size());
+        return true;
+    }
+    return JsonDocument::unescape(node().text, out);
+}
+
+int64_t JsonDocument::Value::asInt(int64_t default_value) const {
+    int64_t value = 0;
+    return getInt(value) ? value : default_value;
+}
+
+bool JsonDocument::Value::asBool(bool default_value) const {
+    bool value = false;
+    return getBool(value) ? value : default_value;
+}
+
+std::string JsonDocument::Value::asString(const std::string& default_value) const {
+    std::string value;
+    return getString(value) ? value : default_value;
+}
+
+// ---------------------------------------------------------------------------
+// JsonWriter
+// ---------------------------------------------------------------------------
+
+void JsonWriter::clear() {
+    out_.clear();
+    has_members_.clear();
+    after_key_ = false;
+}
+
+void JsonWriter::separator() {
+    if (after_key_) {
+        after_key_ = false;
+        return;
+    }
+    if (!has_members_.empty()) {
+        if (has_members_.back()) {
+            out_ += ',';
+        }
+        has_members_.back() = true;
+    }
+}
+
+JsonWriter& JsonWriter::beginObject() {
+    separator();
+    out_ += '{';
+    has_members_.push_back(false);
+    return *this;
+}
+
+JsonWriter& JsonWriter::endObject() {
+    out_ += '}';
+    if (!has_members_.empty()) {
+        has_members_.pop_back();
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::beginArray() {
+    separator();
+    out_ += '[';
+    has_members_.push_back(false);
+    return *this;
+}
+
+JsonWriter& JsonWriter::endArray() {
+    out_ += ']';
+    if (!has_members_.empty()) {
+        has_members_.pop_back();
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::key(std::string_view name) {
+    separator();
+    appendEscaped(out_, name);
+    out_ += ':';
+    after_key_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(std::string_view text) {
+    separator();
+    appendEscaped(out_, text);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(long long number) {
+    separator();
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+    out_.append(buffer, result.ptr - buffer);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(unsigned long long number) {
+    separator();
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+    out_.append(buffer, result.ptr - buffer);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(double number) {
+    // JSON has no NaN or Infinity literals
+    if (!std::isfinite(number)) {
+        return null();
+    }
+    separator();
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "%.17g", number);
+    out_.append(buffer, length > 0 ? static_cast<size_t>(length) : 0);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(bool flag) {
+    separator();
+    out_ += flag ? "true" : "false";
+    return *this;
+}
+
+JsonWriter& JsonWriter::null() {
+    separator();
+    out_ += "null";
+    return *this;
+}
+
+void JsonWriter::appendEscaped(std::string& out, std::string_view text) {
+    static const char HEX[] = "0123456789abcdef";
+    out += '"';
+    for (char c : text) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += "\\u00";
+                    out += HEX[(c >> 4) & 0xF];
+                    out += HEX[c & 0xF];
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,174 @@
+/**
+ * @file json.h
+ * @brief SONiC Common JSON Reader/Writer Header
+ *
+ * Small JSON support for the Redis command and response paths. The reader
+ * parses in one pass into a flat node table whose strings point into the
+ * input; the writer appends to a reusable buffer.
+ */
+
+#ifndef SONIC_COMMON_JSON_H
+#define SONIC_COMMON_JSON_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace sonic {
+namespace common {
+
+enum class JsonType {
+    NUL,
+    BOOL,
+    NUMBER,
+    STRING,
+    ARRAY,
+    OBJECT
+};
+
+/**
+ * @brief One parsed value; children are linked by index
+ */
+struct JsonNode {
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    JsonType type = JsonType::NUL;
+    std::string_view key;       ///< Member name when the parent is an object (raw)
+    std::string_view text;      ///< String contents (raw) or number literal
+    bool boolean = false;
+    bool escaped = false;       ///< text contains backslash escapes
+    bool key_escaped = false;   ///< key contains backslash escapes
+    uint32_t first_child = NONE;
+    uint32_t next_sibling = NONE;
+    uint32_t size = 0;          ///< Number of children
+};
+
+/**
+ * @brief Parsed JSON document; the input must outlive it
+ *
+ * Reusing one document across parse() calls keeps the node table allocated.
+ */
+class JsonDocument {
+public:
+    /**
+     * @brief Read-only cursor into the document
+     */
+    class Value {
+    public:
+        Value() : doc_(nullptr), index_(JsonNode::NONE) {}
+
+        bool valid() const { return doc_ != nullptr && index_ != JsonNode::NONE; }
+        JsonType type() const { return valid() ? node().type : JsonType::NUL; }
+        bool isObject() const { return type() == JsonType::OBJECT; }
+        bool isArray() const { return type() == JsonType::ARRAY; }
+        bool isString() const { return type() == JsonType::STRING; }
+        bool isNumber() const { return type() == JsonType::NUMBER; }
+        size_t size() const { return valid() ? node().size : 0; }
+
+        /**
+         * @brief Object member lookup; returns an invalid Value when absent
+         */
+        Value operator[](std::string_view key) const;
+        Value at(size_t index) const;
+
+        // Child iteration: for (Value v = obj.firstChild(); v.valid(); v = v.next())
+        Value firstChild() const;
+        Value next() const;
+        std::string_view key() const { return valid() ? node().key : std::string_view(); }
+
+        bool getInt(int64_t& out) const;
+        bool getDouble(double& out) const;
+        bool getBool(bool& out) const;
+        bool getString(std::string& out) const;
+
+        int64_t asInt(int64_t default_value = 0) const;
+        bool asBool(bool default_value = false) const;
+        std::string asString(const std::string& default_value = "") const;
+
+        /**
+         * @brief String contents without decoding escapes (zero-copy)
+         */
+        std::string_view rawString() const { return isString() ? node().text : std::string_view(); }
+
+    private:
+        friend class JsonDocument;
+        Value(const JsonDocument* doc, uint32_t index) : doc_(doc), index_(index) {}
+        const JsonNode& node() const { return doc_->nodes_[index_]; }
+
+        const JsonDocument* doc_;
+        uint32_t index_;
+    };
+
+    static constexpr int MAX_DEPTH = 64;
+
+    bool parse(std::string_view input);
+    Value root() const { return nodes_.empty() ? Value() : Value(this, 0); }
+    const std::string& error() const { return error_; }
+
+    /**
+     * @brief Decode JSON string escapes (\\n, \\uXXXX, ...) into UTF-8
+     */
+    static bool unescape(std::string_view raw, std::string& out);
+
+private:
+    bool parseValue(uint32_t index, int depth);
+    bool parseString(std::string_view& text, bool& escaped);
+    bool parseNumber(std::string_view& text);
+    bool parseLiteral(const char* literal);
+    void skipWhitespace();
+    bool fail(const char* message);
+    uint32_t addNode();
+
+    std::vector<JsonNode> nodes_;
+    std::string_view input_;
+    size_t pos_ = 0;
+    std::string error_;
+};
+
+/**
+ * @brief Streaming JSON writer over a reusable buffer
+ */
+class JsonWriter {
+public:
+    /**
+     * @brief Reset the output, keeping the buffer's capacity
+     */
+    void clear();
+
+    JsonWriter& beginObject();
+    JsonWriter& endObject();
+    JsonWriter& beginArray();
+    JsonWriter& endArray();
+    JsonWriter& key(std::string_view name);
+
+    JsonWriter& value(std::string_view text);
+    JsonWriter& value(const char* text) { return value(std::string_view(text)); }
+    JsonWriter& value(const std::string& text) { return value(std::string_view(text)); }
+    JsonWriter& value(int number) { return value(static_cast<long long>(number)); }
+    JsonWriter& value(unsigned number) { return value(static_cast<unsigned long long>(number)); }
+    JsonWriter& value(long number) { return value(static_cast<long long>(number)); }
+    JsonWriter& value(unsigned long number) { return value(static_cast<unsigned long long>(number)); }
+    JsonWriter& value(long long number);
+    JsonWriter& value(unsigned long long number);
+    JsonWriter& value(double number);
+    JsonWriter& value(bool flag);
+    JsonWriter& null();
+
+    const std::string& str() const { return out_; }
+
+    static void appendEscaped(std::string& out, std::string_view text);
+
+private:
+    void separator();
+
+    std::string out_;
+    std::vector<bool> has_members_;     ///< One entry per open object/array
+    bool after_key_ = false;
+};
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_JSON_H
@@ -4,33 +4,503 @@
  */
 
 #include "logger.h"
-#include <iostream>
-#include <fstream>
-#include <iomanip>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <memory>
 #include <mutex>
+#include <streambuf>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <unistd.h>
 
 namespace sonic {
 namespace common {
 
-static std::mutex log_mutex;
+namespace {
 
-void Logger::log(LogLevel level, const std::string& message) {
-    std::lock_guard<std::mutex> lock(log_mutex);
-    
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    
-    std::string level_str;
+constexpr size_t RING_SLOTS = 512;          // Per thread; a power of two
+constexpr size_t RECORD_TEXT = 480;         // Longer messages are truncated
+constexpr size_t RECORD_TAG = 15;
+constexpr auto WRITER_PERIOD = std::chrono::milliseconds(20);
+constexpr auto FULL_RING_WAIT = std::chrono::milliseconds(10);   // Longest a producer waits before dropping
+
+struct LogRecord {
+    int64_t time_ns;
+    LogLevel level;
+    uint8_t tag_length;
+    uint16_t text_length;
+    char tag[RECORD_TAG];
+    char text[RECORD_TEXT];
+};
+
+// Single-producer ring of one logging thread, drained by the writer
+struct ThreadRing {
+    LogRecord slots[RING_SLOTS];
+    alignas(64) std::atomic<uint64_t> head{0};      // Written by the owning thread
+    alignas(64) std::atomic<uint64_t> tail{0};      // Written by the writer
+    std::atomic<uint64_t> dropped{0};               // Messages lost to a full ring
+    std::atomic<bool> orphaned{false};              // Owning thread has exited
+};
+
+// Output buffer that silently truncates instead of failing the stream
+class FixedBuffer : public std::streambuf {
+public:
+    FixedBuffer() { reset(); }
+    void reset() { setp(data_, data_ + RECORD_TEXT); }
+    std::string_view view() const { return std::string_view(pbase(), static_cast<size_t>(pptr() - pbase())); }
+
+protected:
+    int_type overflow(int_type ch) override { return traits_type::not_eof(ch); }
+
+private:
+    char data_[RECORD_TEXT];
+};
+
+struct MessageStream {
+    FixedBuffer buffer;
+    std::ostream stream{&buffer};
+    std::ios_base::fmtflags default_flags = stream.flags();
+};
+
+const char* levelName(LogLevel level) {
     switch (level) {
-        case LogLevel::DEBUG: level_str = "DEBUG"; break;
-        case LogLevel::INFO:  level_str = "INFO";  break;
-        case LogLevel::WARN:  level_str = "WARN";  break;
-        case LogLevel::ERROR: level_str = "ERROR"; break;
-    }
-    
-    std::cout << "[" << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S") 
-              << "] [" << level_str << "] " << message << std::endl;
+        case LogLevel::DEBUG: return "DEBUG";
+        case LogLevel::INFO:  return "INFO";
+        case LogLevel::WARN:  return "WARN";
+        case LogLevel::ERROR: return "ERROR";
+    }
+    return "INFO";
+}
+
+int64_t nowNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+uint64_t hashMessage(LogLevel level, std::string_view tag, std::string_view text) {
+    uint64_t hash = 1469598103934665603ULL ^ static_cast<uint64_t>(level);
+    for (std::string_view part : {tag, text}) {
+        for (char ch : part) {
+            hash = (hash ^ static_cast<unsigned char>(ch)) * 1099511628211ULL;
+        }
+        hash = (hash ^ 0xFF) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+void writeAll(int fd, const std::string& data) {
+    size_t offset = 0;
+    while (offset < data.size()) {
+        ssize_t written = ::write(fd, data.data() + offset, data.size() - offset);
+        if (written <= 0) {
+            return;     // Nowhere left to report a failure to the log itself
+        }
+        offset += static_cast<size_t>(written);
+    }
+}
+
+class Backend {
+public:
+    static Backend& instance() {
+        // Never destroyed, so threads can still log during static destruction
+        static Backend* backend = new Backend();
+        return *backend;
+    }
+
+    void push(LogLevel level, std::string_view tag, std::string_view text);
+    void flush();
+    void setRateLimit(uint32_t burst, uint32_t window_ms);
+
+    std::atomic<int> min_level{static_cast<int>(LogLevel::DEBUG)};
+
+private:
+    struct Repeat {
+        int64_t window_start_ns;
+        uint32_t count;
+        uint32_t suppressed;
+        LogLevel level;
+        std::string tag;
+        std::string text;
+    };
+
+    struct RingHandle {
+        std::shared_ptr<ThreadRing> ring;
+        ~RingHandle() {
+            if (ring) {
+                ring->orphaned.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    Backend();
+    static void stopAtExit() { instance().stop(); }
+    static void stopAtTerminate();
+
+    ThreadRing& localRing();
+    void wake();
+    void stop();
+    void writerLoop();
+    void drain();
+    void emit(int64_t time_ns, LogLevel level, std::string_view tag, std::string_view text);
+    void format(int64_t time_ns, LogLevel level, std::string_view tag, std::string_view text);
+    void emitExpiredRepeats(int64_t now_ns, bool all);
+    void writeBatches();
+
+    std::mutex rings_mutex_;
+    std::vector<std::shared_ptr<ThreadRing>> rings_;
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    std::condition_variable drained_cv_;
+    bool wake_requested_ = false;
+    uint64_t drain_passes_ = 0;
+    std::atomic<bool> stopped_{false};
+    std::thread writer_;
+
+    // Formatting state, used by the writer thread or, once stopped, under format_mutex_
+    std::mutex format_mutex_;
+    std::string out_batch_;
+    std::string err_batch_;
+    int64_t cached_second_ = -1;
+    char cached_time_[32] = {0};
+    size_t cached_time_length_ = 0;
+    std::atomic<uint32_t> rate_burst_{0};
+    std::atomic<uint32_t> rate_window_ms_{10000};
+    std::unordered_map<uint64_t, Repeat> repeats_;
+    size_t suppressing_ = 0;        // Entries in repeats_ with suppressed > 0
+
+    static std::terminate_handler previous_terminate_;
+};
+
+std::terminate_handler Backend::previous_terminate_ = nullptr;
+
+Backend::Backend() {
+    out_batch_.reserve(64 * 1024);
+    err_batch_.reserve(4 * 1024);
+    writer_ = std::thread(&Backend::writerLoop, this);
+    std::atexit(&Backend::stopAtExit);
+    // atexit does not run on std::terminate, and the lines before a crash matter most
+    previous_terminate_ = std::set_terminate(&Backend::stopAtTerminate);
+}
+
+void Backend::stopAtTerminate() {
+    Backend& backend = instance();
+    // The writer cannot join itself; whatever it had batched is lost with it
+    if (std::this_thread::get_id() != backend.writer_.get_id()) {
+        backend.stop();
+    }
+    if (previous_terminate_) {
+        previous_terminate_();
+    }
+    std::abort();
+}
+
+ThreadRing& Backend::localRing() {
+    thread_local RingHandle handle;
+    if (!handle.ring) {
+        handle.ring = std::make_shared<ThreadRing>();
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        rings_.push_back(handle.ring);
+    }
+    return *handle.ring;
+}
+
+void Backend::wake() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        wake_requested_ = true;
+    }
+    wake_cv_.notify_one();
+}
+
+void Backend::push(LogLevel level, std::string_view tag, std::string_view text) {
+    int64_t time_ns = nowNanoseconds();
+    if (stopped_.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(format_mutex_);   // Writer is gone; write synchronously
+        emit(time_ns, level, tag, text);
+        writeBatches();
+        return;
+    }
+
+    ThreadRing& ring = localRing();
+    uint64_t head = ring.head.load(std::memory_order_relaxed);
+    uint64_t used = head - ring.tail.load(std::memory_order_acquire);
+    if (used >= RING_SLOTS) {
+        // Give the writer a moment to catch up on a burst rather than losing it
+        wake();
+        auto deadline = std::chrono::steady_clock::now() + FULL_RING_WAIT;
+        while (used >= RING_SLOTS && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            used = head - ring.tail.load(std::memory_order_acquire);
+        }
+        if (used >= RING_SLOTS) {
+            ring.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    LogRecord& record = ring.slots[head & (RING_SLOTS - 1)];
+    record.time_ns = time_ns;
+    record.level = level;
+    record.tag_length = static_cast<uint8_t>(std::min(tag.size(), RECORD_TAG));
+    std::memcpy(record.tag, tag.data(), record.tag_length);
+    record.text_length = static_cast<uint16_t>(std::min(text.size(), RECORD_TEXT));
+    std::memcpy(record.text, text.data(), record.text_length);
+    ring.head.store(head + 1, std::memory_order_release);
+
+    // Errors and filling rings are written promptly; everything else waits for the next period
+    if (level == LogLevel::ERROR || used + 1 >= RING_SLOTS / 2) {
+        wake();
+    }
+}
+
+void Backend::flush() {
+    if (stopped_.load(std::memory_order_acquire)) {
+        return;     // Logging is synchronous after shutdown
+    }
+    std::unique_lock<std::mutex> lock(wake_mutex_);
+    uint64_t target = drain_passes_ + 2;    // A whole pass must start after this call
+    wake_requested_ = true;
+    wake_cv_.notify_one();
+    drained_cv_.wait(lock, [&] { return drain_passes_ >= target || stopped_.load(); });
+}
+
+void Backend::setRateLimit(uint32_t burst, uint32_t window_ms) {
+    rate_burst_.store(burst);
+    rate_window_ms_.store(std::max<uint32_t>(window_ms, 1));
+}
+
+void Backend::stop() {
+    if (stopped_.load()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        stopped_.store(true, std::memory_order_release);
+        wake_requested_ = true;
+    }
+    wake_cv_.notify_one();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+
+    // Pick up anything pushed while the writer was exiting
+    std::lock_guard<std::mutex> lock(format_mutex_);
+    drain();
+    emitExpiredRepeats(0, true);
+    writeBatches();
+    drained_cv_.notify_all();
+}
+
+void Backend::writerLoop() {
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(format_mutex_);
+            drain();
+            emitExpiredRepeats(nowNanoseconds(), false);
+            writeBatches();
+        }
+
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        drain_passes_++;
+        drained_cv_.notify_all();
+        if (stopped_.load()) {
+            return;
+        }
+        wake_cv_.wait_for(lock, WRITER_PERIOD, [&] { return wake_requested_; });
+        wake_requested_ = false;
+    }
+}
+
+void Backend::drain() {
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        rings = rings_;
+    }
+
+    // Merge the rings by time so lines from different threads interleave in order
+    struct Pending {
+        const LogRecord* record;
+        size_t ring;
+    };
+    std::vector<Pending> pending;
+    std::vector<uint64_t> heads(rings.size());
+    for (size_t i = 0; i < rings.size(); ++i) {
+        ThreadRing& ring = *rings[i];
+        heads[i] = ring.head.load(std::memory_order_acquire);
+        for (uint64_t seq = ring.tail.load(std::memory_order_relaxed); seq < heads[i]; ++seq) {
+            pending.push_back({&ring.slots[seq & (RING_SLOTS - 1)], i});
+        }
+    }
+    std::stable_sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) {
+        return a.record->time_ns < b.record->time_ns;
+    });
+    for (const auto& item : pending) {
+        const LogRecord& record = *item.record;
+        emit(record.time_ns, record.level, std::string_view(record.tag, record.tag_length),
+             std::string_view(record.text, record.text_length));
+    }
+
+    for (size_t i = 0; i < rings.size(); ++i) {
+        ThreadRing& ring = *rings[i];
+        ring.tail.store(heads[i], std::memory_order_release);
+        uint64_t dropped = ring.dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0) {
+            std::string text = std::to_string(dropped) + " messages dropped, log ring full";
+            format(nowNanoseconds(), LogLevel::WARN, "LOG", text);
+        }
+    }
+
+    // Forget rings of exited threads once they are empty
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [](const std::shared_ptr<ThreadRing>& ring) {
+        return ring->orphaned.load(std::memory_order_acquire) &&
+               ring->tail.load(std::memory_order_relaxed) == ring->head.load(std::memory_order_acquire);
+    }), rings_.end());
+}
+
+void Backend::emit(int64_t time_ns, LogLevel level, std::string_view tag, std::string_view text) {
+    uint32_t burst = rate_burst_.load(std::memory_order_relaxed);
+    if (burst == 0) {
+        format(time_ns, level, tag, text);
+        return;
+    }
+
+    int64_t window_ns = static_cast<int64_t>(rate_window_ms_.load(std::memory_order_relaxed)) * 1000000;
+    Repeat& repeat = repeats_[hashMessage(level, tag, text)];
+    if (repeat.count == 0 || time_ns - repeat.window_start_ns >= window_ns) {
+        if (repeat.suppressed > 0) {
+            std::string summary = repeat.text + " (repeated " + std::to_string(repeat.suppressed) + " more times)";
+            format(time_ns, level, tag, summary);
+            suppressing_--;
+        }
+        repeat.window_start_ns = time_ns;
+        repeat.count = 0;
+        repeat.suppressed = 0;
+    }
+    if (++repeat.count <= burst) {
+        format(time_ns, level, tag, text);
+        return;
+    }
+    if (repeat.suppressed++ == 0) {
+        repeat.level = level;
+        repeat.tag.assign(tag.data(), tag.size());
+        repeat.text.assign(text.data(), text.size());
+        suppressing_++;
+    }
+}
+
+void Backend::emitExpiredRepeats(int64_t now_ns, bool all) {
+    int64_t window_ns = static_cast<int64_t>(rate_window_ms_.load(std::memory_order_relaxed)) * 1000000;
+    bool prune = repeats_.size() > 4096;
+    if (suppressing_ == 0 && !prune) {
+        return;
+    }
+    for (auto it = repeats_.begin(); it != repeats_.end();) {
+        Repeat& repeat = it->second;
+        bool expired = all || now_ns - repeat.window_start_ns >= window_ns;
+        if (expired && repeat.suppressed > 0) {
+            std::string summary = repeat.text + " (repeated " + std::to_string(repeat.suppressed) + " more times)";
+            format(now_ns > 0 ? now_ns : nowNanoseconds(), repeat.level, repeat.tag, summary);
+            repeat.suppressed = 0;
+            suppressing_--;
+        }
+        it = (expired && prune) ? repeats_.erase(it) : std::next(it);
+    }
+}
+
+void Backend::format(int64_t time_ns, LogLevel level, std::string_view tag, std::string_view text) {
+    // localtime_r only runs when the second changes
+    int64_t second = time_ns / 1000000000;
+    if (second != cached_second_) {
+        std::time_t time = static_cast<std::time_t>(second);
+        struct tm local;
+        localtime_r(&time, &local);
+        cached_time_length_ = std::strftime(cached_time_, sizeof(cached_time_), "%Y-%m-%d %H:%M:%S", &local);
+        cached_second_ = second;
+    }
+
+    std::string& out = level >= LogLevel::WARN ? err_batch_ : out_batch_;
+    out.push_back('[');
+    out.append(cached_time_, cached_time_length_);
+    out.append("] [");
+    out.append(levelName(level));
+    out.append("] ");
+    if (!tag.empty()) {
+        out.push_back('[');
+        out.append(tag.data(), tag.size());
+        out.append("] ");
+    }
+    out.append(text.data(), text.size());
+    out.push_back('\n');
+}
+
+void Backend::writeBatches() {
+    if (!out_batch_.empty()) {
+        writeAll(STDOUT_FILENO, out_batch_);
+        out_batch_.clear();
+    }
+    if (!err_batch_.empty()) {
+        writeAll(STDERR_FILENO, err_batch_);
+        err_batch_.clear();
+    }
+}
+
+MessageStream& localStream() {
+    thread_local MessageStream stream;
+    return stream;
+}
+
+} // anonymous namespace
+
+void Logger::log(LogLevel level, const std::string& message) {
+    log(level, std::string_view(), message);
+}
+
+void Logger::log(LogLevel level, std::string_view tag, std::string_view message) {
+    if (isEnabled(level)) {
+        Backend::instance().push(level, tag, message);
+    }
+}
+
+void Logger::setLevel(LogLevel level) {
+    Backend::instance().min_level.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+bool Logger::isEnabled(LogLevel level) {
+    return static_cast<int>(level) >= SONIC_LOG_MIN_LEVEL &&
+           static_cast<int>(level) >= Backend::instance().min_level.load(std::memory_order_relaxed);
+}
+
+void Logger::setRateLimit(uint32_t burst, uint32_t window_ms) {
+    Backend::instance().setRateLimit(burst, window_ms);
+}
+
+void Logger::flush() {
+    Backend::instance().flush();
+}
+
+std::ostream& Logger::beginMessage() {
+    MessageStream& message = localStream();
+    message.buffer.reset();
+    message.stream.clear();
+    message.stream.flags(message.default_flags);
+    message.stream.precision(6);
+    message.stream.width(0);
+    message.stream.fill(' ');
+    return message.stream;
+}
+
+void Logger::endMessage(LogLevel level, std::string_view tag) {
+    Backend::instance().push(level, tag, localStream().buffer.view());
 }
 
 } // namespace common
@@ -1,12 +1,28 @@
 /**
  * @file logger.h
  * @brief SONiC Common Logger Header
+ *
+ * Messages are formatted on the calling thread into a fixed buffer and pushed
+ * onto that thread's lock-free ring; a background writer drains every ring,
+ * stamps lines with a cached timestamp and writes them in batches. Levels
+ * below SONIC_LOG_MIN_LEVEL compile away. Once a rate limit is set, a message
+ * repeated more than the limit within one window is collapsed into a repeat
+ * count. Queued lines are written when the process exits normally or through
+ * std::terminate; call flush() where output must be on screen sooner.
  */
 
 #ifndef SONIC_COMMON_LOGGER_H
 #define SONIC_COMMON_LOGGER_H
 
 #include <string>
+#include <string_view>
+#include <ostream>
+#include <cstdint>
+
+// Lowest level compiled in: 0 DEBUG, 1 INFO, 2 WARN, 3 ERROR
+#ifndef SONIC_LOG_MIN_LEVEL
+#define SONIC_LOG_MIN_LEVEL 0
+#endif
 
 namespace sonic {
 namespace common {
@@ -21,9 +37,56 @@ enum class LogLevel {
 class Logger {
 public:
     static void log(LogLevel level, const std::string& message);
+
+    /**
+     * @brief Queue one message, shown as "[tag] message" when tag is non-empty
+     */
+    static void log(LogLevel level, std::string_view tag, std::string_view message);
+
+    /**
+     * @brief Runtime filter on top of SONIC_LOG_MIN_LEVEL
+     */
+    static void setLevel(LogLevel level);
+    static bool isEnabled(LogLevel level);
+
+    /**
+     * @brief Show at most burst copies of a message per window; burst 0 (the default) disables the limit
+     */
+    static void setRateLimit(uint32_t burst, uint32_t window_ms);
+
+    /**
+     * @brief Block until every message queued so far has been written
+     */
+    static void flush();
+
+    /**
+     * @brief Thread-local stream for building the next message, used by SONIC_LOG
+     *
+     * Writes into a fixed buffer; text past its end is truncated.
+     */
+    static std::ostream& beginMessage();
+    static void endMessage(LogLevel level, std::string_view tag);
 };
 
 } // namespace common
 } // namespace sonic
 
+/**
+ * @brief Stream-style logging: SONIC_LOG(INFO, "SAI", "Created VLAN " << vlan_id)
+ */
+#define SONIC_LOG(level, tag, ...)                                                                  \
+    do {                                                                                            \
+        if constexpr (static_cast<int>(::sonic::common::LogLevel::level) >= SONIC_LOG_MIN_LEVEL) {  \
+            if (::sonic::common::Logger::isEnabled(::sonic::common::LogLevel::level)) {             \
+                ::sonic::common::Logger::beginMessage() << __VA_ARGS__;                             \
+                ::sonic::common::Logger::endMessage(::sonic::common::LogLevel::level, tag);         \
+            }                                                                                       \
+        }                                                                                           \
+    } while (0)
+
+#define SONIC_LOG_DEBUG(tag, ...) SONIC_LOG(DEBUG, tag, __VA_ARGS__)
+#define SONIC_LOG_INFO(tag, ...) SONIC_LOG(INFO, tag, __VA_ARGS__)
+#define SONIC_LOG_WARN(tag, ...) SONIC_LOG(WARN, tag, __VA_ARGS__)
+#define SONIC_LOG_ERROR(tag, ...) SONIC_LOG(ERROR, tag, __VA_ARGS__)
+
 #endif // SONIC_COMMON_LOGGER_H
@@ -0,0 +1,282 @@
+/**
+ * @file metrics.cpp
+ * @brief SONiC Common Metrics Implementation
+ */
+
+#include "metrics.h"
+#include "redis_client.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace sonic {
+namespace common {
+
+namespace {
+
+constexpr int STATE_DB = 6;
+const double QUANTILES[] = {0.5, 0.9, 0.99, 0.999};
+
+void appendNumber(std::string& out, double value) {
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+    out.append(buffer, static_cast<size_t>(length));
+}
+
+std::string formatMicroseconds(uint64_t nanoseconds) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.3f", static_cast<double>(nanoseconds) / 1000.0);
+    return buffer;
+}
+
+} // anonymous namespace
+
+size_t LatencyHistogram::bucketIndex(uint64_t nanoseconds) {
+    constexpr uint64_t SUB_BUCKETS = 1ULL << SUB_BUCKET_BITS;
+    if (nanoseconds < SUB_BUCKETS) {
+        return static_cast<size_t>(nanoseconds);    // Exact below 16 ns
+    }
+    int exponent = 63 - __builtin_clzll(nanoseconds);
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    size_t group = static_cast<size_t>(exponent - SUB_BUCKET_BITS + 1);
+    size_t sub = static_cast<size_t>((nanoseconds >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+    return (group << SUB_BUCKET_BITS) + sub;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index) {
+    constexpr size_t SUB_BUCKETS = 1U << SUB_BUCKET_BITS;
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    size_t group = index >> SUB_BUCKET_BITS;
+    uint64_t width = 1ULL << (group - 1);
+    uint64_t lower = (SUB_BUCKETS + (index & (SUB_BUCKETS - 1))) * width;
+    return lower + width - 1;
+}
+
+void LatencyHistogram::record(uint64_t nanoseconds) {
+    buckets_[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(nanoseconds, std::memory_order_relaxed);
+    uint64_t current = max_.load(std::memory_order_relaxed);
+    while (nanoseconds > current && !max_.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::setSampleRate(uint32_t every_n) {
+    uint32_t rate = 1;
+    while (rate < every_n && rate < (1U << 31)) {
+        rate <<= 1;
+    }
+    sample_mask_.store(rate - 1, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::percentile(double q) const {
+    // Count from the buckets themselves so a concurrent record cannot push the target past the end
+    uint64_t counts[BUCKET_COUNT];
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    q = std::min(std::max(q, 0.0), 1.0);
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(total))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += counts[i];
+        if (seen >= target) {
+            return std::min(bucketUpperBound(i), max());
+        }
+    }
+    return max();
+}
+
+MetricsRegistry& MetricsRegistry::instance() {
+    // Never destroyed, so instrumented code stays safe during static destruction
+    static MetricsRegistry* registry = new MetricsRegistry();
+    return *registry;
+}
+
+MetricsRegistry::Entry& MetricsRegistry::find(const std::string& name, const std::string& help, Type type) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(name);
+    if (it != entries_.end()) {
+        if (it->second->type != type) {
+            throw std::invalid_argument("metric " + name + " already registered with another type");
+        }
+        return *it->second;
+    }
+    auto entry = std::make_unique<Entry>();
+    entry->type = type;
+    entry->help = help;
+    if (type == Type::HISTOGRAM) {
+        entry->histogram = std::make_unique<LatencyHistogram>();
+    }
+    Entry& result = *entry;
+    entries_.emplace(name, std::move(entry));
+    return result;
+}
+
+Counter& MetricsRegistry::counter(const std::string& name, const std::string& help) {
+    return find(name, help, Type::COUNTER).counter;
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name, const std::string& help) {
+    return find(name, help, Type::GAUGE).gauge;
+}
+
+LatencyHistogram& MetricsRegistry::histogram(const std::string& name, const std::string& help) {
+    return *find(name, help, Type::HISTOGRAM).histogram;
+}
+
+void MetricsRegistry::exportPrometheus(std::string& out) const {
+    out.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& item : entries_) {
+        const std::string& name = item.first;
+        const Entry& entry = *item.second;
+        const char* type = entry.type == Type::COUNTER ? "counter" : entry.type == Type::GAUGE ? "gauge" : "summary";
+        out.append("# HELP ").append(name).append(" ").append(entry.help).append("\n");
+        out.append("# TYPE ").append(name).append(" ").append(type).append("\n");
+
+        switch (entry.type) {
+            case Type::COUNTER:
+                out.append(name).append(" ").append(std::to_string(entry.counter.value())).append("\n");
+                break;
+            case Type::GAUGE:
+                out.append(name).append(" ").append(std::to_string(entry.gauge.value())).append("\n");
+                break;
+            case Type::HISTOGRAM: {
+                const LatencyHistogram& histogram = *entry.histogram;
+                for (double quantile : QUANTILES) {
+                    out.append(name).append("{quantile=\"");
+                    appendNumber(out, quantile);
+                    out.append("\"} ");
+                    appendNumber(out, static_cast<double>(histogram.percentile(quantile)) / 1e9);
+                    out.append("\n");
+                }
+                out.append(name).append("_sum ");
+                appendNumber(out, static_cast<double>(histogram.sum()) / 1e9);
+                out.append("\n").append(name).append("_count ").append(std::to_string(histogram.count())).append("\n");
+                break;
+            }
+        }
+    }
+}
+
+bool MetricsRegistry::exportToStateDB(RedisClient& client) const {
+    std::vector<std::vector<std::string>> commands;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        commands.reserve(entries_.size());
+        for (const auto& item : entries_) {
+            const Entry& entry = *item.second;
+            std::vector<std::string> command = {"HSET", "METRICS|" + item.first};
+            switch (entry.type) {
+                case Type::COUNTER:
+                    command.insert(command.end(), {"type", "counter", "value", std::to_string(entry.counter.value())});
+                    break;
+                case Type::GAUGE:
+                    command.insert(command.end(), {"type", "gauge", "value", std::to_string(entry.gauge.value())});
+                    break;
+                case Type::HISTOGRAM: {
+                    const LatencyHistogram& histogram = *entry.histogram;
+                    command.insert(command.end(), {
+                        "type", "histogram",
+                        "count", std::to_string(histogram.count()),
+                        "sum_us", formatMicroseconds(histogram.sum()),
+                        "p50_us", formatMicroseconds(histogram.percentile(0.5)),
+                        "p90_us", formatMicroseconds(histogram.percentile(0.9)),
+                        "p99_us", formatMicroseconds(histogram.percentile(0.99)),
+                        "max_us", formatMicroseconds(histogram.max())});
+                    break;
+                }
+            }
+            commands.push_back(std::move(command));
+        }
+    }
+    if (commands.empty()) {
+        return true;
+    }
+
+    std::vector<RedisReply> replies;
+    if (!client.pipeline(STATE_DB, commands, replies)) {
+        return false;
+    }
+    for (const auto& reply : replies) {
+        if (reply.isError()) {
+            std::cerr << "Failed to export metrics: " << reply.str << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+MetricsExporter::MetricsExporter(RedisClient* client, const std::string& textfile_path)
+    : client_(client), textfile_path_(textfile_path), interval_ms_(10000), running_(false) {}
+
+MetricsExporter::~MetricsExporter() {
+    stop();
+}
+
+void MetricsExporter::start(int interval_ms) {
+    if (running_.exchange(true)) {
+        return;
+    }
+    interval_ms_ = interval_ms > 0 ? interval_ms : 10000;
+    thread_ = std::thread(&MetricsExporter::exportLoop, this);
+}
+
+void MetricsExporter::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+    }
+    wait_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+bool MetricsExporter::exportOnce() {
+    bool ok = true;
+    if (client_ && !MetricsRegistry::instance().exportToStateDB(*client_)) {
+        ok = false;
+    }
+    if (!textfile_path_.empty()) {
+        MetricsRegistry::instance().exportPrometheus(buffer_);
+        std::string temp_path = textfile_path_ + ".tmp";
+        std::ofstream file(temp_path, std::ios::trunc);
+        file << buffer_;
+        file.close();
+        if (!file || std::rename(temp_path.c_str(), textfile_path_.c_str()) != 0) {
+            std::cerr << "Failed to write metrics to " << textfile_path_ << std::endl;
+            std::remove(temp_path.c_str());
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+void MetricsExporter::exportLoop() {
+    while (running_) {
+        exportOnce();
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        wait_cv_.wait_for(lock, std::chrono::milliseconds(interval_ms_), [this] { return !running_.load(); });
+    }
+    exportOnce();   // Leave the final values behind
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,243 @@
+/**
+ * @file metrics.h
+ * @brief SONiC Common Metrics Header
+ *
+ * Process-wide counters, gauges and latency histograms. Updates are relaxed
+ * atomics, so instrumented code never takes a lock. Histograms use
+ * log-linear buckets (16 per power of two, under 7% error) from 1 ns to a
+ * few hours. Scoped timers can sample one call in N; an unsampled call costs
+ * a thread-local increment and a branch. The registry renders everything as
+ * Prometheus text or writes it to STATE_DB.
+ */
+
+#ifndef SONIC_COMMON_METRICS_H
+#define SONIC_COMMON_METRICS_H
+
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace sonic {
+namespace common {
+
+class RedisClient;
+
+/**
+ * @brief Monotonically increasing count
+ */
+class Counter {
+public:
+    void inc(uint64_t amount = 1) { value_.fetch_add(amount, std::memory_order_relaxed); }
+    uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+/**
+ * @brief Value that can go up and down
+ */
+class Gauge {
+public:
+    void set(int64_t value) { value_.store(value, std::memory_order_relaxed); }
+    void add(int64_t amount) { value_.fetch_add(amount, std::memory_order_relaxed); }
+    int64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> value_{0};
+};
+
+/**
+ * @brief Lock-free latency histogram in nanoseconds
+ */
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 4;
+    static constexpr int MAX_EXPONENT = 43;     ///< Values above 2^44 ns (~4.9 h) land in the last bucket
+    static constexpr size_t BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) << SUB_BUCKET_BITS;
+
+    void record(uint64_t nanoseconds);
+
+    /**
+     * @brief Time one call in every_n (rounded up to a power of two); 1 times every call
+     */
+    void setSampleRate(uint32_t every_n);
+
+    /**
+     * @brief Whether the calling thread should time this call
+     */
+    bool shouldSample() const {
+        uint32_t mask = sample_mask_.load(std::memory_order_relaxed);
+        return mask == 0 || (++sampleTick() & mask) == 0;
+    }
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return sum_.load(std::memory_order_relaxed); }
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Upper bound of the bucket holding the q-th quantile, 0 when empty
+     * @param q Quantile in [0, 1]
+     */
+    uint64_t percentile(double q) const;
+
+    static size_t bucketIndex(uint64_t nanoseconds);
+    static uint64_t bucketUpperBound(size_t index);
+
+private:
+    static uint32_t& sampleTick() {
+        thread_local uint32_t tick = 0;
+        return tick;
+    }
+
+    std::atomic<uint64_t> buckets_[BUCKET_COUNT] = {};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+    std::atomic<uint32_t> sample_mask_{0};
+};
+
+/**
+ * @brief Records the lifetime of a scope into a histogram when the call is sampled
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(LatencyHistogram& histogram)
+        : histogram_(histogram.shouldSample() ? &histogram : nullptr),
+          start_(histogram_ ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point()) {}
+
+    ~ScopedTimer() {
+        if (histogram_) {
+            histogram_->record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start_).count()));
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    LatencyHistogram* histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief Process-wide set of named metrics
+ *
+ * Metrics live until the process exits, so the references handed out can be
+ * cached in function-local statics. Names follow Prometheus conventions
+ * (sonic_<module>_<what>_<unit>).
+ */
+class MetricsRegistry {
+public:
+    static MetricsRegistry& instance();
+
+    /**
+     * @brief Find or create a metric
+     * @throws std::invalid_argument if name is already registered as another type
+     */
+    Counter& counter(const std::string& name, const std::string& help);
+    Gauge& gauge(const std::string& name, const std::string& help);
+    LatencyHistogram& histogram(const std::string& name, const std::string& help);
+
+    /**
+     * @brief Render every metric in the Prometheus text format; histograms become summaries in seconds
+     * @param out Overwritten; its capacity is reused across calls
+     */
+    void exportPrometheus(std::string& out) const;
+
+    /**
+     * @brief Write every metric to STATE_DB as METRICS|<name> hashes in one pipeline
+     * @return true if the pipeline succeeded
+     */
+    bool exportToStateDB(RedisClient& client) const;
+
+private:
+    enum class Type { COUNTER, GAUGE, HISTOGRAM };
+
+    struct Entry {
+        Type type;
+        std::string help;
+        Counter counter;
+        Gauge gauge;
+        std::unique_ptr<LatencyHistogram> histogram;
+    };
+
+    MetricsRegistry() = default;
+    Entry& find(const std::string& name, const std::string& help, Type type);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<Entry>> entries_;     // Sorted, so exports are stable
+};
+
+/**
+ * @brief Periodically exports the registry to STATE_DB and, optionally, a Prometheus textfile
+ *
+ * The textfile is replaced atomically, for node_exporter's textfile collector.
+ */
+class MetricsExporter {
+public:
+    /**
+     * @param client STATE_DB connection, null to skip STATE_DB
+     * @param textfile_path Prometheus output file, empty to skip
+     */
+    MetricsExporter(RedisClient* client, const std::string& textfile_path);
+    ~MetricsExporter();
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+    void start(int interval_ms = 10000);
+    void stop();
+
+    /**
+     * @brief Export once now
+     * @return true if every configured destination was written
+     */
+    bool exportOnce();
+
+private:
+    void exportLoop();
+
+    RedisClient* client_;
+    std::string textfile_path_;
+    std::string buffer_;
+    int interval_ms_;
+    std::atomic<bool> running_;
+    std::thread thread_;
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+};
+
+} // namespace common
+} // namespace sonic
+
+#define SONIC_METRICS_CONCAT_INNER(a, b) a##b
+#define SONIC_METRICS_CONCAT(a, b) SONIC_METRICS_CONCAT_INNER(a, b)
+
+/**
+ * @brief Time the rest of the enclosing scope into the named histogram
+ */
+#define SONIC_SCOPED_TIMER(name, help)                                                                  \
+    static ::sonic::common::LatencyHistogram& SONIC_METRICS_CONCAT(sonic_histogram_, __LINE__) =        \
+        ::sonic::common::MetricsRegistry::instance().histogram(name, help);                             \
+    ::sonic::common::ScopedTimer SONIC_METRICS_CONCAT(sonic_timer_, __LINE__)(                          \
+        SONIC_METRICS_CONCAT(sonic_histogram_, __LINE__))
+
+/**
+ * @brief Increment the named counter
+ */
+#define SONIC_COUNTER_INC(name, help)                                                                   \
+    do {                                                                                                \
+        static ::sonic::common::Counter& sonic_counter_ =                                               \
+            ::sonic::common::MetricsRegistry::instance().counter(name, help);                           \
+        sonic_counter_.inc();                                                                           \
+    } while (0)
+
+#endif // SONIC_COMMON_METRICS_H
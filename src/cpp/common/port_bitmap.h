@@ -0,0 +1,127 @@
+/**
+ * @file port_bitmap.h
+ * @brief SONiC Common Port Bitmap
+ *
+ * Growable bitset keyed by dense port index (common::PortId). Used for VLAN
+ * membership and other per-port sets where a std::set<std::string> would be
+ * the obvious but much heavier choice.
+ */
+
+#ifndef SONIC_COMMON_PORT_BITMAP_H
+#define SONIC_COMMON_PORT_BITMAP_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace sonic {
+namespace common {
+
+/**
+ * @brief Set of port indices stored one bit per port
+ */
+class PortBitmap {
+public:
+    PortBitmap() : count_(0) {}
+
+    /**
+     * @brief Add index; grows the bitmap as needed
+     * @return false if the bit was already set
+     */
+    bool set(uint32_t index) {
+        size_t word = index / 64;
+        if (word >= words_.size()) {
+            words_.resize(word + 1, 0);
+        }
+        uint64_t mask = uint64_t(1) << (index % 64);
+        if (words_[word] & mask) {
+            return false;
+        }
+        words_[word] |= mask;
+        count_++;
+        return true;
+    }
+
+    /**
+     * @brief Remove index
+     * @return false if the bit was not set
+     */
+    bool reset(uint32_t index) {
+        size_t word = index / 64;
+        uint64_t mask = uint64_t(1) << (index % 64);
+        if (word >= words_.size() || !(words_[word] & mask)) {
+            return false;
+        }
+        words_[word] &= ~mask;
+        count_--;
+        return true;
+    }
+
+    bool test(uint32_t index) const {
+        size_t word = index / 64;
+        return word < words_.size() && (words_[word] >> (index % 64)) & 1;
+    }
+
+    /**
+     * @brief True when both sets share at least one index
+     */
+    bool intersects(const PortBitmap& other) const {
+        size_t words = words_.size() < other.words_.size() ? words_.size() : other.words_.size();
+        for (size_t i = 0; i < words; ++i) {
+            if (words_[i] & other.words_[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Indices present in both sets, ascending
+     */
+    std::vector<uint32_t> intersection(const PortBitmap& other) const {
+        std::vector<uint32_t> result;
+        size_t words = words_.size() < other.words_.size() ? words_.size() : other.words_.size();
+        for (size_t i = 0; i < words; ++i) {
+            appendBits(words_[i] & other.words_[i], i, result);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Call fn(index) for every set index in ascending order
+     */
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (size_t i = 0; i < words_.size(); ++i) {
+            uint64_t bits = words_[i];
+            while (bits) {
+                fn(static_cast<uint32_t>(i * 64 + __builtin_ctzll(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    size_t count() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    void clear() {
+        words_.clear();
+        count_ = 0;
+    }
+
+private:
+    static void appendBits(uint64_t bits, size_t word, std::vector<uint32_t>& out) {
+        while (bits) {
+            out.push_back(static_cast<uint32_t>(word * 64 + __builtin_ctzll(bits)));
+            bits &= bits - 1;
+        }
+    }
+
+    std::vector<uint64_t> words_;
+    size_t count_;
+};
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_PORT_BITMAP_H
@@ -0,0 +1,210 @@
+/**
+ * @file port_registry.cpp
+ * @brief SONiC Common Port Registry Implementation
+ */
+
+#include "port_registry.h"
+#include "redis_client.h"
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+
+namespace sonic {
+namespace common {
+
+namespace {
+
+constexpr int COUNTERS_DB = 2;
+const char* const COUNTERS_PORT_NAME_MAP = "COUNTERS_PORT_NAME_MAP";
+
+} // anonymous namespace
+
+PortId PortRegistrySnapshot::findPort(const std::string& name) const {
+    auto it = std::lower_bound(by_name.begin(), by_name.end(), name,
+        [](const std::pair<const std::string*, PortId>& entry, const std::string& key) {
+            return *entry.first < key;
+        });
+    return (it != by_name.end() && *it->first == name) ? it->second : INVALID_PORT_ID;
+}
+
+PortId PortRegistrySnapshot::findByOID(uint64_t oid) const {
+    auto it = std::lower_bound(by_oid.begin(), by_oid.end(), oid,
+        [](const std::pair<uint64_t, PortId>& entry, uint64_t key) {
+            return entry.first < key;
+        });
+    return (it != by_oid.end() && it->first == oid) ? it->second : INVALID_PORT_ID;
+}
+
+PortRegistry::PortRegistry()
+    : snapshot_(std::make_shared<PortRegistrySnapshot>()), loaded_(false) {
+}
+
+std::shared_ptr<const PortRegistrySnapshot> PortRegistry::snapshot() const {
+    return std::atomic_load(&snapshot_);
+}
+
+PortId PortRegistry::findPort(const std::string& name) const {
+    return snapshot()->findPort(name);
+}
+
+PortId PortRegistry::findByOID(uint64_t oid) const {
+    return snapshot()->findByOID(oid);
+}
+
+uint64_t PortRegistry::getOID(PortId id) const {
+    return snapshot()->getOID(id);
+}
+
+uint64_t PortRegistry::getOID(const std::string& name) const {
+    auto current = snapshot();
+    return current->getOID(current->findPort(name));
+}
+
+size_t PortRegistry::size() const {
+    return snapshot()->size();
+}
+
+bool PortRegistry::addPort(const std::string& name, uint64_t oid) {
+    if (oid == 0) {
+        return false;
+    }
+    PortId id = portNames().intern(name);
+    if (id == INVALID_PORT_ID) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    std::map<PortId, uint64_t> ports = currentPorts();
+    auto it = ports.find(id);
+    if (it != ports.end() && it->second == oid) {
+        return true;
+    }
+    ports[id] = oid;
+    publish(ports);
+    return true;
+}
+
+bool PortRegistry::removePort(const std::string& name) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    PortId id = snapshot()->findPort(name);
+    if (id == INVALID_PORT_ID) {
+        return false;
+    }
+    std::map<PortId, uint64_t> ports = currentPorts();
+    ports.erase(id);
+    publish(ports);
+    return true;
+}
+
+size_t PortRegistry::applyPortMap(const std::map<std::string, std::string>& port_map) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    std::map<PortId, uint64_t> ports = currentPorts();
+    std::map<PortId, uint64_t> updated;
+    for (const auto& entry : port_map) {
+        uint64_t oid = parseOID(entry.second);
+        PortId id = portNames().intern(entry.first);
+        if (oid == 0 || id == INVALID_PORT_ID) {
+            std::cerr << "Ignoring port map entry " << entry.first << " -> " << entry.second << std::endl;
+            continue;
+        }
+        updated[id] = oid;
+    }
+
+    size_t changes = 0;
+    for (const auto& entry : updated) {
+        auto it = ports.find(entry.first);
+        if (it == ports.end() || it->second != entry.second) {
+            changes++;
+        }
+    }
+    for (const auto& entry : ports) {
+        if (updated.find(entry.first) == updated.end()) {
+            changes++;
+        }
+    }
+
+    if (changes != 0) {
+        publish(updated);
+    }
+    return changes;
+}
+
+bool PortRegistry::loadFromCountersDB(RedisClient& client) {
+    RedisReply reply;
+    if (!client.command(COUNTERS_DB, {"HGETALL", COUNTERS_PORT_NAME_MAP}, reply)) {
+        std::cerr << "Failed to read " << COUNTERS_PORT_NAME_MAP << ": " << reply.str << std::endl;
+        return false;
+    }
+    size_t changes = applyPortMap(reply.asHash());
+    if (changes != 0) {
+        std::cout << "Port registry: " << size() << " ports (" << changes << " changed)" << std::endl;
+    }
+    loaded_.store(true);
+    return true;
+}
+
+bool PortRegistry::ensureLoaded(RedisClient& client) {
+    std::call_once(load_once_, [this, &client]() {
+        loadFromCountersDB(client);
+    });
+    return loaded_.load();
+}
+
+bool PortRegistry::ensureLoaded(const RedisConfig& config) {
+    std::call_once(load_once_, [this, &config]() {
+        RedisConfig direct = config;
+        direct.shell_fallback = false;
+        RedisClient client(direct);
+        loadFromCountersDB(client);
+    });
+    return loaded_.load();
+}
+
+uint64_t PortRegistry::parseOID(const std::string& text) {
+    std::string hex = text;
+    if (hex.compare(0, 4, "oid:") == 0) {
+        hex = hex.substr(4);
+    }
+    if (hex.empty()) {
+        return 0;
+    }
+    char* end = nullptr;
+    unsigned long long value = std::strtoull(hex.c_str(), &end, 16);
+    return (end && *end == '\0') ? static_cast<uint64_t>(value) : 0;
+}
+
+std::map<PortId, uint64_t> PortRegistry::currentPorts() const {
+    std::map<PortId, uint64_t> ports;
+    for (const auto& entry : snapshot()->by_oid) {
+        ports[entry.second] = entry.first;
+    }
+    return ports;
+}
+
+void PortRegistry::publish(const std::map<PortId, uint64_t>& ports) {
+    auto next = std::make_shared<PortRegistrySnapshot>();
+    if (!ports.empty()) {
+        next->oid_by_id.assign(ports.rbegin()->first + 1, 0);
+    }
+    next->by_oid.reserve(ports.size());
+    next->by_name.reserve(ports.size());
+    for (const auto& entry : ports) {
+        next->oid_by_id[entry.first] = entry.second;
+        next->by_oid.emplace_back(entry.second, entry.first);
+        next->by_name.emplace_back(&portNames().name(entry.first), entry.first);
+    }
+    std::sort(next->by_oid.begin(), next->by_oid.end());
+    std::sort(next->by_name.begin(), next->by_name.end(),
+        [](const std::pair<const std::string*, PortId>& a, const std::pair<const std::string*, PortId>& b) {
+            return *a.first < *b.first;
+        });
+    std::atomic_store(&snapshot_, std::shared_ptr<const PortRegistrySnapshot>(std::move(next)));
+}
+
+PortRegistry& portRegistry() {
+    static PortRegistry registry;
+    return registry;
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,128 @@
+/**
+ * @file port_registry.h
+ * @brief SONiC Common Port Registry Header
+ *
+ * Process-wide name <-> PortId <-> SAI OID mapping for front-panel ports.
+ * Loaded from COUNTERS_DB COUNTERS_PORT_NAME_MAP and refreshed by diffing
+ * that map; readers work on an immutable snapshot and never take a lock.
+ */
+
+#ifndef SONIC_COMMON_PORT_REGISTRY_H
+#define SONIC_COMMON_PORT_REGISTRY_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <utility>
+#include <cstdint>
+#include "string_interner.h"
+
+namespace sonic {
+namespace common {
+
+class RedisClient;
+struct RedisConfig;
+
+/**
+ * @brief Immutable view of the registry; lookups are array index or binary search
+ */
+struct PortRegistrySnapshot {
+    std::vector<uint64_t> oid_by_id;                               ///< Indexed by PortId, 0 when unregistered
+    std::vector<std::pair<uint64_t, PortId>> by_oid;               ///< Sorted by OID
+    std::vector<std::pair<const std::string*, PortId>> by_name;    ///< Sorted by name; names owned by portNames()
+
+    size_t size() const { return by_oid.size(); }
+
+    PortId findPort(const std::string& name) const;
+    PortId findByOID(uint64_t oid) const;
+
+    uint64_t getOID(PortId id) const {
+        return id < oid_by_id.size() ? oid_by_id[id] : 0;
+    }
+};
+
+/**
+ * @brief Thread-safe port registry; writers publish a new snapshot copy-on-write
+ */
+class PortRegistry {
+public:
+    PortRegistry();
+
+    PortRegistry(const PortRegistry&) = delete;
+    PortRegistry& operator=(const PortRegistry&) = delete;
+
+    /**
+     * @brief Current snapshot; hold it across a hot loop to avoid repeated atomic loads
+     */
+    std::shared_ptr<const PortRegistrySnapshot> snapshot() const;
+
+    /**
+     * @return INVALID_PORT_ID when the port is not registered
+     */
+    PortId findPort(const std::string& name) const;
+    PortId findByOID(uint64_t oid) const;
+
+    /**
+     * @return SAI OID of the port, 0 when it is not registered
+     */
+    uint64_t getOID(PortId id) const;
+    uint64_t getOID(const std::string& name) const;
+
+    const std::string& name(PortId id) const { return portNames().name(id); }
+    size_t size() const;
+
+    /**
+     * @brief Register or re-point a single port
+     */
+    bool addPort(const std::string& name, uint64_t oid);
+    bool removePort(const std::string& name);
+
+    /**
+     * @brief Make the registry match a name -> "oid:0x..." map, applying only the difference
+     * @return Number of ports added, changed or removed
+     */
+    size_t applyPortMap(const std::map<std::string, std::string>& port_map);
+
+    /**
+     * @brief Read COUNTERS_PORT_NAME_MAP and apply it
+     */
+    bool loadFromCountersDB(RedisClient& client);
+
+    /**
+     * @brief Load from COUNTERS_DB once per process; later calls return the first result
+     */
+    bool ensureLoaded(RedisClient& client);
+
+    /**
+     * @brief ensureLoaded() over a short-lived connection (no redis-cli fallback)
+     */
+    bool ensureLoaded(const RedisConfig& config);
+
+    /**
+     * @brief Parse "oid:0x1000000000002" (or plain hex) into an OID
+     * @return 0 on malformed input
+     */
+    static uint64_t parseOID(const std::string& text);
+
+private:
+    void publish(const std::map<PortId, uint64_t>& ports);
+    std::map<PortId, uint64_t> currentPorts() const;
+
+    std::mutex write_mutex_;
+    std::shared_ptr<const PortRegistrySnapshot> snapshot_;
+    std::once_flag load_once_;
+    std::atomic<bool> loaded_;
+};
+
+/**
+ * @brief Process-wide registry shared by the SAI managers, OrchAgent and the interrupt controller
+ */
+PortRegistry& portRegistry();
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_PORT_REGISTRY_H
@@ -0,0 +1,996 @@
+/**
+ * @file redis_client.cpp
+ * @brief SONiC Common Redis Client Implementation
+ */
+
+#include "redis_client.h"
+#include "cli_executor.h"
+#include <iostream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+#include <cerrno>
+#include <algorithm>
+#include <thread>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+namespace sonic {
+namespace common {
+
+namespace {
+
+constexpr int INITIAL_BACKOFF_MS = 100;
+constexpr int MAX_BACKOFF_MS = 5000;
+
+// Anything not listed may change what a SONiC show command prints
+bool changesData(const std::vector<std::string>& args) {
+    static const char* const READS[] = {
+        "GET", "MGET", "HGET", "HGETALL", "HMGET", "HEXISTS", "HKEYS", "HLEN", "EXISTS", "KEYS", "SCAN",
+        "TYPE", "TTL", "PTTL", "LLEN", "LRANGE", "SMEMBERS", "SCARD", "PING", "INFO", "SELECT", "CONFIG",
+        "SUBSCRIBE", "PSUBSCRIBE",
+    };
+    if (args.empty()) {
+        return false;
+    }
+    for (const char* read : READS) {
+        if (strcasecmp(args[0].c_str(), read) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Cached CLI output may describe what a write replaced. Invalidates on leaving
+// scope, after the write, even a failed one since part of it may have applied
+class CliCacheInvalidator {
+public:
+    explicit CliCacheInvalidator(const std::vector<std::string>& args) : writes_(changesData(args)) {}
+    explicit CliCacheInvalidator(const std::vector<std::vector<std::string>>& commands)
+        : writes_(std::any_of(commands.begin(), commands.end(), changesData)) {}
+    ~CliCacheInvalidator() {
+        if (writes_) {
+            CliExecutor::invalidateShared();
+        }
+    }
+
+private:
+    bool writes_;
+};
+
+std::string shellQuote(const std::string& arg) {
+    std::string quoted = "'";
+    for (char c : arg) {
+        if (c == '\'') {
+            quoted += "'\\''";
+        } else {
+            quoted += c;
+        }
+    }
+    quoted += "'";
+    return quoted;
+}
+
+void setSocketTimeouts(int fd, int timeout_ms) {
+    struct timeval tv;
+    tv.tv_sec = timeout_ms / 1000;
+    tv.tv_usec = (timeout_ms % 1000) * 1000;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+}
+
+bool waitConnected(int fd, int timeout_ms) {
+    struct pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLOUT;
+    pfd.revents = 0;
+
+    int rc;
+    do {
+        rc = poll(&pfd, 1, timeout_ms);
+    } while (rc < 0 && errno == EINTR);
+    if (rc <= 0) {
+        return false;
+    }
+
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0) {
+        return false;
+    }
+    return true;
+}
+
+// Non-blocking connect bounded by timeout_ms; leaves the socket blocking on success
+bool connectWithTimeout(int fd, const struct sockaddr* addr, socklen_t addr_len, int timeout_ms) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+    bool connected = (::connect(fd, addr, addr_len) == 0);
+    if (!connected && errno == EINPROGRESS) {
+        connected = waitConnected(fd, timeout_ms);
+    }
+
+    fcntl(fd, F_SETFL, flags);
+    return connected;
+}
+
+} // anonymous namespace
+
+// RedisReply
+
+std::map<std::string, std::string> RedisReply::asHash() const {
+    std::map<std::string, std::string> hash;
+    if (type != Type::ARRAY) {
+        return hash;
+    }
+    for (size_t i = 0; i + 1 < elements.size(); i += 2) {
+        hash[elements[i].str] = elements[i + 1].str;
+    }
+    return hash;
+}
+
+// RedisConfig
+
+RedisConfig RedisConfig::fromEnvironment(const std::string& default_host,
+                                         const std::string& fallback_container) {
+    RedisConfig config;
+    const char* host = std::getenv("REDIS_HOST");
+    const char* port = std::getenv("REDIS_PORT");
+
+    config.host = (host && *host) ? host : default_host;
+    if (port && *port) {
+        int value = std::atoi(port);
+        if (value > 0) {
+            config.port = value;
+        }
+    }
+    config.fallback_container = fallback_container;
+    return config;
+}
+
+// RedisConnection
+
+RedisConnection::RedisConnection(const RedisConfig& config, int db_id)
+    : config_(config), db_id_(db_id), fd_(-1), rpos_(0) {
+}
+
+RedisConnection::~RedisConnection() {
+    close();
+}
+
+bool RedisConnection::connectSocket() {
+    if (!config_.host.empty() && config_.host[0] == '/') {
+        struct sockaddr_un addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, config_.host.c_str(), sizeof(addr.sun_path) - 1);
+
+        fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd_ < 0) {
+            return false;
+        }
+        if (!connectWithTimeout(fd_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr),
+                                config_.connect_timeout_ms)) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    struct addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    struct addrinfo* result = nullptr;
+    std::string port = std::to_string(config_.port);
+    if (getaddrinfo(config_.host.c_str(), port.c_str(), &hints, &result) != 0) {
+        return false;
+    }
+
+    for (struct addrinfo* ai = result; ai != nullptr; ai = ai->ai_next) {
+        fd_ = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd_ < 0) {
+            continue;
+        }
+        if (connectWithTimeout(fd_, ai->ai_addr, ai->ai_addrlen, config_.connect_timeout_ms)) {
+            int one = 1;
+            setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            break;
+        }
+        close();
+    }
+    freeaddrinfo(result);
+    return fd_ >= 0;
+}
+
+bool RedisConnection::connect() {
+    close();
+    if (!connectSocket()) {
+        return false;
+    }
+    setSocketTimeouts(fd_, config_.io_timeout_ms);
+
+    if (db_id_ != 0) {
+        RedisReply reply;
+        if (!execute({"SELECT", std::to_string(db_id_)}, reply) || reply.isError()) {
+            close();
+            return false;
+        }
+    }
+    return true;
+}
+
+void RedisConnection::close() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    rbuf_.clear();
+    rpos_ = 0;
+}
+
+bool RedisConnection::isAlive() {
+    if (fd_ < 0) {
+        return false;
+    }
+    if (rpos_ < rbuf_.size()) {
+        // Unsolicited data means the stream is out of sync
+        return false;
+    }
+
+    char c;
+    ssize_t n = recv(fd_, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (n == 0) {
+        return false;
+    }
+    if (n < 0) {
+        return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+    }
+    return false;
+}
+
+bool RedisConnection::execute(const std::vector<std::string>& args, RedisReply& reply) {
+    return sendCommand(args) && readReply(reply);
+}
+
+bool RedisConnection::executePipeline(const std::vector<std::vector<std::string>>& commands,
+                                      std::vector<RedisReply>& replies) {
+    std::string request;
+    for (const auto& args : commands) {
+        RedisClient::encodeCommand(args, request);
+    }
+    if (!sendAll(request)) {
+        return false;
+    }
+
+    replies.assign(commands.size(), RedisReply());
+    for (auto& reply : replies) {
+        if (!readReply(reply)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RedisConnection::sendCommand(const std::vector<std::string>& args) {
+    std::string request;
+    RedisClient::encodeCommand(args, request);
+    return sendAll(request);
+}
+
+bool RedisConnection::sendAll(const std::string& data) {
+    if (fd_ < 0) {
+        return false;
+    }
+
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = ::send(fd_, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            close();
+            return false;
+        }
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool RedisConnection::fillBuffer() {
+    if (rpos_ > 0) {
+        rbuf_.erase(0, rpos_);
+        rpos_ = 0;
+    }
+
+    char buffer[16384];
+    ssize_t n;
+    do {
+        n = recv(fd_, buffer, sizeof(buffer), 0);
+    } while (n < 0 && errno == EINTR);
+
+    if (n <= 0) {
+        close();
+        return false;
+    }
+    rbuf_.append(buffer, static_cast<size_t>(n));
+    return true;
+}
+
+bool RedisConnection::readLine(std::string& line) {
+    while (true) {
+        size_t eol = rbuf_.find("\r\n", rpos_);
+        if (eol != std::string::npos) {
+            line.assign(rbuf_, rpos_, eol - rpos_);
+            rpos_ = eol + 2;
+            return true;
+        }
+        if (fd_ < 0 || !fillBuffer()) {
+            return false;
+        }
+    }
+}
+
+bool RedisConnection::readBytes(size_t count, std::string& out) {
+    // Payload is followed by CRLF
+    while (rbuf_.size() - rpos_ < count + 2) {
+        if (fd_ < 0 || !fillBuffer()) {
+            return false;
+        }
+    }
+    out.assign(rbuf_, rpos_, count);
+    rpos_ += count + 2;
+    return true;
+}
+
+bool RedisConnection::readReply(RedisReply& reply) {
+    std::string line;
+    if (!readLine(line) || line.empty()) {
+        close();
+        return false;
+    }
+
+    reply = RedisReply();
+    const char prefix = line[0];
+    const std::string payload = line.substr(1);
+
+    try {
+        switch (prefix) {
+            case '+':
+                reply.type = RedisReply::Type::STATUS;
+                reply.str = payload;
+                return true;
+            case '-':
+                reply.type = RedisReply::Type::ERROR;
+                reply.str = payload;
+                return true;
+            case ':':
+                reply.type = RedisReply::Type::INTEGER;
+                reply.integer = std::stoll(payload);
+                return true;
+            case '$': {
+                long long len = std::stoll(payload);
+                if (len < 0) {
+                    reply.type = RedisReply::Type::NIL;
+                    return true;
+                }
+                reply.type = RedisReply::Type::STRING;
+                return readBytes(static_cast<size_t>(len), reply.str);
+            }
+            case '*': {
+                long long count = std::stoll(payload);
+                if (count < 0) {
+                    reply.type = RedisReply::Type::NIL;
+                    return true;
+                }
+                reply.type = RedisReply::Type::ARRAY;
+                reply.elements.resize(static_cast<size_t>(count));
+                for (auto& element : reply.elements) {
+                    if (!readReply(element)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            default:
+                break;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Redis protocol error: " << e.what() << std::endl;
+    }
+
+    close();
+    return false;
+}
+
+// RedisClient
+
+RedisClient::RedisClient(const RedisConfig& config)
+    : config_(config), fallback_count_(0) {
+}
+
+RedisClient::~RedisClient() = default;
+
+RedisClient::Channel& RedisClient::channel(int db_id) {
+    std::lock_guard<std::mutex> lock(channels_mutex_);
+    auto& ch = channels_[db_id];
+    if (!ch) {
+        ch.reset(new Channel());
+        ch->connection.reset(new RedisConnection(config_, db_id));
+    }
+    return *ch;
+}
+
+bool RedisClient::ensureConnected(Channel& ch) {
+    if (ch.connection->isAlive()) {
+        return true;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (ch.backoff_ms > 0 && now < ch.retry_at) {
+        return false;
+    }
+
+    if (ch.connection->connect()) {
+        ch.backoff_ms = 0;
+        return true;
+    }
+
+    ch.backoff_ms = ch.backoff_ms == 0 ? INITIAL_BACKOFF_MS
+                                       : std::min(ch.backoff_ms * 2, MAX_BACKOFF_MS);
+    ch.retry_at = now + std::chrono::milliseconds(ch.backoff_ms);
+    return false;
+}
+
+bool RedisClient::command(int db_id, const std::vector<std::string>& args, RedisReply& reply) {
+    if (args.empty()) {
+        return false;
+    }
+    CliCacheInvalidator invalidate(args);
+
+    Channel& ch = channel(db_id);
+    {
+        std::lock_guard<std::mutex> lock(ch.mutex);
+        if (ensureConnected(ch)) {
+            // A command that fails after it was sent is not replayed, it may have been applied
+            if (!ch.connection->execute(args, reply)) {
+                return false;
+            }
+            return !reply.isError();
+        }
+    }
+
+    if (!config_.shell_fallback) {
+        return false;
+    }
+
+    std::string output;
+    bool ok = shellCommand(db_id, args, output);
+    reply = replyFromShellOutput(output);
+    if (!ok && !reply.isError()) {
+        reply.type = RedisReply::Type::ERROR;
+        reply.str = output;
+    }
+    return ok && !reply.isError();
+}
+
+bool RedisClient::commandLine(int db_id, const std::string& command_line, std::string& output) {
+    std::vector<std::string> args = splitCommandLine(command_line);
+    output.clear();
+    if (args.empty()) {
+        return false;
+    }
+    CliCacheInvalidator invalidate(args);
+
+    Channel& ch = channel(db_id);
+    {
+        std::lock_guard<std::mutex> lock(ch.mutex);
+        if (ensureConnected(ch)) {
+            RedisReply reply;
+            if (!ch.connection->execute(args, reply)) {
+                return false;
+            }
+            output = formatReply(reply);
+            return !reply.isError();
+        }
+    }
+
+    if (!config_.shell_fallback) {
+        return false;
+    }
+    return shellCommand(db_id, args, output);
+}
+
+bool RedisClient::pipeline(int db_id, const std::vector<std::vector<std::string>>& commands,
+                           std::vector<RedisReply>& replies) {
+    replies.clear();
+    if (commands.empty()) {
+        return true;
+    }
+    CliCacheInvalidator invalidate(commands);
+
+    Channel& ch = channel(db_id);
+    {
+        std::lock_guard<std::mutex> lock(ch.mutex);
+        if (ensureConnected(ch)) {
+            return ch.connection->executePipeline(commands, replies);
+        }
+    }
+
+    if (!config_.shell_fallback) {
+        return false;
+    }
+
+    // Without a socket every command costs a process spawn
+    replies.reserve(commands.size());
+    for (const auto& args : commands) {
+        std::string output;
+        bool ok = shellCommand(db_id, args, output);
+        RedisReply reply = replyFromShellOutput(output);
+        if (!ok && !reply.isError()) {
+            reply.type = RedisReply::Type::ERROR;
+            reply.str = output;
+        }
+        replies.push_back(reply);
+    }
+    return true;
+}
+
+bool RedisClient::transaction(int db_id, const std::vector<std::vector<std::string>>& commands,
+                              std::vector<RedisReply>& replies) {
+    replies.clear();
+    if (commands.empty()) {
+        return true;
+    }
+    CliCacheInvalidator invalidate(commands);
+
+    std::vector<std::vector<std::string>> batch;
+    batch.reserve(commands.size() + 2);
+    batch.push_back({"MULTI"});
+    batch.insert(batch.end(), commands.begin(), commands.end());
+    batch.push_back({"EXEC"});
+
+    // MULTI state lives on one connection, so there is no redis-cli fallback
+    std::vector<RedisReply> raw;
+    Channel& ch = channel(db_id);
+    {
+        std::lock_guard<std::mutex> lock(ch.mutex);
+        if (!ensureConnected(ch) || !ch.connection->executePipeline(batch, raw)) {
+            return false;
+        }
+    }
+    if (raw.size() != batch.size() || raw.back().type != RedisReply::Type::ARRAY) {
+        // EXECABORT: a command was rejected while queueing and nothing ran
+        if (!raw.empty()) {
+            replies.push_back(raw.back());
+        }
+        return false;
+    }
+    replies = std::move(raw.back().elements);
+    return true;
+}
+
+bool RedisClient::scanKeys(int db_id, const std::string& pattern, std::vector<std::string>& keys,
+                           size_t count_hint) {
+    keys.clear();
+    std::string cursor = "0";
+    do {
+        RedisReply reply;
+        if (!command(db_id, {"SCAN", cursor, "MATCH", pattern, "COUNT", std::to_string(count_hint)}, reply)
+            || reply.type != RedisReply::Type::ARRAY || reply.elements.empty()) {
+            return false;
+        }
+
+        cursor = reply.elements[0].str;
+        if (reply.elements.size() == 2 && reply.elements[1].type == RedisReply::Type::ARRAY) {
+            for (const auto& key : reply.elements[1].elements) {
+                keys.push_back(key.str);
+            }
+        } else {
+            // Shell fallback flattens the reply into cursor followed by keys
+            for (size_t i = 1; i < reply.elements.size(); ++i) {
+                if (!reply.elements[i].str.empty()) {
+                    keys.push_back(reply.elements[i].str);
+                }
+            }
+        }
+    } while (cursor != "0" && !cursor.empty());
+
+    // SCAN may return a key more than once
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    return true;
+}
+
+bool RedisClient::get(int db_id, const std::string& key, std::string& value) {
+    RedisReply reply;
+    if (!command(db_id, {"GET", key}, reply)) {
+        return false;
+    }
+    value = reply.str;
+    return true;
+}
+
+bool RedisClient::set(int db_id, const std::string& key, const std::string& value) {
+    RedisReply reply;
+    return command(db_id, {"SET", key, value}, reply);
+}
+
+bool RedisClient::setex(int db_id, const std::string& key, int ttl_seconds, const std::string& value) {
+    RedisReply reply;
+    return command(db_id, {"SETEX", key, std::to_string(ttl_seconds), value}, reply);
+}
+
+bool RedisClient::hget(int db_id, const std::string& key, const std::string& field, std::string& value) {
+    RedisReply reply;
+    if (!command(db_id, {"HGET", key, field}, reply)) {
+        return false;
+    }
+    value = reply.str;
+    return true;
+}
+
+bool RedisClient::hset(int db_id, const std::string& key, const std::string& field,
+                       const std::string& value) {
+    RedisReply reply;
+    return command(db_id, {"HSET", key, field, value}, reply);
+}
+
+bool RedisClient::del(int db_id, const std::string& key) {
+    RedisReply reply;
+    return command(db_id, {"DEL", key}, reply);
+}
+
+bool RedisClient::shellCommand(int db_id, const std::vector<std::string>& args, std::string& output) {
+    std::ostringstream cmd;
+    if (!config_.fallback_container.empty()) {
+        cmd << "docker exec " << config_.fallback_container << " redis-cli";
+    } else {
+        cmd << "redis-cli -h " << shellQuote(config_.host) << " -p " << config_.port;
+    }
+    cmd << " -n " << db_id;
+    for (const auto& arg : args) {
+        cmd << " " << shellQuote(arg);
+    }
+    cmd << " 2>&1";
+
+    fallback_count_++;
+
+    output.clear();
+    FILE* pipe = popen(cmd.str().c_str(), "r");
+    if (!pipe) {
+        return false;
+    }
+
+    char buffer[1024];
+    while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+        output += buffer;
+    }
+    return pclose(pipe) == 0;
+}
+
+RedisReply RedisClient::replyFromShellOutput(const std::string& output) {
+    // Best effort: redis-cli --raw drops type information
+    RedisReply reply;
+    std::vector<std::string> lines;
+    std::istringstream stream(output);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        lines.push_back(line);
+    }
+
+    if (lines.empty()) {
+        return reply;
+    }
+    if (lines.size() == 1) {
+        const std::string& value = lines.front();
+        if (value.compare(0, 4, "ERR ") == 0 || value.compare(0, 9, "WRONGTYPE") == 0) {
+            reply.type = RedisReply::Type::ERROR;
+        } else {
+            reply.type = RedisReply::Type::STRING;
+        }
+        reply.str = value;
+        return reply;
+    }
+
+    reply.type = RedisReply::Type::ARRAY;
+    for (const auto& value : lines) {
+        RedisReply element;
+        element.type = RedisReply::Type::STRING;
+        element.str = value;
+        reply.elements.push_back(element);
+    }
+    return reply;
+}
+
+std::vector<std::string> RedisClient::splitCommandLine(const std::string& command_line) {
+    std::vector<std::string> args;
+    std::string current;
+    bool in_token = false;
+    char quote = 0;
+
+    for (size_t i = 0; i < command_line.size(); ++i) {
+        char c = command_line[i];
+        if (quote) {
+            if (c == quote) {
+                quote = 0;
+            } else if (c == '\\' && quote == '"' && i + 1 < command_line.size()) {
+                current += command_line[++i];
+            } else {
+                current += c;
+            }
+        } else if (c == '\'' || c == '"') {
+            quote = c;
+            in_token = true;
+        } else if (c == ' ' || c == '\t' || c == '\n') {
+            if (in_token) {
+                args.push_back(current);
+                current.clear();
+                in_token = false;
+            }
+        } else {
+            current += c;
+            in_token = true;
+        }
+    }
+    if (in_token) {
+        args.push_back(current);
+    }
+    return args;
+}
+
+std::string RedisClient::formatReply(const RedisReply& reply) {
+    switch (reply.type) {
+        case RedisReply::Type::NIL:
+            return "\n";
+        case RedisReply::Type::INTEGER:
+            return std::to_string(reply.integer) + "\n";
+        case RedisReply::Type::ARRAY: {
+            std::string out;
+            for (const auto& element : reply.elements) {
+                out += formatReply(element);
+            }
+            return out;
+        }
+        default:
+            return reply.str + "\n";
+    }
+}
+
+void RedisClient::encodeCommand(const std::vector<std::string>& args, std::string& out) {
+    out += "*" + std::to_string(args.size()) + "\r\n";
+    for (const auto& arg : args) {
+        out += "$" + std::to_string(arg.size()) + "\r\n";
+        out += arg;
+        out += "\r\n";
+    }
+}
+
+// RedisSubscriber
+
+RedisSubscriber::RedisSubscriber(const RedisConfig& config)
+    : config_(config) {
+    wake_pipe_[0] = -1;
+    wake_pipe_[1] = -1;
+    if (pipe2(wake_pipe_, O_NONBLOCK | O_CLOEXEC) != 0) {
+        std::cerr << "Failed to create subscriber wakeup pipe: " << std::strerror(errno) << std::endl;
+    }
+}
+
+RedisSubscriber::~RedisSubscriber() {
+    close();
+    for (int& fd : wake_pipe_) {
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+}
+
+void RedisSubscriber::close() {
+    if (connection_) {
+        connection_->close();
+    }
+}
+
+bool RedisSubscriber::psubscribe(const std::vector<std::string>& patterns) {
+    // Pub/sub channels are global, so the connection never selects a database
+    connection_.reset(new RedisConnection(config_, 0));
+    if (!connection_->connect()) {
+        return false;
+    }
+
+    std::vector<std::string> args;
+    args.reserve(patterns.size() + 1);
+    args.push_back("PSUBSCRIBE");
+    args.insert(args.end(), patterns.begin(), patterns.end());
+    if (!connection_->sendCommand(args)) {
+        return false;
+    }
+
+    // One confirmation per pattern
+    for (size_t i = 0; i < patterns.size(); ++i) {
+        RedisReply reply;
+        if (!connection_->readReply(reply) || reply.type != RedisReply::Type::ARRAY ||
+            reply.elements.empty() || reply.elements[0].str != "psubscribe") {
+            connection_->close();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RedisSubscriber::waitReadable(int timeout_ms, bool& readable) {
+    struct pollfd pfds[2];
+    int nfds = 0;
+    int conn_index = -1;
+
+    if (wake_pipe_[0] >= 0) {
+        pfds[nfds].fd = wake_pipe_[0];
+        pfds[nfds].events = POLLIN;
+        pfds[nfds].revents = 0;
+        nfds++;
+    }
+    if (isConnected()) {
+        conn_index = nfds;
+        pfds[nfds].fd = connection_->fd();
+        pfds[nfds].events = POLLIN;
+        pfds[nfds].revents = 0;
+        nfds++;
+    }
+
+    readable = false;
+    int rc;
+    do {
+        rc = poll(pfds, nfds, timeout_ms);
+    } while (rc < 0 && errno == EINTR);
+    if (rc <= 0) {
+        return rc == 0;
+    }
+
+    if (wake_pipe_[0] >= 0 && (pfds[0].revents & POLLIN)) {
+        drainWakeups();
+        return false;
+    }
+    readable = conn_index >= 0 && pfds[conn_index].revents != 0;
+    return true;
+}
+
+void RedisSubscriber::drainWakeups() {
+    char buffer[64];
+    while (read(wake_pipe_[0], buffer, sizeof(buffer)) > 0) {
+    }
+}
+
+int RedisSubscriber::readMessages(std::vector<RedisMessage>& messages, int timeout_ms, size_t max_messages) {
+    if (!isConnected()) {
+        return -1;
+    }
+
+    if (!connection_->hasBufferedData()) {
+        bool readable = false;
+        if (!waitReadable(timeout_ms, readable) || !readable) {
+            return 0;
+        }
+    }
+
+    int count = 0;
+    do {
+        RedisReply reply;
+        if (!connection_->readReply(reply)) {
+            return -1;
+        }
+        if (reply.type == RedisReply::Type::ARRAY && reply.elements.size() == 4 &&
+            reply.elements[0].str == "pmessage") {
+            RedisMessage message;
+            message.pattern = reply.elements[1].str;
+            message.channel = reply.elements[2].str;
+            message.payload = reply.elements[3].str;
+            messages.push_back(std::move(message));
+            count++;
+        }
+
+        // Keep draining whatever is already available without blocking
+        if (!connection_->hasBufferedData()) {
+            bool readable = false;
+            if (!waitReadable(0, readable) || !readable) {
+                break;
+            }
+        }
+    } while (static_cast<size_t>(count) < max_messages);
+
+    return count;
+}
+
+bool RedisSubscriber::waitInterruptible(int timeout_ms) {
+    if (wake_pipe_[0] < 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+        return true;
+    }
+
+    struct pollfd pfd;
+    pfd.fd = wake_pipe_[0];
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    if (poll(&pfd, 1, timeout_ms) > 0) {
+        drainWakeups();
+        return false;
+    }
+    return true;
+}
+
+void RedisSubscriber::interrupt() {
+    if (wake_pipe_[1] >= 0) {
+        char c = 1;
+        ssize_t ignored = write(wake_pipe_[1], &c, 1);
+        (void)ignored;
+    }
+}
+
+bool RedisSubscriber::parseKeyspaceChannel(const std::string& channel, int& db_id, std::string& key) {
+    static const std::string prefix = "__keyspace@";
+    if (channel.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+
+    size_t db_end = channel.find("__:", prefix.size());
+    if (db_end == std::string::npos) {
+        return false;
+    }
+
+    try {
+        db_id = std::stoi(channel.substr(prefix.size(), db_end - prefix.size()));
+    } catch (const std::exception&) {
+        return false;
+    }
+    key = channel.substr(db_end + 3);
+    return true;
+}
+
+bool RedisSubscriber::enableKeyspaceEvents(RedisClient& client, int db_id) {
+    // Hash writes (h), DEL (g) and expiry (x) must all reach the keyspace channel (K);
+    // A covers all three. Keep whatever else is configured and add only what is missing.
+    RedisReply reply;
+    if (!client.command(db_id, {"CONFIG", "GET", "notify-keyspace-events"}, reply)) {
+        std::cerr << "Cannot read notify-keyspace-events: " << reply.str << std::endl;
+        return false;
+    }
+    std::string flags = reply.elements.size() == 2 ? reply.elements[1].str : "";
+    auto has = [&flags](char flag) { return flags.find(flag) != std::string::npos; };
+    std::string missing;
+    if (!has('K')) {
+        missing += 'K';
+    }
+    if (!has('A')) {
+        for (char flag : {'h', 'g', 'x'}) {
+            if (!has(flag)) {
+                missing += flag;
+            }
+        }
+    }
+    if (missing.empty()) {
+        return true;
+    }
+    if (!client.command(db_id, {"CONFIG", "SET", "notify-keyspace-events", flags + missing}, reply)) {
+        std::cerr << "Cannot enable keyspace notifications: " << reply.str << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,282 @@
+/**
+ * @file redis_client.h
+ * @brief SONiC Common Redis Client Header
+ *
+ * Persistent RESP client shared by the controllers, the BSP monitor and the
+ * SAI command processor. One socket is kept open per SONiC database; when the
+ * server cannot be reached the client falls back to running redis-cli.
+ */
+
+#ifndef SONIC_COMMON_REDIS_CLIENT_H
+#define SONIC_COMMON_REDIS_CLIENT_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace sonic {
+namespace common {
+
+/**
+ * @brief Decoded RESP reply
+ */
+struct RedisReply {
+    enum class Type {
+        NIL,
+        STATUS,
+        ERROR,
+        INTEGER,
+        STRING,
+        ARRAY
+    };
+
+    Type type = Type::NIL;
+    std::string str;                  ///< STATUS, ERROR and STRING payload
+    long long integer = 0;            ///< INTEGER payload
+    std::vector<RedisReply> elements; ///< ARRAY elements
+
+    bool isNil() const { return type == Type::NIL; }
+    bool isError() const { return type == Type::ERROR; }
+
+    /**
+     * @brief Interpret a flat field/value ARRAY (HGETALL) as a hash
+     */
+    std::map<std::string, std::string> asHash() const;
+};
+
+/**
+ * @brief Connection settings for RedisClient
+ */
+struct RedisConfig {
+    std::string host = "localhost";   ///< TCP host, or a unix socket path when it starts with '/'
+    int port = 6379;
+    int connect_timeout_ms = 500;
+    int io_timeout_ms = 2000;
+    bool shell_fallback = true;       ///< Run redis-cli when the socket is unavailable
+    std::string fallback_container;   ///< docker exec target for the fallback; empty runs redis-cli locally
+
+    /**
+     * @brief Build a config from REDIS_HOST / REDIS_PORT
+     * @param default_host Host used when REDIS_HOST is not set
+     * @param fallback_container Container for the redis-cli fallback
+     */
+    static RedisConfig fromEnvironment(const std::string& default_host,
+                                       const std::string& fallback_container = "");
+};
+
+/**
+ * @brief Single RESP connection bound to one database (not thread-safe)
+ */
+class RedisConnection {
+public:
+    RedisConnection(const RedisConfig& config, int db_id);
+    ~RedisConnection();
+
+    RedisConnection(const RedisConnection&) = delete;
+    RedisConnection& operator=(const RedisConnection&) = delete;
+
+    bool connect();
+    void close();
+    bool isConnected() const { return fd_ >= 0; }
+
+    /**
+     * @brief Check that the peer has not closed an idle connection
+     */
+    bool isAlive();
+
+    /**
+     * @brief Send one command and read its reply
+     * @return false on transport failure (the connection is closed)
+     */
+    bool execute(const std::vector<std::string>& args, RedisReply& reply);
+
+    /**
+     * @brief Write all commands in one batch, then read one reply per command
+     */
+    bool executePipeline(const std::vector<std::vector<std::string>>& commands,
+                         std::vector<RedisReply>& replies);
+
+    bool sendCommand(const std::vector<std::string>& args);
+    bool readReply(RedisReply& reply);
+
+    int fd() const { return fd_; }
+    bool hasBufferedData() const { return rpos_ < rbuf_.size(); }
+
+private:
+    bool sendAll(const std::string& data);
+    bool readLine(std::string& line);
+    bool readBytes(size_t count, std::string& out);
+    bool fillBuffer();
+    bool connectSocket();
+
+    RedisConfig config_;
+    int db_id_;
+    int fd_;
+    std::string rbuf_;
+    size_t rpos_;
+};
+
+/**
+ * @brief Thread-safe Redis client with one persistent connection per database
+ */
+class RedisClient {
+public:
+    explicit RedisClient(const RedisConfig& config);
+    ~RedisClient();
+
+    RedisClient(const RedisClient&) = delete;
+    RedisClient& operator=(const RedisClient&) = delete;
+
+    /**
+     * @brief Execute a command given as an argument vector
+     * @return true when a non-error reply was received
+     */
+    bool command(int db_id, const std::vector<std::string>& args, RedisReply& reply);
+
+    /**
+     * @brief Execute a redis-cli style command line ("HGET 'key' field")
+     * @param output Reply rendered the way `redis-cli --raw` prints it
+     */
+    bool commandLine(int db_id, const std::string& command_line, std::string& output);
+
+    /**
+     * @brief Send a batch of commands in a single round trip
+     * @param replies One reply per command, in order; error replies are kept in place
+     * @return false only on transport failure
+     */
+    bool pipeline(int db_id, const std::vector<std::vector<std::string>>& commands,
+                  std::vector<RedisReply>& replies);
+
+    /**
+     * @brief Run commands atomically as one MULTI ... EXEC pipeline
+     * @param replies One reply per command when EXEC ran; per-command errors are kept in place
+     * @return false if the batch was not executed (no socket, transport failure, EXECABORT)
+     */
+    bool transaction(int db_id, const std::vector<std::vector<std::string>>& commands,
+                     std::vector<RedisReply>& replies);
+
+    /**
+     * @brief Collect all keys matching pattern with SCAN (never KEYS)
+     */
+    bool scanKeys(int db_id, const std::string& pattern, std::vector<std::string>& keys,
+                  size_t count_hint = 1000);
+
+    // Convenience wrappers
+    bool get(int db_id, const std::string& key, std::string& value);
+    bool set(int db_id, const std::string& key, const std::string& value);
+    bool setex(int db_id, const std::string& key, int ttl_seconds, const std::string& value);
+    bool hget(int db_id, const std::string& key, const std::string& field, std::string& value);
+    bool hset(int db_id, const std::string& key, const std::string& field, const std::string& value);
+    bool del(int db_id, const std::string& key);
+
+    const RedisConfig& config() const { return config_; }
+    uint64_t fallbackCount() const { return fallback_count_.load(); }
+
+    static std::vector<std::string> splitCommandLine(const std::string& command_line);
+    static std::string formatReply(const RedisReply& reply);
+    static void encodeCommand(const std::vector<std::string>& args, std::string& out);
+
+private:
+    struct Channel {
+        std::mutex mutex;
+        std::unique_ptr<RedisConnection> connection;
+        std::chrono::steady_clock::time_point retry_at;
+        int backoff_ms = 0;
+    };
+
+    Channel& channel(int db_id);
+    bool ensureConnected(Channel& ch);
+    bool shellCommand(int db_id, const std::vector<std::string>& args, std::string& output);
+    static RedisReply replyFromShellOutput(const std::string& output);
+
+    RedisConfig config_;
+    std::mutex channels_mutex_;
+    std::map<int, std::unique_ptr<Channel>> channels_;
+    std::atomic<uint64_t> fallback_count_;
+};
+
+/**
+ * @brief Message delivered to a pattern subscription
+ */
+struct RedisMessage {
+    std::string pattern;
+    std::string channel;
+    std::string payload;
+};
+
+/**
+ * @brief Dedicated pub/sub connection (PSUBSCRIBE) with an interruptible wait
+ */
+class RedisSubscriber {
+public:
+    explicit RedisSubscriber(const RedisConfig& config);
+    ~RedisSubscriber();
+
+    RedisSubscriber(const RedisSubscriber&) = delete;
+    RedisSubscriber& operator=(const RedisSubscriber&) = delete;
+
+    /**
+     * @brief (Re)connect and subscribe to the given channel patterns
+     */
+    bool psubscribe(const std::vector<std::string>& patterns);
+
+    /**
+     * @brief Block until messages arrive, the timeout expires or interrupt() is called
+     * @param timeout_ms -1 waits forever
+     * @return Number of messages appended, 0 on timeout/interrupt, -1 when the connection is lost
+     */
+    int readMessages(std::vector<RedisMessage>& messages, int timeout_ms, size_t max_messages = 1024);
+
+    /**
+     * @brief Sleep that returns early (false) when interrupt() is called
+     */
+    bool waitInterruptible(int timeout_ms);
+
+    /**
+     * @brief Wake up a thread blocked in readMessages or waitInterruptible
+     */
+    void interrupt();
+
+    bool isConnected() const { return connection_ && connection_->isConnected(); }
+    void close();
+
+    /**
+     * @brief Socket to watch for readability in an external event loop (-1 when disconnected)
+     */
+    int fd() const { return isConnected() ? connection_->fd() : -1; }
+
+    /**
+     * @brief Messages already read from the socket but not yet returned; poll would not report them
+     */
+    bool hasBufferedData() const { return isConnected() && connection_->hasBufferedData(); }
+
+    /**
+     * @brief Split "__keyspace@<db>__:<key>" into its database and key
+     */
+    static bool parseKeyspaceChannel(const std::string& channel, int& db_id, std::string& key);
+
+    /**
+     * @brief Make sure hash writes, DEL and expiry all raise keyspace notifications, adding only missing flags
+     * @param client Connection used for CONFIG GET/SET
+     * @param db_id Database the CONFIG commands are sent to (server-wide setting)
+     */
+    static bool enableKeyspaceEvents(RedisClient& client, int db_id = 0);
+
+private:
+    bool waitReadable(int timeout_ms, bool& readable);
+    void drainWakeups();
+
+    RedisConfig config_;
+    std::unique_ptr<RedisConnection> connection_;
+    int wake_pipe_[2];
+};
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_REDIS_CLIENT_H
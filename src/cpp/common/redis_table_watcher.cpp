@@ -0,0 +1,160 @@
+/**
+ * @file redis_table_watcher.cpp
+ * @brief SONiC Common Redis Table Watcher Implementation
+ */
+
+#include "redis_table_watcher.h"
+#include <iostream>
+#include <set>
+
+namespace sonic {
+namespace common {
+
+namespace {
+
+RedisConfig withoutFallback(RedisConfig config) {
+    // Keyspace notifications need a real socket; redis-cli cannot deliver them
+    config.shell_fallback = false;
+    return config;
+}
+
+} // anonymous namespace
+
+RedisTableWatcher::RedisTableWatcher(const RedisConfig& config, const std::vector<WatchedTable>& tables)
+    : tables_(tables), subscriber_(config), client_(withoutFallback(config)) {
+}
+
+bool RedisTableWatcher::subscribe() {
+    std::set<int> databases;
+    std::vector<std::string> patterns;
+    for (const auto& table : tables_) {
+        databases.insert(table.db_id);
+        patterns.push_back("__keyspace@" + std::to_string(table.db_id) + "__:" + table.prefix + "*");
+    }
+    if (!databases.empty()) {
+        RedisSubscriber::enableKeyspaceEvents(client_, *databases.begin());
+    }
+    return subscriber_.psubscribe(patterns);
+}
+
+bool RedisTableWatcher::tableForKey(int db_id, const std::string& key, size_t& table) const {
+    for (size_t i = 0; i < tables_.size(); ++i) {
+        if (tables_[i].db_id == db_id && key.compare(0, tables_[i].prefix.size(), tables_[i].prefix) == 0) {
+            table = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool RedisTableWatcher::snapshot(std::vector<TableChange>& entries) {
+    std::vector<std::pair<size_t, std::string>> keys;
+    for (size_t i = 0; i < tables_.size(); ++i) {
+        std::vector<std::string> table_keys;
+        if (!client_.scanKeys(tables_[i].db_id, tables_[i].prefix + "*", table_keys)) {
+            std::cerr << "Failed to scan " << tables_[i].prefix << "* in db " << tables_[i].db_id << std::endl;
+            return false;
+        }
+        for (auto& key : table_keys) {
+            keys.emplace_back(i, std::move(key));
+        }
+    }
+
+    std::vector<TableChange> fetched;
+    if (!fetch(keys, fetched)) {
+        return false;
+    }
+    for (auto& entry : fetched) {
+        // A key removed between SCAN and HGETALL is simply absent from the snapshot
+        if (!entry.deleted) {
+            entries.push_back(std::move(entry));
+        }
+    }
+    return true;
+}
+
+bool RedisTableWatcher::waitForChanges(std::vector<TableChange>& changes, int timeout_ms) {
+    std::vector<RedisMessage> messages;
+    if (subscriber_.readMessages(messages, timeout_ms) < 0) {
+        return false;
+    }
+
+    // Coalesce repeated notifications for the same key, keeping arrival order
+    std::vector<std::pair<size_t, std::string>> keys;
+    std::map<std::pair<size_t, std::string>, bool> deleted;
+    for (const auto& message : messages) {
+        int db_id = 0;
+        std::string key;
+        size_t table = 0;
+        if (!RedisSubscriber::parseKeyspaceChannel(message.channel, db_id, key) ||
+            !tableForKey(db_id, key, table)) {
+            continue;
+        }
+        auto id = std::make_pair(table, key);
+        if (deleted.find(id) == deleted.end()) {
+            keys.push_back(id);
+        }
+        deleted[id] = (message.payload == "del" || message.payload == "expired");
+    }
+
+    std::vector<std::pair<size_t, std::string>> changed;
+    for (const auto& id : keys) {
+        if (!deleted[id]) {
+            changed.push_back(id);
+        }
+    }
+    std::vector<TableChange> fetched;
+    if (!fetch(changed, fetched)) {
+        // The notifications are consumed, so the changes are lost; drop the subscription
+        // so the caller resubscribes and reloads the tables
+        std::cerr << "Failed to read changed keys, dropping the subscription" << std::endl;
+        subscriber_.close();
+        return false;
+    }
+
+    size_t fetched_index = 0;
+    for (const auto& id : keys) {
+        if (deleted[id]) {
+            TableChange change;
+            change.table = id.first;
+            change.key = id.second.substr(tables_[id.first].prefix.size());
+            change.deleted = true;
+            changes.push_back(std::move(change));
+        } else {
+            changes.push_back(std::move(fetched[fetched_index++]));
+        }
+    }
+    return true;
+}
+
+bool RedisTableWatcher::fetch(const std::vector<std::pair<size_t, std::string>>& keys,
+                              std::vector<TableChange>& out) {
+    // One pipeline per database, replies matched back to keys in order
+    std::map<int, std::vector<std::vector<std::string>>> commands;
+    for (const auto& id : keys) {
+        commands[tables_[id.first].db_id].push_back({"HGETALL", id.second});
+    }
+
+    std::map<int, std::vector<RedisReply>> replies;
+    for (const auto& db_commands : commands) {
+        if (!client_.pipeline(db_commands.first, db_commands.second, replies[db_commands.first])) {
+            return false;
+        }
+    }
+
+    std::map<int, size_t> next_reply;
+    for (const auto& id : keys) {
+        int db_id = tables_[id.first].db_id;
+        TableChange change;
+        change.table = id.first;
+        change.key = id.second.substr(tables_[id.first].prefix.size());
+        change.fields = replies[db_id][next_reply[db_id]++].asHash();
+        // HDEL of the last field removes the key
+        change.deleted = change.fields.empty();
+        out.push_back(std::move(change));
+    }
+    return true;
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,95 @@
+/**
+ * @file redis_table_watcher.h
+ * @brief SONiC Common Redis Table Watcher Header
+ *
+ * Keeps an in-memory copy of SONiC tables current without polling: one SCAN
+ * based snapshot at startup, then keyspace notifications followed by a
+ * pipelined HGETALL of only the keys that changed.
+ */
+
+#ifndef SONIC_COMMON_REDIS_TABLE_WATCHER_H
+#define SONIC_COMMON_REDIS_TABLE_WATCHER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include "redis_client.h"
+
+namespace sonic {
+namespace common {
+
+/**
+ * @brief Table to watch: all keys "<prefix>*" in one database
+ */
+struct WatchedTable {
+    int db_id;
+    std::string prefix;   ///< Including the separator, e.g. "VLAN|" or "PORT_TABLE:"
+};
+
+/**
+ * @brief Current contents of one key, or its removal
+ */
+struct TableChange {
+    size_t table;         ///< Index into the watcher's table list
+    std::string key;      ///< Key with the table prefix stripped
+    bool deleted;
+    std::map<std::string, std::string> fields;
+};
+
+/**
+ * @brief Snapshot + change feed for a set of hash tables (not thread-safe)
+ */
+class RedisTableWatcher {
+public:
+    RedisTableWatcher(const RedisConfig& config, const std::vector<WatchedTable>& tables);
+
+    RedisTableWatcher(const RedisTableWatcher&) = delete;
+    RedisTableWatcher& operator=(const RedisTableWatcher&) = delete;
+
+    /**
+     * @brief (Re)subscribe to keyspace notifications for every table
+     */
+    bool subscribe();
+    bool isSubscribed() const { return subscriber_.isConnected(); }
+
+    /**
+     * @brief Notification socket for an external event loop; call waitForChanges(changes, 0)
+     * when it is readable or hasBufferedData() is true
+     */
+    int fd() const { return subscriber_.fd(); }
+    bool hasBufferedData() const { return subscriber_.hasBufferedData(); }
+
+    /**
+     * @brief Read every key of every table with SCAN and pipelined HGETALL
+     * @param entries Receives one non-deleted TableChange per key
+     */
+    bool snapshot(std::vector<TableChange>& entries);
+
+    /**
+     * @brief Block until changes arrive, timeout_ms expires (-1 = forever) or interrupt() is called
+     * @return false when the subscription was lost, or dropped because changed keys could not
+     *         be read, and subscribe() must be called again
+     */
+    bool waitForChanges(std::vector<TableChange>& changes, int timeout_ms);
+
+    /**
+     * @brief Interruptible sleep used between resubscribe attempts
+     */
+    bool waitInterruptible(int timeout_ms) { return subscriber_.waitInterruptible(timeout_ms); }
+    void interrupt() { subscriber_.interrupt(); }
+
+    const std::vector<WatchedTable>& tables() const { return tables_; }
+
+private:
+    bool tableForKey(int db_id, const std::string& key, size_t& table) const;
+    bool fetch(const std::vector<std::pair<size_t, std::string>>& keys, std::vector<TableChange>& out);
+
+    std::vector<WatchedTable> tables_;
+    RedisSubscriber subscriber_;
+    RedisClient client_;
+};
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_REDIS_TABLE_WATCHER_H
@@ -0,0 +1,320 @@
+/**
+ * @file route_table.h
+ * @brief SONiC Common Longest-Prefix-Match Route Table
+ *
+ * Path-compressed binary (Patricia) trie keyed by IpPrefix, one trie per
+ * address family. Insert, erase, exact find and longest-prefix match all walk
+ * at most prefix-length nodes. Nodes and values live in flat vectors indexed
+ * by 32-bit offsets and are recycled through free lists, so a full table does
+ * not pay one heap allocation per prefix.
+ */
+
+#ifndef SONIC_COMMON_ROUTE_TABLE_H
+#define SONIC_COMMON_ROUTE_TABLE_H
+
+#include "ip_prefix.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+namespace sonic {
+namespace common {
+
+/**
+ * @brief IPv4/IPv6 route table with ordered iteration (not thread-safe)
+ */
+template <typename T>
+class RouteTable {
+public:
+    RouteTable() { clear(); }
+
+    /**
+     * @brief Add or replace the value for prefix
+     * @return true if the prefix was new
+     */
+    bool insert(const IpPrefix& prefix, T value) {
+        uint128 key = IpPrefix::mask(prefix.address, prefix.length);
+        uint8_t length = prefix.length;
+        uint32_t cur = roots_[prefix.v6];
+
+        while (true) {
+            if (nodes_[cur].length == length) {
+                // Every node on the walk is a prefix of key, so this is the exact node
+                if (nodes_[cur].value != NONE) {
+                    values_[nodes_[cur].value] = std::move(value);
+                    return false;
+                }
+                nodes_[cur].value = allocValue(std::move(value));
+                return true;
+            }
+
+            int branch = bitAt(key, nodes_[cur].length);
+            uint32_t child = nodes_[cur].child[branch];
+            if (child == NONE) {
+                uint32_t leaf = allocNode(key, length, allocValue(std::move(value)));
+                nodes_[cur].child[branch] = leaf;
+                return true;
+            }
+
+            uint8_t child_length = nodes_[child].length;
+            uint8_t common = commonLength(key, nodes_[child].key, length < child_length ? length : child_length);
+            if (common == child_length) {
+                cur = child;
+                continue;
+            }
+
+            if (common == length) {
+                // New prefix sits between cur and child
+                uint32_t node = allocNode(key, length, allocValue(std::move(value)));
+                nodes_[node].child[bitAt(nodes_[child].key, length)] = child;
+                nodes_[cur].child[branch] = node;
+                return true;
+            }
+
+            // Diverge below cur: glue node at the common prefix holds both
+            uint128 child_key = nodes_[child].key;
+            uint32_t glue = allocNode(IpPrefix::mask(key, common), common, NONE);
+            uint32_t leaf = allocNode(key, length, allocValue(std::move(value)));
+            nodes_[glue].child[bitAt(key, common)] = leaf;
+            nodes_[glue].child[bitAt(child_key, common)] = child;
+            nodes_[cur].child[branch] = glue;
+            return true;
+        }
+    }
+
+    /**
+     * @brief Remove prefix; glue nodes left with one child are spliced out
+     * @return false if the prefix was not present
+     */
+    bool erase(const IpPrefix& prefix) {
+        uint32_t path[130];
+        size_t depth = 0;
+        uint32_t node = findNode(prefix, path, depth);
+        if (node == NONE || nodes_[node].value == NONE) {
+            return false;
+        }
+
+        freeValue(nodes_[node].value);
+        nodes_[node].value = NONE;
+        if (depth == 1) {
+            return true;    // Family root stays
+        }
+
+        uint32_t parent = path[depth - 2];
+        Node& target = nodes_[node];
+        if (target.child[0] != NONE && target.child[1] != NONE) {
+            return true;    // Still needed as a glue node
+        }
+
+        uint32_t only_child = target.child[0] != NONE ? target.child[0] : target.child[1];
+        replaceChild(parent, node, only_child);
+        freeNode(node);
+
+        // A valueless parent with a single child no longer branches
+        if (only_child == NONE && depth >= 3 && nodes_[parent].value == NONE) {
+            Node& glue = nodes_[parent];
+            uint32_t remaining = glue.child[0] != NONE ? glue.child[0] : glue.child[1];
+            if (glue.child[0] == NONE || glue.child[1] == NONE) {
+                replaceChild(path[depth - 3], parent, remaining);
+                freeNode(parent);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Exact-match lookup
+     */
+    const T* find(const IpPrefix& prefix) const {
+        uint32_t path[130];
+        size_t depth = 0;
+        uint32_t node = findNode(prefix, path, depth);
+        return (node != NONE && nodes_[node].value != NONE) ? &values_[nodes_[node].value] : nullptr;
+    }
+
+    T* find(const IpPrefix& prefix) {
+        return const_cast<T*>(static_cast<const RouteTable*>(this)->find(prefix));
+    }
+
+    /**
+     * @brief Longest-prefix match for an address (or the most specific cover of a prefix)
+     * @param matched Receives the matching prefix when not null
+     */
+    const T* lookup(const IpPrefix& address, IpPrefix* matched = nullptr) const {
+        uint128 key = IpPrefix::mask(address.address, address.length);
+        uint32_t cur = roots_[address.v6];
+        uint32_t best = NONE;
+
+        while (true) {
+            const Node& n = nodes_[cur];
+            if (n.value != NONE) {
+                best = cur;
+            }
+            if (n.length >= address.length) {
+                break;
+            }
+            uint32_t child = n.child[bitAt(key, n.length)];
+            if (child == NONE || nodes_[child].length > address.length ||
+                commonLength(key, nodes_[child].key, nodes_[child].length) < nodes_[child].length) {
+                break;
+            }
+            cur = child;
+        }
+
+        if (best == NONE) {
+            return nullptr;
+        }
+        if (matched) {
+            matched->address = nodes_[best].key;
+            matched->length = nodes_[best].length;
+            matched->v6 = address.v6;
+        }
+        return &values_[nodes_[best].value];
+    }
+
+    /**
+     * @brief Visit every route as fn(const IpPrefix&, const T&); IPv4 first, then by address, shorter first
+     */
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        std::vector<uint32_t> stack;
+        for (int family = 0; family < 2; ++family) {
+            stack.push_back(roots_[family]);
+            while (!stack.empty()) {
+                uint32_t cur = stack.back();
+                stack.pop_back();
+                const Node& n = nodes_[cur];
+                if (n.value != NONE) {
+                    IpPrefix prefix;
+                    prefix.address = n.key;
+                    prefix.length = n.length;
+                    prefix.v6 = (family == 1);
+                    fn(static_cast<const IpPrefix&>(prefix), static_cast<const T&>(values_[n.value]));
+                }
+                if (n.child[1] != NONE) {
+                    stack.push_back(n.child[1]);
+                }
+                if (n.child[0] != NONE) {
+                    stack.push_back(n.child[0]);
+                }
+            }
+        }
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * @brief Live trie nodes, including glue and the two family roots
+     */
+    size_t nodeCount() const { return nodes_.size() - free_nodes_.size(); }
+
+    void clear() {
+        nodes_.clear();
+        values_.clear();
+        free_nodes_.clear();
+        free_values_.clear();
+        size_ = 0;
+        roots_[0] = allocNode(0, 0, NONE);
+        roots_[1] = allocNode(0, 0, NONE);
+    }
+
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    struct Node {
+        uint128 key;
+        uint32_t child[2];
+        uint32_t value;     // Index into values_, NONE for glue nodes
+        uint8_t length;
+    };
+
+    static int bitAt(uint128 key, uint8_t index) {
+        return static_cast<int>((key >> (127 - index)) & 1);
+    }
+
+    // Number of leading bits a and b share, capped at limit
+    static uint8_t commonLength(uint128 a, uint128 b, uint8_t limit) {
+        uint128 diff = a ^ b;
+        uint64_t high = static_cast<uint64_t>(diff >> 64);
+        uint64_t low = static_cast<uint64_t>(diff);
+        unsigned common = high ? __builtin_clzll(high) : (low ? 64 + __builtin_clzll(low) : 128);
+        return static_cast<uint8_t>(common < limit ? common : limit);
+    }
+
+    uint32_t findNode(const IpPrefix& prefix, uint32_t* path, size_t& depth) const {
+        uint128 key = IpPrefix::mask(prefix.address, prefix.length);
+        uint32_t cur = roots_[prefix.v6];
+        depth = 0;
+        while (true) {
+            path[depth++] = cur;
+            const Node& n = nodes_[cur];
+            if (n.length == prefix.length) {
+                return cur;
+            }
+            uint32_t child = n.child[bitAt(key, n.length)];
+            if (child == NONE || nodes_[child].length > prefix.length ||
+                commonLength(key, nodes_[child].key, nodes_[child].length) < nodes_[child].length) {
+                return NONE;
+            }
+            cur = child;
+        }
+    }
+
+    void replaceChild(uint32_t parent, uint32_t old_child, uint32_t new_child) {
+        Node& n = nodes_[parent];
+        n.child[n.child[0] == old_child ? 0 : 1] = new_child;
+    }
+
+    uint32_t allocNode(uint128 key, uint8_t length, uint32_t value) {
+        Node node;
+        node.key = key;
+        node.length = length;
+        node.value = value;
+        node.child[0] = NONE;
+        node.child[1] = NONE;
+        if (!free_nodes_.empty()) {
+            uint32_t index = free_nodes_.back();
+            free_nodes_.pop_back();
+            nodes_[index] = node;
+            return index;
+        }
+        nodes_.push_back(node);
+        return static_cast<uint32_t>(nodes_.size() - 1);
+    }
+
+    void freeNode(uint32_t index) {
+        free_nodes_.push_back(index);
+    }
+
+    uint32_t allocValue(T value) {
+        size_++;
+        if (!free_values_.empty()) {
+            uint32_t index = free_values_.back();
+            free_values_.pop_back();
+            values_[index] = std::move(value);
+            return index;
+        }
+        values_.push_back(std::move(value));
+        return static_cast<uint32_t>(values_.size() - 1);
+    }
+
+    void freeValue(uint32_t index) {
+        size_--;
+        values_[index] = T();   // Release whatever the value owns
+        free_values_.push_back(index);
+    }
+
+    std::vector<Node> nodes_;
+    std::vector<T> values_;
+    std::vector<uint32_t> free_nodes_;
+    std::vector<uint32_t> free_values_;
+    uint32_t roots_[2];
+    size_t size_;
+};
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_ROUTE_TABLE_H
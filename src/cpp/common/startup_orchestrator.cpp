@@ -0,0 +1,144 @@
+/**
+ * @file startup_orchestrator.cpp
+ * @brief SONiC Common Startup Orchestrator Implementation
+ */
+
+#include "startup_orchestrator.h"
+#include "logger.h"
+#include "metrics.h"
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <future>
+#include <thread>
+
+namespace sonic {
+namespace common {
+
+namespace {
+
+bool validPhaseName(const std::string& name) {
+    if (name.empty()) {
+        return false;
+    }
+    for (char c : name) {
+        if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // anonymous namespace
+
+bool StartupOrchestrator::addPhase(const std::string& name, Phase phase, const std::vector<std::string>& depends_on) {
+    if (!validPhaseName(name) || !phase) {
+        SONIC_LOG_ERROR("STARTUP", "Invalid startup phase '" << name << "'");
+        return false;
+    }
+    PhaseSpec spec;
+    for (const auto& existing : phases_) {
+        if (existing.name == name) {
+            SONIC_LOG_ERROR("STARTUP", "Startup phase '" << name << "' registered twice");
+            return false;
+        }
+    }
+    // Dependencies must already be registered, which also rules out cycles
+    for (const auto& dep : depends_on) {
+        size_t index = 0;
+        while (index < phases_.size() && phases_[index].name != dep) {
+            ++index;
+        }
+        if (index == phases_.size()) {
+            SONIC_LOG_ERROR("STARTUP", "Startup phase '" << name << "' depends on unknown phase '" << dep << "'");
+            return false;
+        }
+        spec.depends_on.push_back(index);
+    }
+    spec.name = name;
+    spec.phase = std::move(phase);
+    phases_.push_back(std::move(spec));
+    return true;
+}
+
+bool StartupOrchestrator::run() {
+    const size_t count = phases_.size();
+    results_.assign(count, StartupPhaseResult());
+    std::vector<std::promise<bool>> done(count);
+    std::vector<std::shared_future<bool>> finished;
+    finished.reserve(count);
+    for (auto& promise : done) {
+        finished.push_back(promise.get_future().share());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        threads.emplace_back([this, i, start, &done, &finished]() {
+            const PhaseSpec& spec = phases_[i];
+            StartupPhaseResult& result = results_[i];
+            result.name = spec.name;
+
+            for (size_t dep : spec.depends_on) {
+                if (!finished[dep].get()) {
+                    result.skipped = true;
+                    result.error = "dependency '" + phases_[dep].name + "' failed";
+                }
+            }
+            if (!result.skipped) {
+                auto phase_start = std::chrono::steady_clock::now();
+                result.start_ms = std::chrono::duration<double, std::milli>(phase_start - start).count();
+                try {
+                    result.ok = spec.phase();
+                } catch (const std::exception& e) {
+                    result.error = e.what();
+                }
+                result.duration_ms = millisecondsSince(phase_start);
+            }
+            done[i].set_value(result.ok);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    total_ms_ = millisecondsSince(start);
+
+    bool all_ok = true;
+    for (const auto& result : results_) {
+        MetricsRegistry::instance()
+            .gauge("sonic_startup_" + result.name + "_milliseconds", "Duration of the " + result.name + " startup phase")
+            .set(static_cast<int64_t>(result.duration_ms));
+        if (!result.ok) {
+            all_ok = false;
+            SONIC_LOG_WARN("STARTUP", "Startup phase '" << result.name << "' "
+                           << (result.skipped ? "skipped" : "failed")
+                           << (result.error.empty() ? "" : ": ") << result.error);
+        }
+    }
+    MetricsRegistry::instance()
+        .gauge("sonic_startup_total_milliseconds", "Wall-clock duration of startup")
+        .set(static_cast<int64_t>(total_ms_));
+    return all_ok;
+}
+
+std::string StartupOrchestrator::report() const {
+    std::string out;
+    char line[160];
+    for (const auto& result : results_) {
+        const char* state = result.ok ? "ok" : (result.skipped ? "skipped" : "FAILED");
+        snprintf(line, sizeof(line), "  %-16s %-8s start %8.1f ms  took %8.1f ms\n",
+                 result.name.c_str(), state, result.start_ms, result.duration_ms);
+        out += line;
+    }
+    snprintf(line, sizeof(line), "  %-16s %-8s %27.1f ms\n", "total", "", total_ms_);
+    out += line;
+    return out;
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,72 @@
+/**
+ * @file string_interner.cpp
+ * @brief SONiC Common String Interner Implementation
+ */
+
+#include "string_interner.h"
+
+namespace sonic {
+namespace common {
+
+StringInterner::StringInterner(size_t max_entries)
+    : max_entries_(max_entries == 0 || max_entries > CAPACITY ? CAPACITY : max_entries),
+      chunk_table_(new std::atomic<const std::string*>[MAX_CHUNKS]), size_(0) {
+    for (size_t i = 0; i < MAX_CHUNKS; ++i) {
+        chunk_table_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+InternId StringInterner::intern(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+    size_t size = size_.load(std::memory_order_relaxed);
+    if (size >= max_entries_) {
+        return INVALID_INTERN_ID;
+    }
+
+    size_t chunk = size >> CHUNK_BITS;
+    if (chunk == chunks_.size()) {
+        chunks_.emplace_back(new std::string[CHUNK_SIZE]);
+        chunk_table_[chunk].store(chunks_.back().get(), std::memory_order_relaxed);
+    }
+    chunks_[chunk][size & (CHUNK_SIZE - 1)] = name;
+    InternId id = static_cast<InternId>(size);
+    ids_.emplace(name, id);
+    // Publishes the name (and a new chunk) to name() callers
+    size_.store(size + 1, std::memory_order_release);
+    return id;
+}
+
+bool StringInterner::find(const std::string& name, InternId& id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    if (it == ids_.end()) {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
+
+const std::string& StringInterner::name(InternId id) const {
+    static const std::string empty;
+    if (id >= size_.load(std::memory_order_acquire)) {
+        return empty;
+    }
+    // Chunks never move once published, and a published slot is never written again
+    return chunk_table_[id >> CHUNK_BITS].load(std::memory_order_relaxed)[id & (CHUNK_SIZE - 1)];
+}
+
+size_t StringInterner::size() const {
+    return size_.load(std::memory_order_acquire);
+}
+
+StringInterner& portNames() {
+    static StringInterner interner;
+    return interner;
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,88 @@
+/**
+ * @file string_interner.h
+ * @brief SONiC Common String Interner Header
+ *
+ * Maps frequently repeated names (ports, event texts) to dense integer IDs so
+ * hot paths can store and compare integers instead of heap strings.
+ */
+
+#ifndef SONIC_COMMON_STRING_INTERNER_H
+#define SONIC_COMMON_STRING_INTERNER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+namespace sonic {
+namespace common {
+
+using InternId = uint32_t;
+constexpr InternId INVALID_INTERN_ID = UINT32_MAX;
+
+/**
+ * @brief Thread-safe string <-> dense ID table; IDs are never reused
+ *
+ * Names live in fixed-size chunks that never move, so name() is an array
+ * lookup without a lock; only intern() and find() take the mutex.
+ */
+class StringInterner {
+public:
+    static constexpr size_t CHUNK_BITS = 8;
+    static constexpr size_t CHUNK_SIZE = size_t(1) << CHUNK_BITS;
+    static constexpr size_t MAX_CHUNKS = 4096;
+    static constexpr size_t CAPACITY = CHUNK_SIZE * MAX_CHUNKS;
+
+    /**
+     * @param max_entries intern() refuses new strings past this size (0 = CAPACITY)
+     */
+    explicit StringInterner(size_t max_entries = 0);
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    /**
+     * @brief Return the ID for name, assigning the next one if it is new
+     * @return INVALID_INTERN_ID when the table is full
+     */
+    InternId intern(const std::string& name);
+
+    /**
+     * @brief Look name up without assigning an ID
+     */
+    bool find(const std::string& name, InternId& id) const;
+
+    /**
+     * @brief Name for an ID in O(1) without locking; the reference stays valid
+     *        for the interner's lifetime
+     * @return An empty string for unknown IDs
+     */
+    const std::string& name(InternId id) const;
+
+    size_t size() const;
+
+private:
+    size_t max_entries_;
+    mutable std::mutex mutex_;                          ///< Serializes intern() and guards ids_
+    std::unordered_map<std::string, InternId> ids_;
+    std::vector<std::unique_ptr<std::string[]>> chunks_;            ///< Owns the names
+    std::unique_ptr<std::atomic<const std::string*>[]> chunk_table_;  ///< Lock-free view of chunks_
+    std::atomic<size_t> size_;                          ///< Names visible to name()
+};
+
+using PortId = InternId;
+constexpr PortId INVALID_PORT_ID = INVALID_INTERN_ID;
+
+/**
+ * @brief Process-wide port name table shared by all modules
+ */
+StringInterner& portNames();
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_STRING_INTERNER_H
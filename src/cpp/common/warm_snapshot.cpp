@@ -0,0 +1,248 @@
+/**
+ * @file warm_snapshot.cpp
+ * @brief SONiC Common Warm-Restart Snapshot File Implementation
+ */
+
+#include "warm_snapshot.h"
+#include <iostream>
+#include <ctime>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace sonic {
+namespace common {
+
+namespace {
+
+const char SNAPSHOT_MAGIC[8] = {'S', 'O', 'N', 'I', 'C', 'W', 'R', 'S'};
+constexpr uint32_t SNAPSHOT_FORMAT_VERSION = 1;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t kind;
+    uint32_t schema_version;
+    uint32_t section_count;
+    uint64_t created_at;
+    uint64_t payload_size;
+    uint32_t payload_crc;
+    uint32_t reserved;
+};
+
+struct SectionHeader {
+    uint32_t id;
+    uint32_t reserved;
+    uint64_t size;
+};
+
+bool writeAll(int fd, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        ssize_t written = ::write(fd, bytes, size);
+        if (written < 0) {
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+uint32_t crc32(const uint8_t* data, size_t size) {
+    static uint32_t table[256];
+    static bool table_ready = [] {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+        return true;
+    }();
+    (void)table_ready;
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+SnapshotWriter::SnapshotWriter(uint32_t kind, uint32_t schema_version)
+    : kind_(kind), schema_version_(schema_version), section_count_(0), section_start_(SIZE_MAX) {
+}
+
+void SnapshotWriter::beginSection(uint32_t id) {
+    if (section_start_ != SIZE_MAX) {
+        endSection();
+    }
+    SectionHeader header = {id, 0, 0};
+    section_start_ = payload_.size();
+    putRaw(&header, sizeof(header));
+    section_count_++;
+}
+
+void SnapshotWriter::endSection() {
+    if (section_start_ == SIZE_MAX) {
+        return;
+    }
+    uint64_t size = payload_.size() - section_start_ - sizeof(SectionHeader);
+    std::memcpy(&payload_[section_start_ + offsetof(SectionHeader, size)], &size, sizeof(size));
+    section_start_ = SIZE_MAX;
+}
+
+void SnapshotWriter::putString(const std::string& value) {
+    putU32(static_cast<uint32_t>(value.size()));
+    putRaw(value.data(), value.size());
+}
+
+void SnapshotWriter::putRaw(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    payload_.insert(payload_.end(), bytes, bytes + size);
+}
+
+bool SnapshotWriter::writeFile(const std::string& path) const {
+    if (section_start_ != SIZE_MAX) {
+        std::cerr << "Snapshot " << path << " has an unterminated section" << std::endl;
+        return false;
+    }
+
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.format_version = SNAPSHOT_FORMAT_VERSION;
+    header.kind = kind_;
+    header.schema_version = schema_version_;
+    header.section_count = section_count_;
+    header.created_at = static_cast<uint64_t>(std::time(nullptr));
+    header.payload_size = payload_.size();
+    header.payload_crc = crc32(payload_.data(), payload_.size());
+
+    std::string temp_path = path + ".tmp";
+    int fd = ::open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        std::cerr << "Failed to create snapshot " << temp_path << std::endl;
+        return false;
+    }
+    bool written = writeAll(fd, &header, sizeof(header)) && writeAll(fd, payload_.data(), payload_.size()) &&
+                   ::fsync(fd) == 0;
+    ::close(fd);
+    if (!written || std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::cerr << "Failed to write snapshot " << path << std::endl;
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool SnapshotCursor::getString(std::string& value) {
+    uint32_t size = 0;
+    if (!getU32(size) || size > size_ - offset_) {
+        failed_ = true;
+        return false;
+    }
+    value.assign(reinterpret_cast<const char*>(data_ + offset_), size);
+    offset_ += size;
+    return true;
+}
+
+SnapshotReader::SnapshotReader() : mapping_(nullptr), mapping_size_(0), created_at_(0) {
+}
+
+SnapshotReader::~SnapshotReader() {
+    close();
+}
+
+bool SnapshotReader::open(const std::string& path, uint32_t kind, uint32_t schema_version) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;   // No snapshot: a cold start, not an error
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(FileHeader)) {
+        ::close(fd);
+        std::cerr << "Snapshot " << path << " is truncated" << std::endl;
+        return false;
+    }
+    mapping_size_ = static_cast<size_t>(info.st_size);
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        std::cerr << "Failed to map snapshot " << path << std::endl;
+        return false;
+    }
+
+    const uint8_t* base = static_cast<const uint8_t*>(mapping_);
+    FileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    const uint8_t* payload = base + sizeof(header);
+    const char* problem = nullptr;
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0) {
+        problem = "is not a snapshot";
+    } else if (header.format_version != SNAPSHOT_FORMAT_VERSION || header.kind != kind ||
+               header.schema_version != schema_version) {
+        problem = "was written by another version";
+    } else if (header.payload_size != mapping_size_ - sizeof(header)) {
+        problem = "is truncated";
+    } else if (crc32(payload, header.payload_size) != header.payload_crc) {
+        problem = "is corrupt";
+    }
+
+    // Index the sections; the CRC already covers their headers
+    size_t offset = 0;
+    for (uint32_t i = 0; !problem && i < header.section_count; ++i) {
+        SectionHeader section_header;
+        if (header.payload_size - offset < sizeof(section_header)) {
+            problem = "has a malformed section table";
+            break;
+        }
+        std::memcpy(&section_header, payload + offset, sizeof(section_header));
+        offset += sizeof(section_header);
+        if (section_header.size > header.payload_size - offset) {
+            problem = "has a malformed section table";
+            break;
+        }
+        sections_.push_back({section_header.id, payload + offset, static_cast<size_t>(section_header.size)});
+        offset += section_header.size;
+    }
+
+    if (problem) {
+        std::cerr << "Snapshot " << path << " " << problem << ", ignoring it" << std::endl;
+        close();
+        return false;
+    }
+    created_at_ = header.created_at;
+    return true;
+}
+
+void SnapshotReader::close() {
+    if (mapping_) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+    }
+    mapping_size_ = 0;
+    created_at_ = 0;
+    sections_.clear();
+}
+
+bool SnapshotReader::section(uint32_t id, SnapshotCursor& cursor) const {
+    for (const auto& section : sections_) {
+        if (section.id == id) {
+            cursor = SnapshotCursor(section.data, section.size);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,165 @@
+/**
+ * @file warm_snapshot.h
+ * @brief SONiC Common Warm-Restart Snapshot File
+ *
+ * Versioned binary container for state that should survive a restart. A
+ * file is a fixed header (magic, format version, owner kind and schema
+ * version, payload CRC) followed by tagged sections. Readers map the file
+ * read-only and decode sections in place; any mismatch in magic, version,
+ * size or CRC rejects the whole file so the owner falls back to a cold
+ * start. Values are stored in host byte order: snapshots are meant for a
+ * restart on the same machine, not for exchange.
+ */
+
+#ifndef SONIC_COMMON_WARM_SNAPSHOT_H
+#define SONIC_COMMON_WARM_SNAPSHOT_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace sonic {
+namespace common {
+
+/**
+ * @brief Builds a snapshot in memory and writes it atomically
+ */
+class SnapshotWriter {
+public:
+    /**
+     * @param kind Identifies the owner (four-character code)
+     * @param schema_version Owner's layout version; readers reject any other
+     */
+    SnapshotWriter(uint32_t kind, uint32_t schema_version);
+
+    /**
+     * @brief Start a tagged section; sections do not nest
+     */
+    void beginSection(uint32_t id);
+    void endSection();
+
+    void putU8(uint8_t value) { putRaw(&value, sizeof(value)); }
+    void putU16(uint16_t value) { putRaw(&value, sizeof(value)); }
+    void putU32(uint32_t value) { putRaw(&value, sizeof(value)); }
+    void putU64(uint64_t value) { putRaw(&value, sizeof(value)); }
+    void putString(const std::string& value);
+
+    /**
+     * @brief Write to path via a temporary file and rename, so a crash never leaves a torn snapshot
+     * @return true if successful, false otherwise
+     */
+    bool writeFile(const std::string& path) const;
+
+    size_t size() const { return payload_.size(); }
+
+private:
+    void putRaw(const void* data, size_t size);
+
+    uint32_t kind_;
+    uint32_t schema_version_;
+    uint32_t section_count_;
+    size_t section_start_;      // Offset of the open section's header, SIZE_MAX if none
+    std::vector<uint8_t> payload_;
+};
+
+/**
+ * @brief Bounds-checked reader over one section
+ *
+ * Every get returns false once the section is exhausted; the cursor then
+ * stays failed so callers may check ok() once after a run of reads.
+ */
+class SnapshotCursor {
+public:
+    SnapshotCursor() : data_(nullptr), size_(0), offset_(0), failed_(false) {}
+    SnapshotCursor(const uint8_t* data, size_t size) : data_(data), size_(size), offset_(0), failed_(false) {}
+
+    bool getU8(uint8_t& value) { return getRaw(&value, sizeof(value)); }
+    bool getU16(uint16_t& value) { return getRaw(&value, sizeof(value)); }
+    bool getU32(uint32_t& value) { return getRaw(&value, sizeof(value)); }
+    bool getU64(uint64_t& value) { return getRaw(&value, sizeof(value)); }
+    bool getString(std::string& value);
+
+    bool ok() const { return !failed_; }
+    bool atEnd() const { return offset_ == size_; }
+
+private:
+    bool getRaw(void* out, size_t size) {
+        if (failed_ || size > size_ - offset_) {
+            failed_ = true;
+            return false;
+        }
+        std::memcpy(out, data_ + offset_, size);
+        offset_ += size;
+        return true;
+    }
+
+    const uint8_t* data_;
+    size_t size_;
+    size_t offset_;
+    bool failed_;
+};
+
+/**
+ * @brief Memory-mapped, validated snapshot file
+ */
+class SnapshotReader {
+public:
+    SnapshotReader();
+    ~SnapshotReader();
+
+    SnapshotReader(const SnapshotReader&) = delete;
+    SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+    /**
+     * @brief Map path and validate it against the expected owner and schema
+     * @return false if the file is missing, foreign, stale or corrupt
+     */
+    bool open(const std::string& path, uint32_t kind, uint32_t schema_version);
+
+    void close();
+
+    /**
+     * @brief Cursor over the first section with this id
+     * @return false if the snapshot has no such section
+     */
+    bool section(uint32_t id, SnapshotCursor& cursor) const;
+
+    /**
+     * @brief Wall-clock time the snapshot was written (seconds since the epoch)
+     */
+    uint64_t createdAt() const { return created_at_; }
+
+private:
+    struct Section {
+        uint32_t id;
+        const uint8_t* data;
+        size_t size;
+    };
+
+    void* mapping_;
+    size_t mapping_size_;
+    uint64_t created_at_;
+    std::vector<Section> sections_;
+};
+
+/**
+ * @brief CRC-32 (IEEE 802.3) of a buffer
+ */
+uint32_t crc32(const uint8_t* data, size_t size);
+
+/**
+ * @brief Four-character code for SnapshotWriter kinds and section ids
+ */
+constexpr uint32_t snapshotTag(const char (&tag)[5]) {
+    return static_cast<uint32_t>(static_cast<uint8_t>(tag[0])) |
+           static_cast<uint32_t>(static_cast<uint8_t>(tag[1])) << 8 |
+           static_cast<uint32_t>(static_cast<uint8_t>(tag[2])) << 16 |
+           static_cast<uint32_t>(static_cast<uint8_t>(tag[3])) << 24;
+}
+
+} // namespace common
+} // namespace sonic
+
+#endif // SONIC_COMMON_WARM_SNAPSHOT_H
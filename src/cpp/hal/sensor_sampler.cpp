@@ -0,0 +1,460 @@
+/**
+ * @file sensor_sampler.cpp
+ * @brief SONiC HAL Sensor Sampler Implementation
+ */
+
+#include "sensor_sampler.h"
+#include "../common/redis_client.h"
+#include "../common/logger.h"
+#include "../common/metrics.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include <dirent.h>
+
+namespace sonic {
+namespace hal {
+
+namespace {
+
+constexpr int STATE_DB = 6;
+constexpr uint32_t KEY_REFRESH_SAMPLES = 30;
+constexpr int MAX_HWMON_CHANNELS = 32;
+
+float parseFloat(const std::map<std::string, std::string>& fields, const std::string& name) {
+    auto it = fields.find(name);
+    if (it == fields.end()) {
+        return 0.0f;
+    }
+    char* end = nullptr;
+    float value = std::strtof(it->second.c_str(), &end);
+    return end != it->second.c_str() ? value : 0.0f;     // "N/A" reads as 0
+}
+
+bool parseBool(const std::map<std::string, std::string>& fields, const std::string& name) {
+    auto it = fields.find(name);
+    return it != fields.end() && (it->second == "True" || it->second == "true");
+}
+
+std::string fieldOr(const std::map<std::string, std::string>& fields, const std::string& name,
+                    const std::string& default_value = "") {
+    auto it = fields.find(name);
+    return it != fields.end() ? it->second : default_value;
+}
+
+// Trailing number of a key ("FAN_INFO|Fan3" -> 3, "PSU_INFO|PSU 2" -> 2); 0 when it has none
+int keySuffix(const std::string& key) {
+    size_t begin = key.size();
+    while (begin > 0 && std::isdigit(static_cast<unsigned char>(key[begin - 1]))) {
+        --begin;
+    }
+    if (begin == key.size() || key.size() - begin > 9) {
+        return 0;
+    }
+    return std::atoi(key.c_str() + begin);
+}
+
+// IDs come from the key suffixes, so they stay put when keys come and go. Keys without a
+// number, or whose number another key already took, get the next IDs after the largest one.
+void assignKeyIds(std::vector<std::string>& keys, std::vector<int>& ids) {
+    std::sort(keys.begin(), keys.end());
+    ids.assign(keys.size(), 0);
+    std::set<int> taken;
+    int max_id = 0;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        int id = keySuffix(keys[i]);
+        if (id > 0 && taken.insert(id).second) {
+            ids[i] = id;
+            max_id = std::max(max_id, id);
+        }
+    }
+    for (int& id : ids) {
+        if (id == 0) {
+            id = ++max_id;
+        }
+    }
+
+    std::vector<size_t> order(keys.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&ids](size_t a, size_t b) { return ids[a] < ids[b]; });
+    std::vector<std::string> sorted_keys;
+    std::vector<int> sorted_ids;
+    for (size_t i : order) {
+        sorted_keys.push_back(std::move(keys[i]));
+        sorted_ids.push_back(ids[i]);
+    }
+    keys = std::move(sorted_keys);
+    ids = std::move(sorted_ids);
+}
+
+// Single-value sysfs attribute
+bool readSysfsValue(const std::string& path, long& value) {
+    std::ifstream file(path);
+    return static_cast<bool>(file >> value);
+}
+
+bool readSysfsText(const std::string& path, std::string& text) {
+    std::ifstream file(path);
+    return static_cast<bool>(std::getline(file, text));
+}
+
+std::vector<std::string> listHwmonDevices(const std::string& root) {
+    std::vector<std::string> devices;
+    DIR* dir = opendir(root.c_str());
+    if (!dir) {
+        return devices;
+    }
+    while (struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.compare(0, 5, "hwmon") == 0) {
+            devices.push_back(root + "/" + name);
+        }
+    }
+    closedir(dir);
+    std::sort(devices.begin(), devices.end());
+    return devices;
+}
+
+std::string temperatureStatus(float temperature, float high, float critical) {
+    if (critical > 0 && temperature >= critical) {
+        return "CRITICAL";
+    }
+    if (high > 0 && temperature >= high) {
+        return "WARNING";
+    }
+    return "OK";
+}
+
+template <typename T, typename Id>
+const T* findById(const std::vector<T>& items, int id, Id id_of) {
+    auto it = std::lower_bound(items.begin(), items.end(), id,
+                               [&](const T& item, int value) { return id_of(item) < value; });
+    return (it != items.end() && id_of(*it) == id) ? &*it : nullptr;
+}
+
+} // anonymous namespace
+
+const FanInfo* SensorSnapshot::findFan(int fan_id) const {
+    return findById(fans, fan_id, [](const FanInfo& fan) { return fan.fan_id; });
+}
+
+const TempSensorInfo* SensorSnapshot::findTempSensor(int sensor_id) const {
+    return findById(temp_sensors, sensor_id, [](const TempSensorInfo& sensor) { return sensor.sensor_id; });
+}
+
+const PSUInfo* SensorSnapshot::findPSU(int psu_id) const {
+    return findById(psus, psu_id, [](const PSUInfo& psu) { return psu.psu_id; });
+}
+
+SensorSampler::SensorSampler(common::RedisClient& client, const std::string& hwmon_root)
+    : client_(client), hwmon_root_(hwmon_root), sequence_(0),
+      samples_since_key_refresh_(KEY_REFRESH_SAMPLES), read_failed_(false), drift_temperatures_(false),
+      rng_(std::random_device{}()), running_(false), interval_ms_(2000) {
+    fan_table_.pattern = "FAN_INFO|*";
+    temp_table_.pattern = "TEMPERATURE_INFO|*";
+    psu_table_.pattern = "PSU_INFO|*";
+}
+
+SensorSampler::~SensorSampler() {
+    stop();
+}
+
+void SensorSampler::start(int interval_ms) {
+    if (running_.exchange(true)) {
+        return;
+    }
+    interval_ms_ = interval_ms > 0 ? interval_ms : 2000;
+    thread_ = std::thread(&SensorSampler::sampleLoop, this);
+}
+
+void SensorSampler::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+    }
+    wait_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void SensorSampler::sampleLoop() {
+    while (running_.load()) {
+        sampleOnce();
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        wait_cv_.wait_for(lock, std::chrono::milliseconds(interval_ms_), [this] { return !running_.load(); });
+    }
+}
+
+std::shared_ptr<const SensorSnapshot> SensorSampler::snapshot() const {
+    return std::atomic_load(&current_);
+}
+
+void SensorSampler::setSimulated(const std::vector<FanInfo>& fans, const std::vector<TempSensorInfo>& temp_sensors,
+                                 const std::vector<PSUInfo>& psus, bool drift_temperatures) {
+    std::lock_guard<std::mutex> lock(sample_mutex_);
+    simulated_fans_ = fans;
+    simulated_temps_ = temp_sensors;
+    simulated_psus_ = psus;
+    drift_temperatures_ = drift_temperatures;
+    std::sort(simulated_fans_.begin(), simulated_fans_.end(),
+              [](const FanInfo& a, const FanInfo& b) { return a.fan_id < b.fan_id; });
+    std::sort(simulated_temps_.begin(), simulated_temps_.end(),
+              [](const TempSensorInfo& a, const TempSensorInfo& b) { return a.sensor_id < b.sensor_id; });
+    std::sort(simulated_psus_.begin(), simulated_psus_.end(),
+              [](const PSUInfo& a, const PSUInfo& b) { return a.psu_id < b.psu_id; });
+}
+
+bool SensorSampler::sampleOnce() {
+    std::lock_guard<std::mutex> lock(sample_mutex_);
+    SONIC_SCOPED_TIMER("sonic_hal_sensor_sample_seconds", "Time to read every sensor into one snapshot");
+    std::shared_ptr<SensorSnapshot> next = std::make_shared<SensorSnapshot>();
+
+    // Rediscover sensors now and then; a failed attempt also waits for the next round
+    if (++samples_since_key_refresh_ >= KEY_REFRESH_SAMPLES) {
+        samples_since_key_refresh_ = 0;
+        loadStateKeys();
+    }
+    bool state_ok = readStateDB(*next);
+    readSysfs(*next);
+    fillSimulated(*next);
+
+    next->sequence = ++sequence_;
+    publish(std::move(next));
+    return state_ok;
+}
+
+bool SensorSampler::loadStateKeys() {
+    StateTable* tables[] = {&fan_table_, &temp_table_, &psu_table_};
+    std::vector<std::string> found[3];
+    std::vector<std::vector<std::string>> commands;
+    bool ok = true;
+    for (size_t t = 0; t < 3 && ok; ++t) {
+        ok = client_.scanKeys(STATE_DB, tables[t]->pattern, found[t]);
+        for (const auto& key : found[t]) {
+            commands.push_back({"TYPE", key});
+        }
+    }
+
+    // Only PMON hashes are sensors; anything else under the pattern would fail HGETALL
+    // on every sample and force a rescan
+    std::vector<common::RedisReply> types;
+    if (ok && !commands.empty()) {
+        ok = client_.pipeline(STATE_DB, commands, types) && types.size() == commands.size();
+    }
+    if (!ok) {
+        if (!read_failed_) {
+            SONIC_LOG_ERROR("HAL", "Failed to read PMON tables from STATE_DB");
+        }
+        read_failed_ = true;
+        return false;
+    }
+
+    size_t reply = 0;
+    for (size_t t = 0; t < 3; ++t) {
+        std::vector<std::string> keys;
+        for (auto& key : found[t]) {
+            if (types[reply++].str == "hash") {
+                keys.push_back(std::move(key));
+            }
+        }
+        assignKeyIds(keys, tables[t]->ids);
+        tables[t]->keys = std::move(keys);
+    }
+    return true;
+}
+
+bool SensorSampler::readStateDB(SensorSnapshot& out) {
+    std::vector<std::vector<std::string>> commands;
+    const StateTable* tables[] = {&fan_table_, &temp_table_, &psu_table_};
+    for (const StateTable* table : tables) {
+        for (const auto& key : table->keys) {
+            commands.push_back({"HGETALL", key});
+        }
+    }
+    if (commands.empty()) {
+        return true;
+    }
+
+    std::vector<common::RedisReply> replies;
+    if (!client_.pipeline(STATE_DB, commands, replies) || replies.size() != commands.size()) {
+        if (!read_failed_) {
+            SONIC_LOG_ERROR("HAL", "Failed to sample sensors from STATE_DB");
+        }
+        read_failed_ = true;
+        return false;
+    }
+    read_failed_ = false;
+
+    size_t reply = 0;
+    for (size_t i = 0; i < fan_table_.keys.size(); ++i, ++reply) {
+        std::map<std::string, std::string> fields = replies[reply].asHash();
+        if (fields.empty()) {
+            samples_since_key_refresh_ = KEY_REFRESH_SAMPLES;     // Key went away
+            continue;
+        }
+        FanInfo fan;
+        fan.fan_id = fan_table_.ids[i];
+        fan.speed_rpm = static_cast<int>(parseFloat(fields, "speed") * MAX_FAN_RPM / 100.0f);
+        fan.target_speed_rpm = static_cast<int>(parseFloat(fields, "speed_target") * MAX_FAN_RPM / 100.0f);
+        fan.is_present = parseBool(fields, "presence");
+        fan.status = parseBool(fields, "status") ? "OK" : "NOT OK";
+        out.fans.push_back(fan);
+    }
+    for (size_t i = 0; i < temp_table_.keys.size(); ++i, ++reply) {
+        std::map<std::string, std::string> fields = replies[reply].asHash();
+        if (fields.empty()) {
+            samples_since_key_refresh_ = KEY_REFRESH_SAMPLES;
+            continue;
+        }
+        TempSensorInfo sensor;
+        sensor.sensor_id = temp_table_.ids[i];
+        sensor.name = temp_table_.keys[i].substr(temp_table_.keys[i].find('|') + 1);
+        sensor.temperature = parseFloat(fields, "temperature");
+        sensor.high_threshold = parseFloat(fields, "high_threshold");
+        sensor.critical_threshold = parseFloat(fields, "critical_high_threshold");
+        sensor.status = temperatureStatus(sensor.temperature, sensor.high_threshold, sensor.critical_threshold);
+        out.temp_sensors.push_back(sensor);
+    }
+    for (size_t i = 0; i < psu_table_.keys.size(); ++i, ++reply) {
+        std::map<std::string, std::string> fields = replies[reply].asHash();
+        if (fields.empty()) {
+            samples_since_key_refresh_ = KEY_REFRESH_SAMPLES;
+            continue;
+        }
+        PSUInfo psu;
+        psu.psu_id = psu_table_.ids[i];
+        psu.model = fieldOr(fields, "model");
+        psu.voltage = parseFloat(fields, "voltage");
+        psu.current = parseFloat(fields, "current");
+        psu.power = parseFloat(fields, "power");
+        psu.is_present = parseBool(fields, "presence");
+        psu.status = parseBool(fields, "status") ? "OK" : "NOT OK";
+        out.psus.push_back(psu);
+    }
+
+    if (!out.fans.empty()) {
+        out.fan_source = SensorSource::STATE_DB;
+    }
+    if (!out.temp_sensors.empty()) {
+        out.temp_source = SensorSource::STATE_DB;
+    }
+    if (!out.psus.empty()) {
+        out.psu_source = SensorSource::STATE_DB;
+    }
+    return true;
+}
+
+void SensorSampler::readSysfs(SensorSnapshot& out) {
+    bool want_fans = out.fan_source == SensorSource::NONE;
+    bool want_temps = out.temp_source == SensorSource::NONE;
+    if (!want_fans && !want_temps) {
+        return;
+    }
+
+    for (const auto& device : listHwmonDevices(hwmon_root_)) {
+        std::string chip;
+        readSysfsText(device + "/name", chip);
+        for (int channel = 1; channel <= MAX_HWMON_CHANNELS; ++channel) {
+            std::string prefix = device + "/";
+            std::string index = std::to_string(channel);
+            long value = 0;
+
+            if (want_temps && readSysfsValue(prefix + "temp" + index + "_input", value)) {
+                TempSensorInfo sensor;
+                sensor.sensor_id = static_cast<int>(out.temp_sensors.size() + 1);
+                if (!readSysfsText(prefix + "temp" + index + "_label", sensor.name)) {
+                    sensor.name = chip + "_temp" + index;
+                }
+                sensor.temperature = value / 1000.0f;   // Millidegrees
+                long threshold = 0;
+                sensor.high_threshold = readSysfsValue(prefix + "temp" + index + "_max", threshold)
+                                            ? threshold / 1000.0f : 0.0f;
+                sensor.critical_threshold = readSysfsValue(prefix + "temp" + index + "_crit", threshold)
+                                                ? threshold / 1000.0f : 0.0f;
+                sensor.status = temperatureStatus(sensor.temperature, sensor.high_threshold,
+                                                  sensor.critical_threshold);
+                out.temp_sensors.push_back(sensor);
+            }
+
+            if (want_fans && readSysfsValue(prefix + "fan" + index + "_input", value)) {
+                FanInfo fan;
+                fan.fan_id = static_cast<int>(out.fans.size() + 1);
+                fan.speed_rpm = static_cast<int>(value);
+                long target = 0;
+                fan.target_speed_rpm = readSysfsValue(prefix + "fan" + index + "_target", target)
+                                           ? static_cast<int>(target) : fan.speed_rpm;
+                fan.is_present = true;
+                fan.status = value > 0 ? "OK" : "NOT OK";
+                out.fans.push_back(fan);
+            }
+        }
+    }
+
+    if (want_fans && !out.fans.empty()) {
+        out.fan_source = SensorSource::SYSFS;
+    }
+    if (want_temps && !out.temp_sensors.empty()) {
+        out.temp_source = SensorSource::SYSFS;
+    }
+}
+
+void SensorSampler::fillSimulated(SensorSnapshot& out) {
+    if (out.fan_source == SensorSource::NONE && !simulated_fans_.empty()) {
+        out.fans = simulated_fans_;
+        out.fan_source = SensorSource::SIMULATED;
+    }
+    if (out.temp_source == SensorSource::NONE && !simulated_temps_.empty()) {
+        if (drift_temperatures_) {
+            std::uniform_real_distribution<float> drift(-2.0f, 2.0f);
+            for (auto& sensor : simulated_temps_) {
+                // Keep temperature in reasonable range
+                sensor.temperature = std::min(60.0f, std::max(20.0f, sensor.temperature + drift(rng_)));
+            }
+        }
+        out.temp_sensors = simulated_temps_;
+        out.temp_source = SensorSource::SIMULATED;
+    }
+    if (out.psu_source == SensorSource::NONE && !simulated_psus_.empty()) {
+        out.psus = simulated_psus_;
+        out.psu_source = SensorSource::SIMULATED;
+    }
+}
+
+bool SensorSampler::setFanTarget(int fan_id, int target_rpm) {
+    std::lock_guard<std::mutex> lock(sample_mutex_);
+    std::shared_ptr<const SensorSnapshot> current = std::atomic_load(&current_);
+    if (!current || !current->findFan(fan_id)) {
+        return false;
+    }
+
+    std::shared_ptr<SensorSnapshot> next = std::make_shared<SensorSnapshot>(*current);
+    FanInfo& fan = *std::find_if(next->fans.begin(), next->fans.end(),
+                                 [fan_id](const FanInfo& candidate) { return candidate.fan_id == fan_id; });
+    fan.target_speed_rpm = target_rpm;
+    if (next->fan_source == SensorSource::SIMULATED) {
+        // Simulated fans respond immediately; real ones report their speed on the next sample
+        fan.speed_rpm = target_rpm;
+        for (auto& simulated : simulated_fans_) {
+            if (simulated.fan_id == fan_id) {
+                simulated = fan;
+            }
+        }
+    }
+    publish(std::move(next));
+    return true;
+}
+
+void SensorSampler::publish(std::shared_ptr<SensorSnapshot> next) {
+    std::atomic_store(&current_, std::shared_ptr<const SensorSnapshot>(std::move(next)));
+}
+
+} // namespace hal
+} // namespace sonic
@@ -0,0 +1,148 @@
+/**
+ * @file sensor_sampler.h
+ * @brief SONiC HAL Sensor Sampler Header
+ *
+ * Samples fans, temperature sensors and PSUs on a background thread and
+ * publishes each round as an immutable snapshot swapped in atomically, so
+ * readers never block on a sample in progress. Each sensor class is read
+ * from the PMON tables in STATE_DB when present, else from hwmon in sysfs,
+ * else from the simulated values of a virtual switch.
+ */
+
+#ifndef SONIC_HAL_SENSOR_SAMPLER_H
+#define SONIC_HAL_SENSOR_SAMPLER_H
+
+#include "sonic_hal_controller.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <random>
+#include <cstdint>
+
+namespace sonic {
+namespace common {
+class RedisClient;
+}
+
+namespace hal {
+
+/**
+ * @brief Where a sensor class was read from in a snapshot
+ */
+enum class SensorSource {
+    NONE,
+    STATE_DB,
+    SYSFS,
+    SIMULATED
+};
+
+/**
+ * @brief Result of one sampling round; never modified after it is published
+ */
+struct SensorSnapshot {
+    uint64_t sequence = 0;                      ///< Round number, 1 for the first
+    std::vector<FanInfo> fans;                  ///< Sorted by fan_id
+    std::vector<TempSensorInfo> temp_sensors;   ///< Sorted by sensor_id
+    std::vector<PSUInfo> psus;                  ///< Sorted by psu_id
+    SensorSource fan_source = SensorSource::NONE;
+    SensorSource temp_source = SensorSource::NONE;
+    SensorSource psu_source = SensorSource::NONE;
+
+    /**
+     * @brief Binary search by ID, null when absent
+     */
+    const FanInfo* findFan(int fan_id) const;
+    const TempSensorInfo* findTempSensor(int sensor_id) const;
+    const PSUInfo* findPSU(int psu_id) const;
+};
+
+/**
+ * @brief Periodic reader for platform sensors
+ */
+class SensorSampler {
+public:
+    static constexpr int MAX_FAN_RPM = 6000;    ///< Scale for STATE_DB fan percentages
+
+    explicit SensorSampler(common::RedisClient& client, const std::string& hwmon_root = "/sys/class/hwmon");
+    ~SensorSampler();
+
+    SensorSampler(const SensorSampler&) = delete;
+    SensorSampler& operator=(const SensorSampler&) = delete;
+
+    /**
+     * @brief Sample every interval_ms on a background thread
+     */
+    void start(int interval_ms = 2000);
+    void stop();
+    bool isRunning() const { return running_.load(); }
+
+    /**
+     * @brief Read every sensor once and publish a new snapshot
+     */
+    bool sampleOnce();
+
+    /**
+     * @brief Latest published snapshot, null before the first sample
+     */
+    std::shared_ptr<const SensorSnapshot> snapshot() const;
+
+    /**
+     * @brief Values reported for sensor classes no real source provides
+     * @param drift_temperatures Random-walk simulated temperatures between samples
+     */
+    void setSimulated(const std::vector<FanInfo>& fans, const std::vector<TempSensorInfo>& temp_sensors,
+                      const std::vector<PSUInfo>& psus, bool drift_temperatures = true);
+
+    /**
+     * @brief Record a new fan target and publish it without waiting for the next sample
+     * @return false if the fan is not in the latest snapshot
+     */
+    bool setFanTarget(int fan_id, int target_rpm);
+
+private:
+    struct StateTable {
+        const char* pattern;                    // STATE_DB key pattern
+        std::vector<std::string> keys;          // Hash keys only, ordered by ID
+        std::vector<int> ids;                   // Sensor ID of each key, from its numeric suffix
+    };
+
+    bool loadStateKeys();
+    bool readStateDB(SensorSnapshot& out);
+    void readSysfs(SensorSnapshot& out);
+    void fillSimulated(SensorSnapshot& out);
+    void publish(std::shared_ptr<SensorSnapshot> next);
+    void sampleLoop();
+
+    common::RedisClient& client_;
+    std::string hwmon_root_;
+    std::mutex sample_mutex_;   // Serializes sampling and setFanTarget
+    std::shared_ptr<const SensorSnapshot> current_;     // Accessed with std::atomic_load/store
+    uint64_t sequence_;
+
+    StateTable fan_table_;
+    StateTable temp_table_;
+    StateTable psu_table_;
+    uint32_t samples_since_key_refresh_;
+    bool read_failed_;          // Log a failure once per outage
+
+    std::vector<FanInfo> simulated_fans_;
+    std::vector<TempSensorInfo> simulated_temps_;
+    std::vector<PSUInfo> simulated_psus_;
+    bool drift_temperatures_;
+    std::mt19937 rng_;
+
+    std::thread thread_;
+    std::atomic<bool> running_;
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+    int interval_ms_;
+};
+
+} // namespace hal
+} // namespace sonic
+
+#endif // SONIC_HAL_SENSOR_SAMPLER_H
@@ -1,4 +1,10 @@
 #include "sonic_hal_controller.h"
+#include "sensor_sampler.h"
+#include "../common/redis_client.h"
+#include "../common/logger.h"
+#include "../common/metrics.h"
+#include "../common/cli_executor.h"
+#include "../common/actuator_queue.h"
 #include <iostream>
 #include <sstream>
 #include <cstdlib>
@@ -10,90 +16,119 @@ namespace sonic {
 namespace hal {
 
 SONiCHALController::SONiCHALController() 
-    : m_initialized(false), m_sonic_container_name("sonic-vs-official") {
+    : m_initialized(false), m_sonic_container_name("sonic-vs-official"), m_sensor_sample_interval_ms(2000) {
+    m_redis.reset(new common::RedisClient(
+        common::RedisConfig::fromEnvironment(m_sonic_container_name, m_sonic_container_name)));
+    m_sensor_sampler.reset(new SensorSampler(*m_redis));
+    m_actuators.reset(new common::ActuatorQueue(
+        [this](const common::ActuatorQueue::Batch& batch, std::vector<bool>& rejected) {
+            return writeActuatorFrame(batch, rejected);
+        }, ACTUATOR_FRAME_MS));
 }
 
 SONiCHALController::~SONiCHALController() {
     cleanup();
+    m_sensor_sampler->stop();
+    m_actuators->stop();
 }
 
 bool SONiCHALController::initialize() {
-    std::cout << "[HAL] Initializing SONiC HAL Controller..." << std::endl;
+    SONIC_LOG_INFO("HAL", "Initializing SONiC HAL Controller...");
     
     // Test connection to SONiC container
     std::string output;
     if (!executeSONiCCommand("echo 'HAL_TEST'", output)) {
-        std::cerr << "[HAL] Failed to connect to SONiC container" << std::endl;
+        SONIC_LOG_ERROR("HAL", "Failed to connect to SONiC container");
         return false;
     }
     
     if (!detectPlatform()) {
-        std::cerr << "[HAL] Failed to detect platform" << std::endl;
+        SONIC_LOG_ERROR("HAL", "Failed to detect platform");
         return false;
     }
     
     if (!initializePlatformHAL()) {
-        std::cerr << "[HAL] Failed to initialize platform HAL" << std::endl;
+        SONIC_LOG_ERROR("HAL", "Failed to initialize platform HAL");
         return false;
     }
     
+    // First sample is taken inline so readers have data as soon as initialize() returns
+    m_sensor_sampler->sampleOnce();
+    m_sensor_sampler->start(m_sensor_sample_interval_ms);
+    m_actuators->start();
+
     m_initialized = true;
-    std::cout << "[HAL] SONiC HAL Controller initialized successfully" << std::endl;
-    std::cout << "[HAL] Platform: " << m_platform_name << std::endl;
+    SONIC_LOG_INFO("HAL", "SONiC HAL Controller initialized successfully");
+    SONIC_LOG_INFO("HAL", "Platform: " << m_platform_name);
     
     return true;
 }
 
 void SONiCHALController::cleanup() {
     if (m_initialized) {
-        std::cout << "[HAL] Cleaning up SONiC HAL Controller..." << std::endl;
+        SONIC_LOG_INFO("HAL", "Cleaning up SONiC HAL Controller...");
+        m_sensor_sampler->stop();
+        m_actuators->stop();
         m_initialized = false;
     }
 }
 
-bool SONiCHALController::executeSONiCCommand(const std::string& command, std::string& output) {
-    std::string full_command = "docker exec " + m_sonic_container_name + " bash -c \"" + command + "\"";
-    
-    FILE* pipe = popen(full_command.c_str(), "r");
-    if (!pipe) {
+bool SONiCHALController::writeActuatorFrame(const std::vector<std::pair<std::string, std::string>>& batch,
+                                           std::vector<bool>& rejected) {
+    std::vector<std::vector<std::string>> commands;
+    commands.reserve(batch.size());
+    for (const auto& update : batch) {
+        commands.push_back({"SET", update.first, update.second});
+    }
+    std::vector<common::RedisReply> replies;
+    if (!m_redis->pipeline(6, commands, replies)) { // STATE_DB
+        SONIC_LOG_WARN("HAL", "Failed to write " << batch.size() << " fan/LED updates, retrying next frame");
         return false;
     }
-    
-    char buffer[128];
-    output.clear();
-    while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
-        output += buffer;
+    // An error reply (a key of another type, say) will not clear on a retry
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (i >= replies.size() || replies[i].isError()) {
+            rejected[i] = true;
+            SONIC_LOG_WARN("HAL", "Failed to write " << batch[i].first << ": "
+                           << (i < replies.size() ? replies[i].str : "no reply"));
+        }
     }
-    
-    int result = pclose(pipe);
-    return (result == 0);
+    return true;
+}
+
+std::string SONiCHALController::sonicCommandLine(const std::string& command) const {
+    return "docker exec " + m_sonic_container_name + " bash -c \"" + command + "\"";
+}
+
+bool SONiCHALController::executeSONiCCommand(const std::string& command, std::string& output) {
+    SONIC_SCOPED_TIMER("sonic_hal_container_command_seconds", "Time to run a command in the SONiC container");
+    std::string full_command = sonicCommandLine(command);
+    bool read_only = common::CliExecutor::isReadOnlyCommand(command);
+    common::CliResult result = common::CliExecutor::shared().run(full_command, read_only);
+    output = result.output;
+    if (result.ok && !read_only) {
+        common::CliExecutor::shared().invalidate();
+    }
+    return result.ok;
 }
 
 bool SONiCHALController::executeRedisCommand(const std::string& command, int db_id, std::string& output) {
-    std::stringstream ss;
-    ss << "redis-cli -n " << db_id << " " << command;
-    return executeSONiCCommand(ss.str(), output);
+    SONIC_SCOPED_TIMER("sonic_hal_redis_command_seconds", "Time to run a Redis command line");
+    bool result = m_redis->commandLine(db_id, command, output);
+    if (!result) {
+        SONIC_COUNTER_INC("sonic_hal_redis_command_failures_total", "Redis command lines that failed");
+    }
+    return result;
 }
 
 bool SONiCHALController::setRedisValue(const std::string& key, const std::string& value, int db_id) {
-    std::string output;
-    std::stringstream ss;
-    ss << "SET '" << key << "' '" << value << "'";
-    return executeRedisCommand(ss.str(), db_id, output);
+    return m_redis->set(db_id, key, value);
 }
 
 std::string SONiCHALController::getRedisValue(const std::string& key, int db_id) {
-    std::string output;
-    std::stringstream ss;
-    ss << "GET '" << key << "'";
-    if (executeRedisCommand(ss.str(), db_id, output)) {
-        // Remove trailing newline
-        if (!output.empty() && output.back() == '\n') {
-            output.pop_back();
-        }
-        return output;
-    }
-    return "";
+    std::string value;
+    m_redis->get(db_id, key, value);
+    return value;
 }
 
 bool SONiCHALController::detectPlatform() {
@@ -117,10 +152,15 @@ bool SONiCHALController::detectPlatform() {
 
 bool SONiCHALController::initializePlatformHAL() {
     // Initialize platform-specific HAL components
-    std::cout << "[HAL] Initializing platform HAL for: " << m_platform_name << std::endl;
+    SONIC_LOG_INFO("HAL", "Initializing platform HAL for: " << m_platform_name);
     
-    // For virtual switch, we'll simulate hardware components
+    // For virtual switch, we'll simulate hardware components; the sampler
+    // reports these for any class PMON or hwmon does not provide
     if (m_platform_name == "vs") {
+        std::vector<FanInfo> fans;
+        std::vector<TempSensorInfo> temp_sensors;
+        std::vector<PSUInfo> psus;
+
         // Initialize simulated fans
         for (int i = 1; i <= 4; i++) {
             FanInfo fan;
@@ -129,7 +169,7 @@ bool SONiCHALController::initializePlatformHAL() {
             fan.target_speed_rpm = fan.speed_rpm;
             fan.is_present = true;
             fan.status = "OK";
-            m_fan_cache.push_back(fan);
+            fans.push_back(fan);
         }
         
         // Initialize simulated temperature sensors
@@ -141,7 +181,7 @@ bool SONiCHALController::initializePlatformHAL() {
             sensor.high_threshold = 70.0f;
             sensor.critical_threshold = 85.0f;
             sensor.status = "OK";
-            m_temp_sensor_cache.push_back(sensor);
+            temp_sensors.push_back(sensor);
         }
         
         // Initialize simulated PSUs
@@ -154,8 +194,9 @@ bool SONiCHALController::initializePlatformHAL() {
             psu.power = psu.voltage * psu.current;
             psu.is_present = true;
             psu.status = "OK";
-            m_psu_cache.push_back(psu);
+            psus.push_back(psu);
         }
+        m_sensor_sampler->setSimulated(fans, temp_sensors, psus);
         
         // Initialize simulated LEDs
         std::vector<std::string> led_names = {"STATUS", "FAN", "PSU1", "PSU2", "SYSTEM"};
@@ -175,8 +216,8 @@ bool SONiCHALController::initializePlatformHAL() {
 
 // Interface Control Implementation
 bool SONiCHALController::setInterfaceStatus(const std::string& interface, InterfaceStatus status) {
-    std::cout << "[HAL] Setting interface " << interface << " status to " 
-              << (status == InterfaceStatus::UP ? "UP" : "DOWN") << std::endl;
+    SONIC_LOG_INFO("HAL", "Setting interface " << interface << " status to "
+                   << (status == InterfaceStatus::UP ? "UP" : "DOWN"));
     
     std::string command;
     if (status == InterfaceStatus::UP) {
@@ -190,13 +231,13 @@ bool SONiCHALController::setInterfaceStatus(const std::string& interface, Interf
     
     if (result) {
         m_interface_status_cache[interface] = status;
-        std::cout << "[HAL] Interface " << interface << " status changed successfully" << std::endl;
+        SONIC_LOG_INFO("HAL", "Interface " << interface << " status changed successfully");
         
         // Update Redis database
         std::string status_str = (status == InterfaceStatus::UP) ? "up" : "down";
         setRedisValue("PORT|" + interface + "|admin_status", status_str, 4);
     } else {
-        std::cerr << "[HAL] Failed to change interface " << interface << " status" << std::endl;
+        SONIC_LOG_ERROR("HAL", "Failed to change interface " << interface << " status");
     }
     
     return result;
@@ -205,28 +246,51 @@ bool SONiCHALController::setInterfaceStatus(const std::string& interface, Interf
 InterfaceStatus SONiCHALController::getInterfaceStatus(const std::string& interface) {
     std::string output;
     if (executeSONiCCommand("show interfaces status " + interface, output)) {
-        if (output.find("up") != std::string::npos) {
-            return InterfaceStatus::UP;
-        } else if (output.find("down") != std::string::npos) {
-            return InterfaceStatus::DOWN;
-        }
+        return parseInterfaceStatus(output);
+    }
+    return InterfaceStatus::UNKNOWN;
+}
+
+std::map<std::string, InterfaceStatus> SONiCHALController::getInterfaceStatuses(const std::vector<std::string>& interfaces) {
+    SONIC_SCOPED_TIMER("sonic_hal_interface_statuses_seconds", "Time to query the status of a set of interfaces");
+    // Queue every query before waiting on any, so they run side by side on the executor
+    std::vector<std::pair<std::string, common::CliExecutor::Future>> pending;
+    pending.reserve(interfaces.size());
+    for (const auto& interface : interfaces) {
+        pending.emplace_back(interface, common::CliExecutor::shared().submit(
+            sonicCommandLine("show interfaces status " + interface), true));
+    }
+
+    std::map<std::string, InterfaceStatus> statuses;
+    for (auto& query : pending) {
+        const common::CliResult& result = query.second.get();
+        statuses[query.first] = result.ok ? parseInterfaceStatus(result.output) : InterfaceStatus::UNKNOWN;
+    }
+    return statuses;
+}
+
+InterfaceStatus SONiCHALController::parseInterfaceStatus(const std::string& output) {
+    if (output.find("up") != std::string::npos) {
+        return InterfaceStatus::UP;
+    } else if (output.find("down") != std::string::npos) {
+        return InterfaceStatus::DOWN;
     }
     return InterfaceStatus::UNKNOWN;
 }
 
 bool SONiCHALController::setInterfaceSpeed(const std::string& interface, int speed_mbps) {
-    std::cout << "[HAL] Setting interface " << interface << " speed to " << speed_mbps << " Mbps" << std::endl;
+    SONIC_LOG_INFO("HAL", "Setting interface " << interface << " speed to " << speed_mbps << " Mbps");
     
     std::string command = "config interface speed " + interface + " " + std::to_string(speed_mbps);
     std::string output;
     bool result = executeSONiCCommand(command, output);
     
     if (result) {
-        std::cout << "[HAL] Interface " << interface << " speed changed successfully" << std::endl;
+        SONIC_LOG_INFO("HAL", "Interface " << interface << " speed changed successfully");
         // Update Redis database
         setRedisValue("PORT|" + interface + "|speed", std::to_string(speed_mbps), 4);
     } else {
-        std::cerr << "[HAL] Failed to change interface " << interface << " speed" << std::endl;
+        SONIC_LOG_ERROR("HAL", "Failed to change interface " << interface << " speed");
     }
     
     return result;
@@ -238,7 +302,7 @@ int SONiCHALController::getInterfaceSpeed(const std::string& interface) {
         try {
             return std::stoi(speed_str);
         } catch (const std::exception& e) {
-            std::cerr << "[HAL] Error parsing interface speed: " << e.what() << std::endl;
+            SONIC_LOG_ERROR("HAL", "Error parsing interface speed: " << e.what());
         }
     }
     return -1;
@@ -246,39 +310,37 @@ int SONiCHALController::getInterfaceSpeed(const std::string& interface) {
 
 // Fan Control Implementation
 std::vector<FanInfo> SONiCHALController::getAllFans() {
-    return m_fan_cache;
+    std::shared_ptr<const SensorSnapshot> snapshot = m_sensor_sampler->snapshot();
+    return snapshot ? snapshot->fans : std::vector<FanInfo>();
 }
 
 bool SONiCHALController::setFanSpeed(int fan_id, int speed_percentage) {
-    std::cout << "[HAL] Setting Fan " << fan_id << " speed to " << speed_percentage << "%" << std::endl;
+    SONIC_LOG_INFO("HAL", "Setting Fan " << fan_id << " speed to " << speed_percentage << "%");
     
-    // For virtual switch, simulate fan control
-    for (auto& fan : m_fan_cache) {
-        if (fan.fan_id == fan_id) {
-            int max_rpm = 6000;
-            fan.target_speed_rpm = (max_rpm * speed_percentage) / 100;
-            fan.speed_rpm = fan.target_speed_rpm; // Simulate immediate response
-            
-            std::cout << "[HAL] Fan " << fan_id << " speed set to " << fan.speed_rpm << " RPM" << std::endl;
-            
-            // Update Redis with fan status
-            std::string key = "FAN_INFO|Fan" + std::to_string(fan_id);
-            std::string value = std::to_string(fan.speed_rpm) + "," + std::to_string(fan.target_speed_rpm);
-            setRedisValue(key, value, 6); // STATE_DB
-            
-            return true;
-        }
+    int target_rpm = (SensorSampler::MAX_FAN_RPM * speed_percentage) / 100;
+    if (!m_sensor_sampler->setFanTarget(fan_id, target_rpm)) {
+        SONIC_LOG_ERROR("HAL", "Fan " << fan_id << " not found");
+        return false;
     }
-    
-    std::cerr << "[HAL] Fan " << fan_id << " not found" << std::endl;
-    return false;
+
+    std::shared_ptr<const SensorSnapshot> snapshot = m_sensor_sampler->snapshot();
+    const FanInfo* fan = snapshot->findFan(fan_id);
+    int speed_rpm = fan ? fan->speed_rpm : target_rpm;
+    SONIC_LOG_INFO("HAL", "Fan " << fan_id << " speed set to " << speed_rpm << " RPM");
+
+    // Queue the fan status for the next STATE_DB frame; FAN_INFO holds pmon's hashes, which the sampler reads
+    std::string key = "FAN_STATUS|Fan" + std::to_string(fan_id);
+    std::string value = std::to_string(speed_rpm) + "," + std::to_string(target_rpm);
+    m_actuators->set(key, value);
+
+    return true;
 }
 
 FanInfo SONiCHALController::getFanInfo(int fan_id) {
-    for (const auto& fan : m_fan_cache) {
-        if (fan.fan_id == fan_id) {
-            return fan;
-        }
+    std::shared_ptr<const SensorSnapshot> snapshot = m_sensor_sampler->snapshot();
+    const FanInfo* fan = snapshot ? snapshot->findFan(fan_id) : nullptr;
+    if (fan) {
+        return *fan;
     }
     
     // Return empty fan info if not found
@@ -288,37 +350,26 @@ FanInfo SONiCHALController::getFanInfo(int fan_id) {
 }
 
 bool SONiCHALController::setFanAutoMode(bool enable) {
-    std::cout << "[HAL] Setting fan auto mode: " << (enable ? "enabled" : "disabled") << std::endl;
+    SONIC_LOG_INFO("HAL", "Setting fan auto mode: " << (enable ? "enabled" : "disabled"));
     
     // Simulate fan auto mode control
     std::string mode = enable ? "auto" : "manual";
-    setRedisValue("FAN_MODE", mode, 6);
+    m_actuators->set("FAN_MODE", mode);
     
     return true;
 }
 
 // Temperature Monitoring Implementation
 std::vector<TempSensorInfo> SONiCHALController::getAllTempSensors() {
-    // Simulate temperature fluctuation
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<> dis(-2.0, 2.0);
-    
-    for (auto& sensor : m_temp_sensor_cache) {
-        sensor.temperature += dis(gen);
-        // Keep temperature in reasonable range
-        if (sensor.temperature < 20.0f) sensor.temperature = 20.0f;
-        if (sensor.temperature > 60.0f) sensor.temperature = 60.0f;
-    }
-    
-    return m_temp_sensor_cache;
+    std::shared_ptr<const SensorSnapshot> snapshot = m_sensor_sampler->snapshot();
+    return snapshot ? snapshot->temp_sensors : std::vector<TempSensorInfo>();
 }
 
 TempSensorInfo SONiCHALController::getTempSensorInfo(int sensor_id) {
-    for (const auto& sensor : m_temp_sensor_cache) {
-        if (sensor.sensor_id == sensor_id) {
-            return sensor;
-        }
+    std::shared_ptr<const SensorSnapshot> snapshot = m_sensor_sampler->snapshot();
+    const TempSensorInfo* sensor = snapshot ? snapshot->findTempSensor(sensor_id) : nullptr;
+    if (sensor) {
+        return *sensor;
     }
     
     TempSensorInfo empty_sensor;
@@ -347,47 +398,61 @@ std::string SONiCHALController::getPlatformName() {
 }
 
 std::string SONiCHALController::getHardwareVersion() {
-    std::string output;
-    if (executeSONiCCommand("show version", output)) {
-        // Extract hardware version from output
-        size_t pos = output.find("Hardware Version:");
-        if (pos != std::string::npos) {
-            size_t start = pos + 17; // Length of "Hardware Version:"
-            size_t end = output.find('\n', start);
-            if (end != std::string::npos) {
-                return output.substr(start, end - start);
-            }
-        }
-    }
-    return "Virtual Switch v1.0";
+    std::call_once(m_inventory_once, &SONiCHALController::loadInventory, this);
+    return m_hardware_version;
 }
 
 std::string SONiCHALController::getSerialNumber() {
+    std::call_once(m_inventory_once, &SONiCHALController::loadInventory, this);
+    return m_serial_number;
+}
+
+void SONiCHALController::loadInventory() {
+    // Inventory does not change at runtime, so "show version" runs once for both fields
+    m_hardware_version = "Virtual Switch v1.0";
+    m_serial_number = "VS-SONIC-001";
+
     std::string output;
-    if (executeSONiCCommand("show version", output)) {
-        // Extract serial number from output
-        size_t pos = output.find("Serial Number:");
+    if (!executeSONiCCommand("show version", output)) {
+        return;
+    }
+    auto extract = [&output](const std::string& label, std::string& value) {
+        size_t pos = output.find(label);
         if (pos != std::string::npos) {
-            size_t start = pos + 14; // Length of "Serial Number:"
+            size_t start = pos + label.size();
             size_t end = output.find('\n', start);
             if (end != std::string::npos) {
-                return output.substr(start, end - start);
+                value = output.substr(start, end - start);
             }
         }
+    };
+    extract("Hardware Version:", m_hardware_version);
+    extract("Serial Number:", m_serial_number);
+}
+
+std::shared_ptr<const SensorSnapshot> SONiCHALController::getSensorSnapshot() {
+    return m_sensor_sampler->snapshot();
+}
+
+void SONiCHALController::setSensorSampleInterval(int interval_ms) {
+    m_sensor_sample_interval_ms = interval_ms;
+    if (m_sensor_sampler->isRunning()) {
+        m_sensor_sampler->stop();
+        m_sensor_sampler->start(interval_ms);
     }
-    return "VS-SONIC-001";
 }
 
 // Power Management Implementation
 std::vector<PSUInfo> SONiCHALController::getAllPSUs() {
-    return m_psu_cache;
+    std::shared_ptr<const SensorSnapshot> snapshot = m_sensor_sampler->snapshot();
+    return snapshot ? snapshot->psus : std::vector<PSUInfo>();
 }
 
 PSUInfo SONiCHALController::getPSUInfo(int psu_id) {
-    for (const auto& psu : m_psu_cache) {
-        if (psu.psu_id == psu_id) {
-            return psu;
-        }
+    std::shared_ptr<const SensorSnapshot> snapshot = m_sensor_sampler->snapshot();
+    const PSUInfo* psu = snapshot ? snapshot->findPSU(psu_id) : nullptr;
+    if (psu) {
+        return *psu;
     }
 
     PSUInfo empty_psu;
@@ -396,8 +461,12 @@ PSUInfo SONiCHALController::getPSUInfo(int psu_id) {
 }
 
 float SONiCHALController::getTotalPowerConsumption() {
+    std::shared_ptr<const SensorSnapshot> snapshot = m_sensor_sampler->snapshot();
+    if (!snapshot) {
+        return 0.0f;
+    }
     float total_power = 0.0f;
-    for (const auto& psu : m_psu_cache) {
+    for (const auto& psu : snapshot->psus) {
         if (psu.is_present) {
             total_power += psu.power;
         }
@@ -407,33 +476,32 @@ float SONiCHALController::getTotalPowerConsumption() {
 
 // LED Control Implementation
 std::vector<LEDInfo> SONiCHALController::getAllLEDs() {
+    std::lock_guard<std::mutex> lock(m_led_mutex);
     return m_led_cache;
 }
 
 bool SONiCHALController::setLEDState(const std::string& led_name, const std::string& color, const std::string& state) {
-    std::cout << "[HAL] Setting LED " << led_name << " to " << color << " " << state << std::endl;
-
     // Find LED in cache
+    std::lock_guard<std::mutex> lock(m_led_mutex);
     for (auto& led : m_led_cache) {
         if (led.name == led_name) {
             led.color = color;
             led.state = state;
 
-            // Update Redis with LED status
-            std::string key = "LED_STATUS|" + led_name;
-            std::string value = color + "," + state;
-            setRedisValue(key, value, 6); // STATE_DB
-
-            std::cout << "[HAL] LED " << led_name << " state updated successfully" << std::endl;
+            // Repeats within a frame collapse into one STATE_DB write; unchanged states write nothing
+            if (m_actuators->set("LED_STATUS|" + led_name, color + "," + state)) {
+                SONIC_LOG_INFO("HAL", "Setting LED " << led_name << " to " << color << " " << state);
+            }
             return true;
         }
     }
 
-    std::cerr << "[HAL] LED " << led_name << " not found" << std::endl;
+    SONIC_LOG_ERROR("HAL", "LED " << led_name << " not found");
     return false;
 }
 
 LEDInfo SONiCHALController::getLEDInfo(const std::string& led_name) {
+    std::lock_guard<std::mutex> lock(m_led_mutex);
     for (const auto& led : m_led_cache) {
         if (led.name == led_name) {
             return led;
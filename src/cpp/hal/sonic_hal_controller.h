@@ -5,10 +5,19 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <mutex>
 
 namespace sonic {
+namespace common {
+class RedisClient;
+class ActuatorQueue;
+}
+
 namespace hal {
 
+class SensorSampler;
+struct SensorSnapshot;
+
 // HAL Interface Status
 enum class InterfaceStatus {
     UP,
@@ -66,10 +75,12 @@ public:
     // Interface Control
     bool setInterfaceStatus(const std::string& interface, InterfaceStatus status);
     InterfaceStatus getInterfaceStatus(const std::string& interface);
+    // Query many interfaces at once; takes about as long as the slowest query
+    std::map<std::string, InterfaceStatus> getInterfaceStatuses(const std::vector<std::string>& interfaces);
     bool setInterfaceSpeed(const std::string& interface, int speed_mbps);
     int getInterfaceSpeed(const std::string& interface);
 
-    // Fan Control
+    // Fan Control; fan and LED writes are coalesced and flushed to STATE_DB once per frame
     std::vector<FanInfo> getAllFans();
     bool setFanSpeed(int fan_id, int speed_percentage);
     FanInfo getFanInfo(int fan_id);
@@ -91,7 +102,11 @@ public:
     bool setLEDState(const std::string& led_name, const std::string& color, const std::string& state);
     LEDInfo getLEDInfo(const std::string& led_name);
 
-    // System Information
+    // All fan, temperature and PSU readings from the latest sample; never blocks
+    std::shared_ptr<const SensorSnapshot> getSensorSnapshot();
+    void setSensorSampleInterval(int interval_ms);
+
+    // System Information, read once and memoized
     std::string getPlatformName();
     std::string getHardwareVersion();
     std::string getSerialNumber();
@@ -107,9 +122,12 @@ public:
 private:
     bool m_initialized;
     std::string m_sonic_container_name;
+    std::unique_ptr<common::RedisClient> m_redis;
     
     // Helper functions for SONiC communication
+    std::string sonicCommandLine(const std::string& command) const;
     bool executeSONiCCommand(const std::string& command, std::string& output);
+    static InterfaceStatus parseInterfaceStatus(const std::string& output);
     bool executeRedisCommand(const std::string& command, int db_id, std::string& output);
     bool setRedisValue(const std::string& key, const std::string& value, int db_id = 4);
     std::string getRedisValue(const std::string& key, int db_id = 4);
@@ -118,13 +136,28 @@ private:
     bool initializePlatformHAL();
     bool detectPlatform();
     
+    void loadInventory();
+
     // Internal state
     std::string m_platform_name;
     std::map<std::string, InterfaceStatus> m_interface_status_cache;
-    std::vector<FanInfo> m_fan_cache;
-    std::vector<TempSensorInfo> m_temp_sensor_cache;
-    std::vector<PSUInfo> m_psu_cache;
     std::vector<LEDInfo> m_led_cache;
+    std::mutex m_led_mutex;     // Guards m_led_cache
+
+    // Fans, temperature sensors and PSUs are owned by the sampler
+    std::unique_ptr<SensorSampler> m_sensor_sampler;
+    int m_sensor_sample_interval_ms;
+
+    // Static inventory from "show version"
+    std::once_flag m_inventory_once;
+    std::string m_hardware_version;
+    std::string m_serial_number;
+
+    // Latest fan/LED values per STATE_DB key; declared last so it flushes while m_redis is alive
+    static constexpr int ACTUATOR_FRAME_MS = 100;
+    std::unique_ptr<common::ActuatorQueue> m_actuators;
+    bool writeActuatorFrame(const std::vector<std::pair<std::string, std::string>>& batch,
+                            std::vector<bool>& rejected);
 };
 
 } // namespace hal
@@ -0,0 +1,185 @@
+#include "event_dispatcher.h"
+#include "../common/logger.h"
+#include <iostream>
+#include <chrono>
+#include <functional>
+
+namespace sonic {
+namespace interrupts {
+
+EventDispatcher::EventDispatcher(size_t worker_count, size_t queue_capacity)
+    : m_running(true), m_handlers(std::make_shared<HandlerTable>()), m_handlers_version(0),
+      m_enqueued(0), m_dispatched(0), m_dropped(0), m_handler_errors(0) {
+    if (worker_count == 0) {
+        worker_count = 1;
+    }
+    for (size_t i = 0; i < worker_count; ++i) {
+        m_shards.emplace_back(new Shard(queue_capacity));
+    }
+    for (auto& shard : m_shards) {
+        Shard* s = shard.get();
+        shard->worker = std::thread([this, s]() { workerLoop(*s); });
+    }
+}
+
+EventDispatcher::~EventDispatcher() {
+    stop();
+}
+
+size_t EventDispatcher::shardFor(common::PortId port_id) const {
+    // Dense IDs spread ports round-robin over the workers
+    return port_id % m_shards.size();
+}
+
+bool EventDispatcher::dispatch(PortEvent event) {
+    if (!m_running.load(std::memory_order_acquire)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    Shard& shard = *m_shards[shardFor(resolvePortId(event))];
+    shard.pending.fetch_add(1, std::memory_order_relaxed);
+    if (!shard.queue.tryPush(std::move(event))) {
+        shard.pending.fetch_sub(1, std::memory_order_relaxed);
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    m_enqueued.fetch_add(1, std::memory_order_relaxed);
+
+    // Only pay for the mutex when the worker is actually parked
+    if (shard.sleeping.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(shard.wake_mutex);
+        shard.wake_cv.notify_one();
+    }
+    return true;
+}
+
+void EventDispatcher::publishHandlers(std::shared_ptr<const HandlerTable> handlers) {
+    std::atomic_store(&m_handlers, std::move(handlers));
+    m_handlers_version.fetch_add(1, std::memory_order_release);
+}
+
+void EventDispatcher::workerLoop(Shard& shard) {
+    std::shared_ptr<const HandlerTable> handlers = std::atomic_load(&m_handlers);
+    uint64_t handlers_version = m_handlers_version.load(std::memory_order_acquire);
+    PortEvent event;
+
+    while (true) {
+        if (shard.queue.tryPop(event)) {
+            // Steady state costs one atomic load; the snapshot is reloaded only after a publish
+            uint64_t version = m_handlers_version.load(std::memory_order_acquire);
+            if (version != handlers_version) {
+                handlers = std::atomic_load(&m_handlers);
+                handlers_version = version;
+            }
+            runHandlers(*handlers, event);
+            m_dispatched.fetch_add(1, std::memory_order_relaxed);
+            shard.pending.fetch_sub(1, std::memory_order_release);
+            continue;
+        }
+
+        if (!m_running.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(shard.wake_mutex);
+        shard.sleeping.store(true, std::memory_order_seq_cst);
+        shard.wake_cv.wait_for(lock, std::chrono::milliseconds(100), [this, &shard]() {
+            return shard.queue.sizeApprox() > 0 || !m_running.load(std::memory_order_acquire);
+        });
+        shard.sleeping.store(false, std::memory_order_relaxed);
+    }
+
+    // Deliver anything that raced with stop()
+    while (shard.queue.tryPop(event)) {
+        runHandlers(*std::atomic_load(&m_handlers), event);
+        m_dispatched.fetch_add(1, std::memory_order_relaxed);
+        shard.pending.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+void EventDispatcher::runHandlers(const HandlerTable& handlers, const PortEvent& event) {
+    // Execute specific event handlers
+    auto it = handlers.by_event.find(event.event_type);
+    if (it != handlers.by_event.end()) {
+        for (const auto& entry : it->second) {
+            try {
+                entry.handler(event);
+            } catch (const std::exception& e) {
+                m_handler_errors.fetch_add(1, std::memory_order_relaxed);
+                SONIC_LOG_ERROR("INTERRUPT", "Event handler exception: " << e.what());
+            }
+        }
+    }
+
+    // Execute global handlers
+    for (const auto& entry : handlers.global) {
+        try {
+            entry.handler(event);
+        } catch (const std::exception& e) {
+            m_handler_errors.fetch_add(1, std::memory_order_relaxed);
+            SONIC_LOG_ERROR("INTERRUPT", "Global event handler exception: " << e.what());
+        }
+    }
+}
+
+bool EventDispatcher::waitIdle(int timeout_ms) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (true) {
+        bool idle = true;
+        for (const auto& shard : m_shards) {
+            if (shard->pending.load(std::memory_order_acquire) != 0) {
+                idle = false;
+                break;
+            }
+        }
+        if (idle) {
+            return true;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void EventDispatcher::stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+
+    for (auto& shard : m_shards) {
+        {
+            std::lock_guard<std::mutex> lock(shard->wake_mutex);
+            shard->wake_cv.notify_one();
+        }
+    }
+    for (auto& shard : m_shards) {
+        if (shard->worker.joinable()) {
+            shard->worker.join();
+        }
+    }
+}
+
+size_t EventDispatcher::queueDepth() const {
+    size_t depth = 0;
+    for (const auto& shard : m_shards) {
+        depth += shard->queue.sizeApprox();
+    }
+    return depth;
+}
+
+DispatcherStats EventDispatcher::getStats() const {
+    DispatcherStats stats;
+    stats.enqueued = m_enqueued.load(std::memory_order_relaxed);
+    stats.dispatched = m_dispatched.load(std::memory_order_relaxed);
+    stats.dropped = m_dropped.load(std::memory_order_relaxed);
+    stats.handler_errors = m_handler_errors.load(std::memory_order_relaxed);
+    stats.queue_depth = queueDepth();
+    stats.queue_capacity = m_shards.empty() ? 0 : m_shards.front()->queue.capacity() * m_shards.size();
+    stats.workers = m_shards.size();
+    return stats;
+}
+
+} // namespace interrupts
+} // namespace sonic
@@ -0,0 +1,177 @@
+#ifndef SONIC_EVENT_DISPATCHER_H
+#define SONIC_EVENT_DISPATCHER_H
+
+#include "sonic_interrupt_controller.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sonic {
+namespace interrupts {
+
+// Bounded lock-free queue for many producers and a single consumer.
+// Each cell carries a sequence number (Vyukov); capacity is rounded up to a power of two.
+template <typename T>
+class BoundedMPSCQueue {
+public:
+    explicit BoundedMPSCQueue(size_t capacity)
+        : m_capacity(roundUpPowerOfTwo(capacity)), m_mask(m_capacity - 1),
+          m_cells(new Cell[m_capacity]), m_enqueue_pos(0), m_dequeue_pos(0) {
+        for (size_t i = 0; i < m_capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMPSCQueue(const BoundedMPSCQueue&) = delete;
+    BoundedMPSCQueue& operator=(const BoundedMPSCQueue&) = delete;
+
+    // Returns false when the queue is full
+    bool tryPush(T&& value) {
+        size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Single consumer only
+    bool tryPop(T& value) {
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        Cell& cell = m_cells[pos & m_mask];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) {
+            return false;
+        }
+        value = std::move(cell.value);
+        cell.sequence.store(pos + m_capacity, std::memory_order_release);
+        m_dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    size_t sizeApprox() const {
+        size_t enqueued = m_enqueue_pos.load(std::memory_order_relaxed);
+        size_t dequeued = m_dequeue_pos.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    size_t capacity() const { return m_capacity; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static size_t roundUpPowerOfTwo(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const size_t m_capacity;
+    const size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    alignas(64) std::atomic<size_t> m_enqueue_pos;
+    alignas(64) std::atomic<size_t> m_dequeue_pos;
+};
+
+struct RegisteredHandler {
+    HandlerId id;
+    InterruptHandler handler;
+};
+
+// Immutable handler registry published copy-on-write to the dispatch workers
+struct HandlerTable {
+    std::map<CableEvent, std::vector<RegisteredHandler>> by_event;
+    std::vector<RegisteredHandler> global;
+};
+
+struct DispatcherStats {
+    uint64_t enqueued;
+    uint64_t dispatched;
+    uint64_t dropped;
+    uint64_t handler_errors;
+    size_t queue_depth;
+    size_t queue_capacity;
+    size_t workers;
+};
+
+// Runs InterruptHandlers on a worker pool. Events are sharded by port name, so
+// one port is always served by the same worker and keeps its event order.
+class EventDispatcher {
+public:
+    EventDispatcher(size_t worker_count, size_t queue_capacity);
+    ~EventDispatcher();
+
+    EventDispatcher(const EventDispatcher&) = delete;
+    EventDispatcher& operator=(const EventDispatcher&) = delete;
+
+    // Non-blocking; returns false (and counts a drop) when the port's shard is full
+    bool dispatch(PortEvent event);
+
+    // Readers pick the new table up on their next event
+    void publishHandlers(std::shared_ptr<const HandlerTable> handlers);
+
+    // Wait until every queued event has been handled
+    bool waitIdle(int timeout_ms);
+
+    // Stop the workers; queued events are delivered first
+    void stop();
+
+    DispatcherStats getStats() const;
+    size_t queueDepth() const;
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : queue(capacity), pending(0), sleeping(false) {}
+
+        BoundedMPSCQueue<PortEvent> queue;
+        std::atomic<size_t> pending;
+        std::atomic<bool> sleeping;
+        std::mutex wake_mutex;
+        std::condition_variable wake_cv;
+        std::thread worker;
+    };
+
+    void workerLoop(Shard& shard);
+    void runHandlers(const HandlerTable& handlers, const PortEvent& event);
+    size_t shardFor(common::PortId port_id) const;
+
+    std::vector<std::unique_ptr<Shard>> m_shards;
+    std::atomic<bool> m_running;
+
+    std::shared_ptr<const HandlerTable> m_handlers;
+    std::atomic<uint64_t> m_handlers_version;
+
+    std::atomic<uint64_t> m_enqueued;
+    std::atomic<uint64_t> m_dispatched;
+    std::atomic<uint64_t> m_dropped;
+    std::atomic<uint64_t> m_handler_errors;
+};
+
+} // namespace interrupts
+} // namespace sonic
+
+#endif // SONIC_EVENT_DISPATCHER_H
@@ -0,0 +1,206 @@
+#include "event_history.h"
+#include "../common/logger.h"
+#include "../common/metrics.h"
+#include <algorithm>
+
+namespace sonic {
+namespace interrupts {
+
+EventHistory::EventHistory(size_t capacity)
+    : m_capacity(capacity == 0 ? 1 : capacity), m_ring(m_capacity), m_next_sequence(0),
+      m_window_start(0), m_overwritten(0), m_compacted_at(0), m_dropped_texts(0),
+      m_steady_base(std::chrono::steady_clock::now()),
+      m_wall_base(std::chrono::system_clock::now()) {
+    resetTextsLocked();
+}
+
+void EventHistory::resetTextsLocked() {
+    m_texts.reset(new common::StringInterner(MAX_INFO_STRINGS));
+    // Interned first so there is always room for it
+    m_dropped_text_id = m_texts->intern(DROPPED_TEXT);
+}
+
+void EventHistory::compactTextsLocked() {
+    // Keep only the texts that retained records still point at
+    std::unique_ptr<common::StringInterner> old_texts = std::move(m_texts);
+    resetTextsLocked();
+    auto carry = [this, &old_texts](common::InternId id) {
+        common::InternId carried = m_texts->intern(old_texts->name(id));
+        return carried != common::INVALID_INTERN_ID ? carried : m_dropped_text_id;
+    };
+    for (uint64_t sequence = oldestSequenceLocked(); sequence < m_next_sequence; ++sequence) {
+        EventRecord& record = m_ring[sequence % m_capacity];
+        record.duplex_id = carry(record.duplex_id);
+        record.info_id = carry(record.info_id);
+    }
+    m_compacted_at = m_next_sequence;
+}
+
+common::InternId EventHistory::internTextLocked(const std::string& text) {
+    common::InternId id = m_texts->intern(text);
+    // Rebuild at most once per quarter table of new records, so a history whose
+    // retained texts alone fill the table does not rebuild on every record
+    if (id == common::INVALID_INTERN_ID && m_next_sequence - m_compacted_at >= MAX_INFO_STRINGS / 4) {
+        compactTextsLocked();
+        id = m_texts->intern(text);
+    }
+    if (id != common::INVALID_INTERN_ID) {
+        return id;
+    }
+    SONIC_COUNTER_INC("sonic_interrupt_history_texts_dropped_total",
+                      "Event texts replaced because the history's text table was full");
+    if (m_dropped_texts.fetch_add(1, std::memory_order_relaxed) == 0) {
+        SONIC_LOG_WARN("INTERRUPT", "Event history text table full (" << MAX_INFO_STRINGS
+                       << " strings), new texts are recorded as " << DROPPED_TEXT);
+    }
+    return m_dropped_text_id;
+}
+
+uint64_t EventHistory::oldestSequenceLocked() const {
+    uint64_t oldest = m_next_sequence > m_capacity ? m_next_sequence - m_capacity : 0;
+    return std::max(oldest, m_window_start);
+}
+
+void EventHistory::record(const PortEvent& event) {
+    common::PortId port_id = resolvePortId(event);
+
+    // Keep the record's monotonic time consistent with the wall-clock event time
+    auto steady_time = m_steady_base + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        event.timestamp - m_wall_base);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Texts are interned under the history lock because a rebuild renumbers them
+    common::InternId duplex_id = internTextLocked(event.duplex);
+    common::InternId info_id = internTextLocked(event.additional_info);
+    uint64_t sequence = m_next_sequence++;
+    if (sequence >= m_capacity && sequence - m_capacity >= m_window_start) {
+        ++m_overwritten;
+    }
+    EventRecord& record = m_ring[sequence % m_capacity];
+    record.timestamp = steady_time;
+    record.sequence = sequence;
+    record.port_id = port_id;
+    record.duplex_id = duplex_id;
+    record.info_id = info_id;
+    record.speed_mbps = event.speed_mbps;
+    record.dampening_penalty = event.dampening_penalty;
+    record.suppressed_events = event.suppressed_events;
+    record.event_type = event.event_type;
+    record.old_status = event.old_status;
+    record.new_status = event.new_status;
+    record.prev_port_sequence = NO_SEQUENCE;
+
+    if (port_id != common::INVALID_PORT_ID) {
+        if (port_id >= m_port_last.size()) {
+            m_port_last.resize(port_id + 1, NO_SEQUENCE);
+        }
+        record.prev_port_sequence = m_port_last[port_id];
+        m_port_last[port_id] = sequence;
+    }
+}
+
+void EventHistory::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Sequences keep increasing; everything recorded so far falls out of the window
+    m_window_start = m_next_sequence;
+    std::fill(m_port_last.begin(), m_port_last.end(), NO_SEQUENCE);
+    // No record refers to a text any more
+    resetTextsLocked();
+    m_compacted_at = m_next_sequence;
+}
+
+EventHistory::View EventHistory::view() const {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    uint64_t oldest = oldestSequenceLocked();
+    size_t count = static_cast<size_t>(m_next_sequence - oldest);
+
+    size_t start = static_cast<size_t>(oldest % m_capacity);
+    size_t first_size = std::min(count, m_capacity - start);
+    const EventRecord* first = count ? &m_ring[start] : nullptr;
+    const EventRecord* second = (count > first_size) ? &m_ring[0] : nullptr;
+    return View(std::move(lock), first, first_size, second, count - first_size);
+}
+
+size_t EventHistory::forEachPortEvent(const std::string& port_name,
+                                      const std::function<bool(const EventRecord&)>& visitor) const {
+    common::PortId port_id;
+    if (!common::portNames().find(port_name, port_id)) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (port_id >= m_port_last.size()) {
+        return 0;
+    }
+
+    uint64_t oldest = oldestSequenceLocked();
+    size_t visited = 0;
+    uint64_t seq = m_port_last[port_id];
+    while (seq != NO_SEQUENCE && seq >= oldest) {
+        const EventRecord& record = m_ring[seq % m_capacity];
+        ++visited;
+        if (!visitor(record)) {
+            break;
+        }
+        seq = record.prev_port_sequence;
+    }
+    return visited;
+}
+
+std::vector<PortEvent> EventHistory::getEvents(const std::string& port_name) const {
+    std::vector<PortEvent> events;
+    if (port_name.empty()) {
+        View records = view();
+        events.reserve(records.size());
+        for (const auto& record : records) {
+            events.push_back(toPortEvent(record));
+        }
+        return events;
+    }
+
+    forEachPortEvent(port_name, [this, &events](const EventRecord& record) {
+        events.push_back(toPortEvent(record));
+        return true;
+    });
+    std::reverse(events.begin(), events.end());
+    return events;
+}
+
+PortEvent EventHistory::toPortEvent(const EventRecord& record) const {
+    PortEvent event;
+    event.port_name = common::portNames().name(record.port_id);
+    event.port_id = record.port_id;
+    event.event_type = record.event_type;
+    event.old_status = record.old_status;
+    event.new_status = record.new_status;
+    event.speed_mbps = record.speed_mbps;
+    event.duplex = m_texts->name(record.duplex_id);
+    event.timestamp = m_wall_base + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        record.timestamp - m_steady_base);
+    event.additional_info = m_texts->name(record.info_id);
+    event.dampening_penalty = record.dampening_penalty;
+    event.suppressed_events = record.suppressed_events;
+    return event;
+}
+
+size_t EventHistory::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<size_t>(m_next_sequence - oldestSequenceLocked());
+}
+
+uint64_t EventHistory::totalRecorded() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_next_sequence;
+}
+
+uint64_t EventHistory::overwritten() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_overwritten;
+}
+
+uint64_t EventHistory::droppedTexts() const {
+    return m_dropped_texts.load(std::memory_order_relaxed);
+}
+
+} // namespace interrupts
+} // namespace sonic
@@ -0,0 +1,158 @@
+#ifndef SONIC_EVENT_HISTORY_H
+#define SONIC_EVENT_HISTORY_H
+
+#include "sonic_interrupt_controller.h"
+#include "../common/string_interner.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sonic {
+namespace interrupts {
+
+// Compact history entry: names and texts are interned, time is monotonic
+struct EventRecord {
+    std::chrono::steady_clock::time_point timestamp;
+    uint64_t sequence;
+    uint64_t prev_port_sequence;    // Previous record for the same port (per-port chain)
+    common::PortId port_id;
+    common::InternId duplex_id;
+    common::InternId info_id;
+    uint32_t speed_mbps;
+    uint32_t dampening_penalty;
+    uint32_t suppressed_events;
+    CableEvent event_type;
+    LinkStatus old_status;
+    LinkStatus new_status;
+};
+
+// Fixed-capacity ring buffer of port events. The oldest entry is overwritten
+// when full. Each port keeps a backwards chain through the ring, so a per-port
+// query visits only that port's k records.
+class EventHistory {
+public:
+    static constexpr uint64_t NO_SEQUENCE = UINT64_MAX;
+    static constexpr size_t MAX_INFO_STRINGS = 1024;
+    // Stands in for a text recorded after the text table filled up
+    static constexpr const char* DROPPED_TEXT = "<dropped: event text table full>";
+
+    explicit EventHistory(size_t capacity);
+
+    EventHistory(const EventHistory&) = delete;
+    EventHistory& operator=(const EventHistory&) = delete;
+
+    // Zero-copy view of the retained records, oldest first. The history is
+    // locked for the lifetime of the view, so keep it short-lived.
+    class View {
+    public:
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = EventRecord;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const EventRecord*;
+            using reference = const EventRecord&;
+
+            iterator(const View* view, size_t index) : m_view(view), m_index(index) {}
+            reference operator*() const { return (*m_view)[m_index]; }
+            pointer operator->() const { return &(*m_view)[m_index]; }
+            iterator& operator++() { ++m_index; return *this; }
+            iterator operator++(int) { iterator tmp = *this; ++m_index; return tmp; }
+            bool operator==(const iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+        private:
+            const View* m_view;
+            size_t m_index;
+        };
+
+        View(View&&) = default;
+
+        size_t size() const { return m_first_size + m_second_size; }
+        bool empty() const { return size() == 0; }
+        const EventRecord& operator[](size_t index) const {
+            return index < m_first_size ? m_first[index] : m_second[index - m_first_size];
+        }
+        iterator begin() const { return iterator(this, 0); }
+        iterator end() const { return iterator(this, size()); }
+
+        // The ring as (at most) two contiguous segments
+        const EventRecord* firstSegment() const { return m_first; }
+        size_t firstSegmentSize() const { return m_first_size; }
+        const EventRecord* secondSegment() const { return m_second; }
+        size_t secondSegmentSize() const { return m_second_size; }
+
+    private:
+        friend class EventHistory;
+        View(std::unique_lock<std::mutex>&& lock, const EventRecord* first, size_t first_size,
+             const EventRecord* second, size_t second_size)
+            : m_lock(std::move(lock)), m_first(first), m_first_size(first_size),
+              m_second(second), m_second_size(second_size) {}
+
+        std::unique_lock<std::mutex> m_lock;
+        const EventRecord* m_first;
+        size_t m_first_size;
+        const EventRecord* m_second;
+        size_t m_second_size;
+    };
+
+    void record(const PortEvent& event);
+    void clear();
+
+    View view() const;
+
+    // Visit one port's records newest first without copying; stop early by returning false
+    size_t forEachPortEvent(const std::string& port_name,
+                            const std::function<bool(const EventRecord&)>& visitor) const;
+
+    // Materialized copies in chronological order (empty port_name = all ports)
+    std::vector<PortEvent> getEvents(const std::string& port_name = "") const;
+
+    // Call with a View held; text IDs change when the table is rebuilt
+    PortEvent toPortEvent(const EventRecord& record) const;
+
+    size_t size() const;
+    size_t capacity() const { return m_capacity; }
+    uint64_t totalRecorded() const;
+    uint64_t overwritten() const;       // Records evicted by wrap-around
+    uint64_t droppedTexts() const;      // Texts replaced by DROPPED_TEXT
+
+private:
+    uint64_t oldestSequenceLocked() const;
+
+    const size_t m_capacity;
+    std::vector<EventRecord> m_ring;
+    std::vector<uint64_t> m_port_last;      // Newest sequence per PortId
+    uint64_t m_next_sequence;
+    uint64_t m_window_start;                // First sequence still visible after clear()
+    uint64_t m_overwritten;
+
+    common::InternId internTextLocked(const std::string& text);
+    void resetTextsLocked();
+    void compactTextsLocked();
+
+    // Texts (duplex, additional_info) are low-cardinality; interned per history.
+    // The table is rebuilt from the retained records when it fills and on clear().
+    std::unique_ptr<common::StringInterner> m_texts;
+    common::InternId m_dropped_text_id;
+    uint64_t m_compacted_at;                // m_next_sequence at the last rebuild
+    std::atomic<uint64_t> m_dropped_texts;
+
+    // Maps steady_clock back to wall-clock time for PortEvent
+    std::chrono::steady_clock::time_point m_steady_base;
+    std::chrono::system_clock::time_point m_wall_base;
+
+    mutable std::mutex m_mutex;
+};
+
+} // namespace interrupts
+} // namespace sonic
+
+#endif // SONIC_EVENT_HISTORY_H
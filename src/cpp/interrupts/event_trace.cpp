@@ -0,0 +1,472 @@
+#include "event_trace.h"
+#include "../common/logger.h"
+#include "../common/redis_client.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace sonic {
+namespace interrupts {
+
+namespace {
+
+const char TRACE_MAGIC[8] = {'S', 'N', 'C', 'T', 'R', 'A', 'C', 'E'};
+constexpr uint32_t TRACE_VERSION = 1;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    int64_t start_wall_ns;
+};
+
+struct RecordHeader {
+    uint32_t size;      // Payload bytes
+    uint16_t type;
+    uint16_t reserved;
+    int64_t offset_ns;
+};
+
+constexpr size_t MAX_STRING = 0xFFFF;
+constexpr uint32_t MAX_PAYLOAD = 16 * 1024 * 1024;     // Anything larger is treated as corruption
+
+template <typename T>
+void put(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void putString(std::string& out, const std::string& text) {
+    uint16_t length = static_cast<uint16_t>(std::min(text.size(), MAX_STRING));
+    put(out, length);
+    out.append(text.data(), length);
+}
+
+// Bounds-checked cursor over one record payload
+class PayloadReader {
+public:
+    PayloadReader(const uint8_t* data, size_t size) : m_data(data), m_size(size), m_pos(0), m_ok(true) {}
+
+    template <typename T>
+    T get() {
+        T value{};
+        if (m_pos + sizeof(T) > m_size) {
+            m_ok = false;
+            return value;
+        }
+        std::memcpy(&value, m_data + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return value;
+    }
+
+    std::string getString() {
+        uint16_t length = get<uint16_t>();
+        if (!m_ok || m_pos + length > m_size) {
+            m_ok = false;
+            return std::string();
+        }
+        std::string text(reinterpret_cast<const char*>(m_data + m_pos), length);
+        m_pos += length;
+        return text;
+    }
+
+    bool ok() const { return m_ok; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_pos;
+    bool m_ok;
+};
+
+int64_t toNanoseconds(std::chrono::system_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+std::chrono::system_clock::time_point fromNanoseconds(int64_t ns) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(ns)));
+}
+
+bool writeAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+// ---- EventTraceWriter ----
+
+EventTraceWriter::EventTraceWriter()
+    : m_fd(-1), m_records(0), m_failed(false) {
+}
+
+EventTraceWriter::~EventTraceWriter() {
+    close();
+}
+
+bool EventTraceWriter::open(const std::string& path) {
+    close();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        SONIC_LOG_ERROR("TRACE", "Cannot open " << path << ": " << std::strerror(errno));
+        return false;
+    }
+
+    FileHeader header;
+    std::memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+    header.version = TRACE_VERSION;
+    header.header_size = sizeof(FileHeader);
+    header.start_wall_ns = toNanoseconds(std::chrono::system_clock::now());
+    if (!writeAll(fd, reinterpret_cast<const char*>(&header), sizeof(header))) {
+        SONIC_LOG_ERROR("TRACE", "Cannot write " << path << ": " << std::strerror(errno));
+        ::close(fd);
+        return false;
+    }
+
+    m_fd = fd;
+    m_path = path;
+    m_buffer.clear();
+    m_buffer.reserve(FLUSH_BYTES + 4096);
+    m_start = Clock::now();
+    m_records.store(0, std::memory_order_relaxed);
+    m_failed = false;
+    return true;
+}
+
+void EventTraceWriter::close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_fd < 0) {
+        return;
+    }
+    flushLocked();
+    ::close(m_fd);
+    m_fd = -1;
+}
+
+bool EventTraceWriter::isOpen() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_fd >= 0;
+}
+
+bool EventTraceWriter::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return flushLocked();
+}
+
+bool EventTraceWriter::flushLocked() {
+    if (m_fd < 0 || m_buffer.empty()) {
+        return m_fd >= 0 && !m_failed;
+    }
+    if (!writeAll(m_fd, m_buffer.data(), m_buffer.size())) {
+        if (!m_failed) {
+            SONIC_LOG_ERROR("TRACE", "Write to " << m_path << " failed: " << std::strerror(errno));
+        }
+        m_failed = true;
+    }
+    m_buffer.clear();
+    return !m_failed;
+}
+
+void EventTraceWriter::append(TraceRecordType type, const std::string& payload) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_fd < 0) {
+        return;
+    }
+    // Offsets are taken under the lock so they never go backwards in the file
+    RecordHeader header;
+    header.size = static_cast<uint32_t>(payload.size());
+    header.type = static_cast<uint16_t>(type);
+    header.reserved = 0;
+    header.offset_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start).count();
+    m_buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_buffer.append(payload);
+    m_records.fetch_add(1, std::memory_order_relaxed);
+    if (m_buffer.size() >= FLUSH_BYTES) {
+        flushLocked();
+    }
+}
+
+void EventTraceWriter::recordEvent(const PortEvent& event) {
+    // Encoded outside the lock in a per-thread buffer
+    static thread_local std::string payload;
+    payload.clear();
+    put(payload, static_cast<uint8_t>(event.event_type));
+    put(payload, static_cast<uint8_t>(event.old_status));
+    put(payload, static_cast<uint8_t>(event.new_status));
+    put(payload, static_cast<uint8_t>(0));
+    put(payload, event.speed_mbps);
+    put(payload, toNanoseconds(event.timestamp));
+    putString(payload, event.port_name);
+    putString(payload, event.duplex);
+    putString(payload, event.additional_info);
+    append(TraceRecordType::PORT_EVENT, payload);
+}
+
+void EventTraceWriter::recordRedisWrite(int db_id, const std::string& key, const std::string& field,
+                                        const std::string& value) {
+    static thread_local std::string payload;
+    payload.clear();
+    put(payload, static_cast<int32_t>(db_id));
+    putString(payload, key);
+    putString(payload, field);
+    putString(payload, value);
+    append(TraceRecordType::REDIS_WRITE, payload);
+}
+
+void EventTraceWriter::recordTableUpdate(const PortTableUpdate& update) {
+    static thread_local std::string payload;
+    payload.clear();
+    put(payload, static_cast<uint8_t>(update.table));
+    put(payload, static_cast<uint8_t>(update.deleted ? 1 : 0));
+    put(payload, static_cast<uint16_t>(std::min<size_t>(update.fields.size(), MAX_STRING)));
+    putString(payload, update.port_name);
+    size_t count = 0;
+    for (const auto& field : update.fields) {
+        if (count++ == MAX_STRING) {
+            break;
+        }
+        putString(payload, field.first);
+        putString(payload, field.second);
+    }
+    append(TraceRecordType::TABLE_UPDATE, payload);
+}
+
+// ---- EventTraceReader ----
+
+EventTraceReader::EventTraceReader()
+    : m_data(nullptr), m_size(0), m_pos(0), m_header_size(0), m_start_wall_ns(0), m_truncated(false) {
+}
+
+EventTraceReader::~EventTraceReader() {
+    close();
+}
+
+bool EventTraceReader::open(const std::string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        SONIC_LOG_ERROR("TRACE", "Cannot open " << path << ": " << std::strerror(errno));
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(FileHeader)) {
+        SONIC_LOG_ERROR("TRACE", path << " is not a trace file");
+        ::close(fd);
+        return false;
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        SONIC_LOG_ERROR("TRACE", "Cannot map " << path << ": " << std::strerror(errno));
+        return false;
+    }
+    ::madvise(data, size, MADV_SEQUENTIAL);
+
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) != 0 || header.version != TRACE_VERSION ||
+        header.header_size < sizeof(FileHeader) || header.header_size > size) {
+        SONIC_LOG_ERROR("TRACE", path << " is not a version " << TRACE_VERSION << " trace file");
+        ::munmap(data, size);
+        return false;
+    }
+
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = size;
+    m_header_size = header.header_size;
+    m_pos = m_header_size;
+    m_start_wall_ns = header.start_wall_ns;
+    m_truncated = false;
+    return true;
+}
+
+void EventTraceReader::close() {
+    if (m_data) {
+        ::munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_pos = 0;
+    m_truncated = false;
+}
+
+void EventTraceReader::rewind() {
+    m_pos = m_header_size;
+    m_truncated = false;
+}
+
+std::chrono::system_clock::time_point EventTraceReader::startTime() const {
+    return fromNanoseconds(m_start_wall_ns);
+}
+
+bool EventTraceReader::next(TraceRecord& record) {
+    if (!m_data || m_pos >= m_size) {
+        return false;
+    }
+    RecordHeader header;
+    if (m_pos + sizeof(header) > m_size) {
+        m_truncated = true;
+        return false;
+    }
+    std::memcpy(&header, m_data + m_pos, sizeof(header));
+    if (header.size > MAX_PAYLOAD || m_pos + sizeof(header) + header.size > m_size) {
+        m_truncated = true;
+        return false;
+    }
+
+    PayloadReader payload(m_data + m_pos + sizeof(header), header.size);
+    record.type = static_cast<TraceRecordType>(header.type);
+    record.offset_ns = header.offset_ns;
+    switch (record.type) {
+        case TraceRecordType::PORT_EVENT: {
+            PortEvent& event = record.event;
+            event.event_type = static_cast<CableEvent>(payload.get<uint8_t>());
+            event.old_status = static_cast<LinkStatus>(payload.get<uint8_t>());
+            event.new_status = static_cast<LinkStatus>(payload.get<uint8_t>());
+            payload.get<uint8_t>();
+            event.speed_mbps = payload.get<uint32_t>();
+            event.timestamp = fromNanoseconds(payload.get<int64_t>());
+            event.port_name = payload.getString();
+            event.duplex = payload.getString();
+            event.additional_info = payload.getString();
+            break;
+        }
+        case TraceRecordType::REDIS_WRITE:
+            record.redis_db = payload.get<int32_t>();
+            record.redis_key = payload.getString();
+            record.redis_field = payload.getString();
+            record.redis_value = payload.getString();
+            break;
+        case TraceRecordType::TABLE_UPDATE: {
+            PortTableUpdate& update = record.update;
+            update.table = static_cast<PortTableUpdate::Table>(payload.get<uint8_t>());
+            update.deleted = payload.get<uint8_t>() != 0;
+            uint16_t field_count = payload.get<uint16_t>();
+            update.port_name = payload.getString();
+            update.fields.clear();
+            for (uint16_t i = 0; i < field_count && payload.ok(); ++i) {
+                std::string field = payload.getString();
+                update.fields[field] = payload.getString();
+            }
+            break;
+        }
+        default:
+            break;      // Unknown types from a newer writer are returned as-is for the caller to skip
+    }
+    if (!payload.ok()) {
+        m_truncated = true;
+        return false;
+    }
+    m_pos += sizeof(header) + header.size;
+    return true;
+}
+
+// ---- EventReplayer ----
+
+EventReplayer::EventReplayer(SONiCInterruptController& controller)
+    : m_controller(controller), m_stop(false) {
+}
+
+bool EventReplayer::replay(const std::string& path, const ReplayOptions& options, ReplayStats& stats) {
+    stats = ReplayStats();
+    EventTraceReader reader;
+    if (!reader.open(path)) {
+        return false;
+    }
+    m_stop.store(false);
+
+    uint64_t dropped_before = m_controller.getEventStatistics()["dispatch_dropped"];
+    auto start = std::chrono::steady_clock::now();
+    double total_lag_us = 0;
+    uint64_t scheduled = 0;
+    int64_t last_offset_ns = 0;
+    std::vector<PortTableUpdate> updates(1);
+
+    TraceRecord record;
+    while (!m_stop.load(std::memory_order_relaxed) && reader.next(record)) {
+        stats.records++;
+        last_offset_ns = record.offset_ns;
+
+        if (options.speed > 0) {
+            auto due = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double, std::nano>(record.offset_ns / options.speed));
+            auto now = std::chrono::steady_clock::now();
+            if (now < due) {
+                // Sleep for the bulk of the gap, then yield up to the due time
+                if (due - now > std::chrono::microseconds(200)) {
+                    std::this_thread::sleep_until(due - std::chrono::microseconds(100));
+                }
+                while (std::chrono::steady_clock::now() < due) {
+                    std::this_thread::yield();
+                }
+                now = std::chrono::steady_clock::now();
+            }
+            double lag_us = std::chrono::duration<double, std::micro>(now - due).count();
+            total_lag_us += lag_us;
+            stats.max_lag_us = std::max(stats.max_lag_us, lag_us);
+            scheduled++;
+        }
+
+        switch (record.type) {
+            case TraceRecordType::PORT_EVENT:
+                if (options.source == ReplayOptions::Source::EVENTS) {
+                    if (options.restamp) {
+                        record.event.timestamp = std::chrono::system_clock::now();
+                    }
+                    m_controller.injectEvent(record.event);
+                    stats.events_injected++;
+                }
+                break;
+            case TraceRecordType::TABLE_UPDATE:
+                if (options.source == ReplayOptions::Source::TABLE_UPDATES) {
+                    updates[0] = record.update;
+                    m_controller.injectPortTableUpdates(updates);
+                    stats.table_updates++;
+                }
+                break;
+            case TraceRecordType::REDIS_WRITE:
+                if (options.redis) {
+                    bool ok = record.redis_field.empty()
+                        ? options.redis->set(record.redis_db, record.redis_key, record.redis_value)
+                        : options.redis->hset(record.redis_db, record.redis_key, record.redis_field,
+                                              record.redis_value);
+                    stats.redis_writes++;
+                    stats.redis_failures += ok ? 0 : 1;
+                }
+                break;
+        }
+    }
+
+    m_controller.flushEvents(10000);
+    stats.elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    stats.trace_span_s = last_offset_ns / 1e9;
+    stats.mean_lag_us = scheduled ? total_lag_us / scheduled : 0;
+    stats.truncated = reader.truncated();
+    stats.dispatch_dropped = m_controller.getEventStatistics()["dispatch_dropped"] - dropped_before;
+    if (stats.truncated) {
+        SONIC_LOG_WARN("TRACE", path << " ends in a partial record; replayed the " << stats.records
+                       << " complete ones");
+    }
+    return true;
+}
+
+} // namespace interrupts
+} // namespace sonic
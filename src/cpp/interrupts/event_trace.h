@@ -0,0 +1,165 @@
+#ifndef SONIC_EVENT_TRACE_H
+#define SONIC_EVENT_TRACE_H
+
+#include "sonic_interrupt_controller.h"
+#include "port_table_subscriber.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace sonic {
+namespace common {
+class RedisClient;
+}
+
+namespace interrupts {
+
+// Binary trace of the interrupt subsystem's input and output, for replaying
+// captured link-event storms. The file is a header followed by append-only
+// records, all in host byte order:
+//
+//   header  "SNCTRACE" magic, u32 version, u32 header size, i64 wall-clock start (ns)
+//   record  u32 payload size, u16 type, u16 reserved, i64 ns since start, payload
+//
+// Strings in payloads are a u16 length and the bytes. A record cut short by a
+// crash ends the trace; everything before it stays readable.
+enum class TraceRecordType : uint16_t {
+    PORT_EVENT = 1,     // Event entering triggerEvent(), before dampening
+    REDIS_WRITE = 2,    // SET (empty field) or HSET issued by the controller
+    TABLE_UPDATE = 3    // PORT_TABLE / TRANSCEIVER_INFO change seen by the monitor
+};
+
+struct TraceRecord {
+    TraceRecordType type;
+    int64_t offset_ns;              // Since the trace started
+
+    PortEvent event;                // PORT_EVENT
+
+    int redis_db = 0;               // REDIS_WRITE
+    std::string redis_key;
+    std::string redis_field;
+    std::string redis_value;
+
+    PortTableUpdate update;         // TABLE_UPDATE
+};
+
+// Appends records to a trace file. Thread-safe; records are buffered and
+// written in large chunks, so the file lags by up to FLUSH_BYTES until flush().
+class EventTraceWriter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t FLUSH_BYTES = 64 * 1024;
+
+    EventTraceWriter();
+    ~EventTraceWriter();
+
+    EventTraceWriter(const EventTraceWriter&) = delete;
+    EventTraceWriter& operator=(const EventTraceWriter&) = delete;
+
+    // Truncates the file and writes the header
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const;
+
+    void recordEvent(const PortEvent& event);
+    void recordRedisWrite(int db_id, const std::string& key, const std::string& field, const std::string& value);
+    void recordTableUpdate(const PortTableUpdate& update);
+
+    bool flush();
+
+    uint64_t recordCount() const { return m_records.load(std::memory_order_relaxed); }
+    const std::string& path() const { return m_path; }
+
+private:
+    void append(TraceRecordType type, const std::string& payload);
+    bool flushLocked();
+
+    mutable std::mutex m_mutex;
+    int m_fd;
+    std::string m_path;
+    std::string m_buffer;
+    Clock::time_point m_start;
+    std::atomic<uint64_t> m_records;
+    bool m_failed;
+};
+
+// Memory-mapped, sequential reader for files written by EventTraceWriter
+class EventTraceReader {
+public:
+    EventTraceReader();
+    ~EventTraceReader();
+
+    EventTraceReader(const EventTraceReader&) = delete;
+    EventTraceReader& operator=(const EventTraceReader&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+
+    // False at the end of the trace, or at a truncated or corrupt record
+    bool next(TraceRecord& record);
+    void rewind();
+
+    // A partial record was found where the trace ended
+    bool truncated() const { return m_truncated; }
+    std::chrono::system_clock::time_point startTime() const;
+    size_t sizeBytes() const { return m_size; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_pos;
+    size_t m_header_size;
+    int64_t m_start_wall_ns;
+    bool m_truncated;
+};
+
+struct ReplayOptions {
+    enum class Source {
+        EVENTS,         // Inject recorded PortEvents straight into dispatch
+        TABLE_UPDATES   // Feed recorded table updates through the monitor path, which derives the events
+    };
+
+    double speed = 1.0;             // Multiple of recorded time; 0 replays as fast as possible
+    Source source = Source::EVENTS;
+    bool restamp = true;            // Set event timestamps to injection time, for inject-to-handler latency
+    common::RedisClient* redis = nullptr;   // When set, recorded Redis writes are issued again
+};
+
+struct ReplayStats {
+    uint64_t records = 0;
+    uint64_t events_injected = 0;
+    uint64_t table_updates = 0;
+    uint64_t redis_writes = 0;
+    uint64_t redis_failures = 0;
+    uint64_t dispatch_dropped = 0;  // Events the dispatch queues dropped during the replay
+    double trace_span_s = 0;        // Recorded time covered
+    double elapsed_s = 0;
+    double mean_lag_us = 0;         // How late records were fed relative to the scaled schedule
+    double max_lag_us = 0;
+    bool truncated = false;
+};
+
+// Feeds a trace back through a controller, keeping the recorded spacing
+// scaled by ReplayOptions::speed
+class EventReplayer {
+public:
+    explicit EventReplayer(SONiCInterruptController& controller);
+
+    bool replay(const std::string& path, const ReplayOptions& options, ReplayStats& stats);
+
+    // Ask a running replay() to return early; safe from any thread
+    void stop() { m_stop.store(true); }
+
+private:
+    SONiCInterruptController& m_controller;
+    std::atomic<bool> m_stop;
+};
+
+} // namespace interrupts
+} // namespace sonic
+
+#endif // SONIC_EVENT_TRACE_H
@@ -0,0 +1,224 @@
+#include "flap_dampener.h"
+#include <algorithm>
+#include <cmath>
+
+namespace sonic {
+namespace interrupts {
+
+FlapDampener::FlapDampener(const DampeningConfig& config)
+    : m_config(config), m_suppressions(0), m_releases(0), m_absorbed(0) {
+}
+
+void FlapDampener::setConfig(const DampeningConfig& config) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_config = config;
+}
+
+void FlapDampener::setPortConfig(const std::string& port_name, const DampeningConfig& config) {
+    common::PortId port_id = common::portNames().intern(port_name);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_port_configs[port_id] = config;
+}
+
+void FlapDampener::clearPortConfig(const std::string& port_name) {
+    common::PortId port_id;
+    if (!common::portNames().find(port_name, port_id)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_port_configs.erase(port_id);
+}
+
+DampeningConfig FlapDampener::getConfig(const std::string& port_name) const {
+    common::PortId port_id = common::INVALID_PORT_ID;
+    common::portNames().find(port_name, port_id);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return configFor(port_id);
+}
+
+const DampeningConfig& FlapDampener::configFor(common::PortId port_id) const {
+    if (m_port_configs.empty()) {
+        return m_config;
+    }
+    auto it = m_port_configs.find(port_id);
+    return it != m_port_configs.end() ? it->second : m_config;
+}
+
+bool FlapDampener::isFlapEvent(CableEvent event) {
+    switch (event) {
+        case CableEvent::LINK_UP:
+        case CableEvent::LINK_DOWN:
+        case CableEvent::CABLE_INSERTED:
+        case CableEvent::CABLE_REMOVED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+double FlapDampener::decayedPenalty(const PortState& state, const DampeningConfig& config,
+                                    Clock::time_point now) {
+    if (state.penalty <= 0.0 || config.half_life_ms <= 0) {
+        return state.penalty;
+    }
+    double elapsed_ms = std::chrono::duration<double, std::milli>(now - state.updated).count();
+    if (elapsed_ms <= 0.0) {
+        return state.penalty;
+    }
+    return state.penalty * std::exp2(-elapsed_ms / config.half_life_ms);
+}
+
+double FlapDampener::maxPenalty(const DampeningConfig& config) {
+    if (config.half_life_ms <= 0) {
+        return config.suppress_threshold;
+    }
+    return config.reuse_threshold * std::exp2(static_cast<double>(config.max_suppress_ms) / config.half_life_ms);
+}
+
+FlapDampener::Action FlapDampener::process(const PortEvent& event, Clock::time_point now, PortEvent& notice) {
+    if (!isFlapEvent(event.event_type)) {
+        return Action::DELIVER;
+    }
+
+    common::PortId port_id = resolvePortId(event);
+    if (port_id == common::INVALID_PORT_ID) {
+        return Action::DELIVER;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const DampeningConfig& config = configFor(port_id);
+    if (!config.enabled) {
+        return Action::DELIVER;
+    }
+
+    if (port_id >= m_ports.size()) {
+        m_ports.resize(port_id + 1);
+    }
+    PortState& state = m_ports[port_id];
+    state.penalty = decayedPenalty(state, config, now);
+    state.updated = now;
+
+    // Only transitions towards down count as a flap, like a BGP withdraw
+    if (event.event_type == CableEvent::LINK_DOWN || event.event_type == CableEvent::CABLE_REMOVED) {
+        state.penalty = std::min(state.penalty + config.penalty_per_flap, maxPenalty(config));
+    }
+
+    if (state.suppressed) {
+        state.last_event = event;
+        state.absorbed++;
+        m_absorbed++;
+        return Action::ABSORB;
+    }
+
+    if (state.penalty < config.suppress_threshold) {
+        return Action::DELIVER;
+    }
+
+    state.suppressed = true;
+    state.status_before = event.old_status;
+    state.last_event = event;
+    state.absorbed = 1;
+    m_suppressions++;
+    m_absorbed++;
+
+    notice = event;
+    notice.event_type = CableEvent::FLAP_SUPPRESSED;
+    notice.additional_info = "Flap dampening: suppress threshold reached";
+    notice.dampening_penalty = static_cast<uint32_t>(state.penalty);
+    return Action::SUPPRESS;
+}
+
+void FlapDampener::collectReleased(Clock::time_point now, std::vector<PortEvent>& released) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t port_id = 0; port_id < m_ports.size(); ++port_id) {
+        PortState& state = m_ports[port_id];
+        if (!state.suppressed) {
+            continue;
+        }
+
+        const DampeningConfig& config = configFor(static_cast<common::PortId>(port_id));
+        double penalty = decayedPenalty(state, config, now);
+        if (config.enabled && penalty >= config.reuse_threshold) {
+            continue;
+        }
+
+        state.penalty = penalty;
+        state.updated = now;
+        state.suppressed = false;
+        m_releases++;
+
+        PortEvent event = state.last_event;
+        event.event_type = CableEvent::FLAP_UNSUPPRESSED;
+        event.old_status = state.status_before;
+        event.timestamp = std::chrono::system_clock::now();
+        event.additional_info = "Flap dampening: released";
+        event.suppressed_events = static_cast<uint32_t>(state.absorbed);
+        released.push_back(event);
+    }
+}
+
+int FlapDampener::msUntilNextRelease(Clock::time_point now) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    double next_ms = -1.0;
+    for (size_t port_id = 0; port_id < m_ports.size(); ++port_id) {
+        const PortState& state = m_ports[port_id];
+        if (!state.suppressed) {
+            continue;
+        }
+
+        const DampeningConfig& config = configFor(static_cast<common::PortId>(port_id));
+        double penalty = decayedPenalty(state, config, now);
+        double wait_ms = 0.0;
+        if (config.enabled && penalty >= config.reuse_threshold && config.reuse_threshold > 0.0) {
+            wait_ms = config.half_life_ms * std::log2(penalty / config.reuse_threshold);
+        }
+        if (next_ms < 0.0 || wait_ms < next_ms) {
+            next_ms = wait_ms;
+        }
+    }
+    return next_ms < 0.0 ? -1 : static_cast<int>(std::ceil(next_ms));
+}
+
+bool FlapDampener::isSuppressed(const std::string& port_name) const {
+    common::PortId port_id;
+    if (!common::portNames().find(port_name, port_id)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return port_id < m_ports.size() && m_ports[port_id].suppressed;
+}
+
+double FlapDampener::getPenalty(const std::string& port_name, Clock::time_point now) const {
+    common::PortId port_id;
+    if (!common::portNames().find(port_name, port_id)) {
+        return 0.0;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (port_id >= m_ports.size()) {
+        return 0.0;
+    }
+    return decayedPenalty(m_ports[port_id], configFor(port_id), now);
+}
+
+DampeningStats FlapDampener::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    DampeningStats stats;
+    stats.suppressions = m_suppressions;
+    stats.releases = m_releases;
+    stats.absorbed_events = m_absorbed;
+    stats.suppressed_ports = 0;
+    for (const auto& state : m_ports) {
+        if (state.suppressed) {
+            stats.suppressed_ports++;
+        }
+    }
+    return stats;
+}
+
+void FlapDampener::reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_ports.clear();
+}
+
+} // namespace interrupts
+} // namespace sonic
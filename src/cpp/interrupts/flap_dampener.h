@@ -0,0 +1,96 @@
+#ifndef SONIC_FLAP_DAMPENER_H
+#define SONIC_FLAP_DAMPENER_H
+
+#include "sonic_interrupt_controller.h"
+#include "../common/string_interner.h"
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sonic {
+namespace interrupts {
+
+// BGP-style flap penalties: every down transition adds a penalty that decays
+// with the configured half-life. Crossing suppress_threshold suppresses the port
+// until the penalty decays below reuse_threshold.
+struct DampeningConfig {
+    bool enabled = false;
+    double penalty_per_flap = 1000.0;
+    double suppress_threshold = 2000.0;
+    double reuse_threshold = 750.0;
+    int half_life_ms = 15000;
+    int max_suppress_ms = 60000;    // Caps the penalty so a port is never suppressed longer
+};
+
+struct DampeningStats {
+    uint64_t suppressions;
+    uint64_t releases;
+    uint64_t absorbed_events;
+    uint64_t suppressed_ports;
+};
+
+class FlapDampener {
+public:
+    enum class Action {
+        DELIVER,    // Pass the event through unchanged
+        SUPPRESS,   // Port just got suppressed; deliver the FLAP_SUPPRESSED notice instead
+        ABSORB      // Port is suppressed; drop the event
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    explicit FlapDampener(const DampeningConfig& config = DampeningConfig());
+
+    void setConfig(const DampeningConfig& config);
+    void setPortConfig(const std::string& port_name, const DampeningConfig& config);
+    void clearPortConfig(const std::string& port_name);
+    DampeningConfig getConfig(const std::string& port_name) const;
+
+    Action process(const PortEvent& event, Clock::time_point now, PortEvent& notice);
+
+    // Append one FLAP_UNSUPPRESSED event (carrying the latest state) per released port
+    void collectReleased(Clock::time_point now, std::vector<PortEvent>& released);
+
+    // Time until the next suppressed port may be released, -1 when none is suppressed
+    int msUntilNextRelease(Clock::time_point now) const;
+
+    bool isSuppressed(const std::string& port_name) const;
+    double getPenalty(const std::string& port_name, Clock::time_point now) const;
+    DampeningStats getStats() const;
+    void reset();
+
+    static bool isFlapEvent(CableEvent event);
+
+private:
+    struct PortState {
+        double penalty = 0.0;
+        Clock::time_point updated;
+        bool suppressed = false;
+        uint64_t absorbed = 0;
+        LinkStatus status_before = LinkStatus::UNKNOWN;
+        PortEvent last_event;
+    };
+
+    const DampeningConfig& configFor(common::PortId port_id) const;
+    static double decayedPenalty(const PortState& state, const DampeningConfig& config,
+                                 Clock::time_point now);
+    static double maxPenalty(const DampeningConfig& config);
+
+    DampeningConfig m_config;
+    std::map<common::PortId, DampeningConfig> m_port_configs;
+    std::vector<PortState> m_ports;     // Indexed by PortId; a default state means never flapped
+
+    uint64_t m_suppressions;
+    uint64_t m_releases;
+    uint64_t m_absorbed;
+
+    mutable std::mutex m_mutex;
+};
+
+} // namespace interrupts
+} // namespace sonic
+
+#endif // SONIC_FLAP_DAMPENER_H
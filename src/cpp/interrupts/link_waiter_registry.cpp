@@ -0,0 +1,175 @@
+#include "link_waiter_registry.h"
+#include <algorithm>
+
+namespace sonic {
+namespace interrupts {
+
+LinkWaiterRegistry::LinkWaiterRegistry()
+    : m_next_id(1), m_pending(0), m_running(true) {
+}
+
+LinkWaiterRegistry::~LinkWaiterRegistry() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+    }
+    m_timer_cv.notify_all();
+    if (m_timer.joinable()) {
+        m_timer.join();
+    }
+    cancelAll();
+}
+
+bool LinkWaiterRegistry::changesLinkStatus(CableEvent event) {
+    switch (event) {
+        case CableEvent::CABLE_INSERTED:
+        case CableEvent::CABLE_REMOVED:
+        case CableEvent::LINK_UP:
+        case CableEvent::LINK_DOWN:
+            return true;
+        default:
+            return false;
+    }
+}
+
+uint64_t LinkWaiterRegistry::makeKey(common::PortId port_id, Kind kind, uint8_t value) {
+    return (static_cast<uint64_t>(port_id) << 16) | (static_cast<uint64_t>(kind) << 8) | value;
+}
+
+std::future<bool> LinkWaiterRegistry::waitForEvent(const std::string& port_name, CableEvent event,
+                                                   int timeout_ms, WaiterId* id) {
+    return add(port_name, Kind::EVENT, static_cast<uint8_t>(event), timeout_ms, id);
+}
+
+std::future<bool> LinkWaiterRegistry::waitForStatus(const std::string& port_name, LinkStatus status,
+                                                    int timeout_ms, WaiterId* id) {
+    return add(port_name, Kind::STATUS, static_cast<uint8_t>(status), timeout_ms, id);
+}
+
+std::future<bool> LinkWaiterRegistry::add(const std::string& port_name, Kind kind, uint8_t value,
+                                          int timeout_ms, WaiterId* id) {
+    // Intern before taking the registry lock; the name table locks itself
+    uint64_t key = makeKey(common::portNames().intern(port_name), kind, value);
+    auto deadline = Clock::now() + std::chrono::milliseconds(std::max(timeout_ms, 0));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Waiter waiter;
+    waiter.id = m_next_id++;
+    waiter.deadline = m_deadlines.emplace(deadline, waiter.id);
+    std::future<bool> future = waiter.promise.get_future();
+    if (id) {
+        *id = waiter.id;
+    }
+
+    bool earliest = waiter.deadline == m_deadlines.begin();
+    m_keys[waiter.id] = key;
+    m_waiters[key].push_back(std::move(waiter));
+    // seq_cst pairs with the load in notify(): a waiter that registers and then checks the
+    // current state, racing an event that updates the state and then checks m_pending,
+    // cannot have both sides miss the other
+    m_pending.fetch_add(1);
+
+    if (!m_timer.joinable() && m_running) {
+        m_timer = std::thread(&LinkWaiterRegistry::timerLoop, this);
+    } else if (earliest) {
+        m_timer_cv.notify_one();
+    }
+    return future;
+}
+
+bool LinkWaiterRegistry::resolveLocked(WaiterId id, bool result) {
+    auto key_it = m_keys.find(id);
+    if (key_it == m_keys.end()) {
+        return false;
+    }
+    auto list_it = m_waiters.find(key_it->second);
+    m_keys.erase(key_it);
+    if (list_it == m_waiters.end()) {
+        return false;
+    }
+
+    std::vector<Waiter>& waiters = list_it->second;
+    auto it = std::find_if(waiters.begin(), waiters.end(), [id](const Waiter& w) { return w.id == id; });
+    if (it == waiters.end()) {
+        return false;
+    }
+    it->promise.set_value(result);
+    m_deadlines.erase(it->deadline);
+    if (&*it != &waiters.back()) {
+        *it = std::move(waiters.back());
+    }
+    waiters.pop_back();
+    if (waiters.empty()) {
+        m_waiters.erase(list_it);
+    }
+    m_pending.fetch_sub(1);
+    return true;
+}
+
+void LinkWaiterRegistry::resolveKeyLocked(uint64_t key, bool result) {
+    auto list_it = m_waiters.find(key);
+    if (list_it == m_waiters.end()) {
+        return;
+    }
+    for (auto& waiter : list_it->second) {
+        waiter.promise.set_value(result);
+        m_deadlines.erase(waiter.deadline);
+        m_keys.erase(waiter.id);
+    }
+    m_pending.fetch_sub(list_it->second.size());
+    m_waiters.erase(list_it);
+}
+
+bool LinkWaiterRegistry::resolve(WaiterId id, bool result) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return resolveLocked(id, result);
+}
+
+void LinkWaiterRegistry::notify(const PortEvent& event) {
+    if (m_pending.load() == 0) {
+        return;
+    }
+    common::PortId port_id = event.port_id;
+    if (port_id == common::INVALID_PORT_ID && !common::portNames().find(event.port_name, port_id)) {
+        return;     // Nobody has ever waited on this port
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    resolveKeyLocked(makeKey(port_id, Kind::EVENT, static_cast<uint8_t>(event.event_type)), true);
+    if (changesLinkStatus(event.event_type)) {
+        resolveKeyLocked(makeKey(port_id, Kind::STATUS, static_cast<uint8_t>(event.new_status)), true);
+    }
+}
+
+void LinkWaiterRegistry::cancelAll() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& entry : m_waiters) {
+        for (auto& waiter : entry.second) {
+            waiter.promise.set_value(false);
+        }
+    }
+    m_waiters.clear();
+    m_keys.clear();
+    m_deadlines.clear();
+    m_pending.store(0);
+}
+
+void LinkWaiterRegistry::timerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_running) {
+        if (m_deadlines.empty()) {
+            m_timer_cv.wait(lock);
+            continue;
+        }
+        Clock::time_point next = m_deadlines.begin()->first;
+        if (Clock::now() < next) {
+            m_timer_cv.wait_until(lock, next);
+            continue;
+        }
+        // resolveLocked() erases the deadline entry it was found through
+        resolveLocked(m_deadlines.begin()->second, false);
+    }
+}
+
+} // namespace interrupts
+} // namespace sonic
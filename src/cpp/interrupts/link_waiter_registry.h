@@ -0,0 +1,91 @@
+#ifndef SONIC_LINK_WAITER_REGISTRY_H
+#define SONIC_LINK_WAITER_REGISTRY_H
+
+#include "sonic_interrupt_controller.h"
+#include "../common/string_interner.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace sonic {
+namespace interrupts {
+
+// Threads waiting for a port event or link status, keyed by (port, event) or
+// (port, status). notify() resolves the matching waiters directly, so a waiter
+// wakes as soon as the event is triggered instead of on its next poll. A timer
+// thread, started with the first waiter, resolves expired waiters with false.
+class LinkWaiterRegistry {
+public:
+    using Clock = std::chrono::steady_clock;
+    using WaiterId = uint64_t;
+
+    LinkWaiterRegistry();
+    ~LinkWaiterRegistry();
+
+    LinkWaiterRegistry(const LinkWaiterRegistry&) = delete;
+    LinkWaiterRegistry& operator=(const LinkWaiterRegistry&) = delete;
+
+    // The future becomes true when a matching event is notified, false once
+    // timeout_ms passes or on cancelAll(). id, when given, allows resolve().
+    std::future<bool> waitForEvent(const std::string& port_name, CableEvent event, int timeout_ms,
+                                   WaiterId* id = nullptr);
+    std::future<bool> waitForStatus(const std::string& port_name, LinkStatus status, int timeout_ms,
+                                    WaiterId* id = nullptr);
+
+    // Resolve one waiter early, e.g. when its status already holds; false if it was already resolved
+    bool resolve(WaiterId id, bool result);
+
+    // Resolve waiters on the event's port for its event type and, for link
+    // transitions, its new status. Costs one atomic load when nobody waits.
+    void notify(const PortEvent& event);
+
+    // Resolve every pending waiter with false
+    void cancelAll();
+
+    size_t pending() const { return m_pending.load(); }
+
+    // Link transitions that satisfy status waiters; SFP and dampening notices do not
+    static bool changesLinkStatus(CableEvent event);
+
+private:
+    enum class Kind : uint8_t { EVENT, STATUS };
+
+    using Deadlines = std::multimap<Clock::time_point, WaiterId>;
+
+    struct Waiter {
+        WaiterId id;
+        std::promise<bool> promise;
+        Deadlines::iterator deadline;
+    };
+
+    static uint64_t makeKey(common::PortId port_id, Kind kind, uint8_t value);
+
+    std::future<bool> add(const std::string& port_name, Kind kind, uint8_t value, int timeout_ms,
+                          WaiterId* id);
+    void resolveKeyLocked(uint64_t key, bool result);
+    bool resolveLocked(WaiterId id, bool result);
+    void timerLoop();
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_timer_cv;
+    std::unordered_map<uint64_t, std::vector<Waiter>> m_waiters;    // By (port, kind, value)
+    std::unordered_map<WaiterId, uint64_t> m_keys;                  // Waiter -> its key
+    Deadlines m_deadlines;
+    WaiterId m_next_id;
+    std::atomic<size_t> m_pending;
+    bool m_running;
+    std::thread m_timer;
+};
+
+} // namespace interrupts
+} // namespace sonic
+
+#endif // SONIC_LINK_WAITER_REGISTRY_H
@@ -0,0 +1,305 @@
+#include "port_state_table.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace sonic {
+namespace interrupts {
+
+namespace {
+
+void copyText(char* dest, size_t size, const std::string& text) {
+    size_t length = std::min(text.size(), size - 1);
+    std::memcpy(dest, text.data(), length);
+    std::memset(dest + length, 0, size - length);
+}
+
+std::string fromText(const char* text, size_t size) {
+    return std::string(text, strnlen(text, size));
+}
+
+} // anonymous namespace
+
+PortStateTable::PortStateTable()
+    : m_slots(new Slot[MAX_PORTS]), m_index(std::make_shared<NameIndex>()) {
+}
+
+LinkState PortStateTable::defaultState(const std::string& port_name) {
+    LinkState state;
+    state.port_name = port_name;
+    common::portNames().find(port_name, state.port_id);
+    state.admin_status = LinkStatus::UNKNOWN;
+    state.oper_status = LinkStatus::UNKNOWN;
+    state.speed_mbps = 0;
+    state.duplex = "unknown";
+    state.auto_neg = false;
+    state.mtu = 1500;
+    state.mac_address = "00:00:00:00:00:00";
+    state.last_change = std::chrono::system_clock::now();
+    state.link_up_count = 0;
+    state.link_down_count = 0;
+    return state;
+}
+
+void PortStateTable::toRecord(const LinkState& state, Record& record) {
+    std::memset(&record, 0, sizeof(record));
+    record.present = 1;
+    record.admin_status = static_cast<uint8_t>(state.admin_status);
+    record.oper_status = static_cast<uint8_t>(state.oper_status);
+    record.auto_neg = state.auto_neg ? 1 : 0;
+    record.speed_mbps = state.speed_mbps;
+    record.mtu = state.mtu;
+    copyText(record.duplex, sizeof(record.duplex), state.duplex);
+    copyText(record.mac_address, sizeof(record.mac_address), state.mac_address);
+    record.last_change_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        state.last_change.time_since_epoch()).count();
+    record.link_up_count = state.link_up_count;
+    record.link_down_count = state.link_down_count;
+}
+
+void PortStateTable::toLinkState(const Record& record, common::PortId port_id, const std::string& port_name,
+                                 LinkState& state) {
+    state.port_name = port_name;
+    state.port_id = port_id;
+    state.admin_status = static_cast<LinkStatus>(record.admin_status);
+    state.oper_status = static_cast<LinkStatus>(record.oper_status);
+    state.speed_mbps = record.speed_mbps;
+    state.duplex = fromText(record.duplex, sizeof(record.duplex));
+    state.auto_neg = record.auto_neg != 0;
+    state.mtu = record.mtu;
+    state.mac_address = fromText(record.mac_address, sizeof(record.mac_address));
+    state.last_change = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(record.last_change_ns)));
+    state.link_up_count = record.link_up_count;
+    state.link_down_count = record.link_down_count;
+}
+
+void PortStateTable::readSlot(const Slot& slot, Record& record) const {
+    uint64_t words[RECORD_WORDS];
+    for (;;) {
+        uint32_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            std::this_thread::yield();      // A writer is mid-update; it holds the slot for a few stores
+            continue;
+        }
+        for (size_t i = 0; i < RECORD_WORDS; ++i) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == before) {
+            break;
+        }
+    }
+    std::memcpy(&record, words, sizeof(record));
+}
+
+uint32_t PortStateTable::lockSlot(Slot& slot) {
+    uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    for (;;) {
+        if (!(sequence & 1) &&
+            slot.sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire)) {
+            std::atomic_thread_fence(std::memory_order_release);
+            return sequence + 1;
+        }
+        std::this_thread::yield();
+        sequence = slot.sequence.load(std::memory_order_relaxed);
+    }
+}
+
+void PortStateTable::writeAndUnlock(Slot& slot, uint32_t sequence, const Record& record) {
+    uint64_t words[RECORD_WORDS] = {};
+    std::memcpy(words, &record, sizeof(record));
+    for (size_t i = 0; i < RECORD_WORDS; ++i) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(sequence + 1, std::memory_order_release);
+}
+
+void PortStateTable::unlock(Slot& slot, uint32_t sequence) {
+    // Nothing was written, but readers that saw the odd value only need a different even one
+    slot.sequence.store(sequence + 1, std::memory_order_release);
+}
+
+common::PortId PortStateTable::findId(const std::string& port_name) const {
+    std::shared_ptr<const NameIndex> index = std::atomic_load(&m_index);
+    auto it = std::lower_bound(index->begin(), index->end(), port_name,
+                               [](const NameIndex::value_type& entry, const std::string& name) {
+                                   return entry.first < name;
+                               });
+    return it != index->end() && it->first == port_name ? it->second : common::INVALID_PORT_ID;
+}
+
+void PortStateTable::addToIndex(const std::string& port_name, common::PortId port_id) {
+    std::lock_guard<std::mutex> lock(m_index_mutex);
+    std::shared_ptr<const NameIndex> current = std::atomic_load(&m_index);
+    auto it = std::lower_bound(current->begin(), current->end(), port_name,
+                               [](const NameIndex::value_type& entry, const std::string& name) {
+                                   return entry.first < name;
+                               });
+    if (it != current->end() && it->first == port_name) {
+        return;
+    }
+    auto index = std::make_shared<NameIndex>();
+    index->reserve(current->size() + 1);
+    index->insert(index->end(), current->begin(), it);
+    index->emplace_back(port_name, port_id);
+    index->insert(index->end(), it, current->end());
+    std::atomic_store(&m_index, std::shared_ptr<const NameIndex>(std::move(index)));
+}
+
+bool PortStateTable::get(common::PortId port_id, LinkState& state) const {
+    if (port_id >= MAX_PORTS) {
+        return false;
+    }
+    Record record;
+    readSlot(m_slots[port_id], record);
+    if (!record.present) {
+        return false;
+    }
+    toLinkState(record, port_id, common::portNames().name(port_id), state);
+    return true;
+}
+
+bool PortStateTable::get(const std::string& port_name, LinkState& state) const {
+    common::PortId port_id = findId(port_name);
+    if (port_id >= MAX_PORTS) {
+        return false;
+    }
+    Record record;
+    readSlot(m_slots[port_id], record);
+    if (!record.present) {
+        return false;
+    }
+    toLinkState(record, port_id, port_name, state);
+    return true;
+}
+
+bool PortStateTable::contains(const std::string& port_name) const {
+    common::PortId port_id = findId(port_name);
+    if (port_id >= MAX_PORTS) {
+        return false;
+    }
+    Record record;
+    readSlot(m_slots[port_id], record);
+    return record.present != 0;
+}
+
+std::vector<LinkState> PortStateTable::getAll() const {
+    std::shared_ptr<const NameIndex> index = std::atomic_load(&m_index);
+    std::vector<LinkState> states;
+    states.reserve(index->size());
+    Record record;
+    for (const auto& entry : *index) {
+        readSlot(m_slots[entry.second], record);
+        if (record.present) {
+            states.emplace_back();
+            toLinkState(record, entry.second, entry.first, states.back());
+        }
+    }
+    return states;
+}
+
+std::vector<std::string> PortStateTable::names() const {
+    std::shared_ptr<const NameIndex> index = std::atomic_load(&m_index);
+    std::vector<std::string> port_names;
+    port_names.reserve(index->size());
+    Record record;
+    for (const auto& entry : *index) {
+        readSlot(m_slots[entry.second], record);
+        if (record.present) {
+            port_names.push_back(entry.first);
+        }
+    }
+    return port_names;
+}
+
+size_t PortStateTable::size() const {
+    std::shared_ptr<const NameIndex> index = std::atomic_load(&m_index);
+    size_t count = 0;
+    Record record;
+    for (const auto& entry : *index) {
+        readSlot(m_slots[entry.second], record);
+        count += record.present ? 1 : 0;
+    }
+    return count;
+}
+
+bool PortStateTable::update(const std::string& port_name, const Mutator& mutator) {
+    common::PortId port_id = findId(port_name);
+    bool indexed = port_id != common::INVALID_PORT_ID;
+    if (!indexed) {
+        port_id = common::portNames().intern(port_name);
+    }
+    if (port_id >= MAX_PORTS) {
+        return false;
+    }
+
+    Slot& slot = m_slots[port_id];
+    uint32_t sequence = lockSlot(slot);
+    Record record;
+    uint64_t words[RECORD_WORDS];
+    for (size_t i = 0; i < RECORD_WORDS; ++i) {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+    }
+    std::memcpy(&record, words, sizeof(record));
+
+    bool present = record.present != 0;
+    LinkState state;
+    if (present) {
+        toLinkState(record, port_id, port_name, state);
+    } else {
+        state = defaultState(port_name);
+        state.port_id = port_id;
+    }
+    if (!mutator(state, present)) {
+        unlock(slot, sequence);
+        return true;
+    }
+    toRecord(state, record);
+    writeAndUnlock(slot, sequence, record);
+
+    // Publish the name after the slot so a reader that finds it also finds the state
+    if (!indexed) {
+        addToIndex(port_name, port_id);
+    }
+    return true;
+}
+
+bool PortStateTable::replaceAll(const std::vector<LinkState>& states) {
+    bool ok = true;
+    std::vector<std::string> kept;
+    kept.reserve(states.size());
+    for (const auto& state : states) {
+        ok &= update(state.port_name, [&state](LinkState& current, bool) {
+            current = state;
+            return true;
+        });
+        kept.push_back(state.port_name);
+    }
+    std::sort(kept.begin(), kept.end());
+
+    std::shared_ptr<const NameIndex> index = std::atomic_load(&m_index);
+    Record empty;
+    std::memset(&empty, 0, sizeof(empty));
+    for (const auto& entry : *index) {
+        if (!std::binary_search(kept.begin(), kept.end(), entry.first)) {
+            Slot& slot = m_slots[entry.second];
+            writeAndUnlock(slot, lockSlot(slot), empty);
+        }
+    }
+    return ok;
+}
+
+void PortStateTable::clear() {
+    std::shared_ptr<const NameIndex> index = std::atomic_load(&m_index);
+    Record empty;
+    std::memset(&empty, 0, sizeof(empty));
+    for (const auto& entry : *index) {
+        Slot& slot = m_slots[entry.second];
+        writeAndUnlock(slot, lockSlot(slot), empty);
+    }
+}
+
+} // namespace interrupts
+} // namespace sonic
@@ -0,0 +1,107 @@
+#ifndef SONIC_PORT_STATE_TABLE_H
+#define SONIC_PORT_STATE_TABLE_H
+
+#include "sonic_interrupt_controller.h"
+#include "../common/string_interner.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sonic {
+namespace interrupts {
+
+// Link state for every port, kept in a fixed array indexed by the process-wide
+// PortId. Each slot is a seqlock over a fixed-size record: readers copy it and
+// retry only if a writer overlapped, so they never take a lock or wait on
+// another port. Writers serialize per slot and touch only their own port.
+// Nothing in here does I/O; callers talk to Redis before or after an update.
+class PortStateTable {
+public:
+    static constexpr size_t MAX_PORTS = 1024;
+
+    // Mutator for update(); present is false when the port had no state yet.
+    // Return false to leave the slot unchanged. Runs with the slot held, so it
+    // must be short and must not block.
+    using Mutator = std::function<bool(LinkState& state, bool present)>;
+
+    PortStateTable();
+
+    PortStateTable(const PortStateTable&) = delete;
+    PortStateTable& operator=(const PortStateTable&) = delete;
+
+    // False when the port has no state; state is left untouched
+    bool get(const std::string& port_name, LinkState& state) const;
+    bool get(common::PortId port_id, LinkState& state) const;
+    bool contains(const std::string& port_name) const;
+
+    // Ports with state, sorted by name
+    std::vector<LinkState> getAll() const;
+    std::vector<std::string> names() const;
+    size_t size() const;
+
+    // Read-modify-write of one port, starting from defaultState() when it has none.
+    // Fails when the port cannot be given an ID below MAX_PORTS.
+    bool update(const std::string& port_name, const Mutator& mutator);
+
+    // Make the table hold exactly these ports. Each port switches atomically;
+    // a concurrent getAll() may see a mix of old and new ports.
+    bool replaceAll(const std::vector<LinkState>& states);
+    void clear();
+
+    static LinkState defaultState(const std::string& port_name);
+
+private:
+    // Fixed-size image of a LinkState; the port name comes from the PortId
+    struct Record {
+        uint8_t present;
+        uint8_t admin_status;
+        uint8_t oper_status;
+        uint8_t auto_neg;
+        uint32_t speed_mbps;
+        uint32_t mtu;
+        char duplex[12];
+        char mac_address[24];
+        int64_t last_change_ns;     // system_clock since the epoch
+        uint64_t link_up_count;
+        uint64_t link_down_count;
+    };
+
+    static constexpr size_t RECORD_WORDS = (sizeof(Record) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    // Even sequence = stable, odd = a writer owns the slot
+    struct alignas(64) Slot {
+        std::atomic<uint32_t> sequence{0};
+        std::atomic<uint64_t> words[RECORD_WORDS] = {};
+    };
+
+    using NameIndex = std::vector<std::pair<std::string, common::PortId>>;    // Sorted by name
+
+    common::PortId findId(const std::string& port_name) const;
+    void addToIndex(const std::string& port_name, common::PortId port_id);
+
+    void readSlot(const Slot& slot, Record& record) const;
+    uint32_t lockSlot(Slot& slot);
+    void writeAndUnlock(Slot& slot, uint32_t sequence, const Record& record);
+    void unlock(Slot& slot, uint32_t sequence);
+
+    static void toRecord(const LinkState& state, Record& record);
+    static void toLinkState(const Record& record, common::PortId port_id, const std::string& port_name,
+                            LinkState& state);
+
+    std::unique_ptr<Slot[]> m_slots;
+
+    // Names of every port ever stored; grows copy-on-write, readers load it atomically
+    std::shared_ptr<const NameIndex> m_index;
+    std::mutex m_index_mutex;
+};
+
+} // namespace interrupts
+} // namespace sonic
+
+#endif // SONIC_PORT_STATE_TABLE_H
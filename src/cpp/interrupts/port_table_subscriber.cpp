@@ -0,0 +1,205 @@
+#include "port_table_subscriber.h"
+#include "../common/logger.h"
+#include "../common/redis_table_watcher.h"
+#include <iostream>
+#include <utility>
+
+#ifdef HAVE_SWSSCOMMON
+#include <deque>
+#include <swss/dbconnector.h>
+#include <swss/subscriberstatetable.h>
+#include <swss/select.h>
+#include <swss/selectableevent.h>
+#include <swss/table.h>
+#endif
+
+namespace sonic {
+namespace interrupts {
+
+namespace {
+
+constexpr int APPL_DB = 0;
+constexpr int STATE_DB = 6;
+
+const std::string PORT_TABLE_PREFIX = "PORT_TABLE:";
+const std::string TRANSCEIVER_INFO_PREFIX = "TRANSCEIVER_INFO|";
+
+} // anonymous namespace
+
+#ifdef HAVE_SWSSCOMMON
+
+// SubscriberStateTable backend: swss-common does the keyspace bookkeeping
+struct PortTableSubscriber::Backend {
+    // Declared so that destruction runs select, tables, then their connectors
+    std::unique_ptr<swss::DBConnector> appl_db;
+    std::unique_ptr<swss::DBConnector> state_db;
+    std::unique_ptr<swss::SubscriberStateTable> port_table;
+    std::unique_ptr<swss::SubscriberStateTable> transceiver_table;
+    std::unique_ptr<swss::Select> select;
+
+    // interrupt() wakes both the table wait and the resubscribe backoff
+    swss::SelectableEvent wakeup;
+    swss::Select sleeper;
+
+    Backend() {
+        sleeper.addSelectable(&wakeup);
+    }
+
+    ~Backend() {
+        release();
+    }
+
+    // The Select holds raw table pointers, and each table its connector
+    void release() {
+        select.reset();
+        port_table.reset();
+        transceiver_table.reset();
+        appl_db.reset();
+        state_db.reset();
+    }
+
+    bool subscribe(const common::RedisConfig& config) {
+        release();
+        try {
+            appl_db.reset(new swss::DBConnector(APPL_DB, config.host, config.port, 0));
+            state_db.reset(new swss::DBConnector(STATE_DB, config.host, config.port, 0));
+            port_table.reset(new swss::SubscriberStateTable(appl_db.get(), "PORT_TABLE"));
+            transceiver_table.reset(new swss::SubscriberStateTable(state_db.get(), "TRANSCEIVER_INFO"));
+            select.reset(new swss::Select());
+            select->addSelectable(&wakeup);
+            select->addSelectable(port_table.get());
+            select->addSelectable(transceiver_table.get());
+            return true;
+        } catch (const std::exception& e) {
+            SONIC_LOG_ERROR("INTERRUPT", "SubscriberStateTable setup failed: " << e.what());
+            release();
+            return false;
+        }
+    }
+
+    bool subscribed() const {
+        return select != nullptr;
+    }
+
+    bool wait(std::vector<PortTableUpdate>& updates, int timeout_ms) {
+        if (!select) {
+            return false;
+        }
+        swss::Selectable* selectable = nullptr;
+        int rc = select->select(&selectable, timeout_ms);
+        if (rc == swss::Select::ERROR) {
+            return false;
+        }
+        if (rc != swss::Select::OBJECT || selectable == &wakeup) {
+            return true;    // Timeout or interrupt(); the caller checks why
+        }
+
+        auto* table = static_cast<swss::SubscriberStateTable*>(selectable);
+        std::deque<swss::KeyOpFieldsValuesTuple> entries;
+        table->pops(entries);
+        for (const auto& entry : entries) {
+            PortTableUpdate update;
+            update.table = (table == port_table.get()) ? PortTableUpdate::Table::PORT_TABLE
+                                                       : PortTableUpdate::Table::TRANSCEIVER_INFO;
+            update.port_name = kfvKey(entry);
+            update.deleted = (kfvOp(entry) == DEL_COMMAND);
+            for (const auto& fv : kfvFieldsValues(entry)) {
+                update.fields[fvField(fv)] = fvValue(fv);
+            }
+            updates.push_back(std::move(update));
+        }
+        return true;
+    }
+
+    bool sleep(int timeout_ms) {
+        swss::Selectable* selectable = nullptr;
+        return sleeper.select(&selectable, timeout_ms) != swss::Select::OBJECT;
+    }
+
+    void interrupt() {
+        wakeup.notify();
+    }
+};
+
+#else
+
+// Keyspace notification backend: RedisTableWatcher over both tables
+struct PortTableSubscriber::Backend {
+    // Watched table indices, in the order passed to the watcher
+    enum : size_t { PORT_TABLE = 0, TRANSCEIVER_INFO = 1 };
+
+    common::RedisTableWatcher watcher;
+
+    explicit Backend(const common::RedisConfig& config)
+        : watcher(config, {{APPL_DB, PORT_TABLE_PREFIX}, {STATE_DB, TRANSCEIVER_INFO_PREFIX}}) {
+    }
+
+    bool subscribe(const common::RedisConfig&) {
+        return watcher.subscribe();
+    }
+
+    bool subscribed() const {
+        return watcher.isSubscribed();
+    }
+
+    bool wait(std::vector<PortTableUpdate>& updates, int timeout_ms) {
+        std::vector<common::TableChange> changes;
+        if (!watcher.waitForChanges(changes, timeout_ms)) {
+            return false;
+        }
+        for (auto& change : changes) {
+            PortTableUpdate update;
+            update.table = (change.table == PORT_TABLE) ? PortTableUpdate::Table::PORT_TABLE
+                                                        : PortTableUpdate::Table::TRANSCEIVER_INFO;
+            update.port_name = std::move(change.key);
+            update.deleted = change.deleted;
+            update.fields = std::move(change.fields);
+            updates.push_back(std::move(update));
+        }
+        return true;
+    }
+
+    bool sleep(int timeout_ms) {
+        return watcher.waitInterruptible(timeout_ms);
+    }
+
+    void interrupt() {
+        watcher.interrupt();
+    }
+};
+
+#endif
+
+PortTableSubscriber::PortTableSubscriber(const common::RedisConfig& config)
+    : m_config(config) {
+#ifdef HAVE_SWSSCOMMON
+    m_backend.reset(new Backend());
+#else
+    m_backend.reset(new Backend(config));
+#endif
+}
+
+PortTableSubscriber::~PortTableSubscriber() = default;
+
+bool PortTableSubscriber::subscribe() {
+    return m_backend->subscribe(m_config);
+}
+
+bool PortTableSubscriber::isSubscribed() const {
+    return m_backend->subscribed();
+}
+
+bool PortTableSubscriber::waitForUpdates(std::vector<PortTableUpdate>& updates, int timeout_ms) {
+    return m_backend->wait(updates, timeout_ms);
+}
+
+bool PortTableSubscriber::waitInterruptible(int timeout_ms) {
+    return m_backend->sleep(timeout_ms);
+}
+
+void PortTableSubscriber::interrupt() {
+    m_backend->interrupt();
+}
+
+} // namespace interrupts
+} // namespace sonic
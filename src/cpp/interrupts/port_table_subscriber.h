@@ -0,0 +1,55 @@
+#ifndef SONIC_PORT_TABLE_SUBSCRIBER_H
+#define SONIC_PORT_TABLE_SUBSCRIBER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include "../common/redis_client.h"
+
+namespace sonic {
+namespace interrupts {
+
+// Change to APPL_DB PORT_TABLE or STATE_DB TRANSCEIVER_INFO for one port
+struct PortTableUpdate {
+    enum class Table {
+        PORT_TABLE,
+        TRANSCEIVER_INFO
+    };
+
+    Table table;
+    std::string port_name;
+    bool deleted;
+    std::map<std::string, std::string> fields;
+};
+
+// Event-driven source of port table changes.
+// Uses SubscriberStateTable when built with HAVE_SWSSCOMMON, otherwise Redis
+// keyspace notifications through common::RedisTableWatcher.
+class PortTableSubscriber {
+public:
+    explicit PortTableSubscriber(const common::RedisConfig& config);
+    ~PortTableSubscriber();
+
+    bool subscribe();
+    bool isSubscribed() const;
+
+    // Blocks until updates arrive, timeout_ms expires (-1 = forever) or interrupt() is called.
+    // Returns false when the subscription was lost and subscribe() must be called again.
+    bool waitForUpdates(std::vector<PortTableUpdate>& updates, int timeout_ms);
+
+    // Interruptible sleep used between resubscribe attempts
+    bool waitInterruptible(int timeout_ms);
+    void interrupt();
+
+private:
+    struct Backend;
+
+    common::RedisConfig m_config;
+    std::unique_ptr<Backend> m_backend;
+};
+
+} // namespace interrupts
+} // namespace sonic
+
+#endif // SONIC_PORT_TABLE_SUBSCRIBER_H
@@ -0,0 +1,151 @@
+#include "sfp_info_cache.h"
+#include <algorithm>
+#include <cstring>
+
+namespace sonic {
+namespace interrupts {
+
+namespace {
+
+void copyText(char* dest, size_t size, const std::string& text) {
+    size_t length = std::min(text.size(), size - 1);
+    std::memcpy(dest, text.data(), length);
+    std::memset(dest + length, 0, size - length);
+}
+
+std::string fromText(const char* text, size_t size) {
+    return std::string(text, strnlen(text, size));
+}
+
+} // anonymous namespace
+
+SFPInfo SfpInfoCache::absentInfo(const std::string& port_name) {
+    SFPInfo info;
+    info.port_name = port_name;
+    info.is_present = false;
+    info.status = "not_present";
+    return info;
+}
+
+void SfpInfoCache::toRecord(const SFPInfo& info, Record& record) {
+    std::memset(&record, 0, sizeof(record));
+    record.present = 1;
+    copyText(record.vendor_name, sizeof(record.vendor_name), info.vendor_name);
+    copyText(record.part_number, sizeof(record.part_number), info.part_number);
+    copyText(record.serial_number, sizeof(record.serial_number), info.serial_number);
+    copyText(record.connector_type, sizeof(record.connector_type), info.connector_type);
+    copyText(record.cable_length, sizeof(record.cable_length), info.cable_length);
+    copyText(record.status, sizeof(record.status), info.status.empty() ? "present" : info.status);
+    record.speed_count = static_cast<uint8_t>(std::min(info.supported_speeds.size(), MAX_SPEEDS));
+    std::copy(info.supported_speeds.begin(), info.supported_speeds.begin() + record.speed_count,
+              record.supported_speeds);
+}
+
+void SfpInfoCache::toSFPInfo(const Record& record, const std::string& port_name, SFPInfo& info) {
+    info.port_name = port_name;
+    info.is_present = true;
+    info.vendor_name = fromText(record.vendor_name, sizeof(record.vendor_name));
+    info.part_number = fromText(record.part_number, sizeof(record.part_number));
+    info.serial_number = fromText(record.serial_number, sizeof(record.serial_number));
+    info.connector_type = fromText(record.connector_type, sizeof(record.connector_type));
+    info.cable_length = fromText(record.cable_length, sizeof(record.cable_length));
+    info.status = fromText(record.status, sizeof(record.status));
+    info.supported_speeds.assign(record.supported_speeds, record.supported_speeds + record.speed_count);
+}
+
+const SfpInfoCache::Record* SfpInfoCache::findUnsafe(const std::string& port_name) const {
+    common::PortId port_id;
+    if (!common::portNames().find(port_name, port_id) || port_id >= m_records.size() ||
+        !m_records[port_id].present) {
+        return nullptr;
+    }
+    return &m_records[port_id];
+}
+
+bool SfpInfoCache::insert(const SFPInfo& info) {
+    common::PortId port_id = common::portNames().intern(info.port_name);
+    if (port_id == common::INVALID_PORT_ID || port_id >= MAX_PORTS) {
+        return false;
+    }
+    Record record;
+    toRecord(info, record);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (port_id >= m_records.size()) {
+        m_records.resize(port_id + 1, Record());
+    }
+    if (!m_records[port_id].present) {
+        ++m_present;
+    }
+    m_records[port_id] = record;
+    return true;
+}
+
+bool SfpInfoCache::remove(const std::string& port_name) {
+    common::PortId port_id;
+    if (!common::portNames().find(port_name, port_id)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (port_id >= m_records.size() || !m_records[port_id].present) {
+        return false;
+    }
+    m_records[port_id] = Record();
+    --m_present;
+    return true;
+}
+
+bool SfpInfoCache::isPresent(const std::string& port_name) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return findUnsafe(port_name) != nullptr;
+}
+
+bool SfpInfoCache::get(const std::string& port_name, SFPInfo& info) const {
+    Record record;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const Record* found = findUnsafe(port_name);
+        if (!found) {
+            return false;
+        }
+        record = *found;
+    }
+    toSFPInfo(record, port_name, info);
+    return true;
+}
+
+std::vector<SFPInfo> SfpInfoCache::getAll() const {
+    std::vector<std::pair<common::PortId, Record>> records;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        records.reserve(m_present);
+        for (size_t i = 0; i < m_records.size(); ++i) {
+            if (m_records[i].present) {
+                records.emplace_back(static_cast<common::PortId>(i), m_records[i]);
+            }
+        }
+    }
+
+    std::vector<SFPInfo> infos(records.size());
+    for (size_t i = 0; i < records.size(); ++i) {
+        toSFPInfo(records[i].second, common::portNames().name(records[i].first), infos[i]);
+    }
+    std::sort(infos.begin(), infos.end(), [](const SFPInfo& a, const SFPInfo& b) {
+        return a.port_name < b.port_name;
+    });
+    return infos;
+}
+
+size_t SfpInfoCache::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_present;
+}
+
+void SfpInfoCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records.clear();
+    m_present = 0;
+}
+
+} // namespace interrupts
+} // namespace sonic
@@ -0,0 +1,79 @@
+#ifndef SONIC_SFP_INFO_CACHE_H
+#define SONIC_SFP_INFO_CACHE_H
+
+#include "sonic_interrupt_controller.h"
+#include "../common/string_interner.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sonic {
+namespace interrupts {
+
+// Transceiver data for every port with a module plugged, written once when
+// the module is inserted and dropped when it is removed. EEPROM data does not
+// change in between, so every read, bulk or not, is served from memory.
+// Records are fixed-size with the identity strings inline and live in one
+// array indexed by the process-wide PortId; an SFPInfo is only built when a
+// caller asks for one. Nothing in here does I/O.
+class SfpInfoCache {
+public:
+    static constexpr size_t MAX_PORTS = 1024;
+    static constexpr size_t MAX_SPEEDS = 8;
+
+    SfpInfoCache() = default;
+
+    SfpInfoCache(const SfpInfoCache&) = delete;
+    SfpInfoCache& operator=(const SfpInfoCache&) = delete;
+
+    // Record a module; fields longer than their slot are truncated.
+    // Fails when the port cannot be given an ID below MAX_PORTS.
+    bool insert(const SFPInfo& info);
+
+    // Drop the port's module; false if none was recorded
+    bool remove(const std::string& port_name);
+
+    bool isPresent(const std::string& port_name) const;
+
+    // False when no module is recorded; info is left untouched
+    bool get(const std::string& port_name, SFPInfo& info) const;
+
+    // Every recorded module, sorted by port name
+    std::vector<SFPInfo> getAll() const;
+    size_t size() const;
+    void clear();
+
+    // What get() callers see for a port without a module
+    static SFPInfo absentInfo(const std::string& port_name);
+
+private:
+    // SFF-8472/8636 vendor name, part and serial numbers are 16 ASCII bytes.
+    // The longest SFF-8024 connector name, "SN (previously Mini CS) optical
+    // connector", is 41 characters.
+    struct Record {
+        uint8_t present;
+        uint8_t speed_count;
+        char vendor_name[17];
+        char part_number[17];
+        char serial_number[17];
+        char connector_type[48];
+        char cable_length[8];
+        char status[16];
+        uint32_t supported_speeds[MAX_SPEEDS];
+    };
+
+    static void toRecord(const SFPInfo& info, Record& record);
+    static void toSFPInfo(const Record& record, const std::string& port_name, SFPInfo& info);
+    const Record* findUnsafe(const std::string& port_name) const;
+
+    mutable std::mutex m_mutex;         // Guards the members below; held only for copies
+    std::vector<Record> m_records;      // Indexed by PortId, grown on demand
+    size_t m_present = 0;
+};
+
+} // namespace interrupts
+} // namespace sonic
+
+#endif // SONIC_SFP_INFO_CACHE_H
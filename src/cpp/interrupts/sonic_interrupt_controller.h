@@ -6,13 +6,32 @@
 #include <map>
 #include <memory>
 #include <functional>
+#include <future>
 #include <thread>
 #include <atomic>
 #include <chrono>
+#include <mutex>
+#include "../common/string_interner.h"
 
 namespace sonic {
+namespace common {
+class RedisClient;
+}
+
 namespace interrupts {
 
+struct PortTableUpdate;
+class PortTableSubscriber;
+struct HandlerTable;
+class EventDispatcher;
+class EventHistory;
+class FlapDampener;
+class PortStateTable;
+class SfpInfoCache;
+class LinkWaiterRegistry;
+class EventTraceWriter;
+struct DampeningConfig;
+
 // Link Status Types
 enum class LinkStatus {
     UP,
@@ -29,12 +48,21 @@ enum class CableEvent {
     SFP_INSERTED,
     SFP_REMOVED,
     SPEED_CHANGE,
-    DUPLEX_CHANGE
+    DUPLEX_CHANGE,
+    FLAP_SUPPRESSED,    // Flap dampening started holding back a port's link events
+    FLAP_UNSUPPRESSED   // Dampening released the port; carries its latest state
+};
+
+// How the monitoring thread learns about port changes
+enum class MonitoringMode {
+    EVENT_DRIVEN,   // Keyspace notifications / SubscriberStateTable
+    POLLING         // Periodic bulk read of PORT_TABLE and TRANSCEIVER_INFO
 };
 
 // Port Event Information
 struct PortEvent {
     std::string port_name;
+    common::PortId port_id = common::INVALID_PORT_ID;  // portNames() ID; filled in by triggerEvent() if unset
     CableEvent event_type;
     LinkStatus old_status;
     LinkStatus new_status;
@@ -42,6 +70,9 @@ struct PortEvent {
     std::string duplex;
     std::chrono::system_clock::time_point timestamp;
     std::string additional_info;
+    // Flap dampening notices keep their numbers here so additional_info stays a fixed text
+    uint32_t dampening_penalty = 0;     // FLAP_SUPPRESSED: penalty that crossed the threshold
+    uint32_t suppressed_events = 0;     // FLAP_UNSUPPRESSED: link events held back
 };
 
 // SFP/Transceiver Information
@@ -60,6 +91,7 @@ struct SFPInfo {
 // Link State Information
 struct LinkState {
     std::string port_name;
+    common::PortId port_id = common::INVALID_PORT_ID;  // portNames() ID of port_name
     LinkStatus admin_status;
     LinkStatus oper_status;
     uint32_t speed_mbps;
@@ -72,9 +104,17 @@ struct LinkState {
     uint64_t link_down_count;
 };
 
+// Internal modules key per-port state by ID; events from outside may only carry the name
+inline common::PortId resolvePortId(const PortEvent& event) {
+    return event.port_id != common::INVALID_PORT_ID ? event.port_id : common::portNames().intern(event.port_name);
+}
+
 // Interrupt Handler Callback Type
 using InterruptHandler = std::function<void(const PortEvent&)>;
 
+// Names one registered handler so it can be removed again; 0 is never issued
+using HandlerId = uint64_t;
+
 // Main Interrupt Controller Class
 class SONiCInterruptController {
 public:
@@ -98,14 +138,42 @@ public:
     bool stopEventMonitoring();
     bool isMonitoring() const;
 
+    // Monitoring configuration (applies on the next startEventMonitoring)
+    void setMonitoringMode(MonitoringMode mode);
+    MonitoringMode getMonitoringMode() const;
+    void setPollIntervalMs(int interval_ms);
+
     // Event Handler Registration
-    void registerEventHandler(CableEvent event_type, InterruptHandler handler);
+    HandlerId registerEventHandler(CableEvent event_type, InterruptHandler handler);
     void unregisterEventHandler(CableEvent event_type);
-    void registerGlobalEventHandler(InterruptHandler handler);
+    HandlerId registerGlobalEventHandler(InterruptHandler handler);
+
+    // Remove one handler. A worker already dispatching an event may still call it,
+    // so anything it captures must outlive the call (share it through a shared_ptr).
+    void removeEventHandler(HandlerId id);
+
+    // Handlers run asynchronously on the dispatch workers; wait for queued events to be handled
+    bool flushEvents(int timeout_ms = 1000);
+
+    // Feed an event straight into dampening and dispatch, bypassing Redis (benchmarks, replay)
+    void injectEvent(const PortEvent& event);
+
+    // Feed table changes through the monitor's update path, as if Redis had reported them (replay)
+    void injectPortTableUpdates(const std::vector<PortTableUpdate>& updates);
+
+    // Record events, table changes and the controller's Redis writes to a binary
+    // trace (see event_trace.h). initialize() starts one when SONIC_INTERRUPT_TRACE is set.
+    bool startTrace(const std::string& path);
+    void stopTrace();
+    bool isTracing() const;
+
+    // Per-event console logging, on by default
+    void setEventLogging(bool enabled);
 
     // Port Status Queries
     LinkState getPortLinkState(const std::string& port_name);
     std::vector<LinkState> getAllPortStates();
+    // Transceiver data, served from memory; kept current by SFP insertion and removal
     SFPInfo getSFPInfo(const std::string& port_name);
     std::vector<SFPInfo> getAllSFPInfo();
 
@@ -114,12 +182,28 @@ public:
     std::map<std::string, uint64_t> getEventStatistics();
     void clearEventHistory();
 
-    // Link State Validation
+    // Bounded ring buffer behind getEventHistory(); use its view()/forEachPortEvent() for zero-copy reads
+    const EventHistory& eventHistory() const;
+
+    // Link flap dampening (disabled by default)
+    void setDampeningConfig(const DampeningConfig& config);
+    void setPortDampeningConfig(const std::string& port_name, const DampeningConfig& config);
+    bool isPortSuppressed(const std::string& port_name) const;
+    void processDampeningTimers();
+
+    // Link State Validation; wakes as soon as triggerEvent() sees the match
     bool validateLinkState(const std::string& port_name, LinkStatus expected_status, 
                           int timeout_ms = 5000);
     bool waitForLinkEvent(const std::string& port_name, CableEvent expected_event, 
                          int timeout_ms = 10000);
 
+    // Non-blocking variants for waiting on many ports at once: the future is
+    // true on a match (or if the status already holds), false on timeout or cleanup
+    std::future<bool> waitForLinkStateAsync(const std::string& port_name, LinkStatus expected_status,
+                                            int timeout_ms = 5000);
+    std::future<bool> waitForLinkEventAsync(const std::string& port_name, CableEvent expected_event,
+                                            int timeout_ms = 10000);
+
     // SONiC CLI Integration
     bool refreshPortStatusFromSONiC();
     bool verifySONiCPortStatus(const std::string& port_name, LinkStatus expected_status);
@@ -141,25 +225,50 @@ private:
     std::atomic<bool> m_cleanup_done;
     std::string m_sonic_container_name;
     bool m_verbose_debug;
+    std::atomic<bool> m_event_logging;
+    std::unique_ptr<common::RedisClient> m_redis;
     
     // Event monitoring thread
     std::unique_ptr<std::thread> m_monitor_thread;
+    MonitoringMode m_monitoring_mode;
+    std::atomic<int> m_poll_interval_ms;
+    std::unique_ptr<PortTableSubscriber> m_subscriber;
     void monitoringLoop();
+    bool eventDrivenLoop();
+    void pollingLoop();
+    void processPortTableUpdates(const std::vector<PortTableUpdate>& updates, const std::string& source);
+    void applyPortTableUpdate(const PortTableUpdate& update, const std::string& source,
+                              std::vector<PortEvent>& events);
     
-    // Event handlers
-    std::map<CableEvent, std::vector<InterruptHandler>> m_event_handlers;
-    std::vector<InterruptHandler> m_global_handlers;
+    // Event handlers (copy-on-write snapshot, writers serialize on m_handler_mutex)
+    std::shared_ptr<const HandlerTable> m_handlers;
+    HandlerId m_next_handler_id = 1;
+    void publishHandlers(std::shared_ptr<const HandlerTable> handlers);
     
-    // State tracking
-    std::map<std::string, LinkState> m_port_states;
-    std::map<std::string, SFPInfo> m_sfp_info;
-    std::vector<PortEvent> m_event_history;
+    // State tracking; link state is per-port seqlocked, so readers never wait on a writer
+    std::unique_ptr<PortStateTable> m_port_table;
+    std::unique_ptr<SfpInfoCache> m_sfp_cache;
+    std::unique_ptr<LinkWaiterRegistry> m_waiters;
+    std::unique_ptr<EventHistory> m_event_history;
+
+    // Active trace, swapped atomically; m_tracing spares the hot path the shared_ptr load
+    std::shared_ptr<EventTraceWriter> m_trace;
+    std::atomic<bool> m_tracing;
+    std::shared_ptr<EventTraceWriter> activeTrace() const;
+    static constexpr size_t EVENT_HISTORY_CAPACITY = 4096;
     std::map<std::string, uint64_t> m_event_statistics;
     
     // Synchronization
-    mutable std::mutex m_state_mutex;
     mutable std::mutex m_event_mutex;
     mutable std::mutex m_handler_mutex;
+
+    // Asynchronous handler execution, declared after the state it may touch
+    std::unique_ptr<EventDispatcher> m_dispatcher;
+    std::unique_ptr<FlapDampener> m_dampener;
+    void deliverEvent(const PortEvent& event);
+    int monitorWaitMs(int default_ms) const;
+    static constexpr size_t DISPATCH_WORKERS = 4;
+    static constexpr size_t DISPATCH_QUEUE_CAPACITY = 4096;
     
     // Helper functions for SONiC communication
     bool executeSONiCCommand(const std::string& command, std::string& output);
@@ -187,7 +296,6 @@ private:
     std::string linkStatusToString(LinkStatus status);
     CableEvent stringToCableEvent(const std::string& event_str);
     std::string cableEventToString(CableEvent event);
-    LinkState getPortLinkStateUnsafe(const std::string& port_name); // Assumes mutex is already locked
     
     // Timing and synchronization
     std::chrono::system_clock::time_point m_last_poll_time;
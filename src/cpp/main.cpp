@@ -10,11 +10,16 @@
 #include <signal.h>
 #include <thread>
 #include <chrono>
+#include <cstdlib>
 
 // SONiC component headers
 #include "bsp/platform_health_monitor.h"
 #include "sai/sai_vlan_manager.h"
 #include "swss/orchagent.h"
+#include "common/logger.h"
+#include "common/metrics.h"
+#include "common/startup_orchestrator.h"
+#include "common/redis_client.h"
 
 using namespace sonic;
 
@@ -29,6 +34,24 @@ void signalHandler(int signal) {
     g_shutdown = 1;
 }
 
+/**
+ * @brief Path of a warm-restart snapshot, empty unless SONIC_WARM_RESTART_DIR is set
+ */
+std::string warmRestartFile(const std::string& name) {
+    const char* dir = std::getenv("SONIC_WARM_RESTART_DIR");
+    return (dir && *dir) ? std::string(dir) + "/" + name : std::string();
+}
+
+/**
+ * @brief Start exporting metrics to STATE_DB, and to a Prometheus textfile when SONIC_METRICS_TEXTFILE is set
+ */
+std::unique_ptr<common::MetricsExporter> startMetricsExport(common::RedisClient& client) {
+    const char* textfile = std::getenv("SONIC_METRICS_TEXTFILE");
+    auto exporter = std::make_unique<common::MetricsExporter>(&client, textfile ? textfile : "");
+    exporter->start(10000);
+    return exporter;
+}
+
 /**
  * @brief Print SONiC POC banner
  */
@@ -77,6 +100,12 @@ std::unique_ptr<sai::SAIVLANManager> initializeSAI() {
         return nullptr;
     }
     
+    vlan_manager->setWarmRestartFile(warmRestartFile("vlan_manager.snap"));
+    if (vlan_manager->restoreWarmSnapshot()) {
+        std::cout << "SAI components restored from warm-restart snapshot" << std::endl;
+        return vlan_manager;
+    }
+    
     // Create some demo VLANs
     vlan_manager->createVLAN(100, "Engineering");
     vlan_manager->createVLAN(200, "Sales");
@@ -94,6 +123,7 @@ std::unique_ptr<swss::OrchAgent> initializeSwSS() {
     std::cout << "Initializing SwSS components..." << std::endl;
     
     auto orch_agent = std::make_unique<swss::OrchAgent>();
+    orch_agent->setWarmRestartFile(warmRestartFile("orchagent.snap"));
     
     if (!orch_agent->start()) {
         std::cerr << "Failed to start orchestration agent" << std::endl;
@@ -156,32 +186,53 @@ int main(int argc, char* argv[]) {
     // Set up signal handlers for graceful shutdown
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
+
+    // A wedged port or Redis link repeats the same line; keep the daemon's log readable
+    common::Logger::setRateLimit(10, 10000);
     
     try {
         // Initialize components
         std::cout << "Starting SONiC POC initialization..." << std::endl;
         
-        // Initialize BSP
-        auto health_monitor = initializeBSP();
-        if (!health_monitor) {
-            std::cerr << "Failed to initialize BSP components" << std::endl;
-            return 1;
-        }
-        
-        // Initialize SAI
-        auto vlan_manager = initializeSAI();
-        if (!vlan_manager) {
-            std::cerr << "Failed to initialize SAI components" << std::endl;
-            return 1;
-        }
-        
-        // Initialize SwSS
-        auto orch_agent = initializeSwSS();
-        if (!orch_agent) {
-            std::cerr << "Failed to initialize SwSS components" << std::endl;
+        // BSP shares nothing with the switch stack and comes up alongside it;
+        // SwSS programs through the switch the SAI phase creates, so it follows SAI
+        std::unique_ptr<bsp::PlatformHealthMonitor> health_monitor;
+        std::unique_ptr<sai::SAIVLANManager> vlan_manager;
+        std::unique_ptr<swss::OrchAgent> orch_agent;
+        common::StartupOrchestrator startup;
+        startup.addPhase("bsp", [&health_monitor]() {
+            health_monitor = initializeBSP();
+            return health_monitor != nullptr;
+        });
+        startup.addPhase("sai", [&vlan_manager]() {
+            vlan_manager = initializeSAI();
+            return vlan_manager != nullptr;
+        });
+        startup.addPhase("swss", [&orch_agent]() {
+            orch_agent = initializeSwSS();
+            return orch_agent != nullptr;
+        }, {"sai"});
+        bool started = startup.run();
+        std::cout << "\nStartup phases:\n" << startup.report();
+        if (!started) {
+            for (const auto& phase : startup.results()) {
+                if (!phase.ok) {
+                    std::cerr << "Failed to initialize " << phase.name << " components" << std::endl;
+                }
+            }
+            if (orch_agent) {
+                orch_agent->stop();
+            }
+            if (health_monitor) {
+                health_monitor->stop();
+            }
+            common::Logger::flush();
             return 1;
         }
         
+        common::RedisClient metrics_client(common::RedisConfig::fromEnvironment("localhost"));
+        auto metrics_exporter = startMetricsExport(metrics_client);
+
         std::cout << "\nSONiC POC initialization completed successfully!" << std::endl;
         std::cout << "System is now operational. Press Ctrl+C to shutdown gracefully." << std::endl;
         
@@ -198,17 +249,22 @@ int main(int argc, char* argv[]) {
         if (health_monitor) {
             health_monitor->stop();
         }
+
+        metrics_exporter->stop();
         
         std::cout << "SONiC POC shutdown completed successfully" << std::endl;
         
     } catch (const std::exception& e) {
+        common::Logger::flush();
         std::cerr << "Fatal error: " << e.what() << std::endl;
         return 1;
     } catch (...) {
+        common::Logger::flush();
         std::cerr << "Unknown fatal error occurred" << std::endl;
         return 1;
     }
     
+    common::Logger::flush();
     return 0;
 }
 
@@ -10,13 +10,15 @@
 #include <map>
 #include <vector>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <atomic>
+#include <cstring>
 
-// Global mock SAI state
+// API table; only touched by initialize/query, so one lock is enough
 static std::mutex g_sai_mutex;
 static bool g_sai_initialized = false;
 static std::map<sai_api_t, void*> g_api_table;
-static std::map<sai_object_id_t, MockSAIObject> g_objects;
-static sai_object_id_t g_next_oid = 0x1000000000000000ULL;
 
 // Mock API implementations
 static MockVLANAPI g_vlan_api;
@@ -24,12 +26,212 @@ static MockRouteAPI g_route_api;
 static MockPortAPI g_port_api;
 static MockSwitchAPI g_switch_api;
 static MockBridgeAPI g_bridge_api;
+static MockNextHopAPI g_next_hop_api;
+static MockNextHopGroupAPI g_next_hop_group_api;
+
+// Object store: OIDs carry their object type in bits 48..55 like real SAI
+// implementations, objects are sharded by type and then striped by OID, and
+// every shard has its own reader/writer lock. Lookups take a shared lock on
+// one shard; creates and removes of different objects rarely contend.
+namespace {
+
+constexpr size_t OBJECT_TYPE_COUNT = 64;    // Above every sai_object_type_t the mock defines
+constexpr size_t SHARDS_PER_TYPE = 16;
+constexpr size_t ROUTE_SHARDS = 64;
+constexpr int OID_TYPE_SHIFT = 48;
+constexpr sai_object_id_t OID_INDEX_MASK = (1ULL << OID_TYPE_SHIFT) - 1;
+
+struct ObjectShard {
+    std::shared_mutex mutex;
+    std::unordered_map<sai_object_id_t, MockSAIObject> objects;
+};
 
 /**
- * @brief Generate next object ID
+ * @brief Route entry identity: switch, virtual router, family, address and mask, with no padding bytes
  */
-static sai_object_id_t generateNextOID() {
-    return ++g_next_oid;
+struct RouteKey {
+    uint8_t bytes[2 * sizeof(sai_object_id_t) + 1 + 2 * sizeof(sai_ip6_t)];
+
+    bool operator==(const RouteKey& other) const { return std::memcmp(bytes, other.bytes, sizeof(bytes)) == 0; }
+};
+
+struct RouteKeyHash {
+    size_t operator()(const RouteKey& key) const {
+        uint64_t hash = 14695981039346656037ULL;    // FNV-1a
+        for (uint8_t byte : key.bytes) {
+            hash = (hash ^ byte) * 1099511628211ULL;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
+
+struct RouteShard {
+    std::shared_mutex mutex;
+    std::unordered_map<RouteKey, MockSAIObject, RouteKeyHash> routes;
+};
+
+ObjectShard g_object_shards[OBJECT_TYPE_COUNT][SHARDS_PER_TYPE];
+RouteShard g_route_shards[ROUTE_SHARDS];
+std::atomic<size_t> g_object_counts[OBJECT_TYPE_COUNT];
+std::atomic<size_t> g_route_count{0};
+std::atomic<uint64_t> g_next_oid_index{0};
+std::atomic<bool> g_verbose{true};
+
+/**
+ * @brief Generate the next object ID for an object type
+ */
+sai_object_id_t generateNextOID(sai_object_type_t type) {
+    uint64_t index = g_next_oid_index.fetch_add(1, std::memory_order_relaxed) + 1;
+    return (static_cast<sai_object_id_t>(type) << OID_TYPE_SHIFT) | (index & OID_INDEX_MASK);
+}
+
+sai_object_type_t oidType(sai_object_id_t object_id) {
+    uint64_t type = object_id >> OID_TYPE_SHIFT;
+    return type < OBJECT_TYPE_COUNT ? static_cast<sai_object_type_t>(type) : SAI_OBJECT_TYPE_NULL;
+}
+
+ObjectShard& objectShard(sai_object_type_t type, sai_object_id_t object_id) {
+    return g_object_shards[type][object_id % SHARDS_PER_TYPE];
+}
+
+/**
+ * @brief True for attributes whose SAI value is a list
+ *
+ * The store keeps sai_attribute_t by value, so such a value would point into
+ * the caller's memory after the call returns. They are refused, never copied.
+ */
+bool carriesPointer(sai_object_type_t type, int32_t attr_id) {
+    switch (type) {
+    case SAI_OBJECT_TYPE_VLAN:
+        return attr_id == SAI_VLAN_ATTR_MEMBER_LIST;
+    case SAI_OBJECT_TYPE_NEXT_HOP_GROUP:
+        return attr_id == SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_MEMBER_LIST;
+    default:
+        return false;
+    }
+}
+
+void setAttribute(MockSAIObject& obj, const sai_attribute_t& attr) {
+    for (auto& existing : obj.attributes) {
+        if (existing.id == attr.id) {
+            existing = attr;
+            return;
+        }
+    }
+    obj.attributes.push_back(attr);
+}
+
+/**
+ * @brief Store a new OID object with copies of its attributes
+ */
+sai_status_t insertObject(sai_object_type_t type, sai_object_id_t* object_id, sai_object_id_t switch_id,
+                          uint32_t attr_count, const sai_attribute_t* attr_list) {
+    if (!object_id || (attr_count > 0 && !attr_list) || type == SAI_OBJECT_TYPE_NULL ||
+        static_cast<size_t>(type) >= OBJECT_TYPE_COUNT) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+    for (uint32_t i = 0; i < attr_count; i++) {
+        if (carriesPointer(type, attr_list[i].id)) {
+            return SAI_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    MockSAIObject obj;
+    obj.type = type;
+    obj.switch_id = switch_id;
+    obj.attributes.reserve(attr_count);
+    for (uint32_t i = 0; i < attr_count; i++) {
+        setAttribute(obj, attr_list[i]);
+    }
+
+    *object_id = generateNextOID(type);
+    ObjectShard& shard = objectShard(type, *object_id);
+    {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.objects.emplace(*object_id, std::move(obj));
+    }
+    g_object_counts[type].fetch_add(1, std::memory_order_relaxed);
+    return SAI_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Remove an OID object; fails if it does not exist or has another type
+ */
+sai_status_t eraseObject(sai_object_type_t type, sai_object_id_t object_id) {
+    if (oidType(object_id) != type || type == SAI_OBJECT_TYPE_NULL) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+    ObjectShard& shard = objectShard(type, object_id);
+    {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (shard.objects.erase(object_id) == 0) {
+            return SAI_STATUS_ITEM_NOT_FOUND;
+        }
+    }
+    g_object_counts[type].fetch_sub(1, std::memory_order_relaxed);
+    return SAI_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Replace one attribute of an OID object
+ */
+sai_status_t updateObject(sai_object_type_t type, sai_object_id_t object_id, const sai_attribute_t* attr) {
+    if (!attr) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+    if (oidType(object_id) != type || type == SAI_OBJECT_TYPE_NULL) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+    if (carriesPointer(type, attr->id)) {
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+    ObjectShard& shard = objectShard(type, object_id);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.objects.find(object_id);
+    if (it == shard.objects.end()) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+    setAttribute(it->second, *attr);
+    return SAI_STATUS_SUCCESS;
+}
+
+void clearStore() {
+    for (auto& type_shards : g_object_shards) {
+        for (auto& shard : type_shards) {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            shard.objects.clear();
+        }
+    }
+    for (auto& shard : g_route_shards) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.routes.clear();
+    }
+    for (auto& count : g_object_counts) {
+        count = 0;
+    }
+    g_route_count = 0;
+    g_next_oid_index = 0;
+}
+
+} // anonymous namespace
+
+void mockSAISetVerbose(bool verbose) {
+    g_verbose = verbose;
+}
+
+size_t mockSAIObjectCount(sai_object_type_t type) {
+    if (type != SAI_OBJECT_TYPE_NULL) {
+        return static_cast<size_t>(type) < OBJECT_TYPE_COUNT ? g_object_counts[type].load() : 0;
+    }
+    size_t total = 0;
+    for (const auto& count : g_object_counts) {
+        total += count.load();
+    }
+    return total;
+}
+
+size_t mockSAIRouteCount() {
+    return g_route_count.load();
 }
 
 /**
@@ -51,6 +253,8 @@ sai_status_t sai_api_initialize(uint64_t flags, const sai_service_method_table_t
     g_api_table[SAI_API_PORT] = &g_port_api;
     g_api_table[SAI_API_SWITCH] = &g_switch_api;
     g_api_table[SAI_API_BRIDGE] = &g_bridge_api;
+    g_api_table[SAI_API_NEXT_HOP] = &g_next_hop_api;
+    g_api_table[SAI_API_NEXT_HOP_GROUP] = &g_next_hop_group_api;
     
     g_sai_initialized = true;
     std::cout << "Mock SAI initialized successfully" << std::endl;
@@ -69,9 +273,8 @@ sai_status_t sai_api_uninitialize() {
     }
     
     // Clear all objects
-    g_objects.clear();
+    clearStore();
     g_api_table.clear();
-    g_next_oid = 0x1000000000000000ULL;
     
     g_sai_initialized = false;
     std::cout << "Mock SAI uninitialized" << std::endl;
@@ -108,120 +311,160 @@ sai_status_t sai_api_query(sai_api_t api, void** api_method_table) {
     return SAI_STATUS_SUCCESS;
 }
 
+/**
+ * @brief Object type of an existing OID, SAI_OBJECT_TYPE_NULL if it does not exist
+ */
+sai_object_type_t sai_object_type_query(sai_object_id_t object_id) {
+    sai_object_type_t type = oidType(object_id);
+    if (type == SAI_OBJECT_TYPE_NULL) {
+        return SAI_OBJECT_TYPE_NULL;
+    }
+    ObjectShard& shard = objectShard(type, object_id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.objects.count(object_id) ? type : SAI_OBJECT_TYPE_NULL;
+}
+
+/**
+ * @brief Switch an existing OID was created on, SAI_NULL_OBJECT_ID if it does not exist
+ */
+sai_object_id_t sai_switch_id_query(sai_object_id_t object_id) {
+    sai_object_type_t type = oidType(object_id);
+    if (type == SAI_OBJECT_TYPE_SWITCH || type == SAI_OBJECT_TYPE_NULL) {
+        return type == SAI_OBJECT_TYPE_SWITCH ? object_id : SAI_NULL_OBJECT_ID;
+    }
+    ObjectShard& shard = objectShard(type, object_id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.objects.find(object_id);
+    return it == shard.objects.end() ? SAI_NULL_OBJECT_ID : it->second.switch_id;
+}
+
 // Mock VLAN API Implementation
 sai_status_t mock_create_vlan(sai_object_id_t* vlan_id, sai_object_id_t switch_id, 
                               uint32_t attr_count, const sai_attribute_t* attr_list) {
-    std::lock_guard<std::mutex> lock(g_sai_mutex);
-    
     if (!vlan_id || !attr_list) {
         return SAI_STATUS_INVALID_PARAMETER;
     }
     
-    // Generate new VLAN OID
-    *vlan_id = generateNextOID();
-    
-    // Create mock object
-    MockSAIObject obj;
-    obj.type = SAI_OBJECT_TYPE_VLAN;
-    obj.switch_id = switch_id;
-    
-    // Parse attributes
-    for (uint32_t i = 0; i < attr_count; i++) {
-        if (attr_list[i].id == SAI_VLAN_ATTR_VLAN_ID) {
-            obj.attributes["vlan_id"] = std::to_string(attr_list[i].value.u16);
-        }
+    sai_status_t status = insertObject(SAI_OBJECT_TYPE_VLAN, vlan_id, switch_id, attr_count, attr_list);
+    if (status == SAI_STATUS_SUCCESS && g_verbose) {
+        std::cout << "Mock: Created VLAN with OID " << std::hex << *vlan_id << std::dec << std::endl;
     }
-    
-    g_objects[*vlan_id] = obj;
-    
-    std::cout << "Mock: Created VLAN with OID " << std::hex << *vlan_id << std::dec << std::endl;
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 sai_status_t mock_remove_vlan(sai_object_id_t vlan_id) {
-    std::lock_guard<std::mutex> lock(g_sai_mutex);
-    
-    auto it = g_objects.find(vlan_id);
-    if (it == g_objects.end()) {
-        return SAI_STATUS_ITEM_NOT_FOUND;
+    sai_status_t status = eraseObject(SAI_OBJECT_TYPE_VLAN, vlan_id);
+    if (status == SAI_STATUS_SUCCESS && g_verbose) {
+        std::cout << "Mock: Removed VLAN with OID " << std::hex << vlan_id << std::dec << std::endl;
     }
-    
-    g_objects.erase(it);
-    
-    std::cout << "Mock: Removed VLAN with OID " << std::hex << vlan_id << std::dec << std::endl;
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
-sai_status_t mock_create_vlan_member(sai_object_id_t* vlan_member_id, sai_object_id_t switch_id,
+sai_status_t mock_set_vlan_attribute(sai_object_id_t vlan_id, const sai_attribute_t* attr) {
+    return updateObject(SAI_OBJECT_TYPE_VLAN, vlan_id, attr);
+}
+
+/**
+ * @brief Create one VLAN member object
+ */
+static sai_status_t createVLANMember(sai_object_id_t* vlan_member_id, sai_object_id_t switch_id,
                                      uint32_t attr_count, const sai_attribute_t* attr_list) {
-    std::lock_guard<std::mutex> lock(g_sai_mutex);
-    
     if (!vlan_member_id || !attr_list) {
         return SAI_STATUS_INVALID_PARAMETER;
     }
-    
-    // Generate new VLAN member OID
-    *vlan_member_id = generateNextOID();
-    
-    // Create mock object
-    MockSAIObject obj;
-    obj.type = SAI_OBJECT_TYPE_VLAN_MEMBER;
-    obj.switch_id = switch_id;
-    
-    // Parse attributes
-    for (uint32_t i = 0; i < attr_count; i++) {
-        switch (attr_list[i].id) {
-            case SAI_VLAN_MEMBER_ATTR_VLAN_ID:
-                obj.attributes["vlan_id"] = std::to_string(attr_list[i].value.oid);
-                break;
-            case SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID:
-                obj.attributes["port_id"] = std::to_string(attr_list[i].value.oid);
-                break;
-            case SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE:
-                obj.attributes["tagging_mode"] = std::to_string(attr_list[i].value.s32);
-                break;
-        }
+    return insertObject(SAI_OBJECT_TYPE_VLAN_MEMBER, vlan_member_id, switch_id, attr_count, attr_list);
+}
+
+sai_status_t mock_create_vlan_member(sai_object_id_t* vlan_member_id, sai_object_id_t switch_id,
+                                     uint32_t attr_count, const sai_attribute_t* attr_list) {
+    sai_status_t status = createVLANMember(vlan_member_id, switch_id, attr_count, attr_list);
+    if (status == SAI_STATUS_SUCCESS && g_verbose) {
+        std::cout << "Mock: Created VLAN member with OID " << std::hex << *vlan_member_id << std::dec << std::endl;
     }
-    
-    g_objects[*vlan_member_id] = obj;
-    
-    std::cout << "Mock: Created VLAN member with OID " << std::hex << *vlan_member_id << std::dec << std::endl;
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 sai_status_t mock_remove_vlan_member(sai_object_id_t vlan_member_id) {
-    std::lock_guard<std::mutex> lock(g_sai_mutex);
-    
-    auto it = g_objects.find(vlan_member_id);
-    if (it == g_objects.end()) {
-        return SAI_STATUS_ITEM_NOT_FOUND;
+    sai_status_t status = eraseObject(SAI_OBJECT_TYPE_VLAN_MEMBER, vlan_member_id);
+    if (status == SAI_STATUS_SUCCESS && g_verbose) {
+        std::cout << "Mock: Removed VLAN member with OID " << std::hex << vlan_member_id << std::dec << std::endl;
     }
-    
-    g_objects.erase(it);
-    
-    std::cout << "Mock: Removed VLAN member with OID " << std::hex << vlan_member_id << std::dec << std::endl;
-    return SAI_STATUS_SUCCESS;
+    return status;
+}
+
+sai_status_t mock_set_vlan_member_attribute(sai_object_id_t vlan_member_id, const sai_attribute_t* attr) {
+    return updateObject(SAI_OBJECT_TYPE_VLAN_MEMBER, vlan_member_id, attr);
+}
+
+sai_status_t mock_create_vlan_members(sai_object_id_t switch_id, uint32_t object_count,
+                                      const uint32_t* attr_count, const sai_attribute_t** attr_list,
+                                      sai_bulk_op_error_mode_t mode, sai_object_id_t* object_id,
+                                      sai_status_t* object_statuses) {
+    if (!attr_count || !attr_list || !object_id || !object_statuses) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_status_t result = SAI_STATUS_SUCCESS;
+    uint32_t created = 0;
+    for (uint32_t i = 0; i < object_count; i++) {
+        if (result != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+        object_statuses[i] = createVLANMember(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+        if (object_statuses[i] == SAI_STATUS_SUCCESS) {
+            created++;
+        } else {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            result = SAI_STATUS_FAILURE;
+        }
+    }
+
+    std::cout << "Mock: Bulk created " << created << "/" << object_count << " VLAN members" << std::endl;
+    return result;
+}
+
+sai_status_t mock_remove_vlan_members(uint32_t object_count, const sai_object_id_t* object_id,
+                                      sai_bulk_op_error_mode_t mode, sai_status_t* object_statuses) {
+    if (!object_id || !object_statuses) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_status_t result = SAI_STATUS_SUCCESS;
+    uint32_t removed = 0;
+    for (uint32_t i = 0; i < object_count; i++) {
+        if (result != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+        object_statuses[i] = eraseObject(SAI_OBJECT_TYPE_VLAN_MEMBER, object_id[i]);
+        if (object_statuses[i] != SAI_STATUS_SUCCESS) {
+            result = SAI_STATUS_FAILURE;
+            continue;
+        }
+        removed++;
+    }
+
+    std::cout << "Mock: Bulk removed " << removed << "/" << object_count << " VLAN members" << std::endl;
+    return result;
 }
 
 // Mock Switch API Implementation
 sai_status_t mock_create_switch(sai_object_id_t* switch_id,
                                 uint32_t attr_count, const sai_attribute_t* attr_list) {
-    std::lock_guard<std::mutex> lock(g_sai_mutex);
-
     if (!switch_id) {
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
     // Generate a switch ID
-    *switch_id = generateNextOID();
+    *switch_id = generateNextOID(SAI_OBJECT_TYPE_SWITCH);
 
     std::cout << "Mock: Created switch with ID: " << std::hex << *switch_id << std::dec << std::endl;
     return SAI_STATUS_SUCCESS;
 }
 
 sai_status_t mock_remove_switch(sai_object_id_t switch_id) {
-    std::lock_guard<std::mutex> lock(g_sai_mutex);
-
     std::cout << "Mock: Removed switch with ID: " << std::hex << switch_id << std::dec << std::endl;
     return SAI_STATUS_SUCCESS;
 }
@@ -229,85 +472,316 @@ sai_status_t mock_remove_switch(sai_object_id_t switch_id) {
 // Mock Bridge API Implementation
 sai_status_t mock_create_bridge(sai_object_id_t* bridge_id, sai_object_id_t switch_id,
                                 uint32_t attr_count, const sai_attribute_t* attr_list) {
-    std::lock_guard<std::mutex> lock(g_sai_mutex);
-
     if (!bridge_id) {
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
     // Generate a bridge ID
-    *bridge_id = generateNextOID();
+    *bridge_id = generateNextOID(SAI_OBJECT_TYPE_BRIDGE);
 
     std::cout << "Mock: Created bridge with ID: " << std::hex << *bridge_id << std::dec << std::endl;
     return SAI_STATUS_SUCCESS;
 }
 
 sai_status_t mock_remove_bridge(sai_object_id_t bridge_id) {
-    std::lock_guard<std::mutex> lock(g_sai_mutex);
-
     std::cout << "Mock: Removed bridge with ID: " << std::hex << bridge_id << std::dec << std::endl;
     return SAI_STATUS_SUCCESS;
 }
 
 // Mock Route API Implementation
-sai_status_t mock_create_route_entry(const sai_route_entry_t* route_entry, uint32_t attr_count,
+
+static RouteKey routeKey(const sai_route_entry_t* route_entry) {
+    const sai_ip_prefix_t& prefix = route_entry->destination;
+    size_t length = (prefix.addr_family == SAI_IP_ADDR_FAMILY_IPV6) ? sizeof(sai_ip6_t) : sizeof(sai_ip4_t);
+    RouteKey key;
+    std::memset(key.bytes, 0, sizeof(key.bytes));
+    uint8_t* out = key.bytes;
+    // Each switch has its own route table
+    std::memcpy(out, &route_entry->switch_id, sizeof(route_entry->switch_id));
+    out += sizeof(route_entry->switch_id);
+    std::memcpy(out, &route_entry->vr_id, sizeof(route_entry->vr_id));
+    out += sizeof(route_entry->vr_id);
+    *out++ = static_cast<uint8_t>(prefix.addr_family);
+    std::memcpy(out, &prefix.addr, length);
+    std::memcpy(out + sizeof(sai_ip6_t), &prefix.mask, length);
+    return key;
+}
+
+static RouteShard& routeShard(const RouteKey& key) {
+    return g_route_shards[RouteKeyHash()(key) % ROUTE_SHARDS];
+}
+
+/**
+ * @brief Route entry operations; each locks only the shard holding the route
+ */
+static sai_status_t createRouteEntry(const sai_route_entry_t* route_entry, uint32_t attr_count,
                                      const sai_attribute_t* attr_list) {
-    std::lock_guard<std::mutex> lock(g_sai_mutex);
-    
     if (!route_entry || !attr_list) {
         return SAI_STATUS_INVALID_PARAMETER;
     }
-    
-    // Create mock route object (using destination as key)
-    sai_object_id_t route_oid = generateNextOID();
-    
+
     MockSAIObject obj;
     obj.type = SAI_OBJECT_TYPE_ROUTE_ENTRY;
     obj.switch_id = route_entry->switch_id;
-    
-    // Parse attributes
+    obj.attributes.reserve(attr_count);
     for (uint32_t i = 0; i < attr_count; i++) {
-        switch (attr_list[i].id) {
-            case SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION:
-                obj.attributes["packet_action"] = std::to_string(attr_list[i].value.s32);
-                break;
-            case SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID:
-                obj.attributes["next_hop_id"] = std::to_string(attr_list[i].value.oid);
-                break;
+        setAttribute(obj, attr_list[i]);
+    }
+
+    RouteKey key = routeKey(route_entry);
+    RouteShard& shard = routeShard(key);
+    {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (!shard.routes.emplace(key, std::move(obj)).second) {
+            return SAI_STATUS_ITEM_ALREADY_EXISTS;
         }
     }
-    
-    g_objects[route_oid] = obj;
-    
-    std::cout << "Mock: Created route entry with OID " << std::hex << route_oid << std::dec << std::endl;
+    g_route_count.fetch_add(1, std::memory_order_relaxed);
     return SAI_STATUS_SUCCESS;
 }
 
-sai_status_t mock_remove_route_entry(const sai_route_entry_t* route_entry) {
-    std::lock_guard<std::mutex> lock(g_sai_mutex);
-    
+static sai_status_t removeRouteEntry(const sai_route_entry_t* route_entry) {
     if (!route_entry) {
         return SAI_STATUS_INVALID_PARAMETER;
     }
-    
-    // In a real implementation, we would find the route by destination
-    // For mock, we'll just simulate success
-    
-    std::cout << "Mock: Removed route entry" << std::endl;
+    RouteKey key = routeKey(route_entry);
+    RouteShard& shard = routeShard(key);
+    {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (shard.routes.erase(key) == 0) {
+            return SAI_STATUS_ITEM_NOT_FOUND;
+        }
+    }
+    g_route_count.fetch_sub(1, std::memory_order_relaxed);
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t setRouteEntryAttribute(const sai_route_entry_t* route_entry, const sai_attribute_t* attr) {
+    if (!route_entry || !attr) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+    RouteKey key = routeKey(route_entry);
+    RouteShard& shard = routeShard(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.routes.find(key);
+    if (it == shard.routes.end()) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+    setAttribute(it->second, *attr);
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t mock_create_route_entry(const sai_route_entry_t* route_entry, uint32_t attr_count,
+                                     const sai_attribute_t* attr_list) {
+    sai_status_t status = createRouteEntry(route_entry, attr_count, attr_list);
+    if (status == SAI_STATUS_SUCCESS && g_verbose) {
+        std::cout << "Mock: Created route entry (" << g_route_count.load() << " routes)" << std::endl;
+    }
+    return status;
+}
+
+sai_status_t mock_remove_route_entry(const sai_route_entry_t* route_entry) {
+    sai_status_t status = removeRouteEntry(route_entry);
+    if (status == SAI_STATUS_SUCCESS && g_verbose) {
+        std::cout << "Mock: Removed route entry" << std::endl;
+    }
+    return status;
+}
+
+sai_status_t mock_set_route_entry_attribute(const sai_route_entry_t* route_entry, const sai_attribute_t* attr) {
+    return setRouteEntryAttribute(route_entry, attr);
+}
+
+sai_status_t mock_create_route_entries(uint32_t object_count, const sai_route_entry_t* route_entry,
+                                       const uint32_t* attr_count, const sai_attribute_t** attr_list,
+                                       sai_bulk_op_error_mode_t mode, sai_status_t* object_statuses) {
+    if (!route_entry || !attr_count || !attr_list || !object_statuses) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_status_t result = SAI_STATUS_SUCCESS;
+    uint32_t created = 0;
+    for (uint32_t i = 0; i < object_count; i++) {
+        if (result != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+        object_statuses[i] = createRouteEntry(&route_entry[i], attr_count[i], attr_list[i]);
+        if (object_statuses[i] == SAI_STATUS_SUCCESS) {
+            created++;
+        } else {
+            result = SAI_STATUS_FAILURE;
+        }
+    }
+
+    std::cout << "Mock: Bulk created " << created << "/" << object_count << " route entries" << std::endl;
+    return result;
+}
+
+sai_status_t mock_remove_route_entries(uint32_t object_count, const sai_route_entry_t* route_entry,
+                                       sai_bulk_op_error_mode_t mode, sai_status_t* object_statuses) {
+    if (!route_entry || !object_statuses) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_status_t result = SAI_STATUS_SUCCESS;
+    uint32_t removed = 0;
+    for (uint32_t i = 0; i < object_count; i++) {
+        if (result != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+        object_statuses[i] = removeRouteEntry(&route_entry[i]);
+        if (object_statuses[i] == SAI_STATUS_SUCCESS) {
+            removed++;
+        } else {
+            result = SAI_STATUS_FAILURE;
+        }
+    }
+
+    std::cout << "Mock: Bulk removed " << removed << "/" << object_count << " route entries" << std::endl;
+    return result;
+}
+
+sai_status_t mock_set_route_entries_attribute(uint32_t object_count, const sai_route_entry_t* route_entry,
+                                              const sai_attribute_t* attr_list, sai_bulk_op_error_mode_t mode,
+                                              sai_status_t* object_statuses) {
+    if (!route_entry || !attr_list || !object_statuses) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_status_t result = SAI_STATUS_SUCCESS;
+    for (uint32_t i = 0; i < object_count; i++) {
+        if (result != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+        object_statuses[i] = setRouteEntryAttribute(&route_entry[i], &attr_list[i]);
+        if (object_statuses[i] != SAI_STATUS_SUCCESS) {
+            result = SAI_STATUS_FAILURE;
+        }
+    }
+    return result;
+}
+
+// Mock Next Hop / Next Hop Group API Implementation
+
+sai_status_t mock_create_next_hop(sai_object_id_t* next_hop_id, sai_object_id_t switch_id,
+                                  uint32_t attr_count, const sai_attribute_t* attr_list) {
+    return insertObject(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_id, switch_id, attr_count, attr_list);
+}
+
+sai_status_t mock_remove_next_hop(sai_object_id_t next_hop_id) {
+    return eraseObject(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_id);
+}
+
+sai_status_t mock_set_next_hop_attribute(sai_object_id_t next_hop_id, const sai_attribute_t* attr) {
+    return updateObject(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_id, attr);
+}
+
+sai_status_t mock_create_next_hop_group(sai_object_id_t* next_hop_group_id, sai_object_id_t switch_id,
+                                        uint32_t attr_count, const sai_attribute_t* attr_list) {
+    return insertObject(SAI_OBJECT_TYPE_NEXT_HOP_GROUP, next_hop_group_id, switch_id, attr_count, attr_list);
+}
+
+sai_status_t mock_remove_next_hop_group(sai_object_id_t next_hop_group_id) {
+    return eraseObject(SAI_OBJECT_TYPE_NEXT_HOP_GROUP, next_hop_group_id);
+}
+
+sai_status_t mock_set_next_hop_group_attribute(sai_object_id_t next_hop_group_id, const sai_attribute_t* attr) {
+    return updateObject(SAI_OBJECT_TYPE_NEXT_HOP_GROUP, next_hop_group_id, attr);
+}
+
+sai_status_t mock_create_next_hop_group_member(sai_object_id_t* member_id, sai_object_id_t switch_id,
+                                               uint32_t attr_count, const sai_attribute_t* attr_list) {
+    return insertObject(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, member_id, switch_id, attr_count, attr_list);
+}
+
+sai_status_t mock_remove_next_hop_group_member(sai_object_id_t member_id) {
+    return eraseObject(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, member_id);
+}
+
+sai_status_t mock_set_next_hop_group_member_attribute(sai_object_id_t member_id, const sai_attribute_t* attr) {
+    return updateObject(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, member_id, attr);
+}
+
+sai_status_t mock_create_next_hop_group_members(sai_object_id_t switch_id, uint32_t object_count,
+                                                const uint32_t* attr_count, const sai_attribute_t** attr_list,
+                                                sai_bulk_op_error_mode_t mode, sai_object_id_t* object_id,
+                                                sai_status_t* object_statuses) {
+    if (!attr_count || !attr_list || !object_id || !object_statuses) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_status_t result = SAI_STATUS_SUCCESS;
+    for (uint32_t i = 0; i < object_count; i++) {
+        if (result != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+        object_statuses[i] = insertObject(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, &object_id[i], switch_id,
+                                                attr_count[i], attr_list[i]);
+        if (object_statuses[i] != SAI_STATUS_SUCCESS) {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            result = SAI_STATUS_FAILURE;
+        }
+    }
+    return result;
+}
+
+sai_status_t mock_remove_next_hop_group_members(uint32_t object_count, const sai_object_id_t* object_id,
+                                                sai_bulk_op_error_mode_t mode, sai_status_t* object_statuses) {
+    if (!object_id || !object_statuses) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_status_t result = SAI_STATUS_SUCCESS;
+    for (uint32_t i = 0; i < object_count; i++) {
+        if (result != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+        object_statuses[i] = eraseObject(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, object_id[i]);
+        if (object_statuses[i] != SAI_STATUS_SUCCESS) {
+            result = SAI_STATUS_FAILURE;
+        }
+    }
+    return result;
+}
+
 // Initialize API function pointers
 void initializeMockAPIs() {
     // VLAN API
     g_vlan_api.create_vlan = mock_create_vlan;
     g_vlan_api.remove_vlan = mock_remove_vlan;
+    g_vlan_api.set_vlan_attribute = mock_set_vlan_attribute;
     g_vlan_api.create_vlan_member = mock_create_vlan_member;
     g_vlan_api.remove_vlan_member = mock_remove_vlan_member;
+    g_vlan_api.set_vlan_member_attribute = mock_set_vlan_member_attribute;
+    g_vlan_api.create_vlan_members = mock_create_vlan_members;
+    g_vlan_api.remove_vlan_members = mock_remove_vlan_members;
     
     // Route API
     g_route_api.create_route_entry = mock_create_route_entry;
     g_route_api.remove_route_entry = mock_remove_route_entry;
+    g_route_api.set_route_entry_attribute = mock_set_route_entry_attribute;
+    g_route_api.create_route_entries = mock_create_route_entries;
+    g_route_api.remove_route_entries = mock_remove_route_entries;
+    g_route_api.set_route_entries_attribute = mock_set_route_entries_attribute;
+
+    // Next Hop / Next Hop Group API
+    g_next_hop_api.create_next_hop = mock_create_next_hop;
+    g_next_hop_api.remove_next_hop = mock_remove_next_hop;
+    g_next_hop_api.set_next_hop_attribute = mock_set_next_hop_attribute;
+    g_next_hop_group_api.create_next_hop_group = mock_create_next_hop_group;
+    g_next_hop_group_api.remove_next_hop_group = mock_remove_next_hop_group;
+    g_next_hop_group_api.set_next_hop_group_attribute = mock_set_next_hop_group_attribute;
+    g_next_hop_group_api.create_next_hop_group_member = mock_create_next_hop_group_member;
+    g_next_hop_group_api.remove_next_hop_group_member = mock_remove_next_hop_group_member;
+    g_next_hop_group_api.set_next_hop_group_member_attribute = mock_set_next_hop_group_member_attribute;
+    g_next_hop_group_api.create_next_hop_group_members = mock_create_next_hop_group_members;
+    g_next_hop_group_api.remove_next_hop_group_members = mock_remove_next_hop_group_members;
 
     // Switch API
     g_switch_api.create_switch = mock_create_switch;
@@ -9,8 +9,9 @@
 #define MOCK_SAI_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include <string>
-#include <map>
+#include <vector>
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,7 +34,9 @@ typedef enum _sai_status_t {
     SAI_STATUS_TABLE_FULL = -12,
     SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING = -13,
     SAI_STATUS_NOT_IMPLEMENTED = -14,
-    SAI_STATUS_ADDR_NOT_FOUND = -15
+    SAI_STATUS_ADDR_NOT_FOUND = -15,
+    SAI_STATUS_ITEM_ALREADY_EXISTS = -16,
+    SAI_STATUS_NOT_EXECUTED = -17
 } sai_status_t;
 
 // SAI Object Types
@@ -71,7 +74,8 @@ typedef enum _sai_object_type_t {
     SAI_OBJECT_TYPE_WRED = 30,
     SAI_OBJECT_TYPE_QOS_MAP = 31,
     SAI_OBJECT_TYPE_BRIDGE = 32,
-    SAI_OBJECT_TYPE_BRIDGE_PORT = 33
+    SAI_OBJECT_TYPE_BRIDGE_PORT = 33,
+    SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER = 34
 } sai_object_type_t;
 
 // SAI API Types
@@ -113,6 +117,30 @@ typedef uint32_t sai_ip4_t;
 
 #define SAI_NULL_OBJECT_ID 0ULL
 
+// IP address types (same layout as saitypes.h; IPv4 is in network byte order)
+typedef uint8_t sai_ip6_t[16];
+
+typedef enum _sai_ip_addr_family_t {
+    SAI_IP_ADDR_FAMILY_IPV4 = 0,
+    SAI_IP_ADDR_FAMILY_IPV6 = 1
+} sai_ip_addr_family_t;
+
+typedef union _sai_ip_addr_t {
+    sai_ip4_t ip4;
+    sai_ip6_t ip6;
+} sai_ip_addr_t;
+
+typedef struct _sai_ip_prefix_t {
+    sai_ip_addr_family_t addr_family;
+    sai_ip_addr_t addr;
+    sai_ip_addr_t mask;
+} sai_ip_prefix_t;
+
+typedef struct _sai_ip_address_t {
+    sai_ip_addr_family_t addr_family;
+    sai_ip_addr_t addr;
+} sai_ip_address_t;
+
 // SAI Attribute Value Union
 typedef union _sai_attribute_value_t {
     bool booldata;
@@ -126,6 +154,7 @@ typedef union _sai_attribute_value_t {
     uint64_t u64;
     int64_t s64;
     sai_object_id_t oid;
+    sai_ip_address_t ipaddr;
     // Add more types as needed
 } sai_attribute_value_t;
 
@@ -193,11 +222,45 @@ typedef enum _sai_packet_action_t {
     SAI_PACKET_ACTION_TRANSIT = 7
 } sai_packet_action_t;
 
+// Next Hop Attributes
+typedef enum _sai_next_hop_type_t {
+    SAI_NEXT_HOP_TYPE_IP = 0
+} sai_next_hop_type_t;
+
+typedef enum _sai_next_hop_attr_t {
+    SAI_NEXT_HOP_ATTR_START = 0,
+    SAI_NEXT_HOP_ATTR_TYPE = SAI_NEXT_HOP_ATTR_START,
+    SAI_NEXT_HOP_ATTR_IP = 1,
+    SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID = 2,
+    SAI_NEXT_HOP_ATTR_END = 3
+} sai_next_hop_attr_t;
+
+// Next Hop Group Attributes
+typedef enum _sai_next_hop_group_type_t {
+    SAI_NEXT_HOP_GROUP_TYPE_ECMP = 0
+} sai_next_hop_group_type_t;
+
+typedef enum _sai_next_hop_group_attr_t {
+    SAI_NEXT_HOP_GROUP_ATTR_START = 0,
+    SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_COUNT = SAI_NEXT_HOP_GROUP_ATTR_START,
+    SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_MEMBER_LIST = 1,
+    SAI_NEXT_HOP_GROUP_ATTR_TYPE = 2,
+    SAI_NEXT_HOP_GROUP_ATTR_END = 3
+} sai_next_hop_group_attr_t;
+
+typedef enum _sai_next_hop_group_member_attr_t {
+    SAI_NEXT_HOP_GROUP_MEMBER_ATTR_START = 0,
+    SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_START,
+    SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID = 1,
+    SAI_NEXT_HOP_GROUP_MEMBER_ATTR_WEIGHT = 2,
+    SAI_NEXT_HOP_GROUP_MEMBER_ATTR_END = 3
+} sai_next_hop_group_member_attr_t;
+
 // Route Entry
 typedef struct _sai_route_entry_t {
     sai_object_id_t switch_id;
     sai_object_id_t vr_id;
-    // Simplified - in real SAI this would include destination prefix
+    sai_ip_prefix_t destination;
 } sai_route_entry_t;
 
 // Service Method Table (simplified)
@@ -220,6 +283,14 @@ typedef struct _sai_route_api_t sai_route_api_t;
 typedef struct _sai_port_api_t sai_port_api_t;
 typedef struct _sai_switch_api_t sai_switch_api_t;
 typedef struct _sai_bridge_api_t sai_bridge_api_t;
+typedef struct _sai_next_hop_api_t sai_next_hop_api_t;
+typedef struct _sai_next_hop_group_api_t sai_next_hop_group_api_t;
+
+// Generic OID object create/remove/set (saitypes.h)
+typedef sai_status_t (*sai_generic_create_fn)(sai_object_id_t* object_id, sai_object_id_t switch_id,
+                                              uint32_t attr_count, const sai_attribute_t* attr_list);
+typedef sai_status_t (*sai_generic_remove_fn)(sai_object_id_t object_id);
+typedef sai_status_t (*sai_generic_set_fn)(sai_object_id_t object_id, const sai_attribute_t* attr);
 
 // API function pointers
 typedef sai_status_t (*sai_create_vlan_fn)(sai_object_id_t* vlan_id, sai_object_id_t switch_id,
@@ -239,25 +310,75 @@ typedef sai_status_t (*sai_create_vlan_member_fn)(sai_object_id_t* vlan_member_i
                                                   uint32_t attr_count, const sai_attribute_t* attr_list);
 typedef sai_status_t (*sai_remove_vlan_member_fn)(sai_object_id_t vlan_member_id);
 
+// Bulk operations (same shape as saitypes.h in the real SAI headers)
+typedef enum _sai_bulk_op_error_mode_t {
+    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR = 0,
+    SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR = 1
+} sai_bulk_op_error_mode_t;
+
+typedef sai_status_t (*sai_bulk_object_create_fn)(sai_object_id_t switch_id, uint32_t object_count,
+                                                  const uint32_t* attr_count, const sai_attribute_t** attr_list,
+                                                  sai_bulk_op_error_mode_t mode, sai_object_id_t* object_id,
+                                                  sai_status_t* object_statuses);
+typedef sai_status_t (*sai_bulk_object_remove_fn)(uint32_t object_count, const sai_object_id_t* object_id,
+                                                  sai_bulk_op_error_mode_t mode, sai_status_t* object_statuses);
+
 typedef sai_status_t (*sai_create_route_entry_fn)(const sai_route_entry_t* route_entry, uint32_t attr_count,
                                                    const sai_attribute_t* attr_list);
 typedef sai_status_t (*sai_remove_route_entry_fn)(const sai_route_entry_t* route_entry);
+typedef sai_status_t (*sai_set_route_entry_attribute_fn)(const sai_route_entry_t* route_entry,
+                                                          const sai_attribute_t* attr);
+typedef sai_status_t (*sai_bulk_create_route_entry_fn)(uint32_t object_count, const sai_route_entry_t* route_entry,
+                                                       const uint32_t* attr_count, const sai_attribute_t** attr_list,
+                                                       sai_bulk_op_error_mode_t mode, sai_status_t* object_statuses);
+typedef sai_status_t (*sai_bulk_remove_route_entry_fn)(uint32_t object_count, const sai_route_entry_t* route_entry,
+                                                       sai_bulk_op_error_mode_t mode, sai_status_t* object_statuses);
+typedef sai_status_t (*sai_bulk_set_route_entry_attribute_fn)(uint32_t object_count,
+                                                              const sai_route_entry_t* route_entry,
+                                                              const sai_attribute_t* attr_list,
+                                                              sai_bulk_op_error_mode_t mode,
+                                                              sai_status_t* object_statuses);
 
 // API Structures
 struct _sai_vlan_api_t {
     sai_create_vlan_fn create_vlan;
     sai_remove_vlan_fn remove_vlan;
+    sai_generic_set_fn set_vlan_attribute;
     sai_create_vlan_member_fn create_vlan_member;
     sai_remove_vlan_member_fn remove_vlan_member;
+    sai_generic_set_fn set_vlan_member_attribute;
+    sai_bulk_object_create_fn create_vlan_members;
+    sai_bulk_object_remove_fn remove_vlan_members;
     // Add more function pointers as needed
 };
 
 struct _sai_route_api_t {
     sai_create_route_entry_fn create_route_entry;
     sai_remove_route_entry_fn remove_route_entry;
+    sai_set_route_entry_attribute_fn set_route_entry_attribute;
+    sai_bulk_create_route_entry_fn create_route_entries;
+    sai_bulk_remove_route_entry_fn remove_route_entries;
+    sai_bulk_set_route_entry_attribute_fn set_route_entries_attribute;
     // Add more function pointers as needed
 };
 
+struct _sai_next_hop_api_t {
+    sai_generic_create_fn create_next_hop;
+    sai_generic_remove_fn remove_next_hop;
+    sai_generic_set_fn set_next_hop_attribute;
+};
+
+struct _sai_next_hop_group_api_t {
+    sai_generic_create_fn create_next_hop_group;
+    sai_generic_remove_fn remove_next_hop_group;
+    sai_generic_set_fn set_next_hop_group_attribute;
+    sai_generic_create_fn create_next_hop_group_member;
+    sai_generic_remove_fn remove_next_hop_group_member;
+    sai_generic_set_fn set_next_hop_group_member_attribute;
+    sai_bulk_object_create_fn create_next_hop_group_members;
+    sai_bulk_object_remove_fn remove_next_hop_group_members;
+};
+
 struct _sai_port_api_t {
     // Port API functions (placeholder)
     void* reserved;
@@ -277,6 +398,8 @@ struct _sai_bridge_api_t {
 sai_status_t sai_api_initialize(uint64_t flags, const sai_service_method_table_t* services);
 sai_status_t sai_api_uninitialize(void);
 sai_status_t sai_api_query(sai_api_t api, void** api_method_table);
+sai_object_type_t sai_object_type_query(sai_object_id_t object_id);
+sai_object_id_t sai_switch_id_query(sai_object_id_t object_id);
 
 #ifdef __cplusplus
 }
@@ -285,15 +408,32 @@ sai_status_t sai_api_query(sai_api_t api, void** api_method_table);
 struct MockSAIObject {
     sai_object_type_t type;
     sai_object_id_t switch_id;
-    std::map<std::string, std::string> attributes;
+    std::vector<sai_attribute_t> attributes;   // Typed copies, at most one per attribute id
 };
 
+/**
+ * @brief Enable or disable per-object log lines (on by default); bulk summaries are always logged
+ */
+void mockSAISetVerbose(bool verbose);
+
+/**
+ * @brief Live OID objects of one type, or of every type for SAI_OBJECT_TYPE_NULL
+ */
+size_t mockSAIObjectCount(sai_object_type_t type);
+
+/**
+ * @brief Live route entries
+ */
+size_t mockSAIRouteCount();
+
 // Mock API type definitions
 typedef struct _sai_vlan_api_t MockVLANAPI;
 typedef struct _sai_route_api_t MockRouteAPI;
 typedef struct _sai_port_api_t MockPortAPI;
 typedef struct _sai_switch_api_t MockSwitchAPI;
 typedef struct _sai_bridge_api_t MockBridgeAPI;
+typedef struct _sai_next_hop_api_t MockNextHopAPI;
+typedef struct _sai_next_hop_group_api_t MockNextHopGroupAPI;
 
 #endif // __cplusplus
 
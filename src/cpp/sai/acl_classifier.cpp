@@ -0,0 +1,275 @@
+/**
+ * @file acl_classifier.cpp
+ * @brief SONiC SAI ACL Rule Compiler and Classifier Implementation
+ */
+
+#include "acl_classifier.h"
+#include "../common/ip_prefix.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace sonic {
+namespace sai {
+
+namespace {
+
+uint32_t prefixMask(uint8_t length) {
+    return length == 0 ? 0 : ~uint32_t(0) << (32 - length);
+}
+
+bool parseNumber(const std::string& text, unsigned long max, unsigned long& value) {
+    if (text.empty()) {
+        return false;
+    }
+    char* end = nullptr;
+    value = std::strtoul(text.c_str(), &end, 0);
+    return *end == '\0' && value <= max;
+}
+
+bool parseIPv4Prefix(const std::string& text, uint32_t& address, uint8_t& length, std::string& error) {
+    common::IpPrefix prefix;
+    if (!common::IpPrefix::parse(text, prefix)) {
+        error = "malformed prefix " + text;
+        return false;
+    }
+    if (prefix.v6) {
+        error = "IPv6 match " + text + " is not supported";
+        return false;
+    }
+    address = static_cast<uint32_t>(prefix.address >> 96);
+    length = prefix.length;
+    return true;
+}
+
+// "80" or "1000-2000"
+bool parsePortRange(const std::string& text, uint16_t& low, uint16_t& high) {
+    size_t dash = text.find('-');
+    unsigned long first = 0;
+    unsigned long last = 0;
+    if (!parseNumber(text.substr(0, dash), UINT16_MAX, first)) {
+        return false;
+    }
+    last = first;
+    if (dash != std::string::npos && !parseNumber(text.substr(dash + 1), UINT16_MAX, last)) {
+        return false;
+    }
+    if (first > last) {
+        return false;
+    }
+    low = static_cast<uint16_t>(first);
+    high = static_cast<uint16_t>(last);
+    return true;
+}
+
+bool parseProtocol(const std::string& text, uint8_t& protocol) {
+    static const std::map<std::string, uint8_t> names = {{"ICMP", 1}, {"TCP", 6}, {"UDP", 17}};
+    auto it = names.find(text);
+    if (it != names.end()) {
+        protocol = it->second;
+        return true;
+    }
+    unsigned long value = 0;
+    if (!parseNumber(text, 255, value)) {
+        return false;
+    }
+    protocol = static_cast<uint8_t>(value);
+    return true;
+}
+
+bool prefixCovers(uint32_t outer, uint8_t outer_length, uint32_t inner, uint8_t inner_length) {
+    return outer_length <= inner_length && (inner & prefixMask(outer_length)) == outer;
+}
+
+bool prefixesOverlap(uint32_t a, uint8_t a_length, uint32_t b, uint8_t b_length) {
+    uint32_t mask = prefixMask(std::min(a_length, b_length));
+    return (a & mask) == (b & mask);
+}
+
+} // anonymous namespace
+
+bool CompiledACLRule::matches(const ACLPacket& packet) const {
+    return (packet.src_ip & prefixMask(src_prefix_length)) == src_ip &&
+           (packet.dst_ip & prefixMask(dst_prefix_length)) == dst_ip &&
+           (!match_protocol || packet.protocol == protocol) &&
+           packet.src_port >= src_port_min && packet.src_port <= src_port_max &&
+           packet.dst_port >= dst_port_min && packet.dst_port <= dst_port_max;
+}
+
+bool CompiledACLRule::covers(const CompiledACLRule& other) const {
+    return prefixCovers(src_ip, src_prefix_length, other.src_ip, other.src_prefix_length) &&
+           prefixCovers(dst_ip, dst_prefix_length, other.dst_ip, other.dst_prefix_length) &&
+           (!match_protocol || (other.match_protocol && other.protocol == protocol)) &&
+           src_port_min <= other.src_port_min && other.src_port_max <= src_port_max &&
+           dst_port_min <= other.dst_port_min && other.dst_port_max <= dst_port_max;
+}
+
+bool CompiledACLRule::overlaps(const CompiledACLRule& other) const {
+    return prefixesOverlap(src_ip, src_prefix_length, other.src_ip, other.src_prefix_length) &&
+           prefixesOverlap(dst_ip, dst_prefix_length, other.dst_ip, other.dst_prefix_length) &&
+           (!match_protocol || !other.match_protocol || protocol == other.protocol) &&
+           src_port_min <= other.src_port_max && other.src_port_min <= src_port_max &&
+           dst_port_min <= other.dst_port_max && other.dst_port_min <= dst_port_max;
+}
+
+bool ACLClassifier::compileRule(const std::string& name, const std::map<std::string, std::string>& fields,
+                                CompiledACLRule& rule, std::string& error) {
+    rule = CompiledACLRule();
+    rule.name = name;
+    bool has_action = false;
+
+    for (const auto& field : fields) {
+        const std::string& key = field.first;
+        const std::string& value = field.second;
+        unsigned long number = 0;
+
+        if (key == "PRIORITY") {
+            if (!parseNumber(value, UINT32_MAX, number)) {
+                error = "malformed PRIORITY " + value;
+                return false;
+            }
+            rule.priority = static_cast<uint32_t>(number);
+        } else if (key == "PACKET_ACTION") {
+            has_action = true;
+            if (value == "FORWARD") {
+                rule.action = ACLAction::PERMIT;
+            } else if (value == "DROP") {
+                rule.action = ACLAction::DENY;
+            } else if (value.compare(0, 9, "REDIRECT:") == 0) {
+                rule.action = ACLAction::REDIRECT;
+                rule.redirect_target = value.substr(9);
+            } else {
+                error = "unsupported PACKET_ACTION " + value;
+                return false;
+            }
+        } else if (key == "SRC_IP") {
+            if (!parseIPv4Prefix(value, rule.src_ip, rule.src_prefix_length, error)) {
+                return false;
+            }
+        } else if (key == "DST_IP") {
+            if (!parseIPv4Prefix(value, rule.dst_ip, rule.dst_prefix_length, error)) {
+                return false;
+            }
+        } else if (key == "IP_PROTOCOL") {
+            if (!parseProtocol(value, rule.protocol)) {
+                error = "malformed IP_PROTOCOL " + value;
+                return false;
+            }
+            rule.match_protocol = true;
+        } else if (key == "L4_SRC_PORT" || key == "L4_SRC_PORT_RANGE") {
+            if (!parsePortRange(value, rule.src_port_min, rule.src_port_max)) {
+                error = "malformed " + key + " " + value;
+                return false;
+            }
+        } else if (key == "L4_DST_PORT" || key == "L4_DST_PORT_RANGE") {
+            if (!parsePortRange(value, rule.dst_port_min, rule.dst_port_max)) {
+                error = "malformed " + key + " " + value;
+                return false;
+            }
+        } else if (key == "IP_TYPE") {
+            // Only qualifiers that accept every IPv4 packet are modelled
+            if (value != "ANY" && value != "IP" && value != "IPV4" && value != "IPV4ANY") {
+                error = "unsupported IP_TYPE " + value;
+                return false;
+            }
+        } else {
+            // Verifying with a qualifier silently ignored would give wrong answers
+            error = "unsupported qualifier " + key;
+            return false;
+        }
+    }
+
+    if (!has_action) {
+        error = "no PACKET_ACTION";
+        return false;
+    }
+    return true;
+}
+
+ACLClassifier::ACLClassifier(std::vector<CompiledACLRule> rules) : rules_(std::move(rules)) {
+    std::sort(rules_.begin(), rules_.end(), [](const CompiledACLRule& a, const CompiledACLRule& b) {
+        return a.priority != b.priority ? a.priority > b.priority : a.name < b.name;
+    });
+
+    std::map<uint32_t, size_t> tuple_index;     // (src length, dst length, protocol given) -> tuples_
+    for (uint32_t i = 0; i < rules_.size(); ++i) {
+        const CompiledACLRule& rule = rules_[i];
+        uint32_t shape = (uint32_t(rule.src_prefix_length) << 16) | (uint32_t(rule.dst_prefix_length) << 8) |
+                         (rule.match_protocol ? 1 : 0);
+        auto it = tuple_index.find(shape);
+        if (it == tuple_index.end()) {
+            Tuple tuple;
+            tuple.src_prefix_length = rule.src_prefix_length;
+            tuple.dst_prefix_length = rule.dst_prefix_length;
+            tuple.match_protocol = rule.match_protocol;
+            tuple.best_rule = i;    // Rules are visited best first
+            it = tuple_index.emplace(shape, tuples_.size()).first;
+            tuples_.push_back(std::move(tuple));
+        }
+        Tuple& tuple = tuples_[it->second];
+        tuple.buckets[keyFor(tuple, rule.src_ip, rule.dst_ip, rule.protocol)].push_back(i);
+    }
+    // Tuples were created in order of their best rule, so tuples_ is already sorted
+}
+
+ACLClassifier::TupleKey ACLClassifier::keyFor(const Tuple& tuple, uint32_t src_ip, uint32_t dst_ip,
+                                              uint8_t protocol) const {
+    TupleKey key;
+    key.addresses = (uint64_t(src_ip & prefixMask(tuple.src_prefix_length)) << 32) |
+                    (dst_ip & prefixMask(tuple.dst_prefix_length));
+    key.protocol = tuple.match_protocol ? protocol : 0;
+    return key;
+}
+
+const CompiledACLRule* ACLClassifier::match(const ACLPacket& packet) const {
+    uint32_t best = UINT32_MAX;
+    for (const auto& tuple : tuples_) {
+        if (tuple.best_rule >= best) {
+            break;  // No rule left in this or any later tuple can win
+        }
+        auto bucket = tuple.buckets.find(keyFor(tuple, packet.src_ip, packet.dst_ip, packet.protocol));
+        if (bucket == tuple.buckets.end()) {
+            continue;
+        }
+        for (uint32_t index : bucket->second) {
+            if (index >= best) {
+                break;
+            }
+            const CompiledACLRule& rule = rules_[index];
+            if (packet.src_port >= rule.src_port_min && packet.src_port <= rule.src_port_max &&
+                packet.dst_port >= rule.dst_port_min && packet.dst_port <= rule.dst_port_max) {
+                best = index;
+                break;
+            }
+        }
+    }
+    return best != UINT32_MAX ? &rules_[best] : nullptr;
+}
+
+std::vector<ACLConflict> ACLClassifier::findConflicts(bool include_overlaps) const {
+    std::vector<ACLConflict> conflicts;
+    for (size_t later = 1; later < rules_.size(); ++later) {
+        const CompiledACLRule& rule = rules_[later];
+        const CompiledACLRule* overlap = nullptr;
+        bool hidden = false;
+        for (size_t earlier = 0; earlier < later; ++earlier) {
+            const CompiledACLRule& candidate = rules_[earlier];
+            if (candidate.covers(rule)) {
+                conflicts.push_back({candidate.sameAction(rule) ? ACLConflict::Kind::REDUNDANT
+                                                                 : ACLConflict::Kind::SHADOWED,
+                                     rule.name, candidate.name});
+                hidden = true;
+                break;
+            }
+            if (include_overlaps && !overlap && !candidate.sameAction(rule) && candidate.overlaps(rule)) {
+                overlap = &candidate;
+            }
+        }
+        if (!hidden && overlap) {
+            conflicts.push_back({ACLConflict::Kind::OVERLAP, rule.name, overlap->name});
+        }
+    }
+    return conflicts;
+}
+
+} // namespace sai
+} // namespace sonic
@@ -0,0 +1,160 @@
+/**
+ * @file acl_classifier.h
+ * @brief SONiC SAI ACL Rule Compiler and Classifier Header
+ *
+ * Turns CONFIG_DB ACL_RULE entries into binary match rules (IPv4 prefixes,
+ * protocol, L4 port ranges) sorted by priority, and classifies packets with
+ * a tuple-space search: rules are grouped by (source prefix length,
+ * destination prefix length, protocol given) and each group is one hash
+ * lookup. Also reports rules that a single higher-priority rule shadows.
+ */
+
+#ifndef SONIC_SAI_ACL_CLASSIFIER_H
+#define SONIC_SAI_ACL_CLASSIFIER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace sonic {
+namespace sai {
+
+enum class ACLAction : uint8_t {
+    PERMIT,
+    DENY,
+    REDIRECT
+};
+
+/**
+ * @brief Header fields a rule can match on
+ */
+struct ACLPacket {
+    uint32_t src_ip = 0;
+    uint32_t dst_ip = 0;
+    uint8_t protocol = 0;
+    uint16_t src_port = 0;
+    uint16_t dst_port = 0;
+};
+
+/**
+ * @brief One parsed rule; unset qualifiers match everything
+ */
+struct CompiledACLRule {
+    std::string name;           ///< Rule name within its table
+    uint32_t priority = 0;      ///< Higher wins, as in SONiC
+    uint32_t src_ip = 0;
+    uint8_t src_prefix_length = 0;
+    uint32_t dst_ip = 0;
+    uint8_t dst_prefix_length = 0;
+    bool match_protocol = false;
+    uint8_t protocol = 0;
+    uint16_t src_port_min = 0;
+    uint16_t src_port_max = UINT16_MAX;
+    uint16_t dst_port_min = 0;
+    uint16_t dst_port_max = UINT16_MAX;
+    ACLAction action = ACLAction::PERMIT;
+    std::string redirect_target;
+
+    bool matches(const ACLPacket& packet) const;
+
+    /**
+     * @brief Every packet other matches is also matched by this rule
+     */
+    bool covers(const CompiledACLRule& other) const;
+
+    /**
+     * @brief Some packet matches both rules
+     */
+    bool overlaps(const CompiledACLRule& other) const;
+
+    /**
+     * @brief Same action and redirect target
+     */
+    bool sameAction(const CompiledACLRule& other) const {
+        return action == other.action && redirect_target == other.redirect_target;
+    }
+};
+
+/**
+ * @brief Finding from ACLClassifier::findConflicts()
+ */
+struct ACLConflict {
+    enum class Kind {
+        SHADOWED,   ///< Never hit; an earlier rule with another action covers it
+        REDUNDANT,  ///< Never hit; an earlier rule with the same action covers it
+        OVERLAP     ///< Partly hidden by an earlier rule with another action
+    };
+
+    Kind kind;
+    std::string rule;       ///< The lower-priority rule
+    std::string by;         ///< The higher-priority rule that hides it
+};
+
+/**
+ * @brief Immutable classifier over one ACL table's rules
+ */
+class ACLClassifier {
+public:
+    /**
+     * @brief Parse one ACL_RULE entry's fields
+     * @param error Reason when the rule uses a malformed or unsupported qualifier
+     */
+    static bool compileRule(const std::string& name, const std::map<std::string, std::string>& fields,
+                            CompiledACLRule& rule, std::string& error);
+
+    explicit ACLClassifier(std::vector<CompiledACLRule> rules);
+
+    /**
+     * @brief Highest-priority rule matching packet, null when none does
+     */
+    const CompiledACLRule* match(const ACLPacket& packet) const;
+
+    /**
+     * @brief Rules hidden fully or partly by a single higher-priority rule
+     * @param include_overlaps Also report partial overlaps with a different action
+     */
+    std::vector<ACLConflict> findConflicts(bool include_overlaps = false) const;
+
+    /**
+     * @brief Rules in evaluation order (priority descending, then name)
+     */
+    const std::vector<CompiledACLRule>& rules() const { return rules_; }
+    size_t tupleCount() const { return tuples_.size(); }
+
+private:
+    struct TupleKey {
+        uint64_t addresses;     // Masked source in the high half, destination in the low half
+        uint8_t protocol;
+
+        bool operator==(const TupleKey& other) const {
+            return addresses == other.addresses && protocol == other.protocol;
+        }
+    };
+
+    struct TupleKeyHash {
+        size_t operator()(const TupleKey& key) const {
+            return static_cast<size_t>((key.addresses ^ (uint64_t(key.protocol) << 56)) * 0x9E3779B97F4A7C15ULL >> 16);
+        }
+    };
+
+    struct Tuple {
+        uint8_t src_prefix_length;
+        uint8_t dst_prefix_length;
+        bool match_protocol;
+        uint32_t best_rule;     // Lowest rule index in the tuple
+        std::unordered_map<TupleKey, std::vector<uint32_t>, TupleKeyHash> buckets; // Rule indices, ascending
+    };
+
+    TupleKey keyFor(const Tuple& tuple, uint32_t src_ip, uint32_t dst_ip, uint8_t protocol) const;
+
+    std::vector<CompiledACLRule> rules_;
+    std::vector<Tuple> tuples_;     // Sorted by best_rule so lookups can stop early
+};
+
+} // namespace sai
+} // namespace sonic
+
+#endif // SONIC_SAI_ACL_CLASSIFIER_H
@@ -0,0 +1,322 @@
+/**
+ * @file counter_poller.cpp
+ * @brief SONiC SAI Counter Poller Implementation
+ */
+
+#include "counter_poller.h"
+#include "../common/redis_client.h"
+#include "../common/logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace sonic {
+namespace sai {
+
+namespace {
+
+constexpr int COUNTERS_DB = 2;
+
+const std::vector<std::string> PORT_COUNTER_NAMES = {
+    "SAI_PORT_STAT_IF_IN_OCTETS",
+    "SAI_PORT_STAT_IF_IN_UCAST_PKTS",
+    "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS",
+    "SAI_PORT_STAT_IF_IN_ERRORS",
+    "SAI_PORT_STAT_IF_IN_DISCARDS",
+    "SAI_PORT_STAT_IF_OUT_OCTETS",
+    "SAI_PORT_STAT_IF_OUT_UCAST_PKTS",
+    "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS",
+    "SAI_PORT_STAT_IF_OUT_ERRORS",
+    "SAI_PORT_STAT_IF_OUT_DISCARDS"
+};
+
+const std::vector<std::string> VLAN_COUNTER_NAMES = {
+    "SAI_ROUTER_INTERFACE_STAT_IN_OCTETS",
+    "SAI_ROUTER_INTERFACE_STAT_IN_PACKETS",
+    "SAI_ROUTER_INTERFACE_STAT_IN_ERROR_PACKETS",
+    "SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS",
+    "SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS",
+    "SAI_ROUTER_INTERFACE_STAT_OUT_ERROR_PACKETS"
+};
+
+uint64_t nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t parseCounter(const common::RedisReply& reply) {
+    if (reply.type != common::RedisReply::Type::STRING || reply.str.empty()) {
+        return 0;
+    }
+    return std::strtoull(reply.str.c_str(), nullptr, 10);
+}
+
+} // anonymous namespace
+
+size_t CounterColumns::find(const std::string& name) const {
+    auto it = std::lower_bound(names.begin(), names.end(), name);
+    return (it != names.end() && *it == name) ? static_cast<size_t>(it - names.begin()) : rows();
+}
+
+std::map<std::string, uint64_t> CounterColumns::valuesFor(size_t row) const {
+    std::map<std::string, uint64_t> result;
+    if (row >= rows()) {
+        return result;
+    }
+    for (size_t counter = 0; counter < counter_names.size(); ++counter) {
+        result[counter_names[counter]] = value(counter, row);
+    }
+    return result;
+}
+
+CounterPoller::CounterPoller(common::RedisClient& client)
+    : client_(client), next_buffer_(0), sequence_(0), last_poll_ns_(0), polls_since_name_refresh_(0),
+      name_map_refresh_(30), read_failed_(false), running_(false), interval_ms_(1000) {
+    ports_.name_map = "COUNTERS_PORT_NAME_MAP";
+    ports_.name_prefix = "";
+    ports_.counter_names = PORT_COUNTER_NAMES;
+    // VLAN counters are those of the VLAN's router interface
+    vlans_.name_map = "COUNTERS_RIF_NAME_MAP";
+    vlans_.name_prefix = "Vlan";
+    vlans_.counter_names = VLAN_COUNTER_NAMES;
+}
+
+CounterPoller::~CounterPoller() {
+    stop();
+}
+
+void CounterPoller::start(int interval_ms) {
+    if (running_.exchange(true)) {
+        return;
+    }
+    interval_ms_ = interval_ms > 0 ? interval_ms : 1000;
+    thread_ = std::thread(&CounterPoller::pollLoop, this);
+}
+
+void CounterPoller::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+    }
+    wait_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void CounterPoller::pollLoop() {
+    while (running_.load()) {
+        pollOnce();
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        wait_cv_.wait_for(lock, std::chrono::milliseconds(interval_ms_), [this] { return !running_.load(); });
+    }
+}
+
+std::shared_ptr<const CounterSnapshot> CounterPoller::snapshot() const {
+    return std::atomic_load(&current_);
+}
+
+bool CounterPoller::loadNameMaps() {
+    std::vector<common::RedisReply> replies;
+    if (!client_.pipeline(COUNTERS_DB, {{"HGETALL", ports_.name_map}, {"HGETALL", vlans_.name_map}}, replies) ||
+        replies.size() != 2) {
+        if (!read_failed_) {
+            SONIC_LOG_WARN("SAI", "Counter poller failed to read the counter name maps");
+        }
+        read_failed_ = true;
+        return false;
+    }
+
+    Group* groups[] = {&ports_, &vlans_};
+    for (size_t g = 0; g < 2; ++g) {
+        Group& group = *groups[g];
+        std::vector<std::string> names;
+        std::vector<std::string> oids;
+        size_t prefix_length = std::char_traits<char>::length(group.name_prefix);
+        for (const auto& entry : replies[g].asHash()) {    // Sorted by name
+            if (entry.first.compare(0, prefix_length, group.name_prefix) == 0) {
+                names.push_back(entry.first);
+                oids.push_back(entry.second);
+            }
+        }
+        if (names == group.names) {
+            group.oids.swap(oids);
+            continue;
+        }
+
+        // Carry the latest readings of surviving rows into the new layout
+        size_t old_rows = group.names.size();
+        size_t counters = group.counter_names.size();
+        std::vector<uint64_t> raw(counters * names.size(), 0);
+        group.fresh_rows.clear();
+        for (size_t row = 0; row < names.size(); ++row) {
+            auto it = std::lower_bound(group.names.begin(), group.names.end(), names[row]);
+            if (it == group.names.end() || *it != names[row] || group.raw.size() != counters * old_rows) {
+                group.fresh_rows.push_back(row);
+                continue;
+            }
+            size_t old_row = static_cast<size_t>(it - group.names.begin());
+            for (size_t counter = 0; counter < counters; ++counter) {
+                raw[counter * names.size() + row] = group.raw[counter * old_rows + old_row];
+            }
+        }
+        for (auto it = group.baselines.begin(); it != group.baselines.end();) {
+            it = std::binary_search(names.begin(), names.end(), it->first) ? std::next(it) : group.baselines.erase(it);
+        }
+        group.names.swap(names);
+        group.oids.swap(oids);
+        group.raw.swap(raw);
+    }
+    return true;
+}
+
+bool CounterPoller::pollOnce() {
+    std::lock_guard<std::mutex> lock(poll_mutex_);
+
+    if (sequence_ == 0 || ++polls_since_name_refresh_ >= name_map_refresh_) {
+        if (!loadNameMaps() && sequence_ == 0) {
+            return false;
+        }
+        polls_since_name_refresh_ = 0;
+    }
+
+    // One HMGET per object, all in a single round trip
+    std::vector<std::vector<std::string>> commands;
+    commands.reserve(ports_.oids.size() + vlans_.oids.size());
+    for (const Group* group : {&ports_, &vlans_}) {
+        for (const auto& oid : group->oids) {
+            std::vector<std::string> command;
+            command.reserve(group->counter_names.size() + 2);
+            command.push_back("HMGET");
+            command.push_back("COUNTERS:" + oid);
+            command.insert(command.end(), group->counter_names.begin(), group->counter_names.end());
+            commands.push_back(std::move(command));
+        }
+    }
+
+    std::vector<common::RedisReply> replies;
+    if (!commands.empty() && (!client_.pipeline(COUNTERS_DB, commands, replies) || replies.size() != commands.size())) {
+        if (!read_failed_) {
+            SONIC_LOG_WARN("SAI", "Counter poller failed to read COUNTERS_DB");
+        }
+        read_failed_ = true;
+        return false;
+    }
+    read_failed_ = false;
+
+    uint64_t now_ns = nowNs();
+    double interval_seconds = last_poll_ns_ ? static_cast<double>(now_ns - last_poll_ns_) / 1e9 : 0.0;
+    last_poll_ns_ = now_ns;
+
+    size_t reply_index = 0;
+    for (Group* group : {&ports_, &vlans_}) {
+        size_t rows = group->names.size();
+        size_t counters = group->counter_names.size();
+        group->previous_raw.swap(group->raw);
+        group->raw.assign(counters * rows, 0);
+        for (size_t row = 0; row < rows; ++row) {
+            const common::RedisReply& reply = replies[reply_index++];
+            if (reply.type != common::RedisReply::Type::ARRAY) {
+                continue;
+            }
+            for (size_t counter = 0; counter < counters && counter < reply.elements.size(); ++counter) {
+                group->raw[counter * rows + row] = parseCounter(reply.elements[counter]);
+            }
+        }
+        // Rows without a previous reading report no change rather than their whole count
+        if (group->previous_raw.size() != group->raw.size()) {
+            group->previous_raw = group->raw;
+        }
+        for (size_t row : group->fresh_rows) {
+            for (size_t counter = 0; counter < counters; ++counter) {
+                group->previous_raw[counter * rows + row] = group->raw[counter * rows + row];
+            }
+        }
+        group->fresh_rows.clear();
+    }
+
+    std::shared_ptr<CounterSnapshot> next = writableBuffer();
+    buildColumns(ports_, interval_seconds, next->ports);
+    buildColumns(vlans_, interval_seconds, next->vlans);
+    next->sequence = ++sequence_;
+    next->interval_seconds = interval_seconds;
+    std::atomic_store(&current_, std::shared_ptr<const CounterSnapshot>(next));
+    return true;
+}
+
+std::shared_ptr<CounterSnapshot> CounterPoller::writableBuffer() {
+    // The published buffer is the other one; this one is free unless a reader still holds it
+    std::shared_ptr<CounterSnapshot>& buffer = buffers_[next_buffer_];
+    next_buffer_ ^= 1;
+    if (!buffer || buffer.use_count() > 1) {
+        buffer = std::make_shared<CounterSnapshot>();
+    }
+    return buffer;
+}
+
+void CounterPoller::buildColumns(Group& group, double interval_seconds, CounterColumns& out) {
+    if (out.names != group.names) {
+        out.names = group.names;
+    }
+    if (out.counter_names != group.counter_names) {
+        out.counter_names = group.counter_names;
+    }
+
+    size_t count = group.raw.size();
+    out.values.resize(count);
+    out.deltas.resize(count);
+    out.rates.resize(count);
+
+    // Straight-line loops over contiguous arrays so the compiler can vectorize them
+    const uint64_t* raw = group.raw.data();
+    const uint64_t* previous = group.previous_raw.data();
+    uint64_t* values = out.values.data();
+    uint64_t* deltas = out.deltas.data();
+    double* rates = out.rates.data();
+    double per_second = interval_seconds > 0 ? 1.0 / interval_seconds : 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        // A reading below the previous one means the counter was reset
+        deltas[i] = raw[i] >= previous[i] ? raw[i] - previous[i] : raw[i];
+    }
+    for (size_t i = 0; i < count; ++i) {
+        rates[i] = static_cast<double>(deltas[i]) * per_second;
+    }
+    std::copy(raw, raw + count, values);
+
+    size_t rows = group.names.size();
+    for (auto& baseline : group.baselines) {
+        size_t row = out.find(baseline.first);
+        for (size_t counter = 0; row < rows && counter < baseline.second.size(); ++counter) {
+            uint64_t& value = values[counter * rows + row];
+            if (value < baseline.second[counter]) {
+                baseline.second[counter] = 0;   // Counter reset since the clear
+            }
+            value -= baseline.second[counter];
+        }
+    }
+}
+
+bool CounterPoller::clearPort(const std::string& port_name) {
+    {
+        std::lock_guard<std::mutex> lock(poll_mutex_);
+        auto it = std::lower_bound(ports_.names.begin(), ports_.names.end(), port_name);
+        if (it == ports_.names.end() || *it != port_name) {
+            return false;
+        }
+        size_t rows = ports_.names.size();
+        size_t row = static_cast<size_t>(it - ports_.names.begin());
+        std::vector<uint64_t>& baseline = ports_.baselines[port_name];
+        baseline.resize(ports_.counter_names.size());
+        for (size_t counter = 0; counter < baseline.size(); ++counter) {
+            baseline[counter] = ports_.raw[counter * rows + row];
+        }
+    }
+    // Publish the cleared values now instead of at the next interval
+    pollOnce();
+    return true;
+}
+
+} // namespace sai
+} // namespace sonic
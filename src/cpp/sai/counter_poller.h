@@ -0,0 +1,182 @@
+/**
+ * @file counter_poller.h
+ * @brief SONiC SAI Counter Poller Header
+ *
+ * Reads every port and VLAN counter from COUNTERS_DB in one pipelined round
+ * trip per interval into struct-of-arrays buffers, derives deltas and
+ * per-second rates in a single pass over each buffer, and publishes the
+ * result as an immutable snapshot that readers pick up without a lock.
+ */
+
+#ifndef SONIC_SAI_COUNTER_POLLER_H
+#define SONIC_SAI_COUNTER_POLLER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+
+namespace sonic {
+namespace common {
+class RedisClient;
+}
+
+namespace sai {
+
+/**
+ * @brief Port counters read each interval, in column order
+ */
+enum class PortCounter : size_t {
+    IN_OCTETS,
+    IN_UCAST_PKTS,
+    IN_NON_UCAST_PKTS,
+    IN_ERRORS,
+    IN_DISCARDS,
+    OUT_OCTETS,
+    OUT_UCAST_PKTS,
+    OUT_NON_UCAST_PKTS,
+    OUT_ERRORS,
+    OUT_DISCARDS,
+    COUNT
+};
+
+/**
+ * @brief VLAN (router interface) counters read each interval, in column order
+ */
+enum class VLANCounter : size_t {
+    IN_OCTETS,
+    IN_PACKETS,
+    IN_ERROR_PACKETS,
+    OUT_OCTETS,
+    OUT_PACKETS,
+    OUT_ERROR_PACKETS,
+    COUNT
+};
+
+/**
+ * @brief One counter group in struct-of-arrays form
+ *
+ * Value arrays are counter-major: entry (counter, row) is at
+ * counter * rows() + row, so each counter is one contiguous column.
+ */
+struct CounterColumns {
+    std::vector<std::string> names;         ///< Object name per row, sorted
+    std::vector<std::string> counter_names; ///< COUNTERS_DB field per column
+    std::vector<uint64_t> values;           ///< Counts since the last clear
+    std::vector<uint64_t> deltas;           ///< Change since the previous poll
+    std::vector<double> rates;              ///< deltas per second
+
+    size_t rows() const { return names.size(); }
+
+    /**
+     * @brief Row of an object name, rows() when absent
+     */
+    size_t find(const std::string& name) const;
+
+    uint64_t value(size_t counter, size_t row) const { return values[counter * rows() + row]; }
+    uint64_t delta(size_t counter, size_t row) const { return deltas[counter * rows() + row]; }
+    double rate(size_t counter, size_t row) const { return rates[counter * rows() + row]; }
+
+    /**
+     * @brief All counters of one row keyed by COUNTERS_DB field name
+     */
+    std::map<std::string, uint64_t> valuesFor(size_t row) const;
+};
+
+/**
+ * @brief Result of one poll; never modified after it is published
+ */
+struct CounterSnapshot {
+    uint64_t sequence = 0;          ///< Poll number, 1 for the first poll
+    double interval_seconds = 0;    ///< Time since the previous poll, 0 on the first
+    CounterColumns ports;
+    CounterColumns vlans;
+};
+
+/**
+ * @brief Periodic COUNTERS_DB reader for all ports and VLANs
+ */
+class CounterPoller {
+public:
+    explicit CounterPoller(common::RedisClient& client);
+    ~CounterPoller();
+
+    CounterPoller(const CounterPoller&) = delete;
+    CounterPoller& operator=(const CounterPoller&) = delete;
+
+    /**
+     * @brief Poll every interval_ms on a background thread
+     */
+    void start(int interval_ms = 1000);
+    void stop();
+    bool isRunning() const { return running_.load(); }
+
+    /**
+     * @brief Read all counters once and publish a new snapshot
+     */
+    bool pollOnce();
+
+    /**
+     * @brief Latest published snapshot, null before the first successful poll
+     */
+    std::shared_ptr<const CounterSnapshot> snapshot() const;
+
+    /**
+     * @brief Zero a port's counters from the latest raw readings; deltas are unaffected
+     * @return false if the port has not been polled yet
+     */
+    bool clearPort(const std::string& port_name);
+
+    /**
+     * @brief Re-read the name to OID maps every this many polls (default 30)
+     */
+    void setNameMapRefresh(uint32_t polls) { name_map_refresh_ = polls ? polls : 1; }
+
+private:
+    struct Group {
+        const char* name_map;                   // COUNTERS_DB name -> OID hash
+        const char* name_prefix;                // Rows kept from the map, "" for all
+        std::vector<std::string> counter_names;
+        std::vector<std::string> oids;          // Per row, parallel to names
+        std::vector<std::string> names;
+        std::vector<uint64_t> raw;              // Latest readings, counter-major
+        std::vector<uint64_t> previous_raw;     // Previous readings in the same layout
+        std::vector<size_t> fresh_rows;         // Rows added since the last poll
+        std::map<std::string, std::vector<uint64_t>> baselines; // Cleared rows by name
+    };
+
+    bool loadNameMaps();
+    void buildColumns(Group& group, double interval_seconds, CounterColumns& out);
+    std::shared_ptr<CounterSnapshot> writableBuffer();
+    void pollLoop();
+
+    common::RedisClient& client_;
+    Group ports_;
+    Group vlans_;
+
+    std::mutex poll_mutex_;     // Serializes pollOnce and clearPort
+    std::shared_ptr<const CounterSnapshot> current_;    // Accessed with std::atomic_load/store
+    std::shared_ptr<CounterSnapshot> buffers_[2];
+    size_t next_buffer_;
+    uint64_t sequence_;
+    uint64_t last_poll_ns_;
+    uint32_t polls_since_name_refresh_;
+    uint32_t name_map_refresh_;
+    bool read_failed_;          // Log a failure once per outage
+
+    std::thread thread_;
+    std::atomic<bool> running_;
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+    int interval_ms_;
+};
+
+} // namespace sai
+} // namespace sonic
+
+#endif // SONIC_SAI_COUNTER_POLLER_H
@@ -0,0 +1,425 @@
+/**
+ * @file lag_manager.cpp
+ * @brief SONiC SAI LAG (PortChannel) Manager Implementation
+ */
+
+#include "lag_manager.h"
+#include "../common/redis_client.h"
+#include "../common/logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+namespace sonic {
+namespace sai {
+
+namespace {
+
+constexpr int CONFIG_DB = 4;
+const std::string LAG_PREFIX = "PORTCHANNEL|";
+const std::string MEMBER_PREFIX = "PORTCHANNEL_MEMBER|";
+
+std::string memberKey(const std::string& lag_name, const std::string& port_name) {
+    return MEMBER_PREFIX + lag_name + "|" + port_name;
+}
+
+uint32_t parseField(const std::map<std::string, std::string>& fields, const std::string& name,
+                    uint32_t fallback) {
+    auto it = fields.find(name);
+    if (it == fields.end() || it->second.empty()) {
+        return fallback;
+    }
+    char* end = nullptr;
+    unsigned long value = std::strtoul(it->second.c_str(), &end, 10);
+    return (*end == '\0' && value <= UINT32_MAX) ? static_cast<uint32_t>(value) : fallback;
+}
+
+// Ports never interned cannot be LAG members, so lookups do not grow the table
+common::PortId lookupPort(const std::string& port_name) {
+    common::PortId port = common::INVALID_PORT_ID;
+    common::portNames().find(port_name, port);
+    return port;
+}
+
+} // anonymous namespace
+
+LAGManager::LAGManager(common::RedisClient& client) : client_(client) {}
+
+bool LAGManager::isValidLAGName(const std::string& lag_name) {
+    // SONiC accepts PortChannel followed by up to four digits
+    static const std::string prefix = "PortChannel";
+    if (lag_name.size() <= prefix.size() || lag_name.size() > prefix.size() + 4 ||
+        lag_name.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    return std::all_of(lag_name.begin() + prefix.size(), lag_name.end(),
+                       [](char c) { return c >= '0' && c <= '9'; });
+}
+
+bool LAGManager::load() {
+    std::vector<std::string> lag_keys;
+    std::vector<std::string> member_keys;
+    if (!client_.scanKeys(CONFIG_DB, LAG_PREFIX + "*", lag_keys) ||
+        !client_.scanKeys(CONFIG_DB, MEMBER_PREFIX + "*", member_keys)) {
+        SONIC_LOG_ERROR("SAI", "Failed to read PORTCHANNEL tables from CONFIG_DB");
+        return false;
+    }
+
+    std::vector<std::vector<std::string>> commands;
+    commands.reserve(lag_keys.size());
+    for (const auto& key : lag_keys) {
+        commands.push_back({"HGETALL", key});
+    }
+    std::vector<common::RedisReply> replies;
+    if (!client_.pipeline(CONFIG_DB, commands, replies) || replies.size() != commands.size()) {
+        SONIC_LOG_ERROR("SAI", "Failed to read PORTCHANNEL attributes from CONFIG_DB");
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    lags_.clear();
+    free_lags_.clear();
+    lag_index_.clear();
+    port_lag_.clear();
+
+    for (size_t i = 0; i < lag_keys.size(); ++i) {
+        std::string name = lag_keys[i].substr(LAG_PREFIX.size());
+        std::map<std::string, std::string> fields = replies[i].asHash();
+        LAG& lag = lags_[allocLAGUnsafe(name)];
+        lag.mtu = parseField(fields, "mtu", 9100);
+        lag.min_links = parseField(fields, "min_links", 1);
+        auto admin = fields.find("admin_status");
+        if (admin != fields.end()) {
+            lag.admin_status = admin->second;
+        }
+    }
+
+    for (const auto& key : member_keys) {
+        // PORTCHANNEL_MEMBER|<lag>|<port>
+        size_t split = key.find('|', MEMBER_PREFIX.size());
+        if (split == std::string::npos) {
+            continue;
+        }
+        // CONFIG_DB is the one source whose port names the manager interns
+        auto it = lag_index_.find(key.substr(MEMBER_PREFIX.size(), split - MEMBER_PREFIX.size()));
+        if (it == lag_index_.end()) {
+            continue;
+        }
+        common::PortId port = common::portNames().intern(key.substr(split + 1));
+        if (port == common::INVALID_PORT_ID) {
+            SONIC_LOG_ERROR("SAI", "No port ID left for " << key.substr(split + 1) << ", skipping " << key);
+            continue;
+        }
+        if (lagOfPortUnsafe(port) != NO_LAG) {
+            SONIC_LOG_ERROR("SAI", key.substr(split + 1) << " is configured in more than one LAG");
+            continue;
+        }
+        lags_[it->second].members.set(port);
+        setPortLAGUnsafe(port, it->second);
+    }
+    return true;
+}
+
+bool LAGManager::createLAG(const std::string& lag_name, const std::vector<std::string>& members,
+                           uint32_t mtu, uint32_t min_links) {
+    if (!isValidLAGName(lag_name)) {
+        SONIC_LOG_ERROR("SAI", "Invalid LAG name: " << lag_name);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (lag_index_.count(lag_name)) {
+        SONIC_LOG_ERROR("SAI", "LAG " << lag_name << " already exists");
+        return false;
+    }
+
+    std::vector<common::PortId> ports;
+    ports.reserve(members.size());
+    for (const auto& port_name : members) {
+        common::PortId port = lookupPort(port_name);
+        if (port == common::INVALID_PORT_ID) {
+            SONIC_LOG_ERROR("SAI", "Unknown port " << port_name << " cannot join " << lag_name);
+            return false;
+        }
+        if (lagOfPortUnsafe(port) != NO_LAG ||
+            std::find(ports.begin(), ports.end(), port) != ports.end()) {
+            SONIC_LOG_ERROR("SAI", "Port " << port_name << " cannot join " << lag_name);
+            return false;
+        }
+        ports.push_back(port);
+    }
+
+    std::vector<std::vector<std::string>> commands;
+    commands.reserve(members.size() + 1);
+    commands.push_back({"HSET", LAG_PREFIX + lag_name, "admin_status", "up", "mtu", std::to_string(mtu),
+                        "min_links", std::to_string(min_links)});
+    for (const auto& port_name : members) {
+        commands.push_back({"HSET", memberKey(lag_name, port_name), "NULL", "NULL"});
+    }
+    if (!commit(commands, "create " + lag_name)) {
+        return false;
+    }
+
+    uint32_t index = allocLAGUnsafe(lag_name);
+    LAG& lag = lags_[index];
+    lag.mtu = mtu;
+    lag.min_links = min_links;
+    for (common::PortId port : ports) {
+        lag.members.set(port);
+        setPortLAGUnsafe(port, index);
+    }
+    SONIC_LOG_INFO("SAI", "LAG " << lag_name << " created with " << ports.size() << " members");
+    return true;
+}
+
+bool LAGManager::deleteLAG(const std::string& lag_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lag_index_.find(lag_name);
+    if (it == lag_index_.end()) {
+        SONIC_LOG_ERROR("SAI", "LAG " << lag_name << " does not exist");
+        return false;
+    }
+    uint32_t index = it->second;
+
+    // Members go before the LAG itself, as teammgrd expects
+    std::vector<std::vector<std::string>> commands;
+    lags_[index].members.forEach([&](uint32_t port) {
+        commands.push_back({"DEL", memberKey(lag_name, common::portNames().name(port))});
+    });
+    commands.push_back({"DEL", LAG_PREFIX + lag_name});
+    if (!commit(commands, "delete " + lag_name)) {
+        return false;
+    }
+
+    freeLAGUnsafe(index);
+    SONIC_LOG_INFO("SAI", "LAG " << lag_name << " deleted");
+    return true;
+}
+
+bool LAGManager::updateMembers(const std::string& lag_name, const std::vector<std::string>& add,
+                               const std::vector<std::string>& remove) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lag_index_.find(lag_name);
+    if (it == lag_index_.end()) {
+        SONIC_LOG_ERROR("SAI", "LAG " << lag_name << " does not exist");
+        return false;
+    }
+    uint32_t index = it->second;
+    LAG& lag = lags_[index];
+
+    // Validate the whole change before writing any of it
+    std::vector<common::PortId> added;
+    std::vector<common::PortId> removed;
+    for (const auto& port_name : remove) {
+        common::PortId port = lookupPort(port_name);
+        if (port == common::INVALID_PORT_ID || !lag.members.test(port) ||
+            std::find(removed.begin(), removed.end(), port) != removed.end()) {
+            SONIC_LOG_ERROR("SAI", "Port " << port_name << " is not a member of " << lag_name);
+            return false;
+        }
+        removed.push_back(port);
+    }
+    for (const auto& port_name : add) {
+        common::PortId port = lookupPort(port_name);
+        if (port == common::INVALID_PORT_ID) {
+            SONIC_LOG_ERROR("SAI", "Unknown port " << port_name << " cannot join " << lag_name);
+            return false;
+        }
+        bool removed_here = std::find(removed.begin(), removed.end(), port) != removed.end();
+        if ((lagOfPortUnsafe(port) != NO_LAG && !removed_here) ||
+            std::find(added.begin(), added.end(), port) != added.end()) {
+            SONIC_LOG_ERROR("SAI", "Port " << port_name << " cannot join " << lag_name);
+            return false;
+        }
+        added.push_back(port);
+    }
+
+    std::vector<std::vector<std::string>> commands;
+    commands.reserve(added.size() + removed.size());
+    for (common::PortId port : removed) {
+        commands.push_back({"DEL", memberKey(lag_name, common::portNames().name(port))});
+    }
+    for (common::PortId port : added) {
+        commands.push_back({"HSET", memberKey(lag_name, common::portNames().name(port)), "NULL", "NULL"});
+    }
+    if (commands.empty()) {
+        return true;
+    }
+    if (!commit(commands, "update members of " + lag_name)) {
+        return false;
+    }
+
+    for (common::PortId port : removed) {
+        lag.members.reset(port);
+        lag.members_up.reset(port);
+        setPortLAGUnsafe(port, NO_LAG);
+    }
+    for (common::PortId port : added) {
+        lag.members.set(port);
+        setPortLAGUnsafe(port, index);
+    }
+    return true;
+}
+
+bool LAGManager::setMembers(const std::string& lag_name, const std::vector<std::string>& members) {
+    std::vector<std::string> add;
+    std::vector<std::string> remove;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        LAG* lag = findLAGUnsafe(lag_name);
+        if (!lag) {
+            SONIC_LOG_ERROR("SAI", "LAG " << lag_name << " does not exist");
+            return false;
+        }
+        common::PortBitmap desired;
+        for (const auto& port_name : members) {
+            common::PortId port = lookupPort(port_name);
+            if (port == common::INVALID_PORT_ID) {
+                SONIC_LOG_ERROR("SAI", "Unknown port " << port_name << " cannot be a member of " << lag_name);
+                return false;
+            }
+            if (desired.set(port) && !lag->members.test(port)) {
+                add.push_back(port_name);
+            }
+        }
+        lag->members.forEach([&](uint32_t port) {
+            if (!desired.test(port)) {
+                remove.push_back(common::portNames().name(port));
+            }
+        });
+    }
+    // updateMembers re-validates, so a concurrent change between the two locks cannot slip through
+    return updateMembers(lag_name, add, remove);
+}
+
+bool LAGManager::handleLinkEvent(const std::string& port_name, bool link_up) {
+    common::PortId port = lookupPort(port_name);
+    if (port == common::INVALID_PORT_ID) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint32_t index = lagOfPortUnsafe(port);
+    if (index == NO_LAG) {
+        return false;
+    }
+    LAG& lag = lags_[index];
+    bool was_up = lag.members_up.count() >= lag.min_links;
+    if (link_up) {
+        lag.members_up.set(port);
+    } else {
+        lag.members_up.reset(port);
+    }
+    bool is_up = lag.members_up.count() >= lag.min_links;
+    if (was_up != is_up) {
+        SONIC_LOG_INFO("SAI", "LAG " << lag.name << " is " << (is_up ? "up" : "down") << " ("
+                       << lag.members_up.count() << "/" << lag.members.count() << " members up, min_links "
+                       << lag.min_links << ")");
+    }
+    return true;
+}
+
+bool LAGManager::findLAGForPort(const std::string& port_name, std::string& lag_name) const {
+    common::PortId port = lookupPort(port_name);
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint32_t index = port == common::INVALID_PORT_ID ? NO_LAG : lagOfPortUnsafe(port);
+    if (index == NO_LAG) {
+        return false;
+    }
+    lag_name = lags_[index].name;
+    return true;
+}
+
+bool LAGManager::getLAG(const std::string& lag_name, LAGInfo& info) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lag_index_.find(lag_name);
+    if (it == lag_index_.end()) {
+        return false;
+    }
+    info = toInfoUnsafe(lags_[it->second]);
+    return true;
+}
+
+std::vector<LAGInfo> LAGManager::getAllLAGs() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<LAGInfo> result;
+    result.reserve(lag_index_.size());
+    for (const auto& entry : lag_index_) {
+        result.push_back(toInfoUnsafe(lags_[entry.second]));
+    }
+    return result;
+}
+
+bool LAGManager::commit(const std::vector<std::vector<std::string>>& commands, const std::string& what) {
+    std::vector<common::RedisReply> replies;
+    if (!client_.transaction(CONFIG_DB, commands, replies)) {
+        SONIC_LOG_ERROR("SAI", "Failed to " << what << ": "
+                        << (replies.empty() ? "Redis unavailable" : replies.back().str));
+        return false;
+    }
+    for (const auto& reply : replies) {
+        if (reply.isError()) {
+            // MULTI has no rollback; report it and keep the model as it was
+            SONIC_LOG_ERROR("SAI", "Failed to " << what << ": " << reply.str);
+            return false;
+        }
+    }
+    return true;
+}
+
+LAGManager::LAG* LAGManager::findLAGUnsafe(const std::string& lag_name) {
+    auto it = lag_index_.find(lag_name);
+    return it != lag_index_.end() ? &lags_[it->second] : nullptr;
+}
+
+uint32_t LAGManager::lagOfPortUnsafe(common::PortId port) const {
+    return port < port_lag_.size() ? port_lag_[port] : NO_LAG;
+}
+
+void LAGManager::setPortLAGUnsafe(common::PortId port, uint32_t lag) {
+    if (port >= port_lag_.size()) {
+        if (lag == NO_LAG) {
+            return;
+        }
+        port_lag_.resize(port + 1, NO_LAG);
+    }
+    port_lag_[port] = lag;
+}
+
+uint32_t LAGManager::allocLAGUnsafe(const std::string& lag_name) {
+    uint32_t index;
+    if (!free_lags_.empty()) {
+        index = free_lags_.back();
+        free_lags_.pop_back();
+    } else {
+        lags_.emplace_back();
+        index = static_cast<uint32_t>(lags_.size() - 1);
+    }
+    lags_[index] = LAG();
+    lags_[index].name = lag_name;
+    lag_index_[lag_name] = index;
+    return index;
+}
+
+void LAGManager::freeLAGUnsafe(uint32_t index) {
+    LAG& lag = lags_[index];
+    lag.members.forEach([this](uint32_t port) { setPortLAGUnsafe(port, NO_LAG); });
+    lag_index_.erase(lag.name);
+    lag = LAG();
+    free_lags_.push_back(index);
+}
+
+LAGInfo LAGManager::toInfoUnsafe(const LAG& lag) const {
+    LAGInfo info;
+    info.name = lag.name;
+    info.mtu = lag.mtu;
+    info.min_links = lag.min_links;
+    info.admin_status = lag.admin_status;
+    info.oper_up = lag.members_up.count() >= lag.min_links;
+    lag.members.forEach([&](uint32_t port) { info.members.push_back(common::portNames().name(port)); });
+    lag.members_up.forEach([&](uint32_t port) { info.active_members.push_back(common::portNames().name(port)); });
+    return info;
+}
+
+} // namespace sai
+} // namespace sonic
@@ -0,0 +1,125 @@
+/**
+ * @file lag_manager.h
+ * @brief SONiC SAI LAG (PortChannel) Manager Header
+ *
+ * In-memory model of CONFIG_DB PORTCHANNEL / PORTCHANNEL_MEMBER with a
+ * reverse port -> LAG index. Every configuration change, including a whole
+ * membership rebuild, is written as one MULTI/EXEC transaction and applied
+ * to the model only once Redis has accepted it.
+ */
+
+#ifndef SONIC_SAI_LAG_MANAGER_H
+#define SONIC_SAI_LAG_MANAGER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <cstdint>
+#include "../common/port_bitmap.h"
+#include "../common/string_interner.h"
+
+namespace sonic {
+namespace common {
+class RedisClient;
+}
+
+namespace sai {
+
+/**
+ * @brief Snapshot of one LAG as returned to callers
+ */
+struct LAGInfo {
+    std::string name;
+    std::vector<std::string> members;       ///< Sorted by port index
+    std::vector<std::string> active_members; ///< Members whose link is up
+    uint32_t mtu = 9100;
+    uint32_t min_links = 1;
+    std::string admin_status = "up";
+    bool oper_up = false;                   ///< At least min_links members are up
+};
+
+/**
+ * @brief Thread-safe LAG model; link events may arrive from the interrupt thread
+ */
+class LAGManager {
+public:
+    explicit LAGManager(common::RedisClient& client);
+
+    LAGManager(const LAGManager&) = delete;
+    LAGManager& operator=(const LAGManager&) = delete;
+
+    /**
+     * @brief Rebuild the model from CONFIG_DB
+     */
+    bool load();
+
+    /**
+     * @brief Create a LAG; members must be ports the process already knows
+     *
+     * A known port is one the port registry or CONFIG_DB has named. Unknown
+     * names are rejected rather than interned, so they never take a PortId.
+     */
+    bool createLAG(const std::string& lag_name, const std::vector<std::string>& members,
+                   uint32_t mtu = 9100, uint32_t min_links = 1);
+    bool deleteLAG(const std::string& lag_name);
+
+    /**
+     * @brief Add and remove members in one transaction; nothing changes if any part is invalid
+     */
+    bool updateMembers(const std::string& lag_name, const std::vector<std::string>& add,
+                       const std::vector<std::string>& remove);
+
+    /**
+     * @brief Make the membership exactly members, writing only the difference
+     */
+    bool setMembers(const std::string& lag_name, const std::vector<std::string>& members);
+
+    /**
+     * @brief Record a member's link state; O(1) via the port index
+     * @return false if the port is not in any LAG
+     */
+    bool handleLinkEvent(const std::string& port_name, bool link_up);
+
+    /**
+     * @brief LAG a port belongs to
+     */
+    bool findLAGForPort(const std::string& port_name, std::string& lag_name) const;
+
+    bool getLAG(const std::string& lag_name, LAGInfo& info) const;
+    std::vector<LAGInfo> getAllLAGs() const;
+
+    static bool isValidLAGName(const std::string& lag_name);
+
+private:
+    struct LAG {
+        std::string name;
+        uint32_t mtu = 9100;
+        uint32_t min_links = 1;
+        std::string admin_status = "up";
+        common::PortBitmap members;
+        common::PortBitmap members_up;
+    };
+
+    static constexpr uint32_t NO_LAG = UINT32_MAX;
+
+    bool commit(const std::vector<std::vector<std::string>>& commands, const std::string& what);
+    LAG* findLAGUnsafe(const std::string& lag_name);
+    uint32_t lagOfPortUnsafe(common::PortId port) const;
+    void setPortLAGUnsafe(common::PortId port, uint32_t lag);
+    uint32_t allocLAGUnsafe(const std::string& lag_name);
+    void freeLAGUnsafe(uint32_t lag);
+    LAGInfo toInfoUnsafe(const LAG& lag) const;
+
+    common::RedisClient& client_;
+    mutable std::mutex mutex_;
+    std::vector<LAG> lags_;
+    std::vector<uint32_t> free_lags_;
+    std::map<std::string, uint32_t> lag_index_;     // name -> lags_
+    std::vector<uint32_t> port_lag_;                // PortId -> lags_, NO_LAG when not a member
+};
+
+} // namespace sai
+} // namespace sonic
+
+#endif // SONIC_SAI_LAG_MANAGER_H
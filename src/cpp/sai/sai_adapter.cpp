@@ -6,29 +6,171 @@
  */
 
 #include "sai_adapter.h"
+#include "../common/logger.h"
+#include "../common/metrics.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 #include <dlfcn.h>
+#include <pthread.h>
+#include <sched.h>
 
 namespace sonic {
 namespace sai {
 
-SAIAdapter* SAIAdapter::instance_ = nullptr;
+namespace {
+
+// Set on worker threads so a nested forEachAsic() runs inline instead of
+// queueing behind itself
+thread_local bool on_asic_worker = false;
+
+size_t asicCountFromEnvironment() {
+    const char* value = std::getenv("SONIC_NUM_ASICS");
+    if (!value || !*value) {
+        return 1;
+    }
+    char* end = nullptr;
+    unsigned long count = std::strtoul(value, &end, 10);
+    if (*end != '\0' || count == 0 || count > SAIAdapter::MAX_ASICS) {
+        std::cerr << "Ignoring SONIC_NUM_ASICS=" << value << ", using 1 ASIC" << std::endl;
+        return 1;
+    }
+    return count;
+}
+
+std::vector<int> asicCpusFromEnvironment() {
+    std::vector<int> cpus;
+    const char* value = std::getenv("SONIC_ASIC_CPUS");
+    if (!value) {
+        return cpus;
+    }
+    std::stringstream ss(value);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        try {
+            cpus.push_back(std::stoi(item));
+        } catch (const std::exception&) {
+            std::cerr << "Ignoring SONIC_ASIC_CPUS entry '" << item << "'" << std::endl;
+        }
+    }
+    return cpus;
+}
+
+} // namespace
+
+/**
+ * @brief Worker thread owning one ASIC's task queue
+ */
+class SAIAdapter::AsicWorker {
+public:
+    AsicWorker() : stopping_(false) {
+        thread_ = std::thread(&AsicWorker::run, this);
+    }
+
+    ~AsicWorker() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_one();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    void post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    /**
+     * @brief Pin the worker; must run before the first post()
+     */
+    bool pin(int cpu) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return pthread_setaffinity_np(thread_.native_handle(), sizeof(set), &set) == 0;
+    }
+
+private:
+    void run() {
+        on_asic_worker = true;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;     // Stopping with nothing left to run
+            }
+            std::function<void()> task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            // submit() has no caller left to rethrow to; a throwing task must not end the worker
+            try {
+                task();
+            } catch (const std::exception& e) {
+                SONIC_COUNTER_INC("sonic_sai_asic_task_failures_total", "ASIC worker tasks that threw");
+                SONIC_LOG_ERROR("SAI", "ASIC worker task failed: " << e.what());
+            } catch (...) {
+                SONIC_COUNTER_INC("sonic_sai_asic_task_failures_total", "ASIC worker tasks that threw");
+                SONIC_LOG_ERROR("SAI", "ASIC worker task failed with an unknown exception");
+            }
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_;
+    std::thread thread_;
+};
+
+struct SAIAdapter::AsicSlot {
+    SAISwitchContext context;
+    std::unique_ptr<AsicWorker> worker;     ///< Null with a single ASIC: work runs inline
+};
+
+std::atomic<SAIAdapter*> SAIAdapter::instance_{nullptr};
 std::mutex SAIAdapter::instance_mutex_;
 
 SAIAdapter* SAIAdapter::getInstance() {
+    SAIAdapter* instance = instance_.load(std::memory_order_acquire);
+    if (instance) {
+        return instance;
+    }
     std::lock_guard<std::mutex> lock(instance_mutex_);
-    if (!instance_) {
-        instance_ = new SAIAdapter();
+    instance = instance_.load(std::memory_order_relaxed);
+    if (!instance) {
+        instance = new SAIAdapter();
+        instance_.store(instance, std::memory_order_release);
     }
-    return instance_;
+    return instance;
 }
 
-SAIAdapter::SAIAdapter() : initialized_(false), use_mock_(false) {
+SAIAdapter::SAIAdapter()
+    : initialized_(false), use_mock_(false), configured_asics_(asicCountFromEnvironment()), asic_count_(0) {
     // Try to detect if we're running with real SAI or mock
     detectSAIEnvironment();
 }
 
 SAIAdapter::~SAIAdapter() {
+    // Workers first so no task touches SAI after it is torn down
+    for (auto& slot : slots_) {
+        if (slot) {
+            slot->worker.reset();
+        }
+    }
     if (initialized_) {
         sai_api_uninitialize();
     }
@@ -51,10 +193,29 @@ bool SAIAdapter::detectSAIEnvironment() {
 }
 
 bool SAIAdapter::initialize() {
-    if (initialized_) {
+    if (initialized_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (initialized_.load(std::memory_order_relaxed)) {
         return true;
     }
     
+    // Switches created so far; a later ASIC failing removes them again
+    size_t created = 0;
+    auto unwind = [this, &created]() {
+        for (size_t i = created; i-- > 0;) {
+            SAISwitchContext& context = slots_[i]->context;
+            sai_status_t status = context.switch_api->remove_switch(context.switch_id);
+            if (status != SAI_STATUS_SUCCESS) {
+                std::cerr << "Failed to remove switch for ASIC " << i << ": " << status << std::endl;
+            }
+            context.switch_id = SAI_NULL_OBJECT_ID;
+        }
+        created = 0;
+        sai_api_uninitialize();
+    };
+
     try {
         // Initialize SAI API
         sai_status_t status = sai_api_initialize(0, nullptr);
@@ -62,56 +223,103 @@ bool SAIAdapter::initialize() {
             std::cerr << "Failed to initialize SAI API: " << status << std::endl;
             return false;
         }
-        
-        // Query required APIs
-        status = sai_api_query(SAI_API_SWITCH, (void**)&switch_api_);
-        if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to query Switch API: " << status << std::endl;
-            return false;
-        }
-        
-        status = sai_api_query(SAI_API_VLAN, (void**)&vlan_api_);
-        if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to query VLAN API: " << status << std::endl;
-            return false;
-        }
-        
-        status = sai_api_query(SAI_API_PORT, (void**)&port_api_);
-        if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to query Port API: " << status << std::endl;
-            return false;
-        }
-        
-        status = sai_api_query(SAI_API_ROUTE, (void**)&route_api_);
-        if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to query Route API: " << status << std::endl;
-            return false;
-        }
-        
-        status = sai_api_query(SAI_API_BRIDGE, (void**)&bridge_api_);
-        if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to query Bridge API: " << status << std::endl;
-            return false;
-        }
-        
-        // Create switch instance (required for most SAI operations)
-        if (!createSwitchInstance()) {
-            std::cerr << "Failed to create switch instance" << std::endl;
-            return false;
+
+        std::vector<int> cpus = asicCpusFromEnvironment();
+        unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+        for (size_t i = 0; i < configured_asics_; i++) {
+            if (!slots_[i]) {
+                slots_[i].reset(new AsicSlot());
+            }
+            AsicSlot& slot = *slots_[i];
+            int pinned_cpu = slot.context.cpu;      // A worker kept from before uninitialize() stays pinned
+            slot.context = SAISwitchContext();
+            slot.context.index = i;
+            slot.context.cpu = pinned_cpu;
+
+            if (!queryAPIs(slot.context)) {
+                unwind();
+                return false;
+            }
+
+            // Create switch instance (required for most SAI operations)
+            if (!createSwitchInstance(slot.context)) {
+                std::cerr << "Failed to create switch instance for ASIC " << i << std::endl;
+                unwind();
+                return false;
+            }
+            created = i + 1;
+
+            if (configured_asics_ > 1 && !slot.worker) {
+                int cpu = i < cpus.size() ? cpus[i] : static_cast<int>(i % cores);
+                slot.worker.reset(new AsicWorker());
+                if (cpu >= 0 && slot.worker->pin(cpu)) {
+                    slot.context.cpu = cpu;
+                } else if (cpu >= 0) {
+                    std::cerr << "Could not pin ASIC " << i << " worker to CPU " << cpu << std::endl;
+                }
+            }
         }
-        
-        initialized_ = true;
-        std::cout << "SAI Adapter initialized successfully" << std::endl;
+
+        asic_count_.store(configured_asics_, std::memory_order_release);
+        initialized_.store(true, std::memory_order_release);
+        std::cout << "SAI Adapter initialized successfully with " << configured_asics_
+                  << (configured_asics_ == 1 ? " ASIC" : " ASICs") << std::endl;
         return true;
         
     } catch (const std::exception& e) {
         std::cerr << "Exception during SAI initialization: " << e.what() << std::endl;
+        unwind();
         return false;
     }
 }
 
-bool SAIAdapter::createSwitchInstance() {
-    if (!switch_api_) {
+void SAIAdapter::uninitialize() {
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (!initialized_) {
+        return;
+    }
+    asic_count_.store(0, std::memory_order_release);
+    initialized_.store(false, std::memory_order_release);
+    sai_api_uninitialize();
+}
+
+bool SAIAdapter::queryAPIs(SAISwitchContext& context) {
+    // Query required APIs
+    sai_status_t status = sai_api_query(SAI_API_SWITCH, (void**)&context.switch_api);
+    if (status != SAI_STATUS_SUCCESS) {
+        std::cerr << "Failed to query Switch API: " << status << std::endl;
+        return false;
+    }
+    
+    status = sai_api_query(SAI_API_VLAN, (void**)&context.vlan_api);
+    if (status != SAI_STATUS_SUCCESS) {
+        std::cerr << "Failed to query VLAN API: " << status << std::endl;
+        return false;
+    }
+    
+    status = sai_api_query(SAI_API_PORT, (void**)&context.port_api);
+    if (status != SAI_STATUS_SUCCESS) {
+        std::cerr << "Failed to query Port API: " << status << std::endl;
+        return false;
+    }
+    
+    status = sai_api_query(SAI_API_ROUTE, (void**)&context.route_api);
+    if (status != SAI_STATUS_SUCCESS) {
+        std::cerr << "Failed to query Route API: " << status << std::endl;
+        return false;
+    }
+    
+    status = sai_api_query(SAI_API_BRIDGE, (void**)&context.bridge_api);
+    if (status != SAI_STATUS_SUCCESS) {
+        std::cerr << "Failed to query Bridge API: " << status << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool SAIAdapter::createSwitchInstance(SAISwitchContext& context) {
+    if (!context.switch_api) {
         return false;
     }
     
@@ -122,38 +330,117 @@ bool SAIAdapter::createSwitchInstance() {
     switch_attrs[0].id = SAI_SWITCH_ATTR_INIT_SWITCH;
     switch_attrs[0].value.booldata = true;
     
-    sai_status_t status = switch_api_->create_switch(&switch_id_, 1, switch_attrs);
+    sai_status_t status = context.switch_api->create_switch(&context.switch_id, 1, switch_attrs);
     if (status != SAI_STATUS_SUCCESS) {
         std::cerr << "Failed to create switch instance: " << status << std::endl;
         return false;
     }
     
-    std::cout << "Switch instance created with ID: " << std::hex << switch_id_ << std::dec << std::endl;
+    std::cout << "Switch instance created with ID: " << std::hex << context.switch_id << std::dec << std::endl;
+    return true;
+}
+
+bool SAIAdapter::setAsicCount(size_t count) {
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (initialized_ || count == 0 || count > MAX_ASICS) {
+        return false;
+    }
+    configured_asics_ = count;
+    return true;
+}
+
+size_t SAIAdapter::getAsicCount() const {
+    return asic_count_.load(std::memory_order_acquire);
+}
+
+const SAISwitchContext* SAIAdapter::getSwitch(size_t asic_index) const {
+    if (asic_index >= asic_count_.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    return &slots_[asic_index]->context;
+}
+
+void SAIAdapter::forEachAsic(const std::function<void(const SAISwitchContext&)>& fn) {
+    size_t count = getAsicCount();
+    if (count <= 1 || on_asic_worker) {
+        for (size_t i = 0; i < count; i++) {
+            fn(slots_[i]->context);
+        }
+        return;
+    }
+
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    size_t remaining = count;
+    std::exception_ptr error;
+
+    for (size_t i = 0; i < count; i++) {
+        slots_[i]->worker->post([&, i]() {
+            std::exception_ptr caught;
+            try {
+                fn(slots_[i]->context);
+            } catch (...) {
+                caught = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(done_mutex);
+            if (caught && !error) {
+                error = caught;
+            }
+            if (--remaining == 0) {
+                done_cv.notify_one();
+            }
+        });
+    }
+
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_cv.wait(lock, [&] { return remaining == 0; });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+bool SAIAdapter::submit(size_t asic_index, std::function<void(const SAISwitchContext&)> fn) {
+    if (asic_index >= getAsicCount()) {
+        return false;
+    }
+    AsicSlot& slot = *slots_[asic_index];
+    if (!slot.worker) {
+        fn(slot.context);
+        return true;
+    }
+    const SAISwitchContext& context = slot.context;
+    slot.worker->post([fn = std::move(fn), &context]() { fn(context); });
     return true;
 }
 
 sai_vlan_api_t* SAIAdapter::getVLANAPI() {
-    return vlan_api_;
+    const SAISwitchContext* context = getSwitch(0);
+    return context ? context->vlan_api : nullptr;
 }
 
 sai_port_api_t* SAIAdapter::getPortAPI() {
-    return port_api_;
+    const SAISwitchContext* context = getSwitch(0);
+    return context ? context->port_api : nullptr;
 }
 
 sai_route_api_t* SAIAdapter::getRouteAPI() {
-    return route_api_;
+    const SAISwitchContext* context = getSwitch(0);
+    return context ? context->route_api : nullptr;
 }
 
 sai_bridge_api_t* SAIAdapter::getBridgeAPI() {
-    return bridge_api_;
+    const SAISwitchContext* context = getSwitch(0);
+    return context ? context->bridge_api : nullptr;
 }
 
 sai_switch_api_t* SAIAdapter::getSwitchAPI() {
-    return switch_api_;
+    const SAISwitchContext* context = getSwitch(0);
+    return context ? context->switch_api : nullptr;
 }
 
 sai_object_id_t SAIAdapter::getSwitchId() {
-    return switch_id_;
+    const SAISwitchContext* context = getSwitch(0);
+    return context ? context->switch_id : SAI_NULL_OBJECT_ID;
 }
 
 bool SAIAdapter::isInitialized() const {
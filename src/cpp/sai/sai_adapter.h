@@ -8,6 +8,10 @@
 #ifndef SONIC_SAI_ADAPTER_H
 #define SONIC_SAI_ADAPTER_H
 
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <mutex>
 
 // Real SAI headers
@@ -23,25 +27,97 @@ extern "C" {
 namespace sonic {
 namespace sai {
 
+/**
+ * @brief One ASIC managed by the adapter: its switch object and API table
+ *
+ * Contexts are created by SAIAdapter::initialize() and live as long as the
+ * adapter, so callers may keep the pointer.
+ */
+struct SAISwitchContext {
+    size_t index = 0;
+    sai_object_id_t switch_id = SAI_NULL_OBJECT_ID;
+    sai_switch_api_t* switch_api = nullptr;
+    sai_vlan_api_t* vlan_api = nullptr;
+    sai_port_api_t* port_api = nullptr;
+    sai_route_api_t* route_api = nullptr;
+    sai_bridge_api_t* bridge_api = nullptr;
+    int cpu = -1;       ///< CPU the ASIC's worker is pinned to, -1 if unpinned
+};
+
 /**
  * @brief SAI Adapter class - Singleton pattern
  * 
  * This class provides a unified interface to both real SAI and mock SAI implementations.
  * It automatically detects the available SAI environment and initializes accordingly.
+ *
+ * A multi-ASIC box gets one switch instance per ASIC (SONIC_NUM_ASICS, or
+ * setAsicCount() before initialize()). Each ASIC has a worker thread with its
+ * own task queue, pinned to a CPU (SONIC_ASIC_CPUS="2,3,..." overrides the
+ * default of CPU index modulo core count), so forEachAsic() programs all
+ * ASICs in parallel. The single-ASIC getters below refer to ASIC 0.
  */
 class SAIAdapter {
 public:
+    static constexpr size_t MAX_ASICS = 16;
+
     /**
      * @brief Get singleton instance
      * @return SAI Adapter instance
+     *
+     * Lock-free once the instance exists, so hot paths may call it freely.
      */
     static SAIAdapter* getInstance();
     
     /**
      * @brief Initialize SAI
+     *
+     * A failure part way removes the switches already created and
+     * uninitializes SAI, so a later call starts clean.
      * @return true if successful, false otherwise
      */
     bool initialize();
+
+    /**
+     * @brief Uninitialize SAI; a later initialize() creates the switches again
+     *
+     * Switch contexts stay allocated, so held pointers remain safe to read;
+     * work queued with submit() should be drained first.
+     */
+    void uninitialize();
+
+    /**
+     * @brief Set how many ASICs initialize() creates switches for
+     * @return false once initialized or if count is 0 or above MAX_ASICS
+     */
+    bool setAsicCount(size_t count);
+
+    /**
+     * @brief Number of initialized ASICs, 0 before initialize()
+     */
+    size_t getAsicCount() const;
+
+    /**
+     * @brief Context of one ASIC
+     * @return nullptr if asic_index is out of range
+     */
+    const SAISwitchContext* getSwitch(size_t asic_index) const;
+
+    /**
+     * @brief Run fn for every ASIC on that ASIC's worker and wait for all of them
+     *
+     * Runs inline with a single ASIC, or when called from a worker. The first
+     * exception thrown by fn is rethrown once every ASIC has finished.
+     */
+    void forEachAsic(const std::function<void(const SAISwitchContext&)>& fn);
+
+    /**
+     * @brief Queue fn on one ASIC's worker without waiting
+     *
+     * An exception thrown by fn on the worker is logged and counted, and the
+     * worker carries on with its queue.
+     * @return false if asic_index is out of range
+     */
+    bool submit(size_t asic_index, std::function<void(const SAISwitchContext&)> fn);
     
     /**
      * @brief Get VLAN API
@@ -108,27 +184,35 @@ private:
      */
     bool detectSAIEnvironment();
     
+    /**
+     * @brief Query the API table of one ASIC
+     * @return true if successful
+     */
+    bool queryAPIs(SAISwitchContext& context);
+
     /**
      * @brief Create switch instance
      * @return true if successful
      */
-    bool createSwitchInstance();
-    
+    bool createSwitchInstance(SAISwitchContext& context);
+
+    class AsicWorker;
+    struct AsicSlot;
+
     // Singleton instance
-    static SAIAdapter* instance_;
+    static std::atomic<SAIAdapter*> instance_;
     static std::mutex instance_mutex_;
     
     // SAI state
-    bool initialized_;
+    std::mutex init_mutex_;
+    std::atomic<bool> initialized_;
     bool use_mock_;
-    sai_object_id_t switch_id_;
-    
-    // SAI API pointers
-    sai_switch_api_t* switch_api_;
-    sai_vlan_api_t* vlan_api_;
-    sai_port_api_t* port_api_;
-    sai_route_api_t* route_api_;
-    sai_bridge_api_t* bridge_api_;
+    size_t configured_asics_;
+
+    // Slots are filled before asic_count_ is published and never freed, so
+    // readers need no lock
+    std::unique_ptr<AsicSlot> slots_[MAX_ASICS];
+    std::atomic<size_t> asic_count_;
     
     // Disable copy constructor and assignment operator
     SAIAdapter(const SAIAdapter&) = delete;
@@ -0,0 +1,133 @@
+/**
+ * @file sai_command.cpp
+ * @brief SONiC SAI Command Schema Implementation
+ * @author SONiC POC Team
+ * @date 2025-09-12
+ */
+
+#include "sai_command.h"
+
+namespace sonic {
+namespace sai {
+
+SAICommandType SAICommandParser::typeFromAction(std::string_view action) {
+    if (action == "create_vlan") return SAICommandType::CREATE_VLAN;
+    if (action == "delete_vlan") return SAICommandType::DELETE_VLAN;
+    if (action == "add_vlan_member" || action == "add_port_to_vlan") return SAICommandType::ADD_VLAN_MEMBER;
+    if (action == "remove_vlan_member" || action == "remove_port_from_vlan") return SAICommandType::REMOVE_VLAN_MEMBER;
+    if (action == "create_route" || action == "add_route") return SAICommandType::CREATE_ROUTE;
+    if (action == "remove_route" || action == "delete_route") return SAICommandType::REMOVE_ROUTE;
+    if (action == "batch") return SAICommandType::BATCH;
+    return SAICommandType::UNKNOWN;
+}
+
+const char* SAICommandParser::actionName(SAICommandType type) {
+    switch (type) {
+        case SAICommandType::CREATE_VLAN: return "create_vlan";
+        case SAICommandType::DELETE_VLAN: return "delete_vlan";
+        case SAICommandType::ADD_VLAN_MEMBER: return "add_vlan_member";
+        case SAICommandType::REMOVE_VLAN_MEMBER: return "remove_vlan_member";
+        case SAICommandType::CREATE_ROUTE: return "create_route";
+        case SAICommandType::REMOVE_ROUTE: return "remove_route";
+        case SAICommandType::BATCH: return "batch";
+        default: return "unknown";
+    }
+}
+
+bool SAICommandParser::parse(std::string_view json, SAICommand& command) {
+    error_.clear();
+    command = SAICommand();
+    if (!document_.parse(json)) {
+        error_ = "invalid JSON: " + document_.error();
+        return false;
+    }
+    return fromValue(document_.root(), command, false);
+}
+
+bool SAICommandParser::fromValue(const common::JsonDocument::Value& value, SAICommand& command, bool nested) {
+    if (!value.isObject()) {
+        error_ = "command must be a JSON object";
+        return false;
+    }
+
+    // One pass over the members; unknown fields (timestamp, ...) are ignored
+    common::JsonDocument::Value commands;
+    for (auto member = value.firstChild(); member.valid(); member = member.next()) {
+        std::string_view key = member.key();
+        if (key == "action") {
+            command.action = member.asString();
+            command.type = typeFromAction(command.action);
+        } else if (key == "vlan_id") {
+            int64_t vlan_id = 0;
+            if (!member.getInt(vlan_id) || vlan_id < 1 || vlan_id > 4094) {
+                error_ = "vlan_id must be between 1 and 4094";
+                return false;
+            }
+            command.vlan_id = static_cast<uint16_t>(vlan_id);
+        } else if (key == "name") {
+            command.name = member.asString();
+        } else if (key == "port" || key == "port_name") {
+            command.port_name = member.asString();
+        } else if (key == "tagged") {
+            command.tagged = member.asBool();
+        } else if (key == "tagging_mode") {
+            command.tagged = (member.rawString() == "tagged");
+        } else if (key == "prefix" || key == "ip_prefix") {
+            command.prefix = member.asString();
+        } else if (key == "next_hop" || key == "nexthop") {
+            command.next_hop = member.asString();
+        } else if (key == "commands") {
+            commands = member;
+        }
+    }
+
+    switch (command.type) {
+        case SAICommandType::CREATE_VLAN:
+        case SAICommandType::DELETE_VLAN:
+            if (command.vlan_id == 0) {
+                error_ = command.action + " requires vlan_id";
+                return false;
+            }
+            return true;
+        case SAICommandType::ADD_VLAN_MEMBER:
+        case SAICommandType::REMOVE_VLAN_MEMBER:
+            if (command.vlan_id == 0 || command.port_name.empty()) {
+                error_ = command.action + " requires vlan_id and port";
+                return false;
+            }
+            return true;
+        case SAICommandType::CREATE_ROUTE:
+        case SAICommandType::REMOVE_ROUTE:
+            if (command.prefix.empty() || (command.type == SAICommandType::CREATE_ROUTE && command.next_hop.empty())) {
+                error_ = command.action + " requires prefix and next_hop";
+                return false;
+            }
+            return true;
+        case SAICommandType::BATCH:
+            if (nested) {
+                error_ = "batch commands cannot be nested";
+                return false;
+            }
+            if (!commands.isArray() || commands.size() > MAX_BATCH_COMMANDS) {
+                error_ = "batch requires a commands array of at most " + std::to_string(MAX_BATCH_COMMANDS) + " entries";
+                return false;
+            }
+            command.commands.resize(commands.size());
+            {
+                size_t index = 0;
+                for (auto entry = commands.firstChild(); entry.valid(); entry = entry.next(), ++index) {
+                    if (!fromValue(entry, command.commands[index], true)) {
+                        error_ = "batch entry " + std::to_string(index) + ": " + error_;
+                        return false;
+                    }
+                }
+            }
+            return true;
+        default:
+            error_ = command.action.empty() ? "missing action" : "unknown action '" + command.action + "'";
+            return false;
+    }
+}
+
+} // namespace sai
+} // namespace sonic
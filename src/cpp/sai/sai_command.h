@@ -0,0 +1,81 @@
+/**
+ * @file sai_command.h
+ * @brief SONiC SAI Command Schema Header
+ * @author SONiC POC Team
+ * @date 2025-09-12
+ */
+
+#ifndef SONIC_SAI_COMMAND_H
+#define SONIC_SAI_COMMAND_H
+
+#include "../common/json.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+namespace sonic {
+namespace sai {
+
+/**
+ * @brief Commands accepted on the sonic:sai:commands queue
+ */
+enum class SAICommandType {
+    CREATE_VLAN,
+    DELETE_VLAN,
+    ADD_VLAN_MEMBER,
+    REMOVE_VLAN_MEMBER,
+    CREATE_ROUTE,
+    REMOVE_ROUTE,
+    BATCH,
+    UNKNOWN
+};
+
+/**
+ * @brief Typed form of one queued JSON command
+ *
+ * Fields not used by a command type keep their defaults.
+ */
+struct SAICommand {
+    SAICommandType type = SAICommandType::UNKNOWN;
+    std::string action;             ///< Raw "action" value
+    uint16_t vlan_id = 0;
+    std::string name;               ///< VLAN name
+    std::string port_name;          ///< VLAN member port
+    bool tagged = false;
+    std::string prefix;             ///< Route destination, e.g. "10.0.0.0/24"
+    std::string next_hop;
+    std::vector<SAICommand> commands;   ///< BATCH sub-commands, executed in order
+};
+
+/**
+ * @brief Single-pass parser from queued JSON to SAICommand
+ *
+ * Keep one parser per consumer thread; it reuses its document between calls.
+ */
+class SAICommandParser {
+public:
+    static constexpr size_t MAX_BATCH_COMMANDS = 1024;
+
+    /**
+     * @brief Parse a JSON command
+     * @return false on malformed JSON or invalid fields; see error()
+     */
+    bool parse(std::string_view json, SAICommand& command);
+
+    const std::string& error() const { return error_; }
+
+    static SAICommandType typeFromAction(std::string_view action);
+    static const char* actionName(SAICommandType type);
+
+private:
+    bool fromValue(const common::JsonDocument::Value& value, SAICommand& command, bool nested);
+
+    common::JsonDocument document_;
+    std::string error_;
+};
+
+} // namespace sai
+} // namespace sonic
+
+#endif // SONIC_SAI_COMMAND_H
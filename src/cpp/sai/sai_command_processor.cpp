@@ -7,6 +7,10 @@
 
 #include "sai_vlan_manager.h"
 #include "sai_adapter.h"
+#include "sai_command.h"
+#include "../common/redis_client.h"
+#include "../common/json.h"
+#include "../common/logger.h"
 #include <iostream>
 #include <string>
 #include <thread>
@@ -15,18 +19,41 @@
 #include <sstream>
 #include <iomanip>
 #include <cstdio>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace sonic {
 namespace sai {
 
 class SAICommandProcessor {
 private:
+    static constexpr int COMMAND_DB = 0;
+    static constexpr int BLOCK_TIMEOUT_SECONDS = 1;   ///< Bounds how long stop() waits
+    static constexpr size_t MAX_BATCH_SIZE = 64;
+    static constexpr int RESPONSE_TTL_SECONDS = 10;
+
+    const std::string COMMAND_QUEUE = "sonic:sai:commands";
+
     SAIVLANManager vlan_manager_;
-    bool running_;
+    SAICommandParser parser_;
+    common::JsonWriter response_writer_;     ///< Reused for every response
+    common::RedisClient redis_;
+    std::unique_ptr<common::RedisConnection> blocking_conn_;   ///< Dedicated to BRPOP so it never holds redis_
+    bool rpop_count_supported_;
+    std::vector<std::pair<std::string, std::string>> pending_responses_;
+    std::atomic<bool> running_;
     std::thread processor_thread_;
 
 public:
-    SAICommandProcessor() : running_(false) {}
+    SAICommandProcessor()
+        : redis_(common::RedisConfig::fromEnvironment("localhost")),
+          rpop_count_supported_(true), running_(false) {
+        common::RedisConfig config = redis_.config();
+        config.io_timeout_ms = (BLOCK_TIMEOUT_SECONDS + 1) * 1000;
+        blocking_conn_.reset(new common::RedisConnection(config, COMMAND_DB));
+    }
     
     ~SAICommandProcessor() {
         stop();
@@ -38,14 +65,14 @@ public:
         // Initialize SAI adapter first
         auto* sai_adapter = sonic::sai::SAIAdapter::getInstance();
         if (!sai_adapter || !sai_adapter->initialize()) {
-            std::cerr << "Failed to initialize SAI adapter in command processor" << std::endl;
+            SONIC_LOG_ERROR("SAI", "Failed to initialize SAI adapter in command processor");
             return false;
         }
-        std::cout << "SAI adapter initialized successfully in command processor" << std::endl;
+        SONIC_LOG_INFO("SAI", "SAI adapter initialized successfully in command processor");
 
         running_ = true;
         processor_thread_ = std::thread(&SAICommandProcessor::processCommands, this);
-        std::cout << "SAI Command Processor started" << std::endl;
+        SONIC_LOG_INFO("SAI", "SAI Command Processor started");
         return true;
     }
     
@@ -55,141 +82,219 @@ public:
             if (processor_thread_.joinable()) {
                 processor_thread_.join();
             }
-            std::cout << "SAI Command Processor stopped" << std::endl;
+            SONIC_LOG_INFO("SAI", "SAI Command Processor stopped");
         }
     }
     
 private:
     void processCommands() {
+        std::vector<std::string> batch;
         while (running_) {
             try {
-                // Check for commands from Python API via Redis
-                std::string command = getNextCommand();
-                if (!command.empty()) {
+                // Block until the Python API pushes work, then drain a batch
+                batch.clear();
+                getNextCommands(batch);
+                for (const auto& command : batch) {
                     processCommand(command);
                 }
-                
-                // Sleep briefly to avoid busy waiting
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-                
+                flushResponses();
+
             } catch (const std::exception& e) {
-                std::cerr << "Error in command processor: " << e.what() << std::endl;
+                SONIC_LOG_ERROR("SAI", "Error in command processor: " << e.what());
                 std::this_thread::sleep_for(std::chrono::seconds(1));
             }
         }
     }
-    
-    std::string getNextCommand() {
-        // Use redis-cli to get next command (in production, use hiredis library)
-        std::string redis_cmd = "redis-cli -h localhost -p 6379 RPOP sonic:sai:commands";
-        
-        FILE* pipe = popen(redis_cmd.c_str(), "r");
-        if (!pipe) return "";
-        
-        char buffer[1024];
-        std::string result;
-        while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
-            result += buffer;
+
+    /**
+     * @brief Wait for the next command with BRPOP, then pop up to MAX_BATCH_SIZE - 1 more
+     *
+     * Falls back to polling RPOP through redis_ (which may use redis-cli) when
+     * no socket connection can be made.
+     */
+    void getNextCommands(std::vector<std::string>& commands) {
+        if (!blocking_conn_->isConnected() && !blocking_conn_->connect()) {
+            std::string command = getNextCommand();
+            if (command.empty()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            } else {
+                commands.push_back(command);
+            }
+            return;
         }
-        pclose(pipe);
-        
-        // Remove trailing newline
-        if (!result.empty() && result.back() == '\n') {
-            result.pop_back();
+
+        common::RedisReply reply;
+        if (!blocking_conn_->execute({"BRPOP", COMMAND_QUEUE, std::to_string(BLOCK_TIMEOUT_SECONDS)}, reply)) {
+            SONIC_LOG_WARN("SAI", "Lost command queue connection, reconnecting");
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            return;
+        }
+        if (reply.isNil() || reply.elements.size() != 2) {
+            return; // Timed out
+        }
+        commands.push_back(reply.elements[1].str);
+
+        // LPUSH + RPOP keeps FIFO order; RPOP <count> needs Redis 6.2
+        const std::string remaining = std::to_string(MAX_BATCH_SIZE - 1);
+        if (rpop_count_supported_) {
+            if (!blocking_conn_->execute({"RPOP", COMMAND_QUEUE, remaining}, reply)) {
+                return;
+            }
+            if (!reply.isError()) {
+                for (const auto& element : reply.elements) {
+                    commands.push_back(element.str);
+                }
+                return;
+            }
+            rpop_count_supported_ = false;
+        }
+
+        std::vector<std::vector<std::string>> pops(MAX_BATCH_SIZE - 1, {"RPOP", COMMAND_QUEUE});
+        std::vector<common::RedisReply> replies;
+        if (blocking_conn_->executePipeline(pops, replies)) {
+            for (const auto& popped : replies) {
+                if (popped.isNil()) {
+                    break;
+                }
+                commands.push_back(popped.str);
+            }
         }
-        
-        return result.empty() || result == "(nil)" ? "" : result;
     }
-    
-    void processCommand(const std::string& command_json) {
-        std::cout << "Processing command: " << command_json << std::endl;
-        
-        // Parse JSON command (simple parsing for POC)
-        // In production, use a proper JSON library like nlohmann/json
-        
-        if (command_json.find("create_vlan") != std::string::npos) {
-            processCreateVLAN(command_json);
-        } else if (command_json.find("delete_vlan") != std::string::npos) {
-            processDeleteVLAN(command_json);
-        } else {
-            std::cerr << "Unknown command: " << command_json << std::endl;
+
+    std::string getNextCommand() {
+        common::RedisReply reply;
+        if (!redis_.command(COMMAND_DB, {"RPOP", COMMAND_QUEUE}, reply) || reply.isNil()) {
+            return "";
         }
+        return reply.str == "(nil)" ? "" : reply.str;
     }
     
-    void processCreateVLAN(const std::string& command_json) {
-        // Extract VLAN ID and name from JSON (simple parsing for POC)
-        uint16_t vlan_id = 0;
-        std::string vlan_name;
-
-        std::cout << "Parsing JSON: " << command_json << std::endl;
-
-        // Simple JSON parsing (in production, use proper JSON library)
-        size_t vlan_id_pos = command_json.find("\"vlan_id\":");
-        if (vlan_id_pos != std::string::npos) {
-            size_t start = command_json.find_first_of("0123456789", vlan_id_pos);
-            size_t end = command_json.find_first_not_of("0123456789", start);
-            if (start != std::string::npos && end != std::string::npos) {
-                vlan_id = std::stoi(command_json.substr(start, end - start));
-            }
-        }
+    void processCommand(const std::string& command_json) {
+        SONIC_LOG_INFO("SAI", "Processing command: " << command_json);
 
-        // Fixed VLAN name parsing
-        size_t name_pos = command_json.find("\"name\": \"");
-        if (name_pos == std::string::npos) {
-            name_pos = command_json.find("\"name\":\"");
+        SAICommand command;
+        if (!parser_.parse(command_json, command)) {
+            SONIC_LOG_ERROR("SAI", "Invalid command: " << parser_.error());
+            return;
         }
+        executeCommand(command);
+    }
 
-        if (name_pos != std::string::npos) {
-            size_t start = command_json.find("\"", name_pos + 7); // Find opening quote after "name":
-            if (start != std::string::npos) {
-                start++; // Move past the opening quote
-                size_t end = command_json.find("\"", start); // Find closing quote
-                if (end != std::string::npos) {
-                    vlan_name = command_json.substr(start, end - start);
+    void executeCommand(const SAICommand& command) {
+        switch (command.type) {
+            case SAICommandType::CREATE_VLAN:
+                processCreateVLAN(command);
+                break;
+            case SAICommandType::DELETE_VLAN:
+                processDeleteVLAN(command);
+                break;
+            case SAICommandType::ADD_VLAN_MEMBER:
+            case SAICommandType::REMOVE_VLAN_MEMBER:
+                processVLANMember(command);
+                break;
+            case SAICommandType::CREATE_ROUTE:
+            case SAICommandType::REMOVE_ROUTE:
+                // SAI route manager is not implemented in the POC yet
+                SONIC_LOG_ERROR("SAI", "Route command not supported by command processor: " << command.prefix);
+                break;
+            case SAICommandType::BATCH:
+                SONIC_LOG_INFO("SAI", "Processing batch of " << command.commands.size() << " commands");
+                for (const auto& sub_command : command.commands) {
+                    executeCommand(sub_command);
                 }
-            }
+                break;
+            default:
+                SONIC_LOG_ERROR("SAI", "Unknown command: " << command.action);
+                break;
         }
+    }
+    
+    void processCreateVLAN(const SAICommand& command) {
+        SONIC_LOG_INFO("SAI", "Creating VLAN " << command.vlan_id << " with name " << command.name);
 
-        std::cout << "Extracted VLAN ID: " << vlan_id << ", Name: '" << vlan_name << "'" << std::endl;
-        
-        if (vlan_id > 0) {
-            std::cout << "Creating VLAN " << vlan_id << " with name " << vlan_name << std::endl;
-
-            bool success = vlan_manager_.createVLAN(vlan_id, vlan_name);
+        bool success = vlan_manager_.createVLAN(command.vlan_id, command.name);
 
-            std::cout << "VLAN creation result: " << (success ? "SUCCESS" : "FAILED") << std::endl;
+        SONIC_LOG_INFO("SAI", "VLAN creation result: " << (success ? "SUCCESS" : "FAILED"));
 
-            // Send response back to Python API
-            std::ostringstream response;
-            response << "{"
-                    << "\"vlan_id\":" << vlan_id << ","
-                    << "\"name\":\"" << vlan_name << "\","
-                    << "\"status\":\"" << (success ? "active" : "error") << "\","
-                    << "\"members\":[],"
-                    << "\"created_at\":\"" << getCurrentTimestamp() << "\","
-                    << "\"source\":\"cpp_component\""
-                    << "}";
+        // Send response back to Python API
+        response_writer_.clear();
+        response_writer_.beginObject()
+            .key("vlan_id").value(command.vlan_id)
+            .key("name").value(command.name)
+            .key("status").value(success ? "active" : "error")
+            .key("members").beginArray().endArray()
+            .key("created_at").value(getCurrentTimestamp())
+            .key("source").value("cpp_component")
+            .endObject();
 
-            std::cout << "Sending response: " << response.str() << std::endl;
-            sendResponse("create_vlan", vlan_id, response.str());
-        }
+        SONIC_LOG_INFO("SAI", "Sending response: " << response_writer_.str());
+        sendResponse("create_vlan", command.vlan_id, response_writer_.str());
     }
     
-    void processDeleteVLAN(const std::string& command_json) {
-        // Similar implementation for delete VLAN
-        std::cout << "Delete VLAN command received (not implemented in POC)" << std::endl;
+    void processDeleteVLAN(const SAICommand& command) {
+        SONIC_LOG_INFO("SAI", "Deleting VLAN " << command.vlan_id);
+
+        bool success = vlan_manager_.deleteVLAN(command.vlan_id);
+
+        response_writer_.clear();
+        response_writer_.beginObject()
+            .key("success").value(success)
+            .key("vlan_id").value(command.vlan_id)
+            .key("action").value("deleted")
+            .key("source").value("cpp_component")
+            .endObject();
+        sendResponse("delete_vlan", command.vlan_id, response_writer_.str());
+    }
+
+    void processVLANMember(const SAICommand& command) {
+        bool adding = (command.type == SAICommandType::ADD_VLAN_MEMBER);
+        SONIC_LOG_INFO("SAI", (adding ? "Adding port " : "Removing port ") << command.port_name
+                       << (adding ? " to VLAN " : " from VLAN ") << command.vlan_id);
+
+        bool success = adding ? vlan_manager_.addPortToVLAN(command.vlan_id, command.port_name, command.tagged)
+                              : vlan_manager_.removePortFromVLAN(command.vlan_id, command.port_name);
+
+        response_writer_.clear();
+        response_writer_.beginObject()
+            .key("success").value(success)
+            .key("vlan_id").value(command.vlan_id)
+            .key("port").value(command.port_name);
+        if (adding) {
+            response_writer_.key("tagged").value(command.tagged);
+        }
+        response_writer_.key("source").value("cpp_component").endObject();
+        sendResponse(SAICommandParser::actionName(command.type), command.vlan_id, response_writer_.str());
     }
     
+    /**
+     * @brief Queue a response; flushResponses() writes the whole batch in one round trip
+     */
     void sendResponse(const std::string& action, uint16_t vlan_id, const std::string& response) {
         std::string response_key = "sonic:sai:response:" + action + ":" + std::to_string(vlan_id);
-        std::string redis_cmd = "redis-cli -h localhost -p 6379 SETEX " + response_key + " 10 '" + response + "'";
-        
-        int result = system(redis_cmd.c_str());
-        if (result == 0) {
-            std::cout << "Sent response to Python API: " << response_key << std::endl;
-        } else {
-            std::cerr << "Failed to send response to Python API" << std::endl;
+        pending_responses_.emplace_back(response_key, response);
+    }
+
+    void flushResponses() {
+        if (pending_responses_.empty()) {
+            return;
+        }
+
+        std::vector<std::vector<std::string>> commands;
+        commands.reserve(pending_responses_.size());
+        for (const auto& pending : pending_responses_) {
+            commands.push_back({"SETEX", pending.first, std::to_string(RESPONSE_TTL_SECONDS), pending.second});
+        }
+
+        std::vector<common::RedisReply> replies;
+        bool sent = redis_.pipeline(COMMAND_DB, commands, replies);
+        for (size_t i = 0; i < pending_responses_.size(); ++i) {
+            if (sent && i < replies.size() && !replies[i].isError()) {
+                SONIC_LOG_INFO("SAI", "Sent response to Python API: " << pending_responses_[i].first);
+            } else {
+                SONIC_LOG_ERROR("SAI", "Failed to send response to Python API: " << pending_responses_[i].first);
+            }
         }
+        pending_responses_.clear();
     }
     
     std::string getCurrentTimestamp() {
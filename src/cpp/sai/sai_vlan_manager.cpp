@@ -7,20 +7,26 @@
 
 #include "sai_vlan_manager.h"
 #include "sai_adapter.h"
+#include "../common/port_registry.h"
+#include "../common/redis_client.h"
+#include "../common/metrics.h"
+#include "../common/warm_snapshot.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
-#include <chrono>
 #include <iomanip>
+#include <unordered_map>
 
 namespace sonic {
 namespace sai {
 
-SAIVLANManager::SAIVLANManager() : initialized_(false) {
+SAIVLANManager::SAIVLANManager()
+    : initialized_(false), vlan_table_(MAX_VLAN_ID + 1), vlan_count_(0) {
     // Get SAI adapter instance
     sai_adapter_ = SAIAdapter::getInstance();
     if (sai_adapter_ && sai_adapter_->initialize()) {
         initialized_ = true;
+        common::portRegistry().ensureLoaded(common::RedisConfig::fromEnvironment("localhost"));
         std::cout << "SAI VLAN Manager initialized successfully" << std::endl;
     } else {
         std::cerr << "Failed to initialize SAI VLAN Manager" << std::endl;
@@ -34,6 +40,7 @@ SAIVLANManager::~SAIVLANManager() {
 
 
 bool SAIVLANManager::createVLAN(uint16_t vlan_id, const std::string& name) {
+    SONIC_SCOPED_TIMER("sonic_sai_vlan_create_seconds", "Time to create a VLAN through the SAI adapter");
     std::cout << "SAIVLANManager::createVLAN called with VLAN ID: " << vlan_id << ", name: " << name << std::endl;
     std::cout << "Initialized status: " << (initialized_ ? "true" : "false") << std::endl;
 
@@ -41,9 +48,14 @@ bool SAIVLANManager::createVLAN(uint16_t vlan_id, const std::string& name) {
         std::cerr << "SAI not initialized" << std::endl;
         return false;
     }
+
+    if (!isValidVLANId(vlan_id)) {
+        std::cerr << "Invalid VLAN ID " << vlan_id << std::endl;
+        return false;
+    }
     
     // Check if VLAN already exists
-    if (vlans_.find(vlan_id) != vlans_.end()) {
+    if (vlan_table_[vlan_id]) {
         std::cerr << "VLAN " << vlan_id << " already exists" << std::endl;
         return false;
     }
@@ -52,8 +64,10 @@ bool SAIVLANManager::createVLAN(uint16_t vlan_id, const std::string& name) {
     vlan_attr.id = SAI_VLAN_ATTR_VLAN_ID;
     vlan_attr.value.u16 = vlan_id;
     
-    sai_object_id_t vlan_oid;
-    sai_status_t status = sai_adapter_->getVLANAPI()->create_vlan(&vlan_oid, sai_adapter_->getSwitchId(), 1, &vlan_attr);
+    std::vector<sai_object_id_t> vlan_oids(sai_adapter_->getAsicCount(), SAI_NULL_OBJECT_ID);
+    sai_status_t status = settleCreate(onAllAsics([&](const SAISwitchContext& asic) {
+        return asic.vlan_api->create_vlan(&vlan_oids[asic.index], asic.switch_id, 1, &vlan_attr);
+    }), vlan_oids, removeVLANOn);
     
     if (status != SAI_STATUS_SUCCESS) {
         std::cerr << "Failed to create VLAN " << vlan_id << ": " << status << std::endl;
@@ -61,16 +75,17 @@ bool SAIVLANManager::createVLAN(uint16_t vlan_id, const std::string& name) {
     }
     
     // Store VLAN information
-    VLANInfo vlan_info;
-    vlan_info.vlan_id = vlan_id;
-    vlan_info.vlan_oid = vlan_oid;
-    vlan_info.name = name.empty() ? "VLAN_" + std::to_string(vlan_id) : name;
-    vlan_info.created_at = getCurrentTimestamp();
-    vlan_info.status = VLANStatus::ACTIVE;
-    
-    vlans_[vlan_id] = vlan_info;
-    
-    std::cout << "VLAN " << vlan_id << " (" << vlan_info.name << ") created successfully" << std::endl;
+    std::unique_ptr<VLANEntry> entry(new VLANEntry());
+    entry->vlan_id = vlan_id;
+    entry->vlan_oid = vlan_oids[0];
+    entry->peer_vlan_oids.assign(vlan_oids.begin() + 1, vlan_oids.end());
+    entry->name = name.empty() ? "VLAN_" + std::to_string(vlan_id) : name;
+    entry->created_at = std::time(nullptr);
+    entry->status = VLANStatus::ACTIVE;
+
+    std::cout << "VLAN " << vlan_id << " (" << entry->name << ") created successfully" << std::endl;
+    vlan_table_[vlan_id] = std::move(entry);
+    vlan_count_++;
     return true;
 }
 
@@ -80,25 +95,36 @@ bool SAIVLANManager::deleteVLAN(uint16_t vlan_id) {
         return false;
     }
     
-    auto it = vlans_.find(vlan_id);
-    if (it == vlans_.end()) {
+    VLANEntry* vlan = lookupVLAN(vlan_id);
+    if (!vlan) {
         std::cerr << "VLAN " << vlan_id << " not found" << std::endl;
         return false;
     }
     
-    // Remove all port members first
-    for (const auto& member : it->second.members) {
-        removePortFromVLAN(vlan_id, member.port_name);
+    // Remove all port members first; iterate a copy since removal edits the member list
+    std::vector<common::PortId> member_ports;
+    vlan->member_ports.forEach([&member_ports](uint32_t port_id) { member_ports.push_back(port_id); });
+    for (common::PortId port_id : member_ports) {
+        removePortFromVLAN(vlan_id, common::portNames().name(port_id));
     }
     
     // Delete VLAN from SAI
-    sai_status_t status = sai_adapter_->getVLANAPI()->remove_vlan(it->second.vlan_oid);
+    std::vector<sai_object_id_t> vlan_oids(sai_adapter_->getAsicCount());
+    for (size_t asic = 0; asic < vlan_oids.size(); ++asic) {
+        vlan_oids[asic] = vlanOidOn(*vlan, asic);
+    }
+    sai_status_t status = settleRemove(onAllAsics([&](const SAISwitchContext& asic) {
+        return removeVLANOn(asic, vlan_oids[asic.index]);
+    }), vlan_oids);
     if (status != SAI_STATUS_SUCCESS) {
+        vlan->vlan_oid = vlan_oids[0];
+        std::copy(vlan_oids.begin() + 1, vlan_oids.end(), vlan->peer_vlan_oids.begin());
         std::cerr << "Failed to delete VLAN " << vlan_id << ": " << status << std::endl;
         return false;
     }
     
-    vlans_.erase(it);
+    vlan_table_[vlan_id].reset();
+    vlan_count_--;
     std::cout << "VLAN " << vlan_id << " deleted successfully" << std::endl;
     return true;
 }
@@ -109,24 +135,37 @@ bool SAIVLANManager::addPortToVLAN(uint16_t vlan_id, const std::string& port_nam
         return false;
     }
     
-    auto vlan_it = vlans_.find(vlan_id);
-    if (vlan_it == vlans_.end()) {
+    VLANEntry* vlan = lookupVLAN(vlan_id);
+    if (!vlan) {
         std::cerr << "VLAN " << vlan_id << " not found" << std::endl;
         return false;
     }
     
-    // Get port OID (in real implementation, this would query the port database)
+    // Resolve through the registry first so unknown names never take a PortId
     sai_object_id_t port_oid = getPortOID(port_name);
-    if (port_oid == SAI_NULL_OBJECT_ID) {
+    common::PortId port_id = common::portRegistry().findPort(port_name);
+    if (port_id == common::INVALID_PORT_ID || port_oid == SAI_NULL_OBJECT_ID) {
         std::cerr << "Port " << port_name << " not found" << std::endl;
         return false;
     }
+
+    if (vlan->hasPort(port_id)) {
+        std::cerr << "Port " << port_name << " is already a member of VLAN " << vlan_id << std::endl;
+        return false;
+    }
     
-    // Create VLAN member
+    // The member exists only on the ASIC that owns the port's bridge port
+    size_t owner = portAsic(port_oid);
+    const SAISwitchContext* asic = sai_adapter_->getSwitch(owner);
+    if (!asic) {
+        std::cerr << "Port " << port_name << " is not owned by any ASIC" << std::endl;
+        return false;
+    }
+
     sai_attribute_t vlan_member_attrs[3];
     
     vlan_member_attrs[0].id = SAI_VLAN_MEMBER_ATTR_VLAN_ID;
-    vlan_member_attrs[0].value.oid = vlan_it->second.vlan_oid;
+    vlan_member_attrs[0].value.oid = vlanOidOn(*vlan, owner);
     
     vlan_member_attrs[1].id = SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID;
     vlan_member_attrs[1].value.oid = port_oid;
@@ -134,8 +173,9 @@ bool SAIVLANManager::addPortToVLAN(uint16_t vlan_id, const std::string& port_nam
     vlan_member_attrs[2].id = SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE;
     vlan_member_attrs[2].value.s32 = tagged ? SAI_VLAN_TAGGING_MODE_TAGGED : SAI_VLAN_TAGGING_MODE_UNTAGGED;
     
-    sai_object_id_t vlan_member_oid;
-    sai_status_t status = sai_adapter_->getVLANAPI()->create_vlan_member(&vlan_member_oid, sai_adapter_->getSwitchId(), 3, vlan_member_attrs);
+    std::vector<sai_object_id_t> member_oids(sai_adapter_->getAsicCount(), SAI_NULL_OBJECT_ID);
+    sai_status_t status = asic->vlan_api->create_vlan_member(&member_oids[owner], asic->switch_id, 3,
+                                                             vlan_member_attrs);
     
     if (status != SAI_STATUS_SUCCESS) {
         std::cerr << "Failed to add port " << port_name << " to VLAN " << vlan_id << ": " << status << std::endl;
@@ -143,14 +183,7 @@ bool SAIVLANManager::addPortToVLAN(uint16_t vlan_id, const std::string& port_nam
     }
     
     // Store member information
-    VLANMember member;
-    member.port_name = port_name;
-    member.port_oid = port_oid;
-    member.member_oid = vlan_member_oid;
-    member.tagged = tagged;
-    member.added_at = getCurrentTimestamp();
-    
-    vlan_it->second.members.push_back(member);
+    recordMember(*vlan, port_id, port_oid, member_oids, tagged, std::time(nullptr));
     
     std::string tag_type = tagged ? "tagged" : "untagged";
     std::cout << "Port " << port_name << " added to VLAN " << vlan_id << " as " << tag_type << std::endl;
@@ -163,69 +196,443 @@ bool SAIVLANManager::removePortFromVLAN(uint16_t vlan_id, const std::string& por
         return false;
     }
     
-    auto vlan_it = vlans_.find(vlan_id);
-    if (vlan_it == vlans_.end()) {
+    VLANEntry* vlan = lookupVLAN(vlan_id);
+    if (!vlan) {
         std::cerr << "VLAN " << vlan_id << " not found" << std::endl;
         return false;
     }
     
     // Find the member
-    auto member_it = std::find_if(vlan_it->second.members.begin(), vlan_it->second.members.end(),
-        [&port_name](const VLANMember& member) {
-            return member.port_name == port_name;
-        });
-    
-    if (member_it == vlan_it->second.members.end()) {
+    common::PortId port_id = common::INVALID_PORT_ID;
+    if (!common::portNames().find(port_name, port_id) || !vlan->hasPort(port_id)) {
         std::cerr << "Port " << port_name << " not found in VLAN " << vlan_id << std::endl;
         return false;
     }
+    auto member_it = std::find_if(vlan->members.begin(), vlan->members.end(),
+        [port_id](const VLANMemberEntry& member) {
+            return member.port_id == port_id;
+        });
     
     // Remove VLAN member from SAI
-    sai_status_t status = sai_adapter_->getVLANAPI()->remove_vlan_member(member_it->member_oid);
+    std::vector<sai_object_id_t> member_oids(sai_adapter_->getAsicCount());
+    for (size_t asic = 0; asic < member_oids.size(); ++asic) {
+        member_oids[asic] = memberOidOn(*member_it, asic);
+    }
+    sai_status_t status = settleRemove(onAllAsics([&](const SAISwitchContext& asic) {
+        return removeMemberOn(asic, member_oids[asic.index]);
+    }), member_oids);
     if (status != SAI_STATUS_SUCCESS) {
+        member_it->member_oid = member_oids[0];
+        std::copy(member_oids.begin() + 1, member_oids.end(), member_it->peer_member_oids.begin());
         std::cerr << "Failed to remove port " << port_name << " from VLAN " << vlan_id << ": " << status << std::endl;
         return false;
     }
     
-    vlan_it->second.members.erase(member_it);
+    eraseMember(*vlan, port_id);
     std::cout << "Port " << port_name << " removed from VLAN " << vlan_id << std::endl;
     return true;
 }
 
-bool SAIVLANManager::validateVLANIsolation(uint16_t vlan1_id, uint16_t vlan2_id) {
-    auto vlan1_it = vlans_.find(vlan1_id);
-    auto vlan2_it = vlans_.find(vlan2_id);
-    
-    if (vlan1_it == vlans_.end() || vlan2_it == vlans_.end()) {
-        std::cerr << "One or both VLANs not found" << std::endl;
-        return false;
+std::vector<sai_status_t> SAIVLANManager::createVLANs(const std::vector<VLANCreateRequest>& requests) {
+    std::vector<sai_status_t> statuses(requests.size(), SAI_STATUS_UNINITIALIZED);
+    if (!initialized_) {
+        std::cerr << "SAI not initialized" << std::endl;
+        return statuses;
     }
-    
-    // Check for untagged port overlap (which would break isolation)
-    std::set<std::string> vlan1_untagged, vlan2_untagged;
-    
-    for (const auto& member : vlan1_it->second.members) {
-        if (!member.tagged) {
-            vlan1_untagged.insert(member.port_name);
+
+    std::vector<size_t> pending;
+    std::vector<bool> batch_vlans(MAX_VLAN_ID + 1, false);
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const VLANCreateRequest& request = requests[i];
+        if (!isValidVLANId(request.vlan_id)) {
+            statuses[i] = SAI_STATUS_INVALID_VLAN_ID;
+            continue;
+        }
+        if (vlan_table_[request.vlan_id] || batch_vlans[request.vlan_id]) {
+            statuses[i] = SAI_STATUS_ITEM_ALREADY_EXISTS;
+            continue;
         }
+        batch_vlans[request.vlan_id] = true;
+        pending.push_back(i);
     }
-    
-    for (const auto& member : vlan2_it->second.members) {
-        if (!member.tagged) {
-            vlan2_untagged.insert(member.port_name);
+
+    // SAI has no bulk VLAN create, but each ASIC walks the batch on its own worker
+    size_t asics = sai_adapter_->getAsicCount();
+    std::vector<std::vector<sai_object_id_t>> asic_oids(
+        asics, std::vector<sai_object_id_t>(pending.size(), SAI_NULL_OBJECT_ID));
+    std::vector<std::vector<sai_status_t>> asic_statuses(
+        asics, std::vector<sai_status_t>(pending.size(), SAI_STATUS_NOT_EXECUTED));
+    sai_adapter_->forEachAsic([&](const SAISwitchContext& asic) {
+        for (size_t j = 0; j < pending.size(); ++j) {
+            sai_attribute_t vlan_attr;
+            vlan_attr.id = SAI_VLAN_ATTR_VLAN_ID;
+            vlan_attr.value.u16 = requests[pending[j]].vlan_id;
+            asic_statuses[asic.index][j] = asic.vlan_api->create_vlan(&asic_oids[asic.index][j], asic.switch_id,
+                                                                      1, &vlan_attr);
+        }
+    });
+
+    std::time_t timestamp = std::time(nullptr);
+    std::vector<sai_status_t> item_statuses(asics);
+    std::vector<sai_object_id_t> vlan_oids(asics);
+    size_t created = 0;
+
+    for (size_t j = 0; j < pending.size(); ++j) {
+        for (size_t asic = 0; asic < asics; ++asic) {
+            item_statuses[asic] = asic_statuses[asic][j];
+            vlan_oids[asic] = asic_oids[asic][j];
+        }
+        const VLANCreateRequest& request = requests[pending[j]];
+        statuses[pending[j]] = settleCreate(item_statuses, vlan_oids, removeVLANOn);
+        if (statuses[pending[j]] != SAI_STATUS_SUCCESS) {
+            continue;
+        }
+
+        std::unique_ptr<VLANEntry> entry(new VLANEntry());
+        entry->vlan_id = request.vlan_id;
+        entry->vlan_oid = vlan_oids[0];
+        entry->peer_vlan_oids.assign(vlan_oids.begin() + 1, vlan_oids.end());
+        entry->name = request.name.empty() ? "VLAN_" + std::to_string(request.vlan_id) : request.name;
+        entry->created_at = timestamp;
+        entry->status = VLANStatus::ACTIVE;
+        vlan_table_[request.vlan_id] = std::move(entry);
+        vlan_count_++;
+        created++;
+    }
+
+    std::cout << "Created " << created << "/" << requests.size() << " VLANs" << std::endl;
+    return statuses;
+}
+
+std::vector<sai_status_t> SAIVLANManager::addPortsToVLANs(const std::vector<VLANMemberRequest>& requests) {
+    std::vector<sai_status_t> statuses(requests.size(), SAI_STATUS_UNINITIALIZED);
+    if (!initialized_) {
+        std::cerr << "SAI not initialized" << std::endl;
+        return statuses;
+    }
+
+    // Validate and resolve every request once; only valid ones go to SAI
+    size_t asics = sai_adapter_->getAsicCount();
+    std::vector<size_t> pending;
+    std::vector<common::PortId> port_ids(requests.size(), common::INVALID_PORT_ID);
+    std::vector<sai_object_id_t> port_oids(requests.size(), SAI_NULL_OBJECT_ID);
+    std::vector<size_t> owners(requests.size(), asics);
+    std::vector<sai_attribute_t> attrs;
+    std::unordered_map<uint16_t, common::PortBitmap> batch_ports;
+
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const VLANMemberRequest& request = requests[i];
+        VLANEntry* vlan = lookupVLAN(request.vlan_id);
+        if (!vlan) {
+            statuses[i] = SAI_STATUS_ITEM_NOT_FOUND;
+            continue;
+        }
+        port_oids[i] = getPortOID(request.port_name);
+        port_ids[i] = common::portRegistry().findPort(request.port_name);
+        if (port_ids[i] == common::INVALID_PORT_ID || port_oids[i] == SAI_NULL_OBJECT_ID) {
+            statuses[i] = SAI_STATUS_INVALID_PORT_NUMBER;
+            continue;
+        }
+        owners[i] = portAsic(port_oids[i]);
+        if (owners[i] >= asics) {
+            statuses[i] = SAI_STATUS_INVALID_PORT_NUMBER;
+            continue;
+        }
+        if (vlan->hasPort(port_ids[i]) || !batch_ports[request.vlan_id].set(port_ids[i])) {
+            statuses[i] = SAI_STATUS_ITEM_ALREADY_EXISTS;
+            continue;
+        }
+
+        sai_attribute_t member_attrs[3];
+        member_attrs[0].id = SAI_VLAN_MEMBER_ATTR_VLAN_ID;
+        member_attrs[0].value.oid = vlanOidOn(*vlan, owners[i]);
+        member_attrs[1].id = SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID;
+        member_attrs[1].value.oid = port_oids[i];
+        member_attrs[2].id = SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE;
+        member_attrs[2].value.s32 = request.tagged ? SAI_VLAN_TAGGING_MODE_TAGGED : SAI_VLAN_TAGGING_MODE_UNTAGGED;
+        attrs.insert(attrs.end(), member_attrs, member_attrs + 3);
+        pending.push_back(i);
+    }
+
+    // Each ASIC creates only the members whose ports it owns
+    std::vector<std::vector<size_t>> asic_items(asics);
+    for (size_t j = 0; j < pending.size(); ++j) {
+        asic_items[owners[pending[j]]].push_back(j);
+    }
+    std::vector<sai_object_id_t> created_oids(pending.size(), SAI_NULL_OBJECT_ID);
+    std::vector<sai_status_t> created_statuses(pending.size(), SAI_STATUS_NOT_EXECUTED);
+    std::vector<size_t> asic_bulk_calls(asics, 0);
+    sai_adapter_->forEachAsic([&](const SAISwitchContext& asic) {
+        const std::vector<size_t>& items = asic_items[asic.index];
+        std::vector<const sai_attribute_t*> attr_lists(items.size());
+        for (size_t k = 0; k < items.size(); ++k) {
+            attr_lists[k] = attrs.data() + items[k] * 3;
+        }
+        std::vector<sai_object_id_t> oids(items.size(), SAI_NULL_OBJECT_ID);
+        std::vector<sai_status_t> item_statuses(items.size(), SAI_STATUS_NOT_EXECUTED);
+        asic_bulk_calls[asic.index] = createMembersOn(asic, attr_lists, oids, item_statuses);
+        for (size_t k = 0; k < items.size(); ++k) {
+            created_oids[items[k]] = oids[k];
+            created_statuses[items[k]] = item_statuses[k];
+        }
+    });
+
+    std::time_t timestamp = std::time(nullptr);
+    std::vector<sai_object_id_t> member_oids(asics);
+    size_t created = 0;
+
+    for (size_t j = 0; j < pending.size(); ++j) {
+        size_t index = pending[j];
+        statuses[index] = created_statuses[j];
+        if (statuses[index] == SAI_STATUS_SUCCESS) {
+            const VLANMemberRequest& request = requests[index];
+            std::fill(member_oids.begin(), member_oids.end(), SAI_NULL_OBJECT_ID);
+            member_oids[owners[index]] = created_oids[j];
+            recordMember(*vlan_table_[request.vlan_id], port_ids[index], port_oids[index], member_oids,
+                         request.tagged, timestamp);
+            created++;
+        }
+    }
+
+    size_t bulk_calls = 0;
+    for (size_t calls : asic_bulk_calls) {
+        bulk_calls += calls;
+    }
+    std::cout << "Added " << created << "/" << requests.size() << " VLAN members in "
+              << bulk_calls << " bulk calls";
+    if (asics > 1) {
+        std::cout << " across " << asics << " ASICs";
+    }
+    std::cout << std::endl;
+    return statuses;
+}
+
+std::vector<sai_status_t> SAIVLANManager::removePortsFromVLANs(const std::vector<VLANMemberRequest>& requests) {
+    std::vector<sai_status_t> statuses(requests.size(), SAI_STATUS_UNINITIALIZED);
+    if (!initialized_) {
+        std::cerr << "SAI not initialized" << std::endl;
+        return statuses;
+    }
+
+    size_t asics = sai_adapter_->getAsicCount();
+    std::vector<size_t> pending;
+    std::vector<common::PortId> port_ids;
+    std::vector<std::vector<sai_object_id_t>> asic_oids(asics);
+    std::unordered_map<uint16_t, common::PortBitmap> batch_ports;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const VLANMemberRequest& request = requests[i];
+        VLANEntry* vlan = lookupVLAN(request.vlan_id);
+        common::PortId port_id = common::INVALID_PORT_ID;
+        if (!vlan || !common::portNames().find(request.port_name, port_id) || !vlan->hasPort(port_id) ||
+            !batch_ports[request.vlan_id].set(port_id)) {
+            statuses[i] = SAI_STATUS_ITEM_NOT_FOUND;
+            continue;
+        }
+        auto member_it = std::find_if(vlan->members.begin(), vlan->members.end(),
+            [port_id](const VLANMemberEntry& member) {
+                return member.port_id == port_id;
+            });
+        pending.push_back(i);
+        port_ids.push_back(port_id);
+        for (size_t asic = 0; asic < asics; ++asic) {
+            asic_oids[asic].push_back(memberOidOn(*member_it, asic));
+        }
+    }
+
+    std::vector<std::vector<sai_status_t>> asic_statuses(
+        asics, std::vector<sai_status_t>(pending.size(), SAI_STATUS_NOT_EXECUTED));
+    sai_adapter_->forEachAsic([&](const SAISwitchContext& asic) {
+        removeMembersOn(asic, asic_oids[asic.index], asic_statuses[asic.index]);
+    });
+
+    std::vector<sai_status_t> item_statuses(asics);
+    std::vector<sai_object_id_t> member_oids(asics);
+    size_t removed = 0;
+
+    for (size_t j = 0; j < pending.size(); ++j) {
+        for (size_t asic = 0; asic < asics; ++asic) {
+            item_statuses[asic] = asic_statuses[asic][j];
+            member_oids[asic] = asic_oids[asic][j];
+        }
+        size_t index = pending[j];
+        VLANEntry& vlan = *vlan_table_[requests[index].vlan_id];
+        statuses[index] = settleRemove(item_statuses, member_oids);
+        if (statuses[index] == SAI_STATUS_SUCCESS) {
+            eraseMember(vlan, port_ids[j]);
+            removed++;
+            continue;
+        }
+        common::PortId port_id = port_ids[j];
+        auto member_it = std::find_if(vlan.members.begin(), vlan.members.end(),
+            [port_id](const VLANMemberEntry& member) {
+                return member.port_id == port_id;
+            });
+        member_it->member_oid = member_oids[0];
+        std::copy(member_oids.begin() + 1, member_oids.end(), member_it->peer_member_oids.begin());
+    }
+
+    std::cout << "Removed " << removed << "/" << requests.size() << " VLAN members" << std::endl;
+    return statuses;
+}
+
+size_t SAIVLANManager::createMembersOn(const SAISwitchContext& asic, std::vector<const sai_attribute_t*>& attr_lists,
+                                       std::vector<sai_object_id_t>& member_oids,
+                                       std::vector<sai_status_t>& statuses) {
+    sai_vlan_api_t* vlan_api = asic.vlan_api;
+    bool use_bulk = (vlan_api->create_vlan_members != nullptr);
+    size_t bulk_calls = 0;
+
+    for (size_t offset = 0; offset < attr_lists.size(); offset += BULK_CHUNK_SIZE) {
+        size_t count = std::min(BULK_CHUNK_SIZE, attr_lists.size() - offset);
+
+        if (use_bulk) {
+            std::vector<uint32_t> attr_counts(count, 3);
+            sai_status_t status = vlan_api->create_vlan_members(asic.switch_id, static_cast<uint32_t>(count),
+                                                                attr_counts.data(), &attr_lists[offset],
+                                                                SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                                &member_oids[offset], &statuses[offset]);
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED) {
+                std::cout << "SAI bulk VLAN member create not supported, using per-member calls" << std::endl;
+                use_bulk = false;
+            } else {
+                bulk_calls++;
+            }
+        }
+        if (!use_bulk) {
+            for (size_t j = offset; j < offset + count; ++j) {
+                statuses[j] = vlan_api->create_vlan_member(&member_oids[j], asic.switch_id, 3, attr_lists[j]);
+            }
+        }
+    }
+    return bulk_calls;
+}
+
+void SAIVLANManager::removeMembersOn(const SAISwitchContext& asic, const std::vector<sai_object_id_t>& member_oids,
+                                     std::vector<sai_status_t>& statuses) {
+    // Members live only on their port's ASIC; null slots have nothing to remove here
+    std::vector<size_t> items;
+    std::vector<sai_object_id_t> oids;
+    for (size_t j = 0; j < member_oids.size(); ++j) {
+        if (member_oids[j] == SAI_NULL_OBJECT_ID) {
+            statuses[j] = SAI_STATUS_SUCCESS;
+        } else {
+            items.push_back(j);
+            oids.push_back(member_oids[j]);
+        }
+    }
+
+    sai_vlan_api_t* vlan_api = asic.vlan_api;
+    bool use_bulk = (vlan_api->remove_vlan_members != nullptr);
+    std::vector<sai_status_t> item_statuses(oids.size(), SAI_STATUS_NOT_EXECUTED);
+
+    for (size_t offset = 0; offset < oids.size(); offset += BULK_CHUNK_SIZE) {
+        size_t count = std::min(BULK_CHUNK_SIZE, oids.size() - offset);
+
+        if (use_bulk) {
+            sai_status_t status = vlan_api->remove_vlan_members(static_cast<uint32_t>(count), &oids[offset],
+                                                                SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                                &item_statuses[offset]);
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED) {
+                use_bulk = false;
+            }
+        }
+        if (!use_bulk) {
+            for (size_t k = offset; k < offset + count; ++k) {
+                item_statuses[k] = removeMemberOn(asic, oids[k]);
+            }
         }
     }
+    for (size_t k = 0; k < items.size(); ++k) {
+        statuses[items[k]] = item_statuses[k];
+    }
+}
+
+sai_status_t SAIVLANManager::removeVLANOn(const SAISwitchContext& asic, sai_object_id_t oid) {
+    return oid == SAI_NULL_OBJECT_ID ? SAI_STATUS_SUCCESS : asic.vlan_api->remove_vlan(oid);
+}
+
+sai_status_t SAIVLANManager::removeMemberOn(const SAISwitchContext& asic, sai_object_id_t oid) {
+    return oid == SAI_NULL_OBJECT_ID ? SAI_STATUS_SUCCESS : asic.vlan_api->remove_vlan_member(oid);
+}
+
+std::vector<sai_status_t> SAIVLANManager::onAllAsics(const std::function<sai_status_t(const SAISwitchContext&)>& call) {
+    std::vector<sai_status_t> statuses(sai_adapter_->getAsicCount(), SAI_STATUS_NOT_EXECUTED);
+    sai_adapter_->forEachAsic([&](const SAISwitchContext& asic) {
+        statuses[asic.index] = call(asic);
+    });
+    return statuses;
+}
+
+sai_status_t SAIVLANManager::settleCreate(const std::vector<sai_status_t>& statuses,
+                                          const std::vector<sai_object_id_t>& oids, RemoveFn remove) {
+    auto failed = std::find_if(statuses.begin(), statuses.end(),
+                               [](sai_status_t status) { return status != SAI_STATUS_SUCCESS; });
+    if (failed == statuses.end()) {
+        return SAI_STATUS_SUCCESS;
+    }
+    for (size_t asic = 0; asic < statuses.size(); ++asic) {
+        if (statuses[asic] == SAI_STATUS_SUCCESS) {
+            remove(*sai_adapter_->getSwitch(asic), oids[asic]);
+        }
+    }
+    std::cerr << "ASIC " << (failed - statuses.begin()) << " rejected the object: " << *failed << std::endl;
+    return *failed;
+}
+
+sai_status_t SAIVLANManager::settleRemove(const std::vector<sai_status_t>& statuses,
+                                          std::vector<sai_object_id_t>& oids) {
+    sai_status_t result = SAI_STATUS_SUCCESS;
+    for (size_t asic = 0; asic < statuses.size(); ++asic) {
+        if (statuses[asic] == SAI_STATUS_SUCCESS) {
+            oids[asic] = SAI_NULL_OBJECT_ID;
+        } else if (result == SAI_STATUS_SUCCESS) {
+            result = statuses[asic];
+        }
+    }
+    return result;
+}
+
+void SAIVLANManager::recordMember(VLANEntry& vlan, common::PortId port_id, sai_object_id_t port_oid,
+                                  const std::vector<sai_object_id_t>& member_oids, bool tagged, std::time_t timestamp) {
+    VLANMemberEntry member;
+    member.port_id = port_id;
+    member.port_oid = port_oid;
+    member.member_oid = member_oids[0];
+    member.peer_member_oids.assign(member_oids.begin() + 1, member_oids.end());
+    member.asic = std::find_if(member_oids.begin(), member_oids.end(),
+                               [](sai_object_id_t oid) { return oid != SAI_NULL_OBJECT_ID; }) - member_oids.begin();
+    member.tagged = tagged;
+    member.added_at = timestamp;
+    vlan.members.push_back(member);
+    vlan.member_ports.set(port_id);
+    if (!tagged) {
+        vlan.untagged_ports.set(port_id);
+    }
+}
+
+void SAIVLANManager::eraseMember(VLANEntry& vlan, common::PortId port_id) {
+    vlan.members.erase(std::remove_if(vlan.members.begin(), vlan.members.end(),
+        [port_id](const VLANMemberEntry& member) {
+            return member.port_id == port_id;
+        }), vlan.members.end());
+    vlan.member_ports.reset(port_id);
+    vlan.untagged_ports.reset(port_id);
+}
+
+bool SAIVLANManager::validateVLANIsolation(uint16_t vlan1_id, uint16_t vlan2_id) {
+    const VLANEntry* vlan1 = findVLAN(vlan1_id);
+    const VLANEntry* vlan2 = findVLAN(vlan2_id);
     
-    // Find intersection
-    std::vector<std::string> overlap;
-    std::set_intersection(vlan1_untagged.begin(), vlan1_untagged.end(),
-                         vlan2_untagged.begin(), vlan2_untagged.end(),
-                         std::back_inserter(overlap));
+    if (!vlan1 || !vlan2) {
+        std::cerr << "One or both VLANs not found" << std::endl;
+        return false;
+    }
     
-    if (!overlap.empty()) {
+    // Check for untagged port overlap (which would break isolation)
+    if (vlan1->untagged_ports.intersects(vlan2->untagged_ports)) {
         std::cerr << "VLAN isolation violation: Ports ";
-        for (const auto& port : overlap) {
-            std::cerr << port << " ";
+        for (common::PortId port_id : vlan1->untagged_ports.intersection(vlan2->untagged_ports)) {
+            std::cerr << common::portNames().name(port_id) << " ";
         }
         std::cerr << "are untagged in both VLANs " << vlan1_id << " and " << vlan2_id << std::endl;
         return false;
@@ -237,20 +644,55 @@ bool SAIVLANManager::validateVLANIsolation(uint16_t vlan1_id, uint16_t vlan2_id)
 
 std::vector<VLANInfo> SAIVLANManager::getAllVLANs() const {
     std::vector<VLANInfo> result;
-    for (const auto& pair : vlans_) {
-        result.push_back(pair.second);
-    }
+    result.reserve(vlan_count_);
+    forEachVLAN([&result](const VLANEntry& entry) {
+        result.push_back(toVLANInfo(entry));
+    });
     return result;
 }
 
 VLANInfo SAIVLANManager::getVLANInfo(uint16_t vlan_id) const {
-    auto it = vlans_.find(vlan_id);
-    if (it != vlans_.end()) {
-        return it->second;
+    const VLANEntry* entry = findVLAN(vlan_id);
+    if (entry) {
+        return toVLANInfo(*entry);
     }
     return VLANInfo{}; // Return empty struct if not found
 }
 
+const VLANEntry* SAIVLANManager::findVLAN(uint16_t vlan_id) const {
+    return isValidVLANId(vlan_id) ? vlan_table_[vlan_id].get() : nullptr;
+}
+
+VLANEntry* SAIVLANManager::lookupVLAN(uint16_t vlan_id) {
+    return isValidVLANId(vlan_id) ? vlan_table_[vlan_id].get() : nullptr;
+}
+
+bool SAIVLANManager::isPortInVLAN(uint16_t vlan_id, const std::string& port_name) const {
+    const VLANEntry* entry = findVLAN(vlan_id);
+    common::PortId port_id = common::INVALID_PORT_ID;
+    return entry && common::portNames().find(port_name, port_id) && entry->hasPort(port_id);
+}
+
+VLANInfo SAIVLANManager::toVLANInfo(const VLANEntry& entry) {
+    VLANInfo info;
+    info.vlan_id = entry.vlan_id;
+    info.vlan_oid = entry.vlan_oid;
+    info.name = entry.name;
+    info.status = entry.status;
+    info.created_at = formatTimestamp(entry.created_at);
+    info.members.reserve(entry.members.size());
+    for (const auto& member : entry.members) {
+        VLANMember expanded;
+        expanded.port_name = common::portNames().name(member.port_id);
+        expanded.port_oid = member.port_oid;
+        expanded.member_oid = memberOidOn(member, member.asic);
+        expanded.tagged = member.tagged;
+        expanded.added_at = formatTimestamp(member.added_at);
+        info.members.push_back(std::move(expanded));
+    }
+    return info;
+}
+
 void SAIVLANManager::printVLANStatus() const {
     std::cout << "\n=== VLAN Status ===" << std::endl;
     std::cout << std::setw(8) << "VLAN ID" 
@@ -259,51 +701,207 @@ void SAIVLANManager::printVLANStatus() const {
               << std::setw(8) << "Members" << std::endl;
     std::cout << std::string(50, '-') << std::endl;
     
-    for (const auto& pair : vlans_) {
-        const auto& vlan = pair.second;
+    forEachVLAN([](const VLANEntry& vlan) {
         std::cout << std::setw(8) << vlan.vlan_id
                   << std::setw(15) << vlan.name
                   << std::setw(10) << (vlan.status == VLANStatus::ACTIVE ? "Active" : "Inactive")
                   << std::setw(8) << vlan.members.size() << std::endl;
         
         for (const auto& member : vlan.members) {
-            std::cout << "    " << member.port_name 
+            std::cout << "    " << common::portNames().name(member.port_id)
                       << " (" << (member.tagged ? "tagged" : "untagged") << ")" << std::endl;
         }
-    }
+    });
 }
 
 sai_object_id_t SAIVLANManager::getPortOID(const std::string& port_name) {
-    // In a real implementation, this would query the port database
-    // For simulation, we'll generate a mock OID based on port name
-    static std::map<std::string, sai_object_id_t> port_oids;
-    
-    if (port_oids.find(port_name) == port_oids.end()) {
-        // Generate a mock OID (in real implementation, this would come from SAI)
-        port_oids[port_name] = 0x1000000000000000ULL + port_oids.size();
+    sai_object_id_t port_oid = common::portRegistry().getOID(port_name);
+    if (port_oid == SAI_NULL_OBJECT_ID && sai_adapter_->isUsingMock()) {
+        // Mock SAI has no port list, so give unknown ports a stable synthetic OID
+        common::PortId port_id = common::portNames().intern(port_name);
+        if (port_id != common::INVALID_PORT_ID) {
+            port_oid = 0x1000000000000000ULL + port_id;
+            common::portRegistry().addPort(port_name, port_oid);
+        }
     }
-    
-    return port_oids[port_name];
+    return port_oid;
 }
 
-std::string SAIVLANManager::getCurrentTimestamp() const {
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    
+size_t SAIVLANManager::portAsic(sai_object_id_t port_oid) const {
+    size_t asics = sai_adapter_->getAsicCount();
+    if (asics <= 1) {
+        return 0;
+    }
+    sai_object_id_t switch_id = sai_switch_id_query(port_oid);
+    for (size_t asic = 0; switch_id != SAI_NULL_OBJECT_ID && asic < asics; ++asic) {
+        if (sai_adapter_->getSwitch(asic)->switch_id == switch_id) {
+            return asic;
+        }
+    }
+    // Mock SAI keeps no port objects, so its ports all sit on the first ASIC
+    return sai_adapter_->isUsingMock() ? 0 : asics;
+}
+
+namespace {
+
+const uint32_t WARM_SNAPSHOT_KIND = common::snapshotTag("VLNM");
+const uint32_t SECTION_VLANS = common::snapshotTag("VLAN");
+
+} // anonymous namespace
+
+bool SAIVLANManager::saveWarmSnapshot() const {
+    if (warm_restart_file_.empty()) {
+        return false;
+    }
+
+    common::SnapshotWriter writer(WARM_SNAPSHOT_KIND, WARM_SNAPSHOT_VERSION);
+    writer.beginSection(SECTION_VLANS);
+    writer.putU32(static_cast<uint32_t>(vlan_count_));
+    writer.putU8(static_cast<uint8_t>(sai_adapter_->getAsicCount()));
+    forEachVLAN([&writer](const VLANEntry& vlan) {
+        writer.putU16(vlan.vlan_id);
+        writer.putU64(vlan.vlan_oid);
+        for (sai_object_id_t oid : vlan.peer_vlan_oids) {
+            writer.putU64(oid);
+        }
+        writer.putString(vlan.name);
+        writer.putU8(static_cast<uint8_t>(vlan.status));
+        writer.putU64(static_cast<uint64_t>(vlan.created_at));
+        writer.putU32(static_cast<uint32_t>(vlan.members.size()));
+        for (const auto& member : vlan.members) {
+            // Port IDs are per process; the name rebinds the member on restore
+            writer.putString(common::portNames().name(member.port_id));
+            writer.putU64(member.port_oid);
+            writer.putU64(member.member_oid);
+            for (sai_object_id_t oid : member.peer_member_oids) {
+                writer.putU64(oid);
+            }
+            writer.putU8(member.tagged ? 1 : 0);
+            writer.putU64(static_cast<uint64_t>(member.added_at));
+        }
+    });
+    writer.endSection();
+
+    if (!writer.writeFile(warm_restart_file_)) {
+        return false;
+    }
+    std::cout << "Saved " << vlan_count_ << " VLANs to " << warm_restart_file_ << std::endl;
+    return true;
+}
+
+bool SAIVLANManager::restoreWarmSnapshot() {
+    if (!initialized_ || vlan_count_ > 0) {
+        return false;
+    }
+    common::SnapshotReader reader;
+    common::SnapshotCursor cursor;
+    if (warm_restart_file_.empty() || !reader.open(warm_restart_file_, WARM_SNAPSHOT_KIND, WARM_SNAPSHOT_VERSION) ||
+        !reader.section(SECTION_VLANS, cursor)) {
+        return false;
+    }
+
+    std::vector<std::unique_ptr<VLANEntry>> table(MAX_VLAN_ID + 1);
+    size_t count = 0;
+    uint32_t vlan_count = 0;
+    uint8_t asics = 0;
+    bool valid = cursor.getU32(vlan_count) && cursor.getU8(asics) && asics == sai_adapter_->getAsicCount();
+    std::vector<sai_object_id_t> oids(asics);
+
+    // Every per-ASIC copy must still exist for the snapshot to be trusted; a
+    // member has a copy only on its port's ASIC, so null slots are allowed for it
+    auto readOids = [&cursor, &oids](sai_object_type_t type, bool sparse) {
+        bool present = true;
+        size_t copies = 0;
+        for (auto& oid : oids) {
+            uint64_t value = 0;
+            cursor.getU64(value);
+            oid = value;
+            if (sparse && oid == SAI_NULL_OBJECT_ID) {
+                continue;
+            }
+            present = present && sai_object_type_query(oid) == type;
+            copies++;
+        }
+        return present && copies > 0;
+    };
+    for (uint32_t i = 0; i < vlan_count && valid; ++i) {
+        std::unique_ptr<VLANEntry> vlan(new VLANEntry());
+        uint8_t status = 0;
+        uint64_t created_at = 0;
+        uint32_t member_count = 0;
+        cursor.getU16(vlan->vlan_id);
+        bool present = readOids(SAI_OBJECT_TYPE_VLAN, false);
+        vlan->vlan_oid = oids[0];
+        vlan->peer_vlan_oids.assign(oids.begin() + 1, oids.end());
+        cursor.getString(vlan->name);
+        cursor.getU8(status);
+        cursor.getU64(created_at);
+        cursor.getU32(member_count);
+        vlan->status = static_cast<VLANStatus>(status);
+        vlan->created_at = static_cast<std::time_t>(created_at);
+        valid = cursor.ok() && isValidVLANId(vlan->vlan_id) && !table[vlan->vlan_id] && present;
+
+        for (uint32_t j = 0; j < member_count && valid; ++j) {
+            std::string port_name;
+            uint64_t port_oid = 0;
+            uint8_t tagged = 0;
+            uint64_t added_at = 0;
+            cursor.getString(port_name);
+            cursor.getU64(port_oid);
+            bool member_present = readOids(SAI_OBJECT_TYPE_VLAN_MEMBER, true);
+            cursor.getU8(tagged);
+            cursor.getU64(added_at);
+
+            // A port the registry lost is registered again under its saved OID
+            uint64_t current_oid = common::portRegistry().getOID(port_name);
+            valid = cursor.ok() && (current_oid == 0 || current_oid == port_oid) && member_present &&
+                    (current_oid != 0 || common::portRegistry().addPort(port_name, port_oid));
+            common::PortId port_id = valid ? common::portRegistry().findPort(port_name) : common::INVALID_PORT_ID;
+            valid = valid && port_id != common::INVALID_PORT_ID;
+            if (valid) {
+                recordMember(*vlan, port_id, port_oid, oids, tagged != 0, static_cast<std::time_t>(added_at));
+            }
+        }
+        if (valid) {
+            table[vlan->vlan_id] = std::move(vlan);
+            count++;
+        }
+    }
+
+    if (!valid) {
+        std::cerr << "VLAN snapshot " << warm_restart_file_ << " does not match SAI, starting cold" << std::endl;
+        return false;
+    }
+    vlan_table_ = std::move(table);
+    vlan_count_ = count;
+    std::cout << "Restored " << count << " VLANs from " << warm_restart_file_ << std::endl;
+    return true;
+}
+
+std::string SAIVLANManager::formatTimestamp(std::time_t timestamp) {
     std::stringstream ss;
-    ss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
+    ss << std::put_time(std::localtime(&timestamp), "%Y-%m-%d %H:%M:%S");
     return ss.str();
 }
 
 void SAIVLANManager::cleanup() {
     if (initialized_) {
+        // Keep the VLANs programmed across a warm restart
+        if (!warm_restart_file_.empty() && saveWarmSnapshot()) {
+            vlan_table_.clear();
+            vlan_table_.resize(MAX_VLAN_ID + 1);
+            vlan_count_ = 0;
+        }
+        
         // Clean up all VLANs
-        for (auto& pair : vlans_) {
-            deleteVLAN(pair.first);
+        for (uint16_t vlan_id = 1; vlan_id <= MAX_VLAN_ID; ++vlan_id) {
+            if (vlan_table_[vlan_id]) {
+                deleteVLAN(vlan_id);
+            }
         }
         
         // Uninitialize SAI
-        sai_api_uninitialize();
+        sai_adapter_->uninitialize();
         initialized_ = false;
         std::cout << "SAI VLAN Manager cleaned up" << std::endl;
     }
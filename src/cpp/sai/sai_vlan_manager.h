@@ -11,8 +11,11 @@
 #include <string>
 #include <vector>
 #include <map>
-#include <set>
 #include <memory>
+#include <functional>
+#include <ctime>
+#include "../common/port_bitmap.h"
+#include "../common/string_interner.h"
 
 // Real SAI headers
 extern "C" {
@@ -27,6 +30,7 @@ extern "C" {
 namespace sonic {
 namespace sai {
 class SAIAdapter;
+struct SAISwitchContext;
 }
 }
 
@@ -68,11 +72,68 @@ struct VLANInfo {
     VLANInfo() : vlan_id(0), vlan_oid(SAI_NULL_OBJECT_ID), status(VLANStatus::INACTIVE) {}
 };
 
+/**
+ * @brief Compact member record stored in the VLAN table
+ */
+struct VLANMemberEntry {
+    common::PortId port_id;
+    sai_object_id_t port_oid;
+    sai_object_id_t member_oid;
+    bool tagged;
+    std::time_t added_at;
+    std::vector<sai_object_id_t> peer_member_oids;     ///< ASIC 1..N-1; empty on a single ASIC
+    size_t asic;                                       ///< ASIC owning the port, the only one with a member OID
+};
+
+/**
+ * @brief One slot of the direct-indexed VLAN table
+ *
+ * member_ports and untagged_ports are keyed by common::PortId, so membership
+ * checks and isolation checks never touch port name strings.
+ */
+struct VLANEntry {
+    uint16_t vlan_id;
+    sai_object_id_t vlan_oid;
+    std::string name;
+    VLANStatus status;
+    std::time_t created_at;
+    std::vector<VLANMemberEntry> members;
+    common::PortBitmap member_ports;
+    common::PortBitmap untagged_ports;
+    std::vector<sai_object_id_t> peer_vlan_oids;       ///< ASIC 1..N-1; empty on a single ASIC
+
+    VLANEntry() : vlan_id(0), vlan_oid(SAI_NULL_OBJECT_ID), status(VLANStatus::INACTIVE), created_at(0) {}
+
+    bool hasPort(common::PortId port_id) const { return member_ports.test(port_id); }
+};
+
+/**
+ * @brief One entry of a createVLANs() batch
+ */
+struct VLANCreateRequest {
+    uint16_t vlan_id;
+    std::string name;
+};
+
+/**
+ * @brief One entry of an addPortsToVLANs()/removePortsFromVLANs() batch
+ */
+struct VLANMemberRequest {
+    uint16_t vlan_id;
+    std::string port_name;
+    bool tagged;
+};
+
 /**
  * @brief SAI VLAN Manager class
  * 
  * This class provides a C++ interface for managing VLANs using the SAI API.
  * It handles VLAN creation, deletion, port membership, and validation.
+ *
+ * On a multi-ASIC adapter every VLAN and member is programmed on all ASICs
+ * in parallel. An operation succeeds only if it succeeds everywhere: a
+ * create that fails on one ASIC is undone on the others, and a remove that
+ * fails on one ASIC keeps the entry so a retry removes what is left.
  */
 class SAIVLANManager {
 public:
@@ -117,6 +178,29 @@ public:
      * @return true if successful, false otherwise
      */
     bool removePortFromVLAN(uint16_t vlan_id, const std::string& port_name);
+
+    /**
+     * @brief Create many VLANs in one pass
+     * @param requests VLANs to create
+     * @return One SAI status per request, in request order
+     */
+    std::vector<sai_status_t> createVLANs(const std::vector<VLANCreateRequest>& requests);
+
+    /**
+     * @brief Add many ports to VLANs using the SAI bulk create_vlan_members call
+     *
+     * Falls back to per-member calls when the SAI implementation has no bulk support.
+     * @param requests Memberships to create
+     * @return One SAI status per request, in request order
+     */
+    std::vector<sai_status_t> addPortsToVLANs(const std::vector<VLANMemberRequest>& requests);
+
+    /**
+     * @brief Remove many VLAN members using the SAI bulk remove_vlan_members call
+     * @param requests Memberships to remove (tagged is ignored)
+     * @return One SAI status per request, in request order
+     */
+    std::vector<sai_status_t> removePortsFromVLANs(const std::vector<VLANMemberRequest>& requests);
     
     /**
      * @brief Validate VLAN isolation between two VLANs
@@ -128,16 +212,44 @@ public:
     
     /**
      * @brief Get all VLANs
-     * @return Vector of all VLAN information
+     * @return Copy of every VLAN, with member names and timestamps expanded
      */
     std::vector<VLANInfo> getAllVLANs() const;
     
     /**
      * @brief Get specific VLAN information
      * @param vlan_id VLAN ID to query
-     * @return VLAN information structure
+     * @return Copy of the VLAN, or an empty structure if it does not exist
      */
     VLANInfo getVLANInfo(uint16_t vlan_id) const;
+
+    /**
+     * @brief Read-only access to a VLAN table slot without copying
+     * @return nullptr if the VLAN does not exist; valid until the VLAN is deleted
+     */
+    const VLANEntry* findVLAN(uint16_t vlan_id) const;
+
+    /**
+     * @brief Visit every VLAN in ascending VLAN ID order without copying
+     */
+    template <typename Fn>
+    void forEachVLAN(Fn&& fn) const {
+        for (const auto& entry : vlan_table_) {
+            if (entry) {
+                fn(*entry);
+            }
+        }
+    }
+
+    /**
+     * @brief O(1) membership check
+     */
+    bool isPortInVLAN(uint16_t vlan_id, const std::string& port_name) const;
+
+    /**
+     * @brief Number of VLANs currently configured
+     */
+    size_t getVLANCount() const { return vlan_count_; }
     
     /**
      * @brief Print VLAN status to console
@@ -150,32 +262,139 @@ public:
      */
     bool isInitialized() const { return initialized_; }
 
+    /**
+     * @brief Enable warm restart: on destruction the VLANs are saved to path and left in SAI
+     */
+    void setWarmRestartFile(const std::string& path) { warm_restart_file_ = path; }
+
+    /**
+     * @brief Write the VLAN table to the warm-restart file
+     * @return true if successful, false otherwise
+     */
+    bool saveWarmSnapshot() const;
+
+    /**
+     * @brief Load the VLAN table written by saveWarmSnapshot() instead of recreating it
+     *
+     * Only done while no VLAN exists, and only if every VLAN and member
+     * object in the file still exists in SAI, on the same number of ASICs.
+     * @return true if VLANs were restored
+     */
+    bool restoreWarmSnapshot();
+
 private:
     
     /**
-     * @brief Get port OID from port name
+     * @brief Get port OID from the shared port registry
+     *
+     * Under mock SAI an unknown port is registered with a synthetic OID; that
+     * is the only path here that interns a port name.
      * @param port_name Port name
-     * @return SAI object ID for the port
+     * @return SAI object ID for the port, SAI_NULL_OBJECT_ID if unknown
      */
     sai_object_id_t getPortOID(const std::string& port_name);
+
+    /**
+     * @brief ASIC that owns a port, found from the switch its OID belongs to
+     * @return ASIC index, getAsicCount() when no ASIC owns the port
+     */
+    size_t portAsic(sai_object_id_t port_oid) const;
     
     /**
-     * @brief Get current timestamp as string
+     * @brief Format a stored timestamp as string
      * @return Formatted timestamp string
      */
-    std::string getCurrentTimestamp() const;
+    static std::string formatTimestamp(std::time_t timestamp);
+
+    static bool isValidVLANId(uint16_t vlan_id) { return vlan_id >= 1 && vlan_id <= MAX_VLAN_ID; }
+
+    VLANEntry* lookupVLAN(uint16_t vlan_id);
+
+    /**
+     * @brief Expand a table slot into the string-based VLANInfo
+     */
+    static VLANInfo toVLANInfo(const VLANEntry& entry);
+
+    /**
+     * @brief Record a created member in the VLAN table
+     */
+    void recordMember(VLANEntry& vlan, common::PortId port_id, sai_object_id_t port_oid,
+                      const std::vector<sai_object_id_t>& member_oids, bool tagged, std::time_t timestamp);
+
+    /**
+     * @brief Drop a member from the VLAN table after SAI removed it
+     */
+    void eraseMember(VLANEntry& vlan, common::PortId port_id);
+
+    /// Removes one object on one ASIC; a null OID counts as already removed
+    using RemoveFn = sai_status_t (*)(const SAISwitchContext& asic, sai_object_id_t oid);
+
+    static sai_status_t removeVLANOn(const SAISwitchContext& asic, sai_object_id_t oid);
+    static sai_status_t removeMemberOn(const SAISwitchContext& asic, sai_object_id_t oid);
+
+    /**
+     * @brief Run one SAI call on every ASIC in parallel
+     * @return Status per ASIC
+     */
+    std::vector<sai_status_t> onAllAsics(const std::function<sai_status_t(const SAISwitchContext&)>& call);
+
+    /**
+     * @brief Settle an object created on every ASIC
+     *
+     * If any ASIC failed, the copies created on the others are removed again.
+     * @return SAI_STATUS_SUCCESS, or the first failing ASIC's status
+     */
+    sai_status_t settleCreate(const std::vector<sai_status_t>& statuses, const std::vector<sai_object_id_t>& oids,
+                              RemoveFn remove);
+
+    /**
+     * @brief Settle an object removed on every ASIC
+     * @param oids Per ASIC; those removed are cleared so a retry skips them
+     * @return SAI_STATUS_SUCCESS, or the first failing ASIC's status
+     */
+    static sai_status_t settleRemove(const std::vector<sai_status_t>& statuses, std::vector<sai_object_id_t>& oids);
+
+    /**
+     * @brief Create VLAN members on one ASIC, in bulk where supported
+     * @param attr_lists Three attributes per member
+     */
+    static size_t createMembersOn(const SAISwitchContext& asic, std::vector<const sai_attribute_t*>& attr_lists,
+                                  std::vector<sai_object_id_t>& member_oids, std::vector<sai_status_t>& statuses);
+
+    /**
+     * @brief Remove VLAN members on one ASIC, in bulk where supported
+     */
+    static void removeMembersOn(const SAISwitchContext& asic, const std::vector<sai_object_id_t>& member_oids,
+                                std::vector<sai_status_t>& statuses);
+
+    static sai_object_id_t vlanOidOn(const VLANEntry& vlan, size_t asic) {
+        return asic == 0 ? vlan.vlan_oid : vlan.peer_vlan_oids[asic - 1];
+    }
+    static sai_object_id_t memberOidOn(const VLANMemberEntry& member, size_t asic) {
+        return asic == 0 ? member.member_oid : member.peer_member_oids[asic - 1];
+    }
+
+    static constexpr uint16_t MAX_VLAN_ID = 4094;
+
+    /// Upper bound on objects per SAI bulk call
+    static constexpr size_t BULK_CHUNK_SIZE = 512;
     
     /**
      * @brief Cleanup resources
      */
     void cleanup();
     
+    /// Bump when the warm-restart snapshot layout changes
+    static constexpr uint32_t WARM_SNAPSHOT_VERSION = 2;
+    
     // Member variables
     bool initialized_;
     SAIAdapter* sai_adapter_;
+    std::string warm_restart_file_;
 
-    // VLAN storage
-    std::map<uint16_t, VLANInfo> vlans_;
+    // VLAN storage, indexed directly by VLAN ID (slot 0 is never used)
+    std::vector<std::unique_ptr<VLANEntry>> vlan_table_;
+    size_t vlan_count_;
     
     // Disable copy constructor and assignment operator
     SAIVLANManager(const SAIVLANManager&) = delete;
@@ -1,148 +1,245 @@
 #include "sonic_sai_controller.h"
+#include "../common/redis_client.h"
+#include "../common/logger.h"
+#include "../common/metrics.h"
+#include "../common/redis_table_watcher.h"
+#include "../common/string_interner.h"
+#include "../common/cli_executor.h"
+#include "../interrupts/sonic_interrupt_controller.h"
 #include <iostream>
 #include <sstream>
 #include <cstdlib>
 #include <algorithm>
+#include <chrono>
 #include <regex>
 #include <iomanip>
 
 namespace sonic {
 namespace sai {
 
+namespace {
+
+constexpr int APPL_DB = 0;
+constexpr int CONFIG_DB = 4;
+
+// Order matches the table list handed to the watcher
+enum CacheTable : size_t {
+    PORT_CONFIG,
+    PORT_STATE,
+    VLAN_CONFIG,
+    VLAN_MEMBER_CONFIG,
+    FDB_STATE,
+    STATIC_ROUTE_CONFIG,
+    ACL_RULE_CONFIG
+};
+
+const std::vector<common::WatchedTable> CACHE_TABLES = {
+    {CONFIG_DB, "PORT|"},
+    {APPL_DB, "PORT_TABLE:"},
+    {CONFIG_DB, "VLAN|"},
+    {CONFIG_DB, "VLAN_MEMBER|"},
+    {APPL_DB, "FDB_TABLE:"},
+    {CONFIG_DB, "STATIC_ROUTE|"},
+    {CONFIG_DB, "ACL_RULE|"}
+};
+
+uint32_t parseUint32(const std::map<std::string, std::string>& fields, const std::string& field,
+                     uint32_t default_value) {
+    auto it = fields.find(field);
+    if (it == fields.end() || it->second.empty()) {
+        return default_value;
+    }
+    try {
+        return static_cast<uint32_t>(std::stoul(it->second));
+    } catch (const std::exception&) {
+        return default_value;
+    }
+}
+
+std::string fieldOr(const std::map<std::string, std::string>& fields, const std::string& field,
+                    const std::string& default_value = "") {
+    auto it = fields.find(field);
+    return it != fields.end() ? it->second : default_value;
+}
+
+// "Vlan100" -> 100, 0 when malformed
+uint16_t parseVLANName(const std::string& name) {
+    if (name.compare(0, 4, "Vlan") != 0) {
+        return 0;
+    }
+    try {
+        unsigned long vlan_id = std::stoul(name.substr(4));
+        return vlan_id <= 4094 ? static_cast<uint16_t>(vlan_id) : 0;
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+// FdbRecord flag: the APPL_DB key spells the MAC with '-' rather than ':'
+constexpr uint8_t FDB_KEY_DASHES = 0x1;
+
+std::string fdbKey(const common::FdbRecord& record) {
+    return "FDB_TABLE:Vlan" + std::to_string(record.vlan_id) + ":" +
+           common::FdbTable::formatMac(record.mac, (record.flags & FDB_KEY_DASHES) ? '-' : ':');
+}
+
+void eraseValue(std::vector<std::string>& values, const std::string& value) {
+    values.erase(std::remove(values.begin(), values.end(), value), values.end());
+}
+
+} // anonymous namespace
+
 SONiCSAIController::SONiCSAIController() 
-    : m_initialized(false), m_sonic_container_name("sonic-vs-official"), m_next_object_id(1000) {
+    : m_initialized(false), m_sonic_container_name("sonic-vs-official"), m_counter_poll_interval_ms(1000),
+      m_sync_running(false), m_link_events_live(false), m_next_object_id(1000) {
+    m_redis.reset(new common::RedisClient(
+        common::RedisConfig::fromEnvironment(m_sonic_container_name, m_sonic_container_name)));
+    m_counter_poller.reset(new CounterPoller(*m_redis));
+    m_lag_manager.reset(new LAGManager(*m_redis));
+    m_watcher.reset(new common::RedisTableWatcher(m_redis->config(), CACHE_TABLES));
 }
 
 SONiCSAIController::~SONiCSAIController() {
     cleanup();
+    stopCacheSync();
+    m_counter_poller->stop();
 }
 
 bool SONiCSAIController::initialize() {
-    std::cout << "[SAI] Initializing SONiC SAI Controller..." << std::endl;
+    SONIC_LOG_INFO("SAI", "Initializing SONiC SAI Controller...");
     
     // Test connection to SONiC container
     std::string output;
     if (!executeSONiCCommand("echo 'SAI_TEST'", output)) {
-        std::cerr << "[SAI] Failed to connect to SONiC container" << std::endl;
+        SONIC_LOG_ERROR("SAI", "Failed to connect to SONiC container");
         return false;
     }
     
-    // Initialize caches
-    if (!refreshPortCache()) {
-        std::cerr << "[SAI] Failed to initialize port cache" << std::endl;
-        return false;
+    // Subscribe before the warm load so no change falls between the two
+    if (!m_watcher->subscribe()) {
+        SONIC_LOG_WARN("SAI", "CONFIG_DB notifications unavailable, cache sync will keep retrying");
     }
-    
-    if (!refreshVLANCache()) {
-        std::cerr << "[SAI] Failed to initialize VLAN cache" << std::endl;
-        return false;
+
+    // The caches load on the sync thread; callers that need them wait on m_ready
+    if (!m_sync_running.load()) {
+        m_ready_promise = std::promise<bool>();
+        m_ready = m_ready_promise.get_future().share();
+        std::lock_guard<std::mutex> lock(m_link_event_mutex);
+        m_link_events_live = false;
     }
-    
     m_initialized = true;
-    std::cout << "[SAI] SONiC SAI Controller initialized successfully" << std::endl;
-    std::cout << "[SAI] Found " << m_port_cache.size() << " ports" << std::endl;
-    std::cout << "[SAI] Found " << m_vlan_cache.size() << " VLANs" << std::endl;
-    
+    startCacheSync();
+    m_counter_poller->start(m_counter_poll_interval_ms);
+    SONIC_LOG_INFO("SAI", "SONiC SAI Controller initialized, caches loading in background");
+
     return true;
 }
 
+bool SONiCSAIController::waitUntilReady(int timeout_ms) {
+    if (!m_ready.valid()) {
+        return false;
+    }
+    if (timeout_ms < 0) {
+        m_ready.wait();
+    } else if (m_ready.wait_for(std::chrono::milliseconds(timeout_ms)) != std::future_status::ready) {
+        return false;
+    }
+    return m_ready.get();
+}
+
+bool SONiCSAIController::isReady() const {
+    return m_ready.valid() && m_ready.wait_for(std::chrono::seconds(0)) == std::future_status::ready && m_ready.get();
+}
+
+std::unique_lock<std::mutex> SONiCSAIController::lockCaches() {
+    // Before initialize() there is nothing to wait for; the caches are simply empty
+    if (m_ready.valid() && m_ready.wait_for(std::chrono::seconds(0)) != std::future_status::ready &&
+        !waitUntilReady(CACHE_READY_TIMEOUT_MS)) {
+        SONIC_LOG_WARN("SAI", "Cache load not complete after " << CACHE_READY_TIMEOUT_MS << " ms, serving partial state");
+    }
+    return std::unique_lock<std::mutex>(m_cache_mutex);
+}
+
 void SONiCSAIController::cleanup() {
     if (m_initialized) {
-        std::cout << "[SAI] Cleaning up SONiC SAI Controller..." << std::endl;
+        SONIC_LOG_INFO("SAI", "Cleaning up SONiC SAI Controller...");
+        stopCacheSync();
+        m_counter_poller->stop();
         m_initialized = false;
     }
 }
 
 bool SONiCSAIController::executeSONiCCommand(const std::string& command, std::string& output) {
+    SONIC_SCOPED_TIMER("sonic_sai_container_command_seconds", "Time to run a command in the SONiC container");
     // Use a simpler approach without bash -c to avoid escaping issues
     std::string full_command = "docker exec " + m_sonic_container_name + " " + command;
 
-    FILE* pipe = popen(full_command.c_str(), "r");
-    if (!pipe) {
-        std::cerr << "[SAI] Failed to execute: " << full_command << std::endl;
-        return false;
-    }
-
-    char buffer[256];
-    output.clear();
-    while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
-        output += buffer;
+    bool read_only = common::CliExecutor::isReadOnlyCommand(command);
+    common::CliResult result = common::CliExecutor::shared().run(full_command, read_only);
+    output = result.output;
+    if (!result.ok) {
+        SONIC_LOG_ERROR("SAI", "Command failed: " << full_command << " (exit code: " << result.exit_status << ")");
+    } else if (!read_only) {
+        common::CliExecutor::shared().invalidate();
     }
-
-    int result = pclose(pipe);
-    if (result != 0) {
-        std::cerr << "[SAI] Command failed: " << full_command << " (exit code: " << result << ")" << std::endl;
-    }
-    return (result == 0);
+    return result.ok;
 }
 
 bool SONiCSAIController::executeRedisCommand(const std::string& command, int db_id, std::string& output) {
-    std::stringstream ss;
-    ss << "redis-cli -n " << db_id << " " << command;
-    std::string redis_command = ss.str();
+    SONIC_SCOPED_TIMER("sonic_sai_redis_command_seconds", "Time to run a Redis command line");
 
     // Debug output
-    std::cout << "[SAI] Executing Redis command: " << redis_command << std::endl;
+    SONIC_LOG_INFO("SAI", "Executing Redis command (db " << db_id << "): " << command);
 
-    return executeSONiCCommand(redis_command, output);
+    bool result = m_redis->commandLine(db_id, command, output);
+    if (!result) {
+        SONIC_LOG_ERROR("SAI", "Redis command failed: " << command);
+        SONIC_COUNTER_INC("sonic_sai_redis_command_failures_total", "Redis command lines that failed");
+    }
+    return result;
 }
 
 bool SONiCSAIController::setRedisValue(const std::string& key, const std::string& value, int db_id) {
-    std::string output;
-    std::stringstream ss;
-    ss << "SET '" << key << "' '" << value << "'";
-    return executeRedisCommand(ss.str(), db_id, output);
+    return m_redis->set(db_id, key, value);
 }
 
 std::string SONiCSAIController::getRedisValue(const std::string& key, int db_id) {
-    std::string output;
-    std::stringstream ss;
-    ss << "GET '" << key << "'";
-    if (executeRedisCommand(ss.str(), db_id, output)) {
-        if (!output.empty() && output.back() == '\n') {
-            output.pop_back();
-        }
-        return output;
-    }
-    return "";
+    std::string value;
+    m_redis->get(db_id, key, value);
+    return value;
 }
 
 bool SONiCSAIController::setRedisHashField(const std::string& key, const std::string& field, const std::string& value, int db_id) {
-    std::string output;
-    std::stringstream ss;
-    ss << "HSET \"" << key << "\" \"" << field << "\" \"" << value << "\"";
-    return executeRedisCommand(ss.str(), db_id, output);
+    return m_redis->hset(db_id, key, field, value);
 }
 
 std::string SONiCSAIController::getRedisHashField(const std::string& key, const std::string& field, int db_id) {
-    std::string output;
-    std::stringstream ss;
-    ss << "HGET \"" << key << "\" \"" << field << "\"";
-    if (executeRedisCommand(ss.str(), db_id, output)) {
-        if (!output.empty() && output.back() == '\n') {
-            output.pop_back();
-        }
-        return output;
-    }
-    return "";
+    std::string value;
+    m_redis->hget(db_id, key, field, value);
+    return value;
 }
 
 // VLAN Management Implementation
 bool SONiCSAIController::createVLAN(uint16_t vlan_id, const std::string& name) {
-    std::cout << "[SAI] Creating VLAN " << vlan_id;
+    SONIC_LOG_INFO("SAI", "Creating VLAN " << vlan_id);
     if (!name.empty()) {
         std::cout << " with name '" << name << "'";
     }
     std::cout << std::endl;
     
     if (!validateVLANID(vlan_id)) {
-        std::cerr << "[SAI] Invalid VLAN ID: " << vlan_id << std::endl;
+        SONIC_LOG_ERROR("SAI", "Invalid VLAN ID: " << vlan_id);
         return false;
     }
     
     // Check if VLAN already exists and delete it first (for test cleanup)
-    if (m_vlan_cache.find(vlan_id) != m_vlan_cache.end()) {
-        std::cout << "[SAI] VLAN " << vlan_id << " already exists, deleting first..." << std::endl;
+    bool exists;
+    {
+        auto lock = lockCaches();
+        exists = m_vlan_cache.find(vlan_id) != m_vlan_cache.end();
+    }
+    if (exists) {
+        SONIC_LOG_INFO("SAI", "VLAN " << vlan_id << " already exists, deleting first...");
         deleteVLAN(vlan_id, true); // Silent deletion
     }
     
@@ -161,16 +258,16 @@ bool SONiCSAIController::createVLAN(uint16_t vlan_id, const std::string& name) {
         }
         
         // Update cache
-        VLANInfo vlan_info;
+        auto lock = lockCaches();
+        VLANInfo& vlan_info = m_vlan_cache[vlan_id];
         vlan_info.vlan_id = vlan_id;
         vlan_info.name = name.empty() ? ("Vlan" + std::to_string(vlan_id)) : name;
         vlan_info.is_active = true;
         vlan_info.description = name;
-        m_vlan_cache[vlan_id] = vlan_info;
         
-        std::cout << "[SAI] VLAN " << vlan_id << " created successfully" << std::endl;
+        SONIC_LOG_INFO("SAI", "VLAN " << vlan_id << " created successfully");
     } else {
-        std::cerr << "[SAI] Failed to create VLAN " << vlan_id << ": " << output << std::endl;
+        SONIC_LOG_ERROR("SAI", "Failed to create VLAN " << vlan_id << ": " << output);
     }
     
     return result;
@@ -182,50 +279,52 @@ bool SONiCSAIController::deleteVLAN(uint16_t vlan_id) {
 
 bool SONiCSAIController::deleteVLAN(uint16_t vlan_id, bool silent) {
     if (!silent) {
-        std::cout << "[SAI] Deleting VLAN " << vlan_id << std::endl;
+        SONIC_LOG_INFO("SAI", "Deleting VLAN " << vlan_id);
     }
 
     if (!validateVLANID(vlan_id)) {
         if (!silent) {
-            std::cerr << "[SAI] Invalid VLAN ID: " << vlan_id << std::endl;
+            SONIC_LOG_ERROR("SAI", "Invalid VLAN ID: " << vlan_id);
         }
         return false;
     }
 
-    // Check if VLAN exists
-    if (m_vlan_cache.find(vlan_id) == m_vlan_cache.end()) {
-        if (!silent) {
-            std::cerr << "[SAI] VLAN " << vlan_id << " does not exist" << std::endl;
+    // Check if VLAN exists; copy the members since removal edits the cache
+    std::vector<std::string> member_ports;
+    {
+        auto lock = lockCaches();
+        auto it = m_vlan_cache.find(vlan_id);
+        if (it == m_vlan_cache.end()) {
+            if (!silent) {
+                SONIC_LOG_ERROR("SAI", "VLAN " << vlan_id << " does not exist");
+            }
+            return false;
         }
-        return false;
+        member_ports = it->second.member_ports;
     }
 
     // Remove all ports from VLAN first
-    VLANInfo& vlan_info = m_vlan_cache[vlan_id];
-    for (const auto& port : vlan_info.member_ports) {
-        removePortFromVLAN(vlan_id, port);
+    std::string output;
+    for (const auto& port : member_ports) {
+        std::string member_command = "config vlan member del " + std::to_string(vlan_id) + " " + port;
+        if (!executeSONiCCommand(member_command, output) && !silent) {
+            SONIC_LOG_WARN("SAI", "Failed to remove " << port << " from VLAN " << vlan_id << ": " << output);
+        }
     }
 
     // Delete VLAN using SONiC config command
     std::string command = "config vlan del " + std::to_string(vlan_id);
-    std::string output;
     bool result = executeSONiCCommand(command, output);
 
     if (result) {
-        // Remove from CONFIG_DB
-        std::string vlan_key = "VLAN|Vlan" + std::to_string(vlan_id);
-        std::string del_command = "DEL '" + vlan_key + "'";
-        executeRedisCommand(del_command, 4, output);
-
-        // Update cache
-        m_vlan_cache.erase(vlan_id);
-
-        if (!silent) {
-            std::cout << "[SAI] VLAN " << vlan_id << " deleted successfully" << std::endl;
+        // Member keys and the VLAN key leave CONFIG_DB in one MULTI/EXEC, cache included
+        result = commitTransaction(ConfigTransaction().deleteVLAN(vlan_id));
+        if (result && !silent) {
+            SONIC_LOG_INFO("SAI", "VLAN " << vlan_id << " deleted successfully");
         }
     } else {
         if (!silent) {
-            std::cerr << "[SAI] Failed to delete VLAN " << vlan_id << ": " << output << std::endl;
+            SONIC_LOG_ERROR("SAI", "Failed to delete VLAN " << vlan_id << ": " << output);
         }
     }
 
@@ -233,18 +332,21 @@ bool SONiCSAIController::deleteVLAN(uint16_t vlan_id, bool silent) {
 }
 
 bool SONiCSAIController::addPortToVLAN(uint16_t vlan_id, const std::string& port_name, bool tagged) {
-    std::cout << "[SAI] Adding port " << port_name << " to VLAN " << vlan_id 
-              << " (" << (tagged ? "tagged" : "untagged") << ")" << std::endl;
+    SONIC_LOG_INFO("SAI", "Adding port " << port_name << " to VLAN " << vlan_id
+                   << " (" << (tagged ? "tagged" : "untagged") << ")");
     
     if (!validateVLANID(vlan_id) || !validatePortName(port_name)) {
-        std::cerr << "[SAI] Invalid VLAN ID or port name" << std::endl;
+        SONIC_LOG_ERROR("SAI", "Invalid VLAN ID or port name");
         return false;
     }
     
     // Check if VLAN exists
-    if (m_vlan_cache.find(vlan_id) == m_vlan_cache.end()) {
-        std::cerr << "[SAI] VLAN " << vlan_id << " does not exist" << std::endl;
-        return false;
+    {
+        auto lock = lockCaches();
+        if (m_vlan_cache.find(vlan_id) == m_vlan_cache.end()) {
+            SONIC_LOG_ERROR("SAI", "VLAN " << vlan_id << " does not exist");
+            return false;
+        }
     }
     
     // Add port to VLAN using SONiC config command
@@ -263,32 +365,22 @@ bool SONiCSAIController::addPortToVLAN(uint16_t vlan_id, const std::string& port
         setRedisHashField(member_key, "tagging_mode", tagged ? "tagged" : "untagged", 4);
         
         // Update cache
-        VLANInfo& vlan_info = m_vlan_cache[vlan_id];
-        vlan_info.member_ports.push_back(port_name);
-        if (tagged) {
-            vlan_info.tagged_ports.push_back(port_name);
-        } else {
-            vlan_info.untagged_ports.push_back(port_name);
-        }
-        
-        // Update port cache
-        if (m_port_cache.find(port_name) != m_port_cache.end()) {
-            m_port_cache[port_name].vlan_memberships.push_back(vlan_id);
-        }
+        auto lock = lockCaches();
+        setVLANMembershipUnsafe(vlan_id, port_name, true, tagged);
         
-        std::cout << "[SAI] Port " << port_name << " added to VLAN " << vlan_id << " successfully" << std::endl;
+        SONIC_LOG_INFO("SAI", "Port " << port_name << " added to VLAN " << vlan_id << " successfully");
     } else {
-        std::cerr << "[SAI] Failed to add port " << port_name << " to VLAN " << vlan_id << ": " << output << std::endl;
+        SONIC_LOG_ERROR("SAI", "Failed to add port " << port_name << " to VLAN " << vlan_id << ": " << output);
     }
     
     return result;
 }
 
 bool SONiCSAIController::removePortFromVLAN(uint16_t vlan_id, const std::string& port_name) {
-    std::cout << "[SAI] Removing port " << port_name << " from VLAN " << vlan_id << std::endl;
+    SONIC_LOG_INFO("SAI", "Removing port " << port_name << " from VLAN " << vlan_id);
     
     if (!validateVLANID(vlan_id) || !validatePortName(port_name)) {
-        std::cerr << "[SAI] Invalid VLAN ID or port name" << std::endl;
+        SONIC_LOG_ERROR("SAI", "Invalid VLAN ID or port name");
         return false;
     }
     
@@ -304,34 +396,19 @@ bool SONiCSAIController::removePortFromVLAN(uint16_t vlan_id, const std::string&
         executeRedisCommand(del_command, 4, output);
         
         // Update cache
-        if (m_vlan_cache.find(vlan_id) != m_vlan_cache.end()) {
-            VLANInfo& vlan_info = m_vlan_cache[vlan_id];
-            vlan_info.member_ports.erase(
-                std::remove(vlan_info.member_ports.begin(), vlan_info.member_ports.end(), port_name),
-                vlan_info.member_ports.end());
-            vlan_info.tagged_ports.erase(
-                std::remove(vlan_info.tagged_ports.begin(), vlan_info.tagged_ports.end(), port_name),
-                vlan_info.tagged_ports.end());
-            vlan_info.untagged_ports.erase(
-                std::remove(vlan_info.untagged_ports.begin(), vlan_info.untagged_ports.end(), port_name),
-                vlan_info.untagged_ports.end());
-        }
-        
-        // Update port cache
-        if (m_port_cache.find(port_name) != m_port_cache.end()) {
-            auto& vlans = m_port_cache[port_name].vlan_memberships;
-            vlans.erase(std::remove(vlans.begin(), vlans.end(), vlan_id), vlans.end());
-        }
+        auto lock = lockCaches();
+        setVLANMembershipUnsafe(vlan_id, port_name, false, false);
         
-        std::cout << "[SAI] Port " << port_name << " removed from VLAN " << vlan_id << " successfully" << std::endl;
+        SONIC_LOG_INFO("SAI", "Port " << port_name << " removed from VLAN " << vlan_id << " successfully");
     } else {
-        std::cerr << "[SAI] Failed to remove port " << port_name << " from VLAN " << vlan_id << ": " << output << std::endl;
+        SONIC_LOG_ERROR("SAI", "Failed to remove port " << port_name << " from VLAN " << vlan_id << ": " << output);
     }
     
     return result;
 }
 
 VLANInfo SONiCSAIController::getVLANInfo(uint16_t vlan_id) {
+    auto lock = lockCaches();
     auto it = m_vlan_cache.find(vlan_id);
     if (it != m_vlan_cache.end()) {
         return it->second;
@@ -344,7 +421,9 @@ VLANInfo SONiCSAIController::getVLANInfo(uint16_t vlan_id) {
 }
 
 std::vector<VLANInfo> SONiCSAIController::getAllVLANs() {
+    auto lock = lockCaches();
     std::vector<VLANInfo> vlans;
+    vlans.reserve(m_vlan_cache.size());
     for (const auto& pair : m_vlan_cache) {
         vlans.push_back(pair.second);
     }
@@ -352,11 +431,14 @@ std::vector<VLANInfo> SONiCSAIController::getAllVLANs() {
 }
 
 bool SONiCSAIController::setVLANDescription(uint16_t vlan_id, const std::string& description) {
-    std::cout << "[SAI] Setting VLAN " << vlan_id << " description to: " << description << std::endl;
+    SONIC_LOG_INFO("SAI", "Setting VLAN " << vlan_id << " description to: " << description);
     
-    if (m_vlan_cache.find(vlan_id) == m_vlan_cache.end()) {
-        std::cerr << "[SAI] VLAN " << vlan_id << " does not exist" << std::endl;
-        return false;
+    {
+        auto lock = lockCaches();
+        if (m_vlan_cache.find(vlan_id) == m_vlan_cache.end()) {
+            SONIC_LOG_ERROR("SAI", "VLAN " << vlan_id << " does not exist");
+            return false;
+        }
     }
     
     // Update CONFIG_DB
@@ -365,10 +447,14 @@ bool SONiCSAIController::setVLANDescription(uint16_t vlan_id, const std::string&
     
     if (result) {
         // Update cache
-        m_vlan_cache[vlan_id].description = description;
-        std::cout << "[SAI] VLAN " << vlan_id << " description updated successfully" << std::endl;
+        auto lock = lockCaches();
+        auto it = m_vlan_cache.find(vlan_id);
+        if (it != m_vlan_cache.end()) {
+            it->second.description = description;
+        }
+        SONIC_LOG_INFO("SAI", "VLAN " << vlan_id << " description updated successfully");
     } else {
-        std::cerr << "[SAI] Failed to update VLAN " << vlan_id << " description" << std::endl;
+        SONIC_LOG_ERROR("SAI", "Failed to update VLAN " << vlan_id << " description");
     }
     
     return result;
@@ -376,11 +462,11 @@ bool SONiCSAIController::setVLANDescription(uint16_t vlan_id, const std::string&
 
 // Port Management Implementation
 bool SONiCSAIController::setPortAdminStatus(const std::string& port_name, bool up) {
-    std::cout << "[SAI] Setting port " << port_name << " admin status to " 
-              << (up ? "UP" : "DOWN") << std::endl;
+    SONIC_LOG_INFO("SAI", "Setting port " << port_name << " admin status to "
+                   << (up ? "UP" : "DOWN"));
     
     if (!validatePortName(port_name)) {
-        std::cerr << "[SAI] Invalid port name: " << port_name << std::endl;
+        SONIC_LOG_ERROR("SAI", "Invalid port name: " << port_name);
         return false;
     }
     
@@ -400,23 +486,25 @@ bool SONiCSAIController::setPortAdminStatus(const std::string& port_name, bool u
         setRedisHashField(port_key, "admin_status", up ? "up" : "down", 4);
         
         // Update cache
-        if (m_port_cache.find(port_name) != m_port_cache.end()) {
-            m_port_cache[port_name].admin_status = up ? "up" : "down";
+        auto lock = lockCaches();
+        auto it = m_port_cache.find(port_name);
+        if (it != m_port_cache.end()) {
+            it->second.admin_status = up ? "up" : "down";
         }
         
-        std::cout << "[SAI] Port " << port_name << " admin status updated successfully" << std::endl;
+        SONIC_LOG_INFO("SAI", "Port " << port_name << " admin status updated successfully");
     } else {
-        std::cerr << "[SAI] Failed to update port " << port_name << " admin status: " << output << std::endl;
+        SONIC_LOG_ERROR("SAI", "Failed to update port " << port_name << " admin status: " << output);
     }
     
     return result;
 }
 
 bool SONiCSAIController::setPortSpeed(const std::string& port_name, uint32_t speed) {
-    std::cout << "[SAI] Setting port " << port_name << " speed to " << speed << " Mbps" << std::endl;
+    SONIC_LOG_INFO("SAI", "Setting port " << port_name << " speed to " << speed << " Mbps");
     
     if (!validatePortName(port_name)) {
-        std::cerr << "[SAI] Invalid port name: " << port_name << std::endl;
+        SONIC_LOG_ERROR("SAI", "Invalid port name: " << port_name);
         return false;
     }
     
@@ -430,23 +518,25 @@ bool SONiCSAIController::setPortSpeed(const std::string& port_name, uint32_t spe
         setRedisHashField(port_key, "speed", std::to_string(speed), 4);
         
         // Update cache
-        if (m_port_cache.find(port_name) != m_port_cache.end()) {
-            m_port_cache[port_name].speed = speed;
+        auto lock = lockCaches();
+        auto it = m_port_cache.find(port_name);
+        if (it != m_port_cache.end()) {
+            it->second.speed = speed;
         }
         
-        std::cout << "[SAI] Port " << port_name << " speed updated successfully" << std::endl;
+        SONIC_LOG_INFO("SAI", "Port " << port_name << " speed updated successfully");
     } else {
-        std::cerr << "[SAI] Failed to update port " << port_name << " speed: " << output << std::endl;
+        SONIC_LOG_ERROR("SAI", "Failed to update port " << port_name << " speed: " << output);
     }
     
     return result;
 }
 
 bool SONiCSAIController::setPortMTU(const std::string& port_name, uint32_t mtu) {
-    std::cout << "[SAI] Setting port " << port_name << " MTU to " << mtu << " bytes" << std::endl;
+    SONIC_LOG_INFO("SAI", "Setting port " << port_name << " MTU to " << mtu << " bytes");
     
     if (!validatePortName(port_name)) {
-        std::cerr << "[SAI] Invalid port name: " << port_name << std::endl;
+        SONIC_LOG_ERROR("SAI", "Invalid port name: " << port_name);
         return false;
     }
     
@@ -460,18 +550,309 @@ bool SONiCSAIController::setPortMTU(const std::string& port_name, uint32_t mtu)
         setRedisHashField(port_key, "mtu", std::to_string(mtu), 4);
         
         // Update cache
-        if (m_port_cache.find(port_name) != m_port_cache.end()) {
-            m_port_cache[port_name].mtu = mtu;
+        auto lock = lockCaches();
+        auto it = m_port_cache.find(port_name);
+        if (it != m_port_cache.end()) {
+            it->second.mtu = mtu;
         }
         
-        std::cout << "[SAI] Port " << port_name << " MTU updated successfully" << std::endl;
+        SONIC_LOG_INFO("SAI", "Port " << port_name << " MTU updated successfully");
     } else {
-        std::cerr << "[SAI] Failed to update port " << port_name << " MTU: " << output << std::endl;
+        SONIC_LOG_ERROR("SAI", "Failed to update port " << port_name << " MTU: " << output);
     }
     
     return result;
 }
 
+// Config Transactions
+ConfigTransaction& ConfigTransaction::add(OpType type, uint16_t vlan_id, const std::string& port_name,
+                                          const std::string& text, uint32_t value, bool flag) {
+    m_ops.push_back({type, vlan_id, port_name, text, value, flag});
+    return *this;
+}
+
+ConfigTransaction& ConfigTransaction::createVLAN(uint16_t vlan_id, const std::string& description) {
+    return add(OpType::CREATE_VLAN, vlan_id, "", description, 0, false);
+}
+
+ConfigTransaction& ConfigTransaction::deleteVLAN(uint16_t vlan_id) {
+    return add(OpType::DELETE_VLAN, vlan_id, "", "", 0, false);
+}
+
+ConfigTransaction& ConfigTransaction::setVLANDescription(uint16_t vlan_id, const std::string& description) {
+    return add(OpType::SET_VLAN_DESCRIPTION, vlan_id, "", description, 0, false);
+}
+
+ConfigTransaction& ConfigTransaction::addPortToVLAN(uint16_t vlan_id, const std::string& port_name, bool tagged) {
+    return add(OpType::ADD_VLAN_MEMBER, vlan_id, port_name, "", 0, tagged);
+}
+
+ConfigTransaction& ConfigTransaction::removePortFromVLAN(uint16_t vlan_id, const std::string& port_name) {
+    return add(OpType::REMOVE_VLAN_MEMBER, vlan_id, port_name, "", 0, false);
+}
+
+ConfigTransaction& ConfigTransaction::setPortAdminStatus(const std::string& port_name, bool up) {
+    return add(OpType::SET_PORT_ADMIN_STATUS, 0, port_name, "", 0, up);
+}
+
+ConfigTransaction& ConfigTransaction::setPortSpeed(const std::string& port_name, uint32_t speed) {
+    return add(OpType::SET_PORT_SPEED, 0, port_name, "", speed, false);
+}
+
+ConfigTransaction& ConfigTransaction::setPortMTU(const std::string& port_name, uint32_t mtu) {
+    return add(OpType::SET_PORT_MTU, 0, port_name, "", mtu, false);
+}
+
+bool SONiCSAIController::commitTransaction(const ConfigTransaction& transaction) {
+    SONIC_SCOPED_TIMER("sonic_sai_config_transaction_seconds", "Time to validate and commit a ConfigTransaction");
+    if (transaction.empty()) {
+        return true;
+    }
+    SONIC_LOG_INFO("SAI", "Committing transaction with " << transaction.size() << " operations");
+
+    // Apply to the caches first so each operation is validated against the
+    // state the earlier ones leave behind
+    std::vector<std::vector<std::string>> commands;
+    TransactionUndo undo;
+    {
+        auto lock = lockCaches();
+        for (size_t i = 0; i < transaction.m_ops.size(); ++i) {
+            if (!applyTransactionOpUnsafe(transaction.m_ops[i], commands, undo)) {
+                SONIC_LOG_ERROR("SAI", "Transaction rejected at operation " << (i + 1) << ", nothing written");
+                rollbackTransactionUnsafe(undo);
+                return false;
+            }
+        }
+    }
+
+    std::vector<common::RedisReply> replies;
+    bool executed = m_redis->transaction(CONFIG_DB, commands, replies);
+    bool result = executed;
+    std::string error = executed ? "" : (replies.empty() ? "Redis unavailable" : replies.back().str);
+    for (const auto& reply : replies) {
+        if (result && reply.isError()) {
+            result = false;
+            error = reply.str;
+        }
+    }
+
+    if (!result) {
+        // When EXEC did not run CONFIG_DB still holds the pre-images. EXEC has no rollback,
+        // so after a partial one the touched keys are read back instead.
+        if (!executed || !resyncTransactionKeys(undo)) {
+            auto lock = lockCaches();
+            rollbackTransactionUnsafe(undo);
+        }
+        SONIC_COUNTER_INC("sonic_sai_config_transaction_failures_total", "ConfigTransactions that failed to commit");
+        SONIC_LOG_ERROR("SAI", "Failed to commit transaction: " << error);
+        return false;
+    }
+
+    SONIC_LOG_INFO("SAI", "Transaction committed (" << commands.size() << " CONFIG_DB writes)");
+    return true;
+}
+
+bool SONiCSAIController::applyTransactionOpUnsafe(const ConfigTransaction::Op& op,
+                                                  std::vector<std::vector<std::string>>& commands,
+                                                  TransactionUndo& undo) {
+    using OpType = ConfigTransaction::OpType;
+    const std::string vlan_name = "Vlan" + std::to_string(op.vlan_id);
+    auto vlan_it = m_vlan_cache.find(op.vlan_id);
+    auto port_it = m_port_cache.find(op.port_name);
+
+    switch (op.type) {
+        case OpType::CREATE_VLAN: {
+            if (!validateVLANID(op.vlan_id) || vlan_it != m_vlan_cache.end()) {
+                SONIC_LOG_ERROR("SAI", "Cannot create VLAN " << op.vlan_id << ": invalid or already exists");
+                return false;
+            }
+            std::vector<std::string> command = {"HSET", "VLAN|" + vlan_name, "vlanid", std::to_string(op.vlan_id)};
+            if (!op.text.empty()) {
+                command.insert(command.end(), {"description", op.text});
+            }
+            commands.push_back(std::move(command));
+
+            saveVLANUnsafe(op.vlan_id, undo);
+            VLANInfo& vlan_info = m_vlan_cache[op.vlan_id];
+            vlan_info.vlan_id = op.vlan_id;
+            vlan_info.name = op.text.empty() ? vlan_name : op.text;
+            vlan_info.is_active = true;
+            vlan_info.description = op.text;
+            return true;
+        }
+
+        case OpType::DELETE_VLAN: {
+            if (vlan_it == m_vlan_cache.end()) {
+                SONIC_LOG_ERROR("SAI", "Cannot delete VLAN " << op.vlan_id << ": does not exist");
+                return false;
+            }
+            // Members go first, as deleteVLAN() does
+            saveVLANUnsafe(op.vlan_id, undo);
+            std::vector<std::string> members = vlan_it->second.member_ports;
+            for (const auto& port_name : members) {
+                commands.push_back({"DEL", "VLAN_MEMBER|" + vlan_name + "|" + port_name});
+                savePortUnsafe(port_name, undo);
+                setVLANMembershipUnsafe(op.vlan_id, port_name, false, false);
+            }
+            commands.push_back({"DEL", "VLAN|" + vlan_name});
+            m_vlan_cache.erase(op.vlan_id);
+            return true;
+        }
+
+        case OpType::SET_VLAN_DESCRIPTION:
+            if (vlan_it == m_vlan_cache.end()) {
+                SONIC_LOG_ERROR("SAI", "VLAN " << op.vlan_id << " does not exist");
+                return false;
+            }
+            commands.push_back({"HSET", "VLAN|" + vlan_name, "description", op.text});
+            saveVLANUnsafe(op.vlan_id, undo);
+            vlan_it->second.description = op.text;
+            return true;
+
+        case OpType::ADD_VLAN_MEMBER: {
+            std::string lag_name;
+            if (vlan_it == m_vlan_cache.end() || port_it == m_port_cache.end()) {
+                SONIC_LOG_ERROR("SAI", "Cannot add " << op.port_name << " to VLAN " << op.vlan_id
+                                << ": unknown VLAN or port");
+                return false;
+            }
+            if (m_lag_manager->findLAGForPort(op.port_name, lag_name)) {
+                SONIC_LOG_ERROR("SAI", "Cannot add " << op.port_name << " to VLAN " << op.vlan_id
+                                << ": member of " << lag_name);
+                return false;
+            }
+            commands.push_back({"HSET", "VLAN_MEMBER|" + vlan_name + "|" + op.port_name, "tagging_mode",
+                                op.flag ? "tagged" : "untagged"});
+            saveVLANUnsafe(op.vlan_id, undo);
+            savePortUnsafe(op.port_name, undo);
+            setVLANMembershipUnsafe(op.vlan_id, op.port_name, true, op.flag);
+            return true;
+        }
+
+        case OpType::REMOVE_VLAN_MEMBER: {
+            if (vlan_it == m_vlan_cache.end() ||
+                std::find(vlan_it->second.member_ports.begin(), vlan_it->second.member_ports.end(),
+                          op.port_name) == vlan_it->second.member_ports.end()) {
+                SONIC_LOG_ERROR("SAI", "Port " << op.port_name << " is not a member of VLAN " << op.vlan_id);
+                return false;
+            }
+            commands.push_back({"DEL", "VLAN_MEMBER|" + vlan_name + "|" + op.port_name});
+            saveVLANUnsafe(op.vlan_id, undo);
+            savePortUnsafe(op.port_name, undo);
+            setVLANMembershipUnsafe(op.vlan_id, op.port_name, false, false);
+            return true;
+        }
+
+        case OpType::SET_PORT_ADMIN_STATUS:
+        case OpType::SET_PORT_SPEED:
+        case OpType::SET_PORT_MTU:
+            break;
+    }
+
+    if (port_it == m_port_cache.end()) {
+        SONIC_LOG_ERROR("SAI", "Port " << op.port_name << " does not exist");
+        return false;
+    }
+    PortInfo& port_info = port_it->second;
+    const std::string port_key = "PORT|" + op.port_name;
+    if (op.type == OpType::SET_PORT_ADMIN_STATUS) {
+        commands.push_back({"HSET", port_key, "admin_status", op.flag ? "up" : "down"});
+        savePortUnsafe(op.port_name, undo);
+        port_info.admin_status = op.flag ? "up" : "down";
+    } else if (op.type == OpType::SET_PORT_SPEED) {
+        if (op.value == 0) {
+            SONIC_LOG_ERROR("SAI", "Invalid speed for " << op.port_name);
+            return false;
+        }
+        commands.push_back({"HSET", port_key, "speed", std::to_string(op.value)});
+        savePortUnsafe(op.port_name, undo);
+        port_info.speed = op.value;
+    } else {
+        if (op.value < 68 || op.value > 9216) {
+            SONIC_LOG_ERROR("SAI", "Invalid MTU " << op.value << " for " << op.port_name);
+            return false;
+        }
+        commands.push_back({"HSET", port_key, "mtu", std::to_string(op.value)});
+        savePortUnsafe(op.port_name, undo);
+        port_info.mtu = op.value;
+    }
+    return true;
+}
+
+void SONiCSAIController::saveVLANUnsafe(uint16_t vlan_id, TransactionUndo& undo) {
+    if (undo.vlans.count(vlan_id)) {
+        return;     // Keep the state from before the first change
+    }
+    auto it = m_vlan_cache.find(vlan_id);
+    undo.vlans[vlan_id] = it != m_vlan_cache.end() ? std::make_pair(true, it->second)
+                                                   : std::make_pair(false, VLANInfo());
+}
+
+void SONiCSAIController::savePortUnsafe(const std::string& port_name, TransactionUndo& undo) {
+    if (undo.ports.count(port_name)) {
+        return;
+    }
+    auto it = m_port_cache.find(port_name);
+    undo.ports[port_name] = it != m_port_cache.end() ? std::make_pair(true, it->second)
+                                                     : std::make_pair(false, PortInfo());
+}
+
+bool SONiCSAIController::resyncTransactionKeys(const TransactionUndo& undo) {
+    // VLANs before their members, so membership lands on the VLANs that exist
+    std::vector<common::TableChange> changes;
+    for (const auto& vlan : undo.vlans) {
+        const std::string vlan_name = "Vlan" + std::to_string(vlan.first);
+        changes.push_back({VLAN_CONFIG, vlan_name, false, {}});
+    }
+    for (const auto& vlan : undo.vlans) {
+        const std::string vlan_name = "Vlan" + std::to_string(vlan.first);
+        for (const auto& port : undo.ports) {
+            changes.push_back({VLAN_MEMBER_CONFIG, vlan_name + "|" + port.first, false, {}});
+        }
+    }
+    for (const auto& port : undo.ports) {
+        changes.push_back({PORT_CONFIG, port.first, false, {}});
+    }
+
+    std::vector<std::vector<std::string>> commands;
+    for (const auto& change : changes) {
+        commands.push_back({"HGETALL", CACHE_TABLES[change.table].prefix + change.key});
+    }
+    std::vector<common::RedisReply> replies;
+    if (!m_redis->pipeline(CONFIG_DB, commands, replies) || replies.size() != commands.size()) {
+        SONIC_LOG_WARN("SAI", "Could not read back the transaction's keys; the watcher will resync them");
+        return false;
+    }
+
+    auto lock = lockCaches();
+    rollbackTransactionUnsafe(undo);
+    for (size_t i = 0; i < changes.size(); ++i) {
+        // Same rule as the watcher: a missing or non-hash key is absent
+        changes[i].fields = replies[i].asHash();
+        changes[i].deleted = changes[i].fields.empty();
+        applyTableChange(changes[i]);
+    }
+    SONIC_LOG_INFO("SAI", "Resynced " << changes.size() << " keys after a partial transaction");
+    return true;
+}
+
+void SONiCSAIController::rollbackTransactionUnsafe(const TransactionUndo& undo) {
+    for (const auto& vlan : undo.vlans) {
+        if (vlan.second.first) {
+            m_vlan_cache[vlan.first] = vlan.second.second;
+        } else {
+            m_vlan_cache.erase(vlan.first);
+        }
+    }
+    for (const auto& port : undo.ports) {
+        if (port.second.first) {
+            m_port_cache[port.first] = port.second.second;
+        } else {
+            m_port_cache.erase(port.first);
+        }
+    }
+}
+
 // Validation Helper Functions
 bool SONiCSAIController::validateVLANID(uint16_t vlan_id) {
     return (vlan_id >= 1 && vlan_id <= 4094);
@@ -493,107 +874,373 @@ bool SONiCSAIController::validateIPAddress(const std::string& ip_address) {
     return std::regex_match(ip_address, ipv4_pattern);
 }
 
-// Cache Refresh Functions
-bool SONiCSAIController::refreshPortCache() {
-    std::cout << "[SAI] Refreshing port cache..." << std::endl;
+// Cache Sync Functions
+bool SONiCSAIController::warmLoadCaches() {
+    SONIC_LOG_INFO("SAI", "Loading caches from CONFIG_DB/APPL_DB...");
+
+    std::vector<common::TableChange> entries;
+    if (!m_watcher->snapshot(entries)) {
+        SONIC_LOG_INFO("SAI", "Failed to scan cache tables from Redis");
+        return false;
+    }
 
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
     m_port_cache.clear();
+    m_vlan_cache.clear();
+    m_fdb_cache.clear();
+    m_route_cache.clear();
+    m_acl_cache.clear();
+    m_acl_tables.clear();
+    m_fdb_cache.reserve(static_cast<size_t>(std::count_if(entries.begin(), entries.end(),
+        [](const common::TableChange& entry) { return entry.table == FDB_STATE; })));
+    for (const auto& entry : entries) {
+        applyTableChange(entry);
+    }
+    applyPendingFDBUnsafe();
 
-    // Get all ports from CONFIG_DB
-    std::string output;
-    if (!executeRedisCommand("KEYS \"PORT|*\"", 4, output)) {
-        std::cout << "[SAI] Failed to get port keys from Redis" << std::endl;
-        return false;
+    SONIC_LOG_INFO("SAI", "Caches loaded: " << m_port_cache.size() << " ports, " << m_vlan_cache.size()
+                   << " VLANs, " << m_fdb_cache.size() << " FDB entries, " << routeCountUnsafe()
+                   << " routes, " << m_acl_cache.size() << " ACL rules");
+    return true;
+}
+
+void SONiCSAIController::startCacheSync() {
+    if (m_sync_running.exchange(true)) {
+        return;
+    }
+    m_sync_thread = std::thread(&SONiCSAIController::cacheSyncLoop, this);
+}
+
+void SONiCSAIController::stopCacheSync() {
+    if (!m_sync_running.exchange(false)) {
+        return;
+    }
+    m_watcher->interrupt();
+    if (m_sync_thread.joinable()) {
+        m_sync_thread.join();
+    }
+}
+
+bool SONiCSAIController::initialLoad() {
+    SONIC_SCOPED_TIMER("sonic_sai_initial_load_seconds", "Time to load the SAI caches and LAGs at startup");
+    int backoff_ms = 100;
+    while (m_sync_running.load()) {
+        if (warmLoadCaches() && m_lag_manager->load()) {
+            return true;
+        }
+        SONIC_LOG_WARN("SAI", "Initial cache load failed, retrying in " << backoff_ms << " ms");
+        if (!m_watcher->waitInterruptible(backoff_ms)) {
+            break;
+        }
+        backoff_ms = std::min(backoff_ms * 2, 5000);
+    }
+    return false;
+}
+
+void SONiCSAIController::cacheSyncLoop() {
+    bool loaded = initialLoad();
+    replayLinkEvents(loaded);
+    m_ready_promise.set_value(loaded);
+    if (!loaded) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        SONIC_LOG_INFO("SAI", "Found " << m_port_cache.size() << " ports");
+        SONIC_LOG_INFO("SAI", "Found " << m_vlan_cache.size() << " VLANs");
     }
+    SONIC_LOG_INFO("SAI", "Found " << m_lag_manager->getAllLAGs().size() << " LAGs");
+
+    int backoff_ms = 100;
+    while (m_sync_running.load()) {
+        if (!m_watcher->isSubscribed()) {
+            if (!m_watcher->subscribe()) {
+                if (!m_watcher->waitInterruptible(backoff_ms)) {
+                    break;
+                }
+                backoff_ms = std::min(backoff_ms * 2, 5000);
+                continue;
+            }
+            backoff_ms = 100;
 
-    std::istringstream iss(output);
-    std::string line;
-    while (std::getline(iss, line)) {
-        if (line.find("PORT|") == 0) {
-            std::string port_name = line.substr(5); // Remove "PORT|" prefix
+            // Changes made while we were unsubscribed were never notified
+            warmLoadCaches();
+        }
 
-            PortInfo port_info;
-            port_info.port_name = port_name;
-            port_info.port_id = static_cast<uint32_t>(m_port_cache.size() + 1);
+        std::vector<common::TableChange> changes;
+        if (!m_watcher->waitForChanges(changes, -1)) {
+            SONIC_LOG_WARN("SAI", "Lost CONFIG_DB subscription, resubscribing");
+            continue;
+        }
 
-            // Get port details from Redis
-            std::string port_key = "PORT|" + port_name;
-            std::string speed_str = getRedisHashField(port_key, "speed", 4);
-            std::string mtu_str = getRedisHashField(port_key, "mtu", 4);
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        for (const auto& change : changes) {
+            applyTableChange(change);
+        }
+        applyPendingFDBUnsafe();
+    }
+}
 
-            port_info.speed = speed_str.empty() ? 100000 : std::stoul(speed_str);
-            port_info.mtu = mtu_str.empty() ? 9100 : std::stoul(mtu_str);
-            port_info.admin_status = getRedisHashField(port_key, "admin_status", 4);
+void SONiCSAIController::applyTableChange(const common::TableChange& change) {
+    switch (change.table) {
+        case PORT_CONFIG:
+            applyPortChange(change);
+            break;
+        case PORT_STATE:
+            applyPortStateChange(change);
+            break;
+        case VLAN_CONFIG:
+            applyVLANChange(change);
+            break;
+        case VLAN_MEMBER_CONFIG:
+            applyVLANMemberChange(change);
+            break;
+        case FDB_STATE:
+            applyFDBChange(change);
+            break;
+        case STATIC_ROUTE_CONFIG:
+            applyRouteChange(change);
+            break;
+        case ACL_RULE_CONFIG:
+            applyACLRuleChange(change);
+            break;
+        default:
+            break;
+    }
+}
 
-            // Get operational status from APPL_DB
-            std::string appl_key = "PORT_TABLE:" + port_name;
-            port_info.oper_status = getRedisHashField(appl_key, "oper_status", 0);
+void SONiCSAIController::applyPortChange(const common::TableChange& change) {
+    const std::string& port_name = change.key;
+    if (change.deleted) {
+        m_port_cache.erase(port_name);
+        return;
+    }
 
-            m_port_cache[port_name] = port_info;
+    auto it = m_port_cache.find(port_name);
+    if (it == m_port_cache.end()) {
+        PortInfo port_info;
+        port_info.port_name = port_name;
+        // Interned IDs are stable across adds and removes; 0 stays "not found"
+        port_info.port_id = common::portNames().intern(port_name) + 1;
+        port_info.speed = 100000;
+        port_info.mtu = 9100;
+        for (const auto& vlan : m_vlan_cache) {
+            const auto& members = vlan.second.member_ports;
+            if (std::find(members.begin(), members.end(), port_name) != members.end()) {
+                port_info.vlan_memberships.push_back(vlan.first);
+            }
         }
+        it = m_port_cache.emplace(port_name, port_info).first;
     }
 
-    std::cout << "[SAI] Port cache refreshed: " << m_port_cache.size() << " ports" << std::endl;
-    return true;
+    PortInfo& port_info = it->second;
+    port_info.speed = parseUint32(change.fields, "speed", port_info.speed);
+    port_info.mtu = parseUint32(change.fields, "mtu", port_info.mtu);
+    port_info.admin_status = fieldOr(change.fields, "admin_status", port_info.admin_status);
+    port_info.mac_address = fieldOr(change.fields, "mac", port_info.mac_address);
 }
 
-bool SONiCSAIController::refreshVLANCache() {
-    std::cout << "[SAI] Refreshing VLAN cache..." << std::endl;
+void SONiCSAIController::applyPortStateChange(const common::TableChange& change) {
+    // CONFIG_DB decides which ports exist; APPL_DB only carries their operational state
+    auto it = m_port_cache.find(change.key);
+    if (it != m_port_cache.end()) {
+        it->second.oper_status = change.deleted ? "" : fieldOr(change.fields, "oper_status");
+    }
+}
 
-    m_vlan_cache.clear();
+void SONiCSAIController::applyVLANChange(const common::TableChange& change) {
+    uint16_t vlan_id = parseVLANName(change.key);
+    if (vlan_id == 0) {
+        return;
+    }
+    if (change.deleted) {
+        m_vlan_cache.erase(vlan_id);
+        for (auto& port : m_port_cache) {
+            auto& vlans = port.second.vlan_memberships;
+            vlans.erase(std::remove(vlans.begin(), vlans.end(), vlan_id), vlans.end());
+        }
+        return;
+    }
 
-    // Get all VLANs from CONFIG_DB
-    std::string output;
-    if (!executeRedisCommand("KEYS \"VLAN|*\"", 4, output)) {
-        std::cout << "[SAI] Failed to get VLAN keys from Redis" << std::endl;
-        return false;
+    VLANInfo& vlan_info = m_vlan_cache[vlan_id];
+    vlan_info.vlan_id = vlan_id;
+    if (vlan_info.name.empty()) {
+        vlan_info.name = "Vlan" + std::to_string(vlan_id);
     }
+    vlan_info.is_active = true;
+    vlan_info.description = fieldOr(change.fields, "description");
+}
 
-    std::istringstream iss(output);
-    std::string line;
-    while (std::getline(iss, line)) {
-        if (line.find("VLAN|Vlan") == 0) {
-            std::string vlan_str = line.substr(9); // Remove "VLAN|Vlan" prefix
-            uint16_t vlan_id = static_cast<uint16_t>(std::stoul(vlan_str));
+void SONiCSAIController::applyVLANMemberChange(const common::TableChange& change) {
+    // Key is "Vlan<id>|<port>"
+    size_t separator = change.key.find('|');
+    if (separator == std::string::npos) {
+        return;
+    }
+    uint16_t vlan_id = parseVLANName(change.key.substr(0, separator));
+    if (vlan_id == 0) {
+        return;
+    }
+    bool tagged = fieldOr(change.fields, "tagging_mode") == "tagged";
+    setVLANMembershipUnsafe(vlan_id, change.key.substr(separator + 1), !change.deleted, tagged);
+}
 
-            VLANInfo vlan_info;
-            vlan_info.vlan_id = vlan_id;
-            vlan_info.name = "Vlan" + std::to_string(vlan_id);
-            vlan_info.is_active = true;
+void SONiCSAIController::setVLANMembershipUnsafe(uint16_t vlan_id, const std::string& port_name,
+                                                 bool member, bool tagged) {
+    auto vlan_it = m_vlan_cache.find(vlan_id);
+    if (vlan_it != m_vlan_cache.end()) {
+        VLANInfo& vlan_info = vlan_it->second;
+        eraseValue(vlan_info.member_ports, port_name);
+        eraseValue(vlan_info.tagged_ports, port_name);
+        eraseValue(vlan_info.untagged_ports, port_name);
+        if (member) {
+            vlan_info.member_ports.push_back(port_name);
+            (tagged ? vlan_info.tagged_ports : vlan_info.untagged_ports).push_back(port_name);
+        }
+    }
 
-            // Get VLAN description
-            std::string vlan_key = "VLAN|Vlan" + std::to_string(vlan_id);
-            vlan_info.description = getRedisHashField(vlan_key, "description", 4);
-
-            // Get VLAN members
-            std::string member_output;
-            std::string member_pattern = "VLAN_MEMBER|Vlan" + std::to_string(vlan_id) + "|*";
-            if (executeRedisCommand("KEYS '" + member_pattern + "'", 4, member_output)) {
-                std::istringstream member_iss(member_output);
-                std::string member_line;
-                while (std::getline(member_iss, member_line)) {
-                    size_t last_pipe = member_line.find_last_of('|');
-                    if (last_pipe != std::string::npos) {
-                        std::string port_name = member_line.substr(last_pipe + 1);
-                        vlan_info.member_ports.push_back(port_name);
-
-                        // Check if tagged or untagged
-                        std::string tagging_mode = getRedisHashField(member_line, "tagging_mode", 4);
-                        if (tagging_mode == "tagged") {
-                            vlan_info.tagged_ports.push_back(port_name);
-                        } else {
-                            vlan_info.untagged_ports.push_back(port_name);
-                        }
-                    }
-                }
-            }
+    auto port_it = m_port_cache.find(port_name);
+    if (port_it != m_port_cache.end()) {
+        auto& vlans = port_it->second.vlan_memberships;
+        vlans.erase(std::remove(vlans.begin(), vlans.end(), vlan_id), vlans.end());
+        if (member && vlan_it != m_vlan_cache.end()) {
+            vlans.push_back(vlan_id);
+        }
+    }
+}
+
+void SONiCSAIController::applyFDBChange(const common::TableChange& change) {
+    // Key is "Vlan<id>:<mac>"; the MAC itself contains ':' or '-'
+    size_t separator = change.key.find(':');
+    if (separator == std::string::npos) {
+        return;
+    }
+    common::FdbNotification event;
+    event.vlan_id = parseVLANName(change.key.substr(0, separator));
+    if (event.vlan_id == 0 || !common::FdbTable::parseMac(change.key.substr(separator + 1), event.mac)) {
+        return;
+    }
+
+    if (change.deleted) {
+        event.op = common::FdbOp::REMOVE;
+    } else {
+        event.op = common::FdbOp::LEARN;
+        std::string port_name = fieldOr(change.fields, "port");
+        event.port = port_name.empty() ? common::INVALID_PORT_ID : common::portNames().intern(port_name);
+        event.type = fieldOr(change.fields, "type", "dynamic") == "static" ? common::FdbEntryType::STATIC
+                                                                           : common::FdbEntryType::DYNAMIC;
+        event.flags = change.key[separator + 3] == '-' ? FDB_KEY_DASHES : 0;
+    }
+    // Queued so a notification burst is applied to the table in one batch
+    m_fdb_pending.push_back(event);
+}
+
+void SONiCSAIController::applyPendingFDBUnsafe() {
+    if (m_fdb_pending.empty()) {
+        return;
+    }
+    m_fdb_cache.apply(m_fdb_pending);
+    m_fdb_pending.clear();
+}
+
+FDBEntry SONiCSAIController::toFDBEntry(const common::FdbRecord& record) {
+    FDBEntry entry;
+    entry.mac_address = common::FdbTable::formatMac(record.mac);
+    entry.vlan_id = record.vlan_id;
+    entry.port_name = record.port != common::INVALID_PORT_ID ? common::portNames().name(record.port) : "";
+    entry.entry_type = record.type == common::FdbEntryType::STATIC ? "static" : "dynamic";
+    entry.age_time = 0;
+    return entry;
+}
 
-            m_vlan_cache[vlan_id] = vlan_info;
+void SONiCSAIController::applyRouteChange(const common::TableChange& change) {
+    // Key is "<prefix>" or "<vrf>|<prefix>"
+    size_t vrf_separator = change.key.rfind('|');
+    std::string vrf = vrf_separator == std::string::npos ? "" : change.key.substr(0, vrf_separator);
+    common::IpPrefix prefix;
+    if (!common::IpPrefix::parse(change.key.substr(vrf_separator + 1), prefix)) {
+        SONIC_LOG_INFO("SAI", "Ignoring route with invalid prefix: " << change.key);
+        return;
+    }
+
+    if (change.deleted) {
+        auto table = m_route_cache.find(vrf);
+        if (table != m_route_cache.end()) {
+            table->second.erase(prefix);
+            if (table->second.empty()) {
+                m_route_cache.erase(table);
+            }
         }
+        return;
     }
 
-    std::cout << "[SAI] VLAN cache refreshed: " << m_vlan_cache.size() << " VLANs" << std::endl;
-    return true;
+    CachedRoute route;
+    route.next_hop = fieldOr(change.fields, "nexthop");
+    route.interface = fieldOr(change.fields, "ifname");
+    route.metric = parseUint32(change.fields, "distance", 0);
+    m_route_cache[vrf].insert(prefix, std::move(route));
+}
+
+size_t SONiCSAIController::routeCountUnsafe() const {
+    size_t count = 0;
+    for (const auto& table : m_route_cache) {
+        count += table.second.size();
+    }
+    return count;
+}
+
+RouteEntry SONiCSAIController::toRouteEntry(const common::IpPrefix& prefix, const CachedRoute& route) {
+    RouteEntry entry;
+    entry.destination = prefix.addressString();
+    entry.prefix_length = std::to_string(prefix.length);
+    entry.next_hop = route.next_hop;
+    entry.interface = route.interface;
+    entry.metric = route.metric;
+    entry.route_type = "static";
+    return entry;
+}
+
+void SONiCSAIController::applyACLRuleChange(const common::TableChange& change) {
+    compileACLRuleUnsafe(change);
+    if (change.deleted) {
+        m_acl_cache.erase(change.key);
+        return;
+    }
+
+    // Key is "<table>|<rule>"; rule names usually end in their number ("RULE_10")
+    size_t separator = change.key.find('|');
+    if (separator == std::string::npos) {
+        return;
+    }
+    std::string rule_name = change.key.substr(separator + 1);
+    size_t digits = rule_name.find_last_not_of("0123456789");
+    std::string rule_number = digits == std::string::npos ? rule_name : rule_name.substr(digits + 1);
+
+    ACLRule rule;
+    rule.table_name = change.key.substr(0, separator);
+    rule.rule_id = 0;
+    if (!rule_number.empty()) {
+        try {
+            rule.rule_id = static_cast<uint32_t>(std::stoul(rule_number));
+        } catch (const std::exception&) {
+        }
+    }
+    rule.src_ip = fieldOr(change.fields, "SRC_IP");
+    rule.dst_ip = fieldOr(change.fields, "DST_IP");
+    rule.src_port = static_cast<uint16_t>(parseUint32(change.fields, "L4_SRC_PORT", 0));
+    rule.dst_port = static_cast<uint16_t>(parseUint32(change.fields, "L4_DST_PORT", 0));
+    rule.protocol = fieldOr(change.fields, "IP_PROTOCOL");
+    rule.priority = parseUint32(change.fields, "PRIORITY", 0);
+
+    std::string action = fieldOr(change.fields, "PACKET_ACTION");
+    if (action == "FORWARD") {
+        rule.action = "permit";
+    } else if (action == "DROP") {
+        rule.action = "deny";
+    } else {
+        rule.action = action.compare(0, 8, "REDIRECT") == 0 ? "redirect" : action;
+    }
+    m_acl_cache[change.key] = rule;
 }
 
 uint32_t SONiCSAIController::generateObjectID(SAIObjectType type) {
@@ -608,6 +1255,7 @@ bool SONiCSAIController::isValidObjectID(uint32_t object_id, SAIObjectType expec
 }
 
 PortInfo SONiCSAIController::getPortInfo(const std::string& port_name) {
+    auto lock = lockCaches();
     auto it = m_port_cache.find(port_name);
     if (it != m_port_cache.end()) {
         return it->second;
@@ -621,12 +1269,370 @@ PortInfo SONiCSAIController::getPortInfo(const std::string& port_name) {
 }
 
 std::vector<PortInfo> SONiCSAIController::getAllPorts() {
+    auto lock = lockCaches();
     std::vector<PortInfo> ports;
+    ports.reserve(m_port_cache.size());
     for (const auto& pair : m_port_cache) {
         ports.push_back(pair.second);
     }
     return ports;
 }
 
+std::vector<FDBEntry> SONiCSAIController::getFDBEntries(uint16_t vlan_id) {
+    auto lock = lockCaches();
+    std::vector<FDBEntry> entries;
+    auto collect = [&entries](const common::FdbRecord& record) { entries.push_back(toFDBEntry(record)); };
+    if (vlan_id == 0) {
+        entries.reserve(m_fdb_cache.size());
+        m_fdb_cache.forEach(collect);
+    } else {
+        entries.reserve(m_fdb_cache.vlanSize(vlan_id));
+        m_fdb_cache.forEachInVLAN(vlan_id, collect);
+    }
+    return entries;
+}
+
+bool SONiCSAIController::addStaticFDBEntry(const std::string& mac_address, uint16_t vlan_id,
+                                           const std::string& port_name) {
+    SONIC_LOG_INFO("SAI", "Adding static FDB entry " << mac_address << " on VLAN " << vlan_id
+                   << " port " << port_name);
+
+    uint64_t mac = 0;
+    if (!validateVLANID(vlan_id) || !validatePortName(port_name) ||
+        !common::FdbTable::parseMac(mac_address, mac)) {
+        SONIC_LOG_ERROR("SAI", "Invalid static FDB entry: " << mac_address << " VLAN " << vlan_id
+                        << " port " << port_name);
+        return false;
+    }
+
+    common::FdbRecord record;
+    record.mac = mac;
+    record.vlan_id = vlan_id;
+    record.flags = FDB_KEY_DASHES;
+    common::RedisReply reply;
+    if (!m_redis->command(APPL_DB, {"HSET", fdbKey(record), "port", port_name, "type", "static"}, reply)) {
+        SONIC_LOG_ERROR("SAI", "Failed to write static FDB entry " << mac_address << ": " << reply.str);
+        return false;
+    }
+
+    auto lock = lockCaches();
+    m_fdb_cache.learn(mac, vlan_id, common::portNames().intern(port_name), common::FdbEntryType::STATIC, 0,
+                      FDB_KEY_DASHES);
+    SONIC_LOG_INFO("SAI", "Static FDB entry " << mac_address << " added");
+    return true;
+}
+
+bool SONiCSAIController::deleteStaticFDBEntry(const std::string& mac_address, uint16_t vlan_id) {
+    SONIC_LOG_INFO("SAI", "Deleting static FDB entry " << mac_address << " on VLAN " << vlan_id);
+
+    uint64_t mac = 0;
+    if (!common::FdbTable::parseMac(mac_address, mac)) {
+        SONIC_LOG_ERROR("SAI", "Invalid MAC address: " << mac_address);
+        return false;
+    }
+
+    auto lock = lockCaches();
+    const common::FdbRecord* record = m_fdb_cache.find(mac, vlan_id);
+    if (!record || record->type != common::FdbEntryType::STATIC) {
+        SONIC_LOG_ERROR("SAI", "No static FDB entry " << mac_address << " on VLAN " << vlan_id);
+        return false;
+    }
+    if (!m_redis->del(APPL_DB, fdbKey(*record))) {
+        SONIC_LOG_ERROR("SAI", "Failed to delete static FDB entry " << mac_address);
+        return false;
+    }
+    m_fdb_cache.remove(mac, vlan_id);
+    return true;
+}
+
+bool SONiCSAIController::flushFDBEntries(uint16_t vlan_id) {
+    SONIC_LOG_INFO("SAI", "Flushing dynamic FDB entries"
+                   << (vlan_id ? " on VLAN " + std::to_string(vlan_id) : std::string()));
+
+    auto lock = lockCaches();
+    std::vector<std::vector<std::string>> commands;
+    auto collect = [&commands](const common::FdbRecord& record) {
+        if (record.type == common::FdbEntryType::DYNAMIC) {
+            commands.push_back({"DEL", fdbKey(record)});
+        }
+    };
+    if (vlan_id == 0) {
+        m_fdb_cache.forEach(collect);
+    } else {
+        m_fdb_cache.forEachInVLAN(vlan_id, collect);
+    }
+
+    std::vector<common::RedisReply> replies;
+    if (!commands.empty() && !m_redis->pipeline(APPL_DB, commands, replies)) {
+        SONIC_LOG_ERROR("SAI", "Failed to flush FDB entries from APPL_DB");
+        return false;
+    }
+    size_t removed = vlan_id == 0 ? m_fdb_cache.flushAll() : m_fdb_cache.flushVLAN(vlan_id);
+    SONIC_LOG_INFO("SAI", "Flushed " << removed << " FDB entries");
+    return true;
+}
+
+std::vector<RouteEntry> SONiCSAIController::getRouteTable() {
+    auto lock = lockCaches();
+    std::vector<RouteEntry> routes;
+    routes.reserve(routeCountUnsafe());
+    for (const auto& table : m_route_cache) {
+        table.second.forEach([&routes](const common::IpPrefix& prefix, const CachedRoute& route) {
+            routes.push_back(toRouteEntry(prefix, route));
+        });
+    }
+    return routes;
+}
+
+bool SONiCSAIController::lookupRoute(const std::string& address, RouteEntry& route, const std::string& vrf) {
+    common::IpPrefix target;
+    if (!common::IpPrefix::parse(address, target)) {
+        return false;
+    }
+
+    auto lock = lockCaches();
+    auto table = m_route_cache.find(vrf);
+    if (table == m_route_cache.end()) {
+        return false;
+    }
+    common::IpPrefix matched;
+    const CachedRoute* cached = table->second.lookup(target, &matched);
+    if (!cached) {
+        return false;
+    }
+    route = toRouteEntry(matched, *cached);
+    return true;
+}
+
+std::vector<ACLRule> SONiCSAIController::getACLRules(const std::string& table_name) {
+    auto lock = lockCaches();
+    std::vector<ACLRule> rules;
+    for (const auto& pair : m_acl_cache) {
+        if (table_name.empty() || pair.second.table_name == table_name) {
+            rules.push_back(pair.second);
+        }
+    }
+    return rules;
+}
+
+std::shared_ptr<const CounterSnapshot> SONiCSAIController::getCounterSnapshot() {
+    std::shared_ptr<const CounterSnapshot> snapshot = m_counter_poller->snapshot();
+    if (!snapshot && !m_counter_poller->isRunning()) {
+        // Not polling in the background; read once on demand
+        m_counter_poller->pollOnce();
+        snapshot = m_counter_poller->snapshot();
+    }
+    return snapshot;
+}
+
+void SONiCSAIController::setCounterPollInterval(int interval_ms) {
+    m_counter_poll_interval_ms = interval_ms;
+    if (m_counter_poller->isRunning()) {
+        m_counter_poller->stop();
+        m_counter_poller->start(interval_ms);
+    }
+}
+
+std::map<std::string, uint64_t> SONiCSAIController::getPortStatistics(const std::string& port_name) {
+    std::shared_ptr<const CounterSnapshot> snapshot = getCounterSnapshot();
+    if (!snapshot) {
+        return {};
+    }
+    return snapshot->ports.valuesFor(snapshot->ports.find(port_name));
+}
+
+std::map<std::string, uint64_t> SONiCSAIController::getVLANStatistics(uint16_t vlan_id) {
+    std::shared_ptr<const CounterSnapshot> snapshot = getCounterSnapshot();
+    if (!snapshot) {
+        return {};
+    }
+    return snapshot->vlans.valuesFor(snapshot->vlans.find("Vlan" + std::to_string(vlan_id)));
+}
+
+bool SONiCSAIController::clearPortStatistics(const std::string& port_name) {
+    if (!validatePortName(port_name)) {
+        SONIC_LOG_ERROR("SAI", "Invalid port name: " << port_name);
+        return false;
+    }
+    if (!getCounterSnapshot() || !m_counter_poller->clearPort(port_name)) {
+        SONIC_LOG_ERROR("SAI", "No counters for port " << port_name);
+        return false;
+    }
+    SONIC_LOG_INFO("SAI", "Cleared counters for port " << port_name);
+    return true;
+}
+
+void SONiCSAIController::compileACLRuleUnsafe(const common::TableChange& change) {
+    size_t separator = change.key.find('|');
+    if (separator == std::string::npos) {
+        return;
+    }
+    std::string table_name = change.key.substr(0, separator);
+    std::string rule_name = change.key.substr(separator + 1);
+
+    CompiledACLTable& table = m_acl_tables[table_name];
+    table.rules.erase(rule_name);
+    table.errors.erase(rule_name);
+    table.classifier.reset();
+    std::string error;
+    if (!change.deleted && !ACLClassifier::compileRule(rule_name, change.fields, table.rules[rule_name], error)) {
+        table.rules.erase(rule_name);
+        table.errors[rule_name] = error;
+    }
+    if (table.rules.empty() && table.errors.empty()) {
+        m_acl_tables.erase(table_name);
+    }
+}
+
+std::shared_ptr<const ACLClassifier> SONiCSAIController::aclClassifierUnsafe(const std::string& table_name) {
+    auto it = m_acl_tables.find(table_name);
+    if (it == m_acl_tables.end()) {
+        return nullptr;
+    }
+    CompiledACLTable& table = it->second;
+    if (!table.classifier) {
+        std::vector<CompiledACLRule> rules;
+        rules.reserve(table.rules.size());
+        for (const auto& pair : table.rules) {
+            rules.push_back(pair.second);
+        }
+        table.classifier = std::make_shared<const ACLClassifier>(std::move(rules));
+    }
+    return table.classifier;
+}
+
+bool SONiCSAIController::matchPacket(const std::string& table_name, const std::string& src_ip,
+                                     const std::string& dst_ip, uint8_t protocol, uint16_t src_port,
+                                     uint16_t dst_port, ACLRule& rule) {
+    common::IpPrefix src;
+    common::IpPrefix dst;
+    if (!common::IpPrefix::parse(src_ip, src) || !common::IpPrefix::parse(dst_ip, dst) || src.v6 || dst.v6) {
+        SONIC_LOG_ERROR("SAI", "matchPacket needs IPv4 addresses: " << src_ip << " -> " << dst_ip);
+        return false;
+    }
+    ACLPacket packet;
+    packet.src_ip = static_cast<uint32_t>(src.address >> 96);
+    packet.dst_ip = static_cast<uint32_t>(dst.address >> 96);
+    packet.protocol = protocol;
+    packet.src_port = src_port;
+    packet.dst_port = dst_port;
+
+    auto lock = lockCaches();
+    std::shared_ptr<const ACLClassifier> classifier = aclClassifierUnsafe(table_name);
+    const CompiledACLRule* matched = classifier ? classifier->match(packet) : nullptr;
+    if (!matched) {
+        return false;
+    }
+    auto it = m_acl_cache.find(table_name + "|" + matched->name);
+    if (it == m_acl_cache.end()) {
+        return false;
+    }
+    rule = it->second;
+    return true;
+}
+
+std::vector<ACLConflict> SONiCSAIController::findACLConflicts(const std::string& table_name, bool include_overlaps) {
+    std::shared_ptr<const ACLClassifier> classifier;
+    {
+        auto lock = lockCaches();
+        classifier = aclClassifierUnsafe(table_name);
+    }
+    return classifier ? classifier->findConflicts(include_overlaps) : std::vector<ACLConflict>();
+}
+
+std::map<std::string, std::string> SONiCSAIController::getACLCompileErrors(const std::string& table_name) {
+    auto lock = lockCaches();
+    auto it = m_acl_tables.find(table_name);
+    return it != m_acl_tables.end() ? it->second.errors : std::map<std::string, std::string>();
+}
+
+bool SONiCSAIController::createLAG(const std::string& lag_name, const std::vector<std::string>& member_ports) {
+    waitUntilReady(CACHE_READY_TIMEOUT_MS);
+    for (const auto& port_name : member_ports) {
+        if (!validatePortName(port_name)) {
+            SONIC_LOG_ERROR("SAI", "Invalid port name: " << port_name);
+            return false;
+        }
+    }
+    return m_lag_manager->createLAG(lag_name, member_ports);
+}
+
+bool SONiCSAIController::deleteLAG(const std::string& lag_name) {
+    waitUntilReady(CACHE_READY_TIMEOUT_MS);
+    return m_lag_manager->deleteLAG(lag_name);
+}
+
+bool SONiCSAIController::addPortToLAG(const std::string& lag_name, const std::string& port_name) {
+    waitUntilReady(CACHE_READY_TIMEOUT_MS);
+    if (!validatePortName(port_name)) {
+        SONIC_LOG_ERROR("SAI", "Invalid port name: " << port_name);
+        return false;
+    }
+    return m_lag_manager->updateMembers(lag_name, {port_name}, {});
+}
+
+bool SONiCSAIController::removePortFromLAG(const std::string& lag_name, const std::string& port_name) {
+    waitUntilReady(CACHE_READY_TIMEOUT_MS);
+    return m_lag_manager->updateMembers(lag_name, {}, {port_name});
+}
+
+bool SONiCSAIController::setLAGMembers(const std::string& lag_name, const std::vector<std::string>& member_ports) {
+    waitUntilReady(CACHE_READY_TIMEOUT_MS);
+    for (const auto& port_name : member_ports) {
+        if (!validatePortName(port_name)) {
+            SONIC_LOG_ERROR("SAI", "Invalid port name: " << port_name);
+            return false;
+        }
+    }
+    return m_lag_manager->setMembers(lag_name, member_ports);
+}
+
+bool SONiCSAIController::getLAGInfo(const std::string& lag_name, LAGInfo& info) {
+    waitUntilReady(CACHE_READY_TIMEOUT_MS);
+    return m_lag_manager->getLAG(lag_name, info);
+}
+
+std::vector<LAGInfo> SONiCSAIController::getAllLAGs() {
+    waitUntilReady(CACHE_READY_TIMEOUT_MS);
+    return m_lag_manager->getAllLAGs();
+}
+
+bool SONiCSAIController::handlePortLinkEvent(const std::string& port_name, bool link_up) {
+    // Runs on the interrupt dispatcher, which must not stall behind the cache load
+    {
+        std::lock_guard<std::mutex> lock(m_link_event_mutex);
+        if (!m_link_events_live) {
+            m_pending_link_events[port_name] = link_up;
+            return true;
+        }
+    }
+    return m_lag_manager->handleLinkEvent(port_name, link_up);
+}
+
+void SONiCSAIController::replayLinkEvents(bool loaded) {
+    // Held across the replay so a live event cannot overtake a queued one for its port
+    std::lock_guard<std::mutex> lock(m_link_event_mutex);
+    if (loaded) {
+        for (const auto& event : m_pending_link_events) {
+            m_lag_manager->handleLinkEvent(event.first, event.second);
+        }
+    } else if (!m_pending_link_events.empty()) {
+        SONIC_LOG_WARN("SAI", "Dropping " << m_pending_link_events.size() << " link events, LAGs never loaded");
+    }
+    m_pending_link_events.clear();
+    m_link_events_live = true;
+}
+
+void SONiCSAIController::subscribeLinkEvents(interrupts::SONiCInterruptController& interrupt_controller) {
+    // A released flap suppression reports the port's settled state, so it counts as a transition too
+    interrupt_controller.registerGlobalEventHandler([this](const interrupts::PortEvent& event) {
+        if (event.event_type == interrupts::CableEvent::LINK_UP ||
+            event.event_type == interrupts::CableEvent::LINK_DOWN ||
+            event.event_type == interrupts::CableEvent::FLAP_UNSUPPRESSED) {
+            handlePortLinkEvent(event.port_name, event.new_status == interrupts::LinkStatus::UP);
+        }
+    });
+}
+
 } // namespace sai
 } // namespace sonic
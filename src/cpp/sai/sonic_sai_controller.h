@@ -5,9 +5,28 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <future>
 #include <cstdint>
+#include "../common/route_table.h"
+#include "../common/fdb_table.h"
+#include "counter_poller.h"
+#include "acl_classifier.h"
+#include "lag_manager.h"
 
 namespace sonic {
+namespace common {
+class RedisClient;
+class RedisTableWatcher;
+struct TableChange;
+}
+
+namespace interrupts {
+class SONiCInterruptController;
+}
+
 namespace sai {
 
 // SAI Object Types
@@ -81,15 +100,66 @@ struct ACLRule {
     uint32_t priority;
 };
 
+// Batch of CONFIG_DB changes, validated and written in one MULTI/EXEC by
+// SONiCSAIController::commitTransaction(); operations apply in the order added
+class ConfigTransaction {
+public:
+    ConfigTransaction& createVLAN(uint16_t vlan_id, const std::string& description = "");
+    ConfigTransaction& deleteVLAN(uint16_t vlan_id);
+    ConfigTransaction& setVLANDescription(uint16_t vlan_id, const std::string& description);
+    ConfigTransaction& addPortToVLAN(uint16_t vlan_id, const std::string& port_name, bool tagged = true);
+    ConfigTransaction& removePortFromVLAN(uint16_t vlan_id, const std::string& port_name);
+    ConfigTransaction& setPortAdminStatus(const std::string& port_name, bool up);
+    ConfigTransaction& setPortSpeed(const std::string& port_name, uint32_t speed);
+    ConfigTransaction& setPortMTU(const std::string& port_name, uint32_t mtu);
+
+    size_t size() const { return m_ops.size(); }
+    bool empty() const { return m_ops.empty(); }
+    void clear() { m_ops.clear(); }
+
+private:
+    friend class SONiCSAIController;
+
+    enum class OpType {
+        CREATE_VLAN,
+        DELETE_VLAN,
+        SET_VLAN_DESCRIPTION,
+        ADD_VLAN_MEMBER,
+        REMOVE_VLAN_MEMBER,
+        SET_PORT_ADMIN_STATUS,
+        SET_PORT_SPEED,
+        SET_PORT_MTU
+    };
+
+    struct Op {
+        OpType type;
+        uint16_t vlan_id;
+        std::string port_name;
+        std::string text;       // VLAN description
+        uint32_t value;         // Speed or MTU
+        bool flag;              // Tagged membership or admin up
+    };
+
+    ConfigTransaction& add(OpType type, uint16_t vlan_id, const std::string& port_name,
+                           const std::string& text, uint32_t value, bool flag);
+
+    std::vector<Op> m_ops;
+};
+
 // Main SAI Controller Class
 class SONiCSAIController {
 public:
     SONiCSAIController();
     ~SONiCSAIController();
 
-    // Initialize SAI connection to SONiC
+    // Initialize SAI connection to SONiC; the caches load in the background and
+    // cache-backed calls wait for them (see waitUntilReady)
     bool initialize();
     void cleanup();
+    // Block until the initial cache and LAG load finished; timeout_ms < 0 waits forever.
+    // False on timeout or when the load was abandoned by cleanup()
+    bool waitUntilReady(int timeout_ms = -1);
+    bool isReady() const;
 
     // VLAN Management
     bool createVLAN(uint16_t vlan_id, const std::string& name = "");
@@ -101,6 +171,11 @@ public:
     std::vector<VLANInfo> getAllVLANs();
     bool setVLANDescription(uint16_t vlan_id, const std::string& description);
 
+    // Validate a batch against the caches, apply it to them and write it to CONFIG_DB
+    // atomically. The caches are rolled back if validation or the write fails, or
+    // reloaded from CONFIG_DB if EXEC ran but some commands in it failed
+    bool commitTransaction(const ConfigTransaction& transaction);
+
     // Port Management
     bool setPortAdminStatus(const std::string& port_name, bool up);
     bool setPortSpeed(const std::string& port_name, uint32_t speed);
@@ -125,6 +200,8 @@ public:
                   const std::string& next_hop, const std::string& interface = "");
     bool deleteRoute(const std::string& destination, const std::string& prefix_length);
     std::vector<RouteEntry> getRouteTable();
+    // Longest-prefix match of an address or prefix in a VRF ("" = default)
+    bool lookupRoute(const std::string& address, RouteEntry& route, const std::string& vrf = "");
 
     // ACL Management
     bool createACLTable(const std::string& table_name, const std::string& stage = "ingress");
@@ -132,11 +209,21 @@ public:
     bool addACLRule(const ACLRule& rule);
     bool deleteACLRule(uint32_t rule_id, const std::string& table_name);
     std::vector<ACLRule> getACLRules(const std::string& table_name = "");
+    // Classify an IPv4 packet against a table's compiled rules; false when no rule matches
+    bool matchPacket(const std::string& table_name, const std::string& src_ip, const std::string& dst_ip,
+                     uint8_t protocol, uint16_t src_port, uint16_t dst_port, ACLRule& rule);
+    // Rules a single higher-priority rule hides, optionally with partial overlaps
+    std::vector<ACLConflict> findACLConflicts(const std::string& table_name, bool include_overlaps = false);
+    // Rules that could not be compiled, keyed by rule name
+    std::map<std::string, std::string> getACLCompileErrors(const std::string& table_name);
 
-    // Statistics and Monitoring
+    // Statistics and Monitoring, served from the counter poller's latest snapshot
     std::map<std::string, uint64_t> getPortStatistics(const std::string& port_name);
     std::map<std::string, uint64_t> getVLANStatistics(uint16_t vlan_id);
     bool clearPortStatistics(const std::string& port_name);
+    // All port/VLAN counters, deltas and rates from one poll; never blocks on the poller
+    std::shared_ptr<const CounterSnapshot> getCounterSnapshot();
+    void setCounterPollInterval(int interval_ms);
 
     // Test Functions
     bool runSAIFunctionalTests();
@@ -151,6 +238,17 @@ public:
     bool deleteLAG(const std::string& lag_name);
     bool addPortToLAG(const std::string& lag_name, const std::string& port_name);
     bool removePortFromLAG(const std::string& lag_name, const std::string& port_name);
+    // Replace the whole membership in one CONFIG_DB transaction
+    bool setLAGMembers(const std::string& lag_name, const std::vector<std::string>& member_ports);
+    bool getLAGInfo(const std::string& lag_name, LAGInfo& info);
+    std::vector<LAGInfo> getAllLAGs();
+    // Link state from the interrupt controller; returns false for ports outside any LAG.
+    // Never blocks: until the caches are ready the latest state per port is held and
+    // applied once the LAGs have loaded, and true is returned
+    bool handlePortLinkEvent(const std::string& port_name, bool link_up);
+    // Route the controller's link transitions into handlePortLinkEvent. Registers a
+    // global handler, so call again after the interrupt controller's clearAllHandlers()
+    void subscribeLinkEvents(interrupts::SONiCInterruptController& interrupt_controller);
 
     // Redis communication (public for test framework access)
     bool executeRedisCommand(const std::string& command, int db_id, std::string& output);
@@ -158,6 +256,10 @@ public:
 private:
     bool m_initialized;
     std::string m_sonic_container_name;
+    std::unique_ptr<common::RedisClient> m_redis;
+    std::unique_ptr<CounterPoller> m_counter_poller;
+    int m_counter_poll_interval_ms;
+    std::unique_ptr<LAGManager> m_lag_manager;
     
     // Helper functions for SONiC communication
     bool executeSONiCCommand(const std::string& command, std::string& output);
@@ -172,23 +274,86 @@ private:
     bool validateMACAddress(const std::string& mac_address);
     bool validateIPAddress(const std::string& ip_address);
     
-    // Internal state management
+    // Internal state management, kept current from CONFIG_DB/APPL_DB notifications
+    mutable std::mutex m_cache_mutex;
     std::map<uint16_t, VLANInfo> m_vlan_cache;
     std::map<std::string, PortInfo> m_port_cache;
-    std::vector<FDBEntry> m_fdb_cache;
-    std::vector<RouteEntry> m_route_cache;
-    std::vector<ACLRule> m_acl_cache;
+    common::FdbTable m_fdb_cache;
+    std::vector<common::FdbNotification> m_fdb_pending;  // FDB_TABLE changes not yet applied
+    // Cached route attributes; destination/prefix_length come from the trie key
+    struct CachedRoute {
+        std::string next_hop;
+        std::string interface;
+        uint32_t metric = 0;
+    };
+    std::map<std::string, common::RouteTable<CachedRoute>> m_route_cache; // per VRF, "" = default
+    std::map<std::string, ACLRule> m_acl_cache;      // keyed by "<table>|<rule>"
+    // Compiled rules per ACL table; the classifier is rebuilt on first use after a change
+    struct CompiledACLTable {
+        std::map<std::string, CompiledACLRule> rules;   // by rule name
+        std::map<std::string, std::string> errors;      // rules that failed to compile
+        std::shared_ptr<const ACLClassifier> classifier;
+    };
+    std::map<std::string, CompiledACLTable> m_acl_tables;
+
+    // Cache sync
+    std::unique_ptr<common::RedisTableWatcher> m_watcher;
+    std::thread m_sync_thread;
+    std::atomic<bool> m_sync_running;
+    // Fulfilled by the sync thread once the initial load is done (false if it gave up)
+    std::promise<bool> m_ready_promise;
+    std::shared_future<bool> m_ready;
+    static constexpr int CACHE_READY_TIMEOUT_MS = 30000;
+
+    // Link events that arrive before the LAGs load, latest state per port
+    std::mutex m_link_event_mutex;
+    bool m_link_events_live;
+    std::map<std::string, bool> m_pending_link_events;
     
     // SAI object management
     uint32_t m_next_object_id;
     std::map<uint32_t, SAIObjectType> m_object_type_map;
     
     // Internal helper methods
-    bool refreshVLANCache();
-    bool refreshPortCache();
-    bool refreshFDBCache();
-    bool refreshRouteCache();
-    bool refreshACLCache();
+    bool warmLoadCaches();
+    bool initialLoad();
+    // Wait (bounded) for the initial load, then take m_cache_mutex
+    std::unique_lock<std::mutex> lockCaches();
+    void startCacheSync();
+    void stopCacheSync();
+    void cacheSyncLoop();
+    // Apply the link events held during the initial load, then let new ones through
+    void replayLinkEvents(bool loaded);
+
+    // Cache updates; all assume m_cache_mutex is held
+    void applyTableChange(const common::TableChange& change);
+    void applyPortChange(const common::TableChange& change);
+    void applyPortStateChange(const common::TableChange& change);
+    void applyVLANChange(const common::TableChange& change);
+    void applyVLANMemberChange(const common::TableChange& change);
+    void applyFDBChange(const common::TableChange& change);
+    void applyPendingFDBUnsafe();
+    static FDBEntry toFDBEntry(const common::FdbRecord& record);
+    void applyRouteChange(const common::TableChange& change);
+    void applyACLRuleChange(const common::TableChange& change);
+    size_t routeCountUnsafe() const;
+    void compileACLRuleUnsafe(const common::TableChange& change);
+    std::shared_ptr<const ACLClassifier> aclClassifierUnsafe(const std::string& table_name);
+    static RouteEntry toRouteEntry(const common::IpPrefix& prefix, const CachedRoute& route);
+    void setVLANMembershipUnsafe(uint16_t vlan_id, const std::string& port_name, bool member, bool tagged);
+
+    // Cache entries as they were before a transaction touched them; false = absent
+    struct TransactionUndo {
+        std::map<uint16_t, std::pair<bool, VLANInfo>> vlans;
+        std::map<std::string, std::pair<bool, PortInfo>> ports;
+    };
+    bool applyTransactionOpUnsafe(const ConfigTransaction::Op& op, std::vector<std::vector<std::string>>& commands,
+                                  TransactionUndo& undo);
+    void saveVLANUnsafe(uint16_t vlan_id, TransactionUndo& undo);
+    void savePortUnsafe(const std::string& port_name, TransactionUndo& undo);
+    void rollbackTransactionUnsafe(const TransactionUndo& undo);
+    // Reload every key the transaction touched from CONFIG_DB; takes the cache lock
+    bool resyncTransactionKeys(const TransactionUndo& undo);
     
     uint32_t generateObjectID(SAIObjectType type);
     bool isValidObjectID(uint32_t object_id, SAIObjectType expected_type);
@@ -0,0 +1,436 @@
+/**
+ * @file nexthop_registry.cpp
+ * @brief SONiC SwSS Next-Hop / Next-Hop-Group Registry Implementation
+ */
+
+#include "nexthop_registry.h"
+#include <iostream>
+#include <algorithm>
+#include <arpa/inet.h>
+
+namespace sonic {
+namespace swss {
+
+namespace {
+
+std::string trim(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    size_t end = text.find_last_not_of(" \t");
+    return text.substr(begin, end - begin + 1);
+}
+
+void toSAIAddress(const common::IpPrefix& address, sai_ip_address_t& ip) {
+    if (address.v6) {
+        ip.addr_family = SAI_IP_ADDR_FAMILY_IPV6;
+        for (size_t i = 0; i < 16; ++i) {
+            ip.addr.ip6[i] = static_cast<uint8_t>(address.address >> (120 - 8 * i));
+        }
+    } else {
+        ip.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        ip.addr.ip4 = htonl(static_cast<uint32_t>(address.address >> 96));
+    }
+}
+
+} // anonymous namespace
+
+bool NextHopKey::operator<(const NextHopKey& other) const {
+    if (address.v6 != other.address.v6) {
+        return !address.v6;
+    }
+    if (address.address != other.address.address) {
+        return address.address < other.address.address;
+    }
+    return interface < other.interface;
+}
+
+std::string NextHopKey::toString() const {
+    return interface.empty() ? address.addressString() : address.addressString() + "@" + interface;
+}
+
+NextHopRegistry::NextHopRegistry()
+    : switch_id_(SAI_NULL_OBJECT_ID), next_hop_api_(nullptr), next_hop_group_api_(nullptr),
+      next_hop_count_(0), member_count_(0) {
+}
+
+bool NextHopRegistry::initialize(sai_object_id_t switch_id) {
+    switch_id_ = switch_id;
+
+    sai_status_t status = sai_api_query(SAI_API_NEXT_HOP, (void**)&next_hop_api_);
+    if (status != SAI_STATUS_SUCCESS) {
+        std::cerr << "Failed to query Next Hop API: " << status << std::endl;
+        return false;
+    }
+    status = sai_api_query(SAI_API_NEXT_HOP_GROUP, (void**)&next_hop_group_api_);
+    if (status != SAI_STATUS_SUCCESS) {
+        std::cerr << "Failed to query Next Hop Group API: " << status << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool NextHopRegistry::parse(const std::string& next_hops, NextHopSet& set) {
+    set.clear();
+    size_t start = 0;
+    while (start <= next_hops.size()) {
+        size_t comma = next_hops.find(',', start);
+        std::string token = trim(next_hops.substr(start, comma == std::string::npos ? std::string::npos
+                                                                                    : comma - start));
+        size_t at = token.find('@');
+        std::string address = token.substr(0, at);
+
+        NextHopKey key;
+        if (address.find('/') != std::string::npos || !common::IpPrefix::parse(address, key.address)) {
+            return false;
+        }
+        if (at != std::string::npos) {
+            key.interface = token.substr(at + 1);
+        }
+        set.push_back(std::move(key));
+
+        if (comma == std::string::npos) {
+            break;
+        }
+        start = comma + 1;
+    }
+
+    std::sort(set.begin(), set.end());
+    set.erase(std::unique(set.begin(), set.end()), set.end());
+    return !set.empty();
+}
+
+sai_object_id_t NextHopRegistry::acquire(const std::string& next_hops) {
+    // Fast path: this exact spelling was seen before
+    auto alias = by_text_.find(next_hops);
+    if (alias != by_text_.end()) {
+        entries_[alias->second].refs++;
+        return alias->second;
+    }
+
+    NextHopSet set;
+    if (!parse(next_hops, set)) {
+        std::cerr << "Invalid next hop: " << next_hops << std::endl;
+        return SAI_NULL_OBJECT_ID;
+    }
+    sai_object_id_t oid = acquireSet(set);
+    if (oid != SAI_NULL_OBJECT_ID) {
+        by_text_[next_hops] = oid;
+        entries_[oid].aliases.push_back(next_hops);
+    }
+    return oid;
+}
+
+sai_object_id_t NextHopRegistry::acquireSet(const NextHopSet& set) {
+    auto existing = by_set_.find(set);
+    if (existing != by_set_.end()) {
+        entries_[existing->second].refs++;
+        return existing->second;
+    }
+
+    Entry entry;
+    entry.members = set;
+    entry.refs = 1;
+    sai_object_id_t oid = SAI_NULL_OBJECT_ID;
+
+    if (set.size() == 1) {
+        oid = createNextHop(set[0]);
+        if (oid == SAI_NULL_OBJECT_ID) {
+            return SAI_NULL_OBJECT_ID;
+        }
+        next_hop_count_++;
+    } else {
+        // Each group holds one reference on every member next hop
+        for (const auto& member : set) {
+            sai_object_id_t next_hop_oid = acquireSet(NextHopSet{member});
+            if (next_hop_oid == SAI_NULL_OBJECT_ID) {
+                for (sai_object_id_t acquired : entry.next_hop_oids) {
+                    release(acquired);
+                }
+                return SAI_NULL_OBJECT_ID;
+            }
+            entry.next_hop_oids.push_back(next_hop_oid);
+        }
+        oid = createGroup(entry.next_hop_oids, entry.member_oids);
+        if (oid == SAI_NULL_OBJECT_ID) {
+            for (sai_object_id_t acquired : entry.next_hop_oids) {
+                release(acquired);
+            }
+            return SAI_NULL_OBJECT_ID;
+        }
+        member_count_ += entry.member_oids.size();
+    }
+
+    by_set_[set] = oid;
+    entries_[oid] = std::move(entry);
+    return oid;
+}
+
+void NextHopRegistry::release(sai_object_id_t oid) {
+    auto it = entries_.find(oid);
+    if (it == entries_.end()) {
+        std::cerr << "Release of unknown next hop object 0x" << std::hex << oid << std::dec << std::endl;
+        return;
+    }
+    if (--it->second.refs == 0) {
+        removeEntry(oid);
+    }
+}
+
+size_t NextHopRegistry::refCount(sai_object_id_t oid) const {
+    auto it = entries_.find(oid);
+    return it == entries_.end() ? 0 : it->second.refs;
+}
+
+sai_object_id_t NextHopRegistry::createNextHop(const NextHopKey& key) {
+    if (!next_hop_api_) {
+        std::cerr << "Next Hop API not initialized" << std::endl;
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    // No router interface objects exist in this tree; the interface only
+    // distinguishes otherwise identical (e.g. link-local) next hops
+    sai_attribute_t attrs[2];
+    attrs[0].id = SAI_NEXT_HOP_ATTR_TYPE;
+    attrs[0].value.s32 = SAI_NEXT_HOP_TYPE_IP;
+    attrs[1].id = SAI_NEXT_HOP_ATTR_IP;
+    toSAIAddress(key.address, attrs[1].value.ipaddr);
+
+    sai_object_id_t oid = SAI_NULL_OBJECT_ID;
+    sai_status_t status = next_hop_api_->create_next_hop(&oid, switch_id_, 2, attrs);
+    if (status != SAI_STATUS_SUCCESS) {
+        std::cerr << "Failed to create next hop " << key.toString() << ": " << status << std::endl;
+        return SAI_NULL_OBJECT_ID;
+    }
+    return oid;
+}
+
+sai_object_id_t NextHopRegistry::createGroup(const std::vector<sai_object_id_t>& next_hop_oids,
+                                             std::vector<sai_object_id_t>& member_oids) {
+    if (!next_hop_group_api_) {
+        std::cerr << "Next Hop Group API not initialized" << std::endl;
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    sai_attribute_t group_attr;
+    group_attr.id = SAI_NEXT_HOP_GROUP_ATTR_TYPE;
+    group_attr.value.s32 = SAI_NEXT_HOP_GROUP_TYPE_ECMP;
+
+    sai_object_id_t group_oid = SAI_NULL_OBJECT_ID;
+    sai_status_t status = next_hop_group_api_->create_next_hop_group(&group_oid, switch_id_, 1, &group_attr);
+    if (status != SAI_STATUS_SUCCESS) {
+        std::cerr << "Failed to create next hop group: " << status << std::endl;
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    size_t count = next_hop_oids.size();
+    std::vector<sai_attribute_t> attrs(count * 2);
+    for (size_t i = 0; i < count; ++i) {
+        attrs[i * 2].id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID;
+        attrs[i * 2].value.oid = group_oid;
+        attrs[i * 2 + 1].id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+        attrs[i * 2 + 1].value.oid = next_hop_oids[i];
+    }
+
+    std::vector<sai_object_id_t> oids(count, SAI_NULL_OBJECT_ID);
+    std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+    bool use_bulk = (next_hop_group_api_->create_next_hop_group_members != nullptr);
+    if (use_bulk) {
+        std::vector<uint32_t> attr_counts(count, 2);
+        std::vector<const sai_attribute_t*> attr_lists(count);
+        for (size_t i = 0; i < count; ++i) {
+            attr_lists[i] = &attrs[i * 2];
+        }
+        status = next_hop_group_api_->create_next_hop_group_members(switch_id_, static_cast<uint32_t>(count),
+                                                                    attr_counts.data(), attr_lists.data(),
+                                                                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+                                                                    oids.data(), statuses.data());
+        use_bulk = !(status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED);
+    }
+    if (!use_bulk) {
+        for (size_t i = 0; i < count; ++i) {
+            statuses[i] = next_hop_group_api_->create_next_hop_group_member(&oids[i], switch_id_, 2, &attrs[i * 2]);
+            if (statuses[i] != SAI_STATUS_SUCCESS) {
+                break;
+            }
+        }
+    }
+
+    member_oids.clear();
+    bool complete = true;
+    for (size_t i = 0; i < count; ++i) {
+        if (statuses[i] == SAI_STATUS_SUCCESS) {
+            member_oids.push_back(oids[i]);
+        } else {
+            complete = false;
+        }
+    }
+    if (!complete) {
+        std::cerr << "Failed to add next hop group members, rolling back group" << std::endl;
+        removeGroupMembers(member_oids);
+        member_oids.clear();
+        next_hop_group_api_->remove_next_hop_group(group_oid);
+        return SAI_NULL_OBJECT_ID;
+    }
+    return group_oid;
+}
+
+void NextHopRegistry::removeGroupMembers(const std::vector<sai_object_id_t>& member_oids) {
+    if (member_oids.empty()) {
+        return;
+    }
+
+    std::vector<sai_status_t> statuses(member_oids.size(), SAI_STATUS_NOT_EXECUTED);
+    if (next_hop_group_api_->remove_next_hop_group_members) {
+        sai_status_t status = next_hop_group_api_->remove_next_hop_group_members(
+            static_cast<uint32_t>(member_oids.size()), member_oids.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+            statuses.data());
+        if (status != SAI_STATUS_NOT_IMPLEMENTED && status != SAI_STATUS_NOT_SUPPORTED) {
+            return;
+        }
+    }
+    for (sai_object_id_t member_oid : member_oids) {
+        next_hop_group_api_->remove_next_hop_group_member(member_oid);
+    }
+}
+
+void NextHopRegistry::save(common::SnapshotWriter& writer) const {
+    writer.putU32(static_cast<uint32_t>(entries_.size()));
+    for (const auto& item : entries_) {
+        const Entry& entry = item.second;
+        std::string members;
+        for (const auto& key : entry.members) {
+            members += (members.empty() ? "" : ",") + key.toString();
+        }
+        writer.putU64(item.first);
+        writer.putU64(entry.refs);
+        writer.putString(members);
+        writer.putU32(static_cast<uint32_t>(entry.next_hop_oids.size()));
+        for (sai_object_id_t oid : entry.next_hop_oids) {
+            writer.putU64(oid);
+        }
+        writer.putU32(static_cast<uint32_t>(entry.member_oids.size()));
+        for (sai_object_id_t oid : entry.member_oids) {
+            writer.putU64(oid);
+        }
+        writer.putU32(static_cast<uint32_t>(entry.aliases.size()));
+        for (const auto& alias : entry.aliases) {
+            writer.putString(alias);
+        }
+    }
+}
+
+void NextHopRegistry::reset() {
+    by_set_.clear();
+    by_text_.clear();
+    entries_.clear();
+    next_hop_count_ = 0;
+    member_count_ = 0;
+}
+
+bool NextHopRegistry::restore(common::SnapshotCursor& cursor) {
+    reset();
+
+    auto readOIDs = [&cursor](std::vector<sai_object_id_t>& oids) {
+        uint32_t size = 0;
+        cursor.getU32(size);
+        for (uint32_t i = 0; i < size && cursor.ok(); ++i) {
+            uint64_t oid = 0;
+            cursor.getU64(oid);
+            oids.push_back(oid);
+        }
+    };
+
+    uint32_t count = 0;
+    cursor.getU32(count);
+    bool valid = cursor.ok();
+    for (uint32_t i = 0; i < count && valid; ++i) {
+        uint64_t oid = 0;
+        uint64_t refs = 0;
+        std::string members;
+        Entry entry;
+        cursor.getU64(oid);
+        cursor.getU64(refs);
+        cursor.getString(members);
+        entry.refs = static_cast<size_t>(refs);
+        readOIDs(entry.next_hop_oids);
+        readOIDs(entry.member_oids);
+        uint32_t alias_count = 0;
+        cursor.getU32(alias_count);
+        for (uint32_t j = 0; j < alias_count && cursor.ok(); ++j) {
+            std::string alias;
+            cursor.getString(alias);
+            entry.aliases.push_back(std::move(alias));
+        }
+
+        valid = cursor.ok() && parse(members, entry.members) && entry.refs > 0;
+        if (!valid) {
+            std::cerr << "Malformed next hop entry in snapshot" << std::endl;
+            break;
+        }
+
+        bool group = entry.members.size() > 1;
+        valid = sai_object_type_query(oid) == (group ? SAI_OBJECT_TYPE_NEXT_HOP_GROUP : SAI_OBJECT_TYPE_NEXT_HOP);
+        for (sai_object_id_t member_oid : entry.member_oids) {
+            valid = valid && sai_object_type_query(member_oid) == SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER;
+        }
+        if (!valid) {
+            std::cerr << "Next hop " << members << " from snapshot no longer exists in SAI" << std::endl;
+            break;
+        }
+
+        by_set_[entry.members] = oid;
+        for (const auto& alias : entry.aliases) {
+            by_text_[alias] = oid;
+        }
+        next_hop_count_ += group ? 0 : 1;
+        member_count_ += entry.member_oids.size();
+        entries_[oid] = std::move(entry);
+    }
+
+    // Groups must only reference restored next hops
+    for (const auto& item : entries_) {
+        for (sai_object_id_t next_hop_oid : item.second.next_hop_oids) {
+            valid = valid && entries_.count(next_hop_oid) > 0;
+        }
+    }
+
+    if (!valid) {
+        reset();
+    }
+    return valid;
+}
+
+void NextHopRegistry::removeEntry(sai_object_id_t oid) {
+    auto it = entries_.find(oid);
+    Entry entry = std::move(it->second);
+    entries_.erase(it);
+    by_set_.erase(entry.members);
+    for (const auto& alias : entry.aliases) {
+        by_text_.erase(alias);
+    }
+
+    if (entry.members.size() == 1) {
+        sai_status_t status = next_hop_api_->remove_next_hop(oid);
+        if (status != SAI_STATUS_SUCCESS) {
+            std::cerr << "Failed to remove next hop " << entry.members[0].toString() << ": " << status << std::endl;
+        }
+        next_hop_count_--;
+        return;
+    }
+
+    // Members must go before the group, and the group before its next hops
+    removeGroupMembers(entry.member_oids);
+    member_count_ -= entry.member_oids.size();
+    sai_status_t status = next_hop_group_api_->remove_next_hop_group(oid);
+    if (status != SAI_STATUS_SUCCESS) {
+        std::cerr << "Failed to remove next hop group 0x" << std::hex << oid << std::dec << ": " << status << std::endl;
+    }
+    for (sai_object_id_t next_hop_oid : entry.next_hop_oids) {
+        release(next_hop_oid);
+    }
+}
+
+} // namespace swss
+} // namespace sonic
@@ -0,0 +1,146 @@
+/**
+ * @file nexthop_registry.h
+ * @brief SONiC SwSS Next-Hop / Next-Hop-Group Registry Header
+ *
+ * Routes name their next hops as text ("10.0.0.1", "10.0.0.1@Ethernet0",
+ * "10.0.0.1,10.0.0.2" for ECMP). The registry parses that text once per
+ * distinct spelling, dedups on the parsed (address, interface) set and hands
+ * out one refcounted SAI object per set: a NEXT_HOP for a single member, a
+ * NEXT_HOP_GROUP for ECMP. Groups share the member NEXT_HOP objects, and the
+ * last release removes the SAI objects again.
+ */
+
+#ifndef SONIC_SWSS_NEXTHOP_REGISTRY_H
+#define SONIC_SWSS_NEXTHOP_REGISTRY_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include "../common/ip_prefix.h"
+#include "../common/warm_snapshot.h"
+
+extern "C" {
+#include "sai.h"
+#include "sainexthop.h"
+#include "sainexthopgroup.h"
+}
+
+namespace sonic {
+namespace swss {
+
+/**
+ * @brief One next hop: host address plus optional egress interface
+ */
+struct NextHopKey {
+    common::IpPrefix address;
+    std::string interface;
+
+    bool operator<(const NextHopKey& other) const;
+    bool operator==(const NextHopKey& other) const {
+        return address == other.address && interface == other.interface;
+    }
+    std::string toString() const;
+};
+
+/**
+ * @brief Sorted, duplicate-free ECMP member set
+ */
+typedef std::vector<NextHopKey> NextHopSet;
+
+/**
+ * @brief Refcounted cache of SAI next-hop and next-hop-group objects (not thread-safe)
+ */
+class NextHopRegistry {
+public:
+    NextHopRegistry();
+
+    NextHopRegistry(const NextHopRegistry&) = delete;
+    NextHopRegistry& operator=(const NextHopRegistry&) = delete;
+
+    /**
+     * @brief Query the SAI next-hop APIs
+     * @return true if successful, false otherwise
+     */
+    bool initialize(sai_object_id_t switch_id);
+
+    /**
+     * @brief Parse "ip[@ifname][,ip[@ifname]...]" into a sorted member set
+     * @return false on an empty list or a malformed address
+     */
+    static bool parse(const std::string& next_hops, NextHopSet& set);
+
+    /**
+     * @brief Take one reference on the object for a next-hop list, creating it on first use
+     * @return NEXT_HOP or NEXT_HOP_GROUP OID, SAI_NULL_OBJECT_ID on parse or SAI failure
+     */
+    sai_object_id_t acquire(const std::string& next_hops);
+
+    /**
+     * @brief Drop one reference; the SAI objects are removed with the last one
+     */
+    void release(sai_object_id_t oid);
+
+    /**
+     * @brief References currently held on oid (0 if unknown)
+     */
+    size_t refCount(sai_object_id_t oid) const;
+
+    size_t nextHopCount() const { return next_hop_count_; }
+    size_t groupCount() const { return entries_.size() - next_hop_count_; }
+
+    /**
+     * @brief SAI objects owned by the registry: next hops, groups and group members
+     */
+    size_t saiObjectCount() const { return entries_.size() + member_count_; }
+
+    /**
+     * @brief Append every entry, with its OIDs and reference count, to the open snapshot section
+     */
+    void save(common::SnapshotWriter& writer) const;
+
+    /**
+     * @brief Replace the registry contents with entries written by save()
+     *
+     * Every restored OID must still exist in SAI with the expected type, so
+     * a snapshot from before an ASIC reset is refused.
+     * @return false, leaving the registry empty, on malformed data or a missing object
+     */
+    bool restore(common::SnapshotCursor& cursor);
+
+    /**
+     * @brief Forget every entry without removing its SAI objects
+     */
+    void reset();
+
+private:
+    struct Entry {
+        NextHopSet members;
+        std::vector<sai_object_id_t> next_hop_oids; ///< Referenced NEXT_HOP entries (groups only)
+        std::vector<sai_object_id_t> member_oids;   ///< Group member objects (groups only)
+        std::vector<std::string> aliases;           ///< Spellings cached in by_text_
+        size_t refs = 0;
+    };
+
+    sai_object_id_t acquireSet(const NextHopSet& set);
+    sai_object_id_t createNextHop(const NextHopKey& key);
+    sai_object_id_t createGroup(const std::vector<sai_object_id_t>& next_hop_oids,
+                                std::vector<sai_object_id_t>& member_oids);
+    void removeGroupMembers(const std::vector<sai_object_id_t>& member_oids);
+    void removeEntry(sai_object_id_t oid);
+
+    sai_object_id_t switch_id_;
+    sai_next_hop_api_t* next_hop_api_;
+    sai_next_hop_group_api_t* next_hop_group_api_;
+
+    std::map<NextHopSet, sai_object_id_t> by_set_;
+    std::unordered_map<std::string, sai_object_id_t> by_text_;
+    std::unordered_map<sai_object_id_t, Entry> entries_;
+    size_t next_hop_count_;
+    size_t member_count_;
+};
+
+} // namespace swss
+} // namespace sonic
+
+#endif // SONIC_SWSS_NEXTHOP_REGISTRY_H
@@ -0,0 +1,134 @@
+/**
+ * @file orch.cpp
+ * @brief SONiC SwSS Orch Base Class Implementation
+ */
+
+#include "orch.h"
+#include <atomic>
+#include <iostream>
+#include <unordered_set>
+
+namespace sonic {
+namespace swss {
+
+namespace {
+
+// Shared by every Orch and taken under the Orch's queue lock, so once nextSequence()
+// has moved past a change, locking that Orch's queue shows it
+std::atomic<uint64_t> g_next_sequence{0};
+
+} // anonymous namespace
+
+Orch::Orch(const std::string& name, int priority, const std::vector<common::WatchedTable>& tables)
+    : name_(name), priority_(priority), tables_(tables), queues_(tables.size()), pending_(0), next_table_(0) {
+}
+
+void Orch::enqueue(common::TableChange change) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    TableQueue& queue = queues_[change.table];
+    uint64_t sequence = g_next_sequence.fetch_add(1, std::memory_order_acq_rel);
+    auto existing = queue.by_key.find(change.key);
+    if (existing != queue.by_key.end()) {
+        // Only the latest state of a key matters, and it goes after what was queued before it
+        queue.changes.erase(existing->second);
+        queue.changes.push_back({std::move(change), sequence});
+        existing->second = std::prev(queue.changes.end());
+        return;
+    }
+    std::string key = change.key;
+    queue.changes.push_back({std::move(change), sequence});
+    queue.by_key[key] = std::prev(queue.changes.end());
+    pending_++;
+}
+
+bool Orch::hasPendingWork() const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return pending_ > 0;
+}
+
+size_t Orch::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return pending_;
+}
+
+uint64_t Orch::getOldestSequence() const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    uint64_t oldest = NO_SEQUENCE;
+    for (const auto& queue : queues_) {
+        if (!queue.changes.empty() && queue.changes.front().sequence < oldest) {
+            oldest = queue.changes.front().sequence;
+        }
+    }
+    return oldest;
+}
+
+uint64_t Orch::nextSequence() {
+    return g_next_sequence.load(std::memory_order_acquire);
+}
+
+size_t Orch::drain(size_t max_items, uint64_t before) {
+    size_t processed = 0;
+    while (processed < max_items) {
+        common::TableChange change;
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            if (pending_ == 0) {
+                break;
+            }
+            size_t skipped = 0;
+            while (skipped < queues_.size() && (queues_[next_table_].changes.empty() ||
+                                                queues_[next_table_].changes.front().sequence >= before)) {
+                next_table_ = (next_table_ + 1) % queues_.size();
+                skipped++;
+            }
+            if (skipped == queues_.size()) {
+                break;
+            }
+            TableQueue& queue = queues_[next_table_];
+            change = std::move(queue.changes.front().change);
+            queue.by_key.erase(change.key);
+            queue.changes.pop_front();
+            pending_--;
+            next_table_ = (next_table_ + 1) % queues_.size();
+        }
+
+        // Applied without the queue lock so the event loop can keep enqueueing
+        try {
+            doTask(change);
+        } catch (const std::exception& e) {
+            std::cerr << name_ << ": exception applying " << tables_[change.table].prefix << change.key
+                      << ": " << e.what() << std::endl;
+        }
+        processed++;
+    }
+    return processed;
+}
+
+size_t Orch::reconcile(const std::vector<common::TableChange>& existing) {
+    std::vector<std::unordered_set<std::string>> present(tables_.size());
+    for (const auto& entry : existing) {
+        present[entry.table].insert(entry.key);
+    }
+
+    size_t stale = 0;
+    for (size_t table = 0; table < tables_.size(); ++table) {
+        for (auto& key : getAppliedKeys(table)) {
+            if (present[table].count(key) == 0) {
+                common::TableChange change;
+                change.table = table;
+                change.key = std::move(key);
+                change.deleted = true;
+                enqueue(std::move(change));
+                stale++;
+            }
+        }
+    }
+    return stale;
+}
+
+std::vector<std::string> Orch::getAppliedKeys(size_t) const {
+    return {};
+}
+
+} // namespace swss
+} // namespace sonic
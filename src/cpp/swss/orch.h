@@ -0,0 +1,141 @@
+/**
+ * @file orch.h
+ * @brief SONiC SwSS Orch Base Class Header
+ *
+ * An Orch owns one or more Redis tables. OrchAgent's event loop feeds it the
+ * keyspace changes of those tables, and OrchScheduler runs drain() on a
+ * worker with a bounded budget. Each table has its own queue and drain()
+ * takes from them round-robin, so one busy table cannot starve the others.
+ * Every queued change carries a sequence number shared by all Orchs, so the
+ * scheduler can tell which of two Orchs' changes arrived first.
+ */
+
+#ifndef SONIC_SWSS_ORCH_H
+#define SONIC_SWSS_ORCH_H
+
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+#include "../common/redis_table_watcher.h"
+
+namespace sonic {
+namespace swss {
+
+constexpr int APPL_DB = 0;
+constexpr int CONFIG_DB = 4;
+
+/**
+ * @brief Table consumer with coalescing per-table work queues
+ *
+ * enqueue() and drain() may run on different threads; drain() itself is
+ * never run concurrently for the same Orch.
+ */
+class Orch {
+public:
+    /**
+     * @param name Name used in logs
+     * @param priority Higher priorities are drained first; the scheduler ages waiting Orchs up
+     * @param tables Tables this Orch consumes; TableChange::table indexes this list
+     */
+    Orch(const std::string& name, int priority, const std::vector<common::WatchedTable>& tables);
+    virtual ~Orch() = default;
+
+    Orch(const Orch&) = delete;
+    Orch& operator=(const Orch&) = delete;
+
+    const std::string& getName() const { return name_; }
+    int getPriority() const { return priority_; }
+    const std::vector<common::WatchedTable>& getTables() const { return tables_; }
+
+    /**
+     * @brief Orchs whose queued work must be applied before this one runs
+     */
+    const std::vector<std::string>& getDependencies() const { return dependencies_; }
+
+    /**
+     * @brief Queue a change; a newer change to a key that is still queued replaces it
+     *
+     * The replacement moves to the back of its table's queue with a new
+     * sequence number, because it may rely on changes queued since.
+     */
+    void enqueue(common::TableChange change);
+
+    bool hasPendingWork() const;
+    size_t getPendingCount() const;
+
+    /**
+     * @brief Sequence number of the oldest queued change, NO_SEQUENCE when none is queued
+     */
+    uint64_t getOldestSequence() const;
+
+    /**
+     * @brief Sequence number the next enqueue() on any Orch will receive
+     */
+    static uint64_t nextSequence();
+
+    static constexpr uint64_t NO_SEQUENCE = UINT64_MAX;
+
+    /**
+     * @brief Apply up to max_items queued changes, one table at a time in turn
+     * @param before Only changes with a lower sequence number are applied
+     * @return Number of changes applied
+     */
+    size_t drain(size_t max_items, uint64_t before = NO_SEQUENCE);
+
+    /**
+     * @brief Queue deletes for applied keys missing from a full table snapshot
+     *
+     * Called with each fresh snapshot before it is queued, so state restored
+     * from a warm-restart file or kept across a lost subscription converges
+     * on the database.
+     * @param existing Every current entry of this Orch's tables (local table indexes)
+     * @return Number of deletes queued
+     */
+    size_t reconcile(const std::vector<common::TableChange>& existing);
+
+protected:
+    /**
+     * @brief Declare that orch_name must be drained before this Orch runs
+     */
+    void addDependency(const std::string& orch_name) { dependencies_.push_back(orch_name); }
+
+    /**
+     * @brief Keys of one table that this Orch has applied; the default reports none
+     */
+    virtual std::vector<std::string> getAppliedKeys(size_t table) const;
+
+    /**
+     * @brief Apply one change (current contents of the key, or its deletion)
+     */
+    virtual void doTask(const common::TableChange& change) = 0;
+
+private:
+    struct QueuedChange {
+        common::TableChange change;
+        uint64_t sequence;
+    };
+
+    // Ordered by sequence, oldest first
+    struct TableQueue {
+        std::list<QueuedChange> changes;
+        std::unordered_map<std::string, std::list<QueuedChange>::iterator> by_key;
+    };
+
+    std::string name_;
+    int priority_;
+    std::vector<common::WatchedTable> tables_;
+    std::vector<std::string> dependencies_;
+
+    mutable std::mutex queue_mutex_;
+    std::vector<TableQueue> queues_;    // One per table
+    size_t pending_;
+    size_t next_table_;                 // Round-robin position for drain()
+};
+
+} // namespace swss
+} // namespace sonic
+
+#endif // SONIC_SWSS_ORCH_H
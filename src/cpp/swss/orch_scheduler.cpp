@@ -0,0 +1,243 @@
+/**
+ * @file orch_scheduler.cpp
+ * @brief SONiC SwSS Orch Worker Pool Implementation
+ */
+
+#include "orch_scheduler.h"
+#include "../common/logger.h"
+#include "../common/metrics.h"
+#include <map>
+#include <algorithm>
+
+namespace sonic {
+namespace swss {
+
+OrchScheduler::OrchScheduler(size_t workers) : worker_count_(workers) {
+    if (worker_count_ == 0) {
+        unsigned hardware = std::thread::hardware_concurrency();
+        worker_count_ = std::min<size_t>(std::max<unsigned>(hardware, 2), 4);
+    }
+}
+
+OrchScheduler::~OrchScheduler() {
+    stop();
+}
+
+bool OrchScheduler::setOrchs(const std::vector<Orch*>& orchs) {
+    std::map<std::string, size_t> by_name;
+    for (size_t i = 0; i < orchs.size(); ++i) {
+        by_name[orchs[i]->getName()] = i;
+    }
+
+    std::vector<Slot> slots(orchs.size());
+    for (size_t i = 0; i < orchs.size(); ++i) {
+        slots[i].orch = orchs[i];
+        for (const auto& name : orchs[i]->getDependencies()) {
+            auto it = by_name.find(name);
+            if (it == by_name.end()) {
+                SONIC_LOG_ERROR("SWSS", orchs[i]->getName() << " depends on unknown orch " << name);
+                return false;
+            }
+            slots[i].dependencies.push_back(it->second);
+            slots[it->second].dependents.push_back(i);
+        }
+    }
+
+    // Reject cycles: they would leave every Orch in the cycle waiting forever
+    std::vector<int> state(slots.size(), 0);     // 0 unvisited, 1 on stack, 2 done
+    std::function<bool(size_t)> acyclic = [&](size_t i) {
+        if (state[i] != 0) {
+            return state[i] == 2;
+        }
+        state[i] = 1;
+        for (size_t dependency : slots[i].dependencies) {
+            if (!acyclic(dependency)) {
+                return false;
+            }
+        }
+        state[i] = 2;
+        return true;
+    };
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (!acyclic(i)) {
+            SONIC_LOG_ERROR("SWSS", "Orch dependency cycle through " << slots[i].orch->getName());
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    slots_ = std::move(slots);
+    return true;
+}
+
+void OrchScheduler::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!workers_.empty()) {
+        return;
+    }
+    stopping_ = false;
+    for (size_t i = 0; i < worker_count_; ++i) {
+        workers_.emplace_back(&OrchScheduler::workerLoop, this);
+    }
+}
+
+void OrchScheduler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+}
+
+void OrchScheduler::schedule() {
+    {
+        // Taken so a worker between its check and its wait cannot miss the notify
+        std::lock_guard<std::mutex> lock(mutex_);
+    }
+    work_cv_.notify_all();
+}
+
+void OrchScheduler::post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    work_cv_.notify_one();
+}
+
+void OrchScheduler::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this] { return !busyLocked() || stopping_; });
+}
+
+void OrchScheduler::setBatchSize(size_t batch_size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    batch_size_ = batch_size > 0 ? batch_size : 1;
+}
+
+size_t OrchScheduler::pickRunnable(uint64_t& before) const {
+    size_t best = slots_.size();
+    int64_t best_priority = 0;
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        const Slot& slot = slots_[i];
+        if (slot.running || !slot.orch->hasPendingWork()) {
+            continue;
+        }
+        bool blocked = std::any_of(slot.dependencies.begin(), slot.dependencies.end(), [this](size_t d) {
+            return slots_[d].running;
+        });
+        blocked = blocked || std::any_of(slot.dependents.begin(), slot.dependents.end(), [this](size_t d) {
+            return slots_[d].running;
+        });
+        if (blocked) {
+            continue;
+        }
+
+        // Only changes older than every change still queued on a dependency may go.
+        // nextSequence() is read first, so a dependency change that took a lower
+        // sequence is already in its queue when the dependency is asked below.
+        uint64_t bound = Orch::NO_SEQUENCE;
+        if (!slot.dependencies.empty()) {
+            bound = Orch::nextSequence();
+            for (size_t d : slot.dependencies) {
+                bound = std::min(bound, slots_[d].orch->getOldestSequence());
+            }
+            if (slot.orch->getOldestSequence() >= bound) {
+                continue;
+            }
+        }
+
+        uint64_t waited = run_counter_ - slot.last_run;
+        int64_t priority = slot.orch->getPriority() + static_cast<int64_t>(waited / AGING_RUNS);
+        if (best == slots_.size() || priority > best_priority ||
+            (priority == best_priority && slot.last_run < slots_[best].last_run)) {
+            best = i;
+            best_priority = priority;
+            before = bound;
+        }
+    }
+    return best;
+}
+
+bool OrchScheduler::busyLocked() const {
+    if (active_ > 0 || !tasks_.empty()) {
+        return true;
+    }
+    return std::any_of(slots_.begin(), slots_.end(), [](const Slot& slot) {
+        return slot.orch->hasPendingWork();
+    });
+}
+
+void OrchScheduler::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        size_t index = slots_.size();
+        uint64_t before = Orch::NO_SEQUENCE;
+        std::function<void()> task;
+        work_cv_.wait(lock, [&] {
+            if (stopping_) {
+                return true;
+            }
+            index = pickRunnable(before);
+            return index < slots_.size() || !tasks_.empty();
+        });
+        if (stopping_) {
+            return;
+        }
+
+        if (index < slots_.size()) {
+            Slot& slot = slots_[index];
+            slot.running = true;
+            slot.last_run = ++run_counter_;
+            size_t batch_size = batch_size_;
+            active_++;
+            lock.unlock();
+
+            // A throwing orch must not take the worker down with it; its slot stays
+            // schedulable and the remaining work is retried on the next pick
+            try {
+                slot.orch->drain(batch_size, before);
+            } catch (const std::exception& e) {
+                SONIC_COUNTER_INC("sonic_orch_drain_failures_total", "Orch drains that ended in an exception");
+                SONIC_LOG_ERROR("SWSS", "Exception draining " << slot.orch->getName() << ": " << e.what());
+            } catch (...) {
+                SONIC_COUNTER_INC("sonic_orch_drain_failures_total", "Orch drains that ended in an exception");
+                SONIC_LOG_ERROR("SWSS", "Unknown exception draining " << slot.orch->getName());
+            }
+
+            lock.lock();
+            slot.running = false;
+        } else {
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+            active_++;
+            lock.unlock();
+
+            try {
+                task();
+            } catch (const std::exception& e) {
+                SONIC_LOG_ERROR("SWSS", "Exception in orch scheduler task: " << e.what());
+            } catch (...) {
+                SONIC_LOG_ERROR("SWSS", "Unknown exception in orch scheduler task");
+            }
+
+            lock.lock();
+        }
+        active_--;
+
+        // A finished batch may unblock dependents or leave more work for others
+        work_cv_.notify_all();
+        if (!busyLocked()) {
+            idle_cv_.notify_all();
+        }
+    }
+}
+
+} // namespace swss
+} // namespace sonic
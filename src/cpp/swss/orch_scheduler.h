@@ -0,0 +1,119 @@
+/**
+ * @file orch_scheduler.h
+ * @brief SONiC SwSS Orch Worker Pool
+ *
+ * Runs Orch::drain() on a small pool of worker threads. Unrelated Orchs
+ * (VLANs and routes, say) drain in parallel. An Orch with declared
+ * dependencies never runs alongside them, and only applies changes queued
+ * before every change still queued on its dependencies, so a VLAN exists
+ * before its members and a port before routes over it. A flood on one
+ * dependency holds back only the dependent work that arrived after it.
+ * Priority picks among runnable Orchs, but an Orch gains a level for every
+ * AGING_RUNS picks it waits, so each one gets a bounded share.
+ */
+
+#ifndef SONIC_SWSS_ORCH_SCHEDULER_H
+#define SONIC_SWSS_ORCH_SCHEDULER_H
+
+#include "orch.h"
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstdint>
+
+namespace sonic {
+namespace swss {
+
+/**
+ * @brief Dependency-aware worker pool for Orchs
+ */
+class OrchScheduler {
+public:
+    /**
+     * @param workers Thread count; 0 picks one from the hardware (2 to 4)
+     */
+    explicit OrchScheduler(size_t workers = 0);
+    ~OrchScheduler();
+
+    /**
+     * @brief Set the Orchs to schedule; call before start()
+     * @return false if a dependency names an unknown Orch or forms a cycle
+     */
+    bool setOrchs(const std::vector<Orch*>& orchs);
+
+    void start();
+
+    /**
+     * @brief Finish the batches in progress and join the workers
+     */
+    void stop();
+
+    /**
+     * @brief Wake workers after work was queued on any Orch
+     */
+    void schedule();
+
+    /**
+     * @brief Run a task on a worker once no Orch is runnable
+     */
+    void post(std::function<void()> task);
+
+    /**
+     * @brief Block until no Orch has queued work and no worker is busy
+     */
+    void waitIdle();
+
+    /**
+     * @brief Limit on changes one Orch applies before it goes back to the queue
+     */
+    void setBatchSize(size_t batch_size);
+
+    size_t getWorkerCount() const { return worker_count_; }
+
+    /// Picks an Orch waits to gain one priority level
+    static constexpr uint64_t AGING_RUNS = 8;
+
+private:
+    struct Slot {
+        Orch* orch;
+        std::vector<size_t> dependencies;   // Indexes into slots_
+        std::vector<size_t> dependents;
+        bool running = false;
+        uint64_t last_run = 0;              // Pick count at the last run; ages the priority
+    };
+
+    void workerLoop();
+
+    /**
+     * @brief Runnable Orch with the highest aged priority, least recently run first (caller holds mutex_)
+     * @param before Set to the sequence bound the Orch may drain up to
+     * @return slots_.size() if none is runnable
+     */
+    size_t pickRunnable(uint64_t& before) const;
+
+    bool busyLocked() const;
+
+    size_t worker_count_;
+    std::vector<std::thread> workers_;
+    std::vector<Slot> slots_;
+    std::deque<std::function<void()>> tasks_;
+    size_t batch_size_ = 256;
+    size_t active_ = 0;
+    uint64_t run_counter_ = 0;
+    bool stopping_ = false;
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable idle_cv_;
+
+    OrchScheduler(const OrchScheduler&) = delete;
+    OrchScheduler& operator=(const OrchScheduler&) = delete;
+};
+
+} // namespace swss
+} // namespace sonic
+
+#endif // SONIC_SWSS_ORCH_SCHEDULER_H
@@ -6,19 +6,37 @@
  */
 
 #include "orchagent.h"
+#include "portsorch.h"
+#include "vlanorch.h"
+#include "routeorch.h"
+#include "../common/port_registry.h"
+#include "../common/redis_client.h"
+#include "../common/metrics.h"
+#include "../common/warm_snapshot.h"
+#include "../sai/sai_adapter.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
 #include <chrono>
 #include <thread>
 #include <iomanip>
+#include <cstring>
+#include <arpa/inet.h>
 
 namespace sonic {
 namespace swss {
 
-OrchAgent::OrchAgent() : running_(false), redis_client_(nullptr) {
+OrchAgent::OrchAgent()
+    : running_(false), redis_client_(nullptr), switch_id_(SAI_NULL_OBJECT_ID), switch_api_(nullptr),
+      port_api_(nullptr), vlan_api_(nullptr), route_api_(nullptr) {
     initializeRedisConnection();
     initializeSAI();
+    initializePortRegistry();
+    
+    registerOrch(std::unique_ptr<Orch>(new PortsOrch()));
+    registerOrch(std::unique_ptr<Orch>(new VLANOrch(*this)));
+    registerOrch(std::unique_ptr<Orch>(new VLANMemberOrch(*this)));
+    registerOrch(std::unique_ptr<Orch>(new RouteOrch(*this)));
 }
 
 OrchAgent::~OrchAgent() {
@@ -42,39 +60,35 @@ bool OrchAgent::initializeRedisConnection() {
 
 bool OrchAgent::initializeSAI() {
     try {
-        // Initialize SAI API
-        sai_status_t status = sai_api_initialize(0, nullptr);
-        if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to initialize SAI API: " << status << std::endl;
+        // The adapter owns SAI and one switch per ASIC; ASIC 0 is programmed
+        // inline and every other ASIC mirrors the route batches
+        sai::SAIAdapter* adapter = sai::SAIAdapter::getInstance();
+        if (!adapter->initialize()) {
+            std::cerr << "Failed to initialize SAI adapter" << std::endl;
             return false;
         }
         
-        // Query required SAI APIs
-        status = sai_api_query(SAI_API_SWITCH, (void**)&switch_api_);
-        if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to query Switch API: " << status << std::endl;
-            return false;
-        }
+        const sai::SAISwitchContext* primary = adapter->getSwitch(0);
+        switch_id_ = primary->switch_id;
+        switch_api_ = primary->switch_api;
+        port_api_ = primary->port_api;
+        vlan_api_ = primary->vlan_api;
+        route_api_ = primary->route_api;
         
-        status = sai_api_query(SAI_API_PORT, (void**)&port_api_);
-        if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to query Port API: " << status << std::endl;
+        if (!next_hops_.initialize(switch_id_)) {
             return false;
         }
         
-        status = sai_api_query(SAI_API_VLAN, (void**)&vlan_api_);
-        if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to query VLAN API: " << status << std::endl;
-            return false;
+        for (size_t i = 1; i < adapter->getAsicCount(); ++i) {
+            std::unique_ptr<PeerAsic> peer(new PeerAsic());
+            peer->asic = adapter->getSwitch(i);
+            if (!peer->next_hops.initialize(peer->asic->switch_id)) {
+                return false;
+            }
+            peer_asics_.push_back(std::move(peer));
         }
         
-        status = sai_api_query(SAI_API_ROUTE, (void**)&route_api_);
-        if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to query Route API: " << status << std::endl;
-            return false;
-        }
-        
-        std::cout << "SAI APIs initialized successfully" << std::endl;
+        std::cout << "SAI APIs initialized successfully on " << adapter->getAsicCount() << " ASIC(s)" << std::endl;
         return true;
     } catch (const std::exception& e) {
         std::cerr << "Failed to initialize SAI: " << e.what() << std::endl;
@@ -82,15 +96,39 @@ bool OrchAgent::initializeSAI() {
     }
 }
 
+bool OrchAgent::initializePortRegistry() {
+    if (!common::portRegistry().ensureLoaded(common::RedisConfig::fromEnvironment("localhost"))) {
+        std::cerr << "Port registry not loaded; port lookups will fail until COUNTERS_DB is available" << std::endl;
+        return false;
+    }
+    std::cout << "Port registry ready with " << common::portRegistry().size() << " ports" << std::endl;
+    return true;
+}
+
 bool OrchAgent::start() {
     if (running_) {
         std::cout << "OrchAgent is already running" << std::endl;
         return true;
     }
     
+    std::vector<Orch*> orchs;
+    for (const auto& orch : orchs_) {
+        orchs.push_back(orch.get());
+    }
+    if (!scheduler_.setOrchs(orchs)) {
+        std::cerr << "Invalid orch dependencies" << std::endl;
+        return false;
+    }
+    
+    if (!warm_restart_file_.empty() && getRouteCount() == 0 && getVLANIds().empty()) {
+        restoreWarmSnapshot();
+    }
+    last_checkpoint_ = std::chrono::steady_clock::now();
+    
     running_ = true;
     
     // Start orchestration threads
+    scheduler_.start();
     orch_thread_ = std::make_unique<std::thread>(&OrchAgent::orchestrationLoop, this);
     
     std::cout << "OrchAgent started successfully" << std::endl;
@@ -100,31 +138,73 @@ bool OrchAgent::start() {
 void OrchAgent::stop() {
     if (running_) {
         running_ = false;
+        event_loop_.wakeup();
         
         if (orch_thread_ && orch_thread_->joinable()) {
             orch_thread_->join();
         }
+        scheduler_.stop();
+        
+        if (!warm_restart_file_.empty()) {
+            saveWarmSnapshot();
+        }
         
         std::cout << "OrchAgent stopped" << std::endl;
     }
 }
 
+void OrchAgent::registerOrch(std::unique_ptr<Orch> orch) {
+    auto position = std::find_if(orchs_.begin(), orchs_.end(), [&orch](const std::unique_ptr<Orch>& existing) {
+        return existing->getPriority() < orch->getPriority();
+    });
+    orchs_.insert(position, std::move(orch));
+}
+
 void OrchAgent::orchestrationLoop() {
     std::cout << "Orchestration loop started" << std::endl;
     
+    int subscribed_fd = -1;
+    int retry_ms = 100;
+    
     while (running_) {
         try {
-            // Process configuration changes from Redis
-            processConfigurationChanges();
+            if (subscribed_fd < 0) {
+                if (!subscribeConsumers()) {
+                    // Keep programming queued routes while Redis is unreachable
+                    int due_ms = routeBatchDueMs();
+                    event_loop_.runOnce(due_ms >= 0 && due_ms < retry_ms ? due_ms : retry_ms);
+                    postRouteUpdates();
+                    postCheckpoint();
+                    retry_ms = std::min(retry_ms * 2, 5000);
+                    continue;
+                }
+                retry_ms = 100;
+                subscribed_fd = watcher_->fd();
+                event_loop_.add(subscribed_fd, [this](uint32_t) { readTableChanges(); });
+            }
             
-            // Process state updates
-            processStateUpdates();
+            // Sleep until something happens; workers apply queued changes meanwhile
+            int due_ms = route_flush_posted_ ? -1 : routeBatchDueMs();
+            int checkpoint_ms = checkpoint_posted_ ? -1 : checkpointDueMs();
+            if (due_ms < 0 || (checkpoint_ms >= 0 && checkpoint_ms < due_ms)) {
+                due_ms = checkpoint_ms;
+            }
+            event_loop_.runOnce(watcher_->hasBufferedData() ? 0 : due_ms);
+            SONIC_SCOPED_TIMER("sonic_swss_orchestration_pass_seconds",
+                               "Orchestration loop work after each wakeup, excluding the wait");
+            if (watcher_->hasBufferedData()) {
+                readTableChanges();
+            }
+            if (!watcher_->isSubscribed()) {
+                std::cerr << "Lost Redis subscription, resubscribing" << std::endl;
+                event_loop_.remove(subscribed_fd);
+                subscribed_fd = -1;
+                continue;
+            }
             
-            // Synchronize with hardware via SAI
-            synchronizeWithHardware();
-            
-            // Sleep for a short interval
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            // Program route updates whose batching window has elapsed
+            postRouteUpdates();
+            postCheckpoint();
             
         } catch (const std::exception& e) {
             std::cerr << "Error in orchestration loop: " << e.what() << std::endl;
@@ -132,51 +212,91 @@ void OrchAgent::orchestrationLoop() {
         }
     }
     
+    if (subscribed_fd >= 0) {
+        event_loop_.remove(subscribed_fd);
+    }
     std::cout << "Orchestration loop stopped" << std::endl;
 }
 
-void OrchAgent::processConfigurationChanges() {
-    // In a real implementation, this would:
-    // 1. Subscribe to Redis configuration changes
-    // 2. Parse configuration updates
-    // 3. Validate configuration
-    // 4. Apply changes via SAI
+bool OrchAgent::subscribeConsumers() {
+    if (!watcher_) {
+        std::vector<common::WatchedTable> tables;
+        for (const auto& orch : orchs_) {
+            for (size_t i = 0; i < orch->getTables().size(); ++i) {
+                tables.push_back(orch->getTables()[i]);
+                table_owners_.emplace_back(orch.get(), i);
+            }
+        }
+        watcher_.reset(new common::RedisTableWatcher(common::RedisConfig::fromEnvironment("localhost"), tables));
+    }
     
-    // Simulate processing configuration changes
-    static int config_counter = 0;
-    if (++config_counter % 100 == 0) {
-        std::cout << "Processing configuration changes..." << std::endl;
+    // Subscribe before the snapshot so no change falls in between
+    std::vector<common::TableChange> entries;
+    if (!watcher_->subscribe() || !watcher_->snapshot(entries)) {
+        return false;
+    }
+    std::map<Orch*, std::vector<common::TableChange>> by_orch;
+    for (auto& entry : entries) {
+        const auto& owner = table_owners_[entry.table];
+        entry.table = owner.second;
+        by_orch[owner.first].push_back(std::move(entry));
     }
+    
+    // Reconcile first so state missing from the database is removed before the rest is applied
+    size_t stale = 0;
+    for (const auto& orch : orchs_) {
+        auto& orch_entries = by_orch[orch.get()];
+        stale += orch->reconcile(orch_entries);
+        for (auto& entry : orch_entries) {
+            orch->enqueue(std::move(entry));
+        }
+    }
+    scheduler_.schedule();
+    if (stale > 0) {
+        std::cout << "Removing " << stale << " entries no longer in the database" << std::endl;
+    }
+    std::cout << "Subscribed to " << table_owners_.size() << " tables for " << orchs_.size()
+              << " orchs, " << entries.size() << " existing entries queued" << std::endl;
+    return true;
 }
 
-void OrchAgent::processStateUpdates() {
-    // In a real implementation, this would:
-    // 1. Collect state information from SAI
-    // 2. Update Redis state database
-    // 3. Handle state change notifications
-    
-    // Simulate processing state updates
-    static int state_counter = 0;
-    if (++state_counter % 200 == 0) {
-        std::cout << "Processing state updates..." << std::endl;
+void OrchAgent::readTableChanges() {
+    SONIC_SCOPED_TIMER("sonic_swss_table_changes_seconds", "Time to read and enqueue one batch of table changes");
+    std::vector<common::TableChange> changes;
+    if (!watcher_->waitForChanges(changes, 0)) {
+        return;     // Connection lost; the loop resubscribes
+    }
+    for (auto& change : changes) {
+        const auto& owner = table_owners_[change.table];
+        change.table = owner.second;
+        owner.first->enqueue(std::move(change));
+    }
+    if (!changes.empty()) {
+        static common::Counter& changes_total =
+            common::MetricsRegistry::instance().counter("sonic_swss_table_changes_total", "Table changes enqueued to orchs");
+        changes_total.inc(changes.size());
+        scheduler_.schedule();
     }
 }
 
-void OrchAgent::synchronizeWithHardware() {
-    // In a real implementation, this would:
-    // 1. Ensure hardware state matches desired configuration
-    // 2. Handle hardware events and notifications
-    // 3. Update operational state based on hardware feedback
-    
-    // Simulate hardware synchronization
-    static int sync_counter = 0;
-    if (++sync_counter % 300 == 0) {
-        std::cout << "Synchronizing with hardware..." << std::endl;
+int OrchAgent::routeBatchDueMs() {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    if (pending_routes_.empty()) {
+        return -1;
     }
+    auto due = pending_since_ + std::chrono::milliseconds(route_batch_window_ms_.load());
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(due - std::chrono::steady_clock::now());
+    return remaining.count() > 0 ? static_cast<int>(remaining.count()) : 0;
+}
+
+bool OrchAgent::hasVLAN(uint16_t vlan_id) const {
+    std::lock_guard<std::mutex> lock(vlan_mutex_);
+    return vlans_.find(vlan_id) != vlans_.end();
 }
 
 bool OrchAgent::createVLAN(uint16_t vlan_id) {
     try {
+        std::lock_guard<std::mutex> lock(vlan_mutex_);
         sai_attribute_t vlan_attr;
         vlan_attr.id = SAI_VLAN_ATTR_VLAN_ID;
         vlan_attr.value.u16 = vlan_id;
@@ -196,6 +316,7 @@ bool OrchAgent::createVLAN(uint16_t vlan_id) {
         vlan_entry.created_at = getCurrentTimestamp();
         
         vlans_[vlan_id] = vlan_entry;
+        state_version_++;
         
         // Update Redis state
         updateVLANState(vlan_id, "created");
@@ -211,12 +332,25 @@ bool OrchAgent::createVLAN(uint16_t vlan_id) {
 
 bool OrchAgent::deleteVLAN(uint16_t vlan_id) {
     try {
+        std::lock_guard<std::mutex> lock(vlan_mutex_);
         auto it = vlans_.find(vlan_id);
         if (it == vlans_.end()) {
             std::cerr << "VLAN " << vlan_id << " not found" << std::endl;
             return false;
         }
         
+        // SAI refuses to remove a VLAN that still has members
+        for (auto member = it->second.members.begin(); member != it->second.members.end();) {
+            sai_status_t status = vlan_api_->remove_vlan_member(member->second.member_oid);
+            if (status != SAI_STATUS_SUCCESS) {
+                std::cerr << "Failed to remove " << common::portNames().name(member->first) << " from VLAN " << vlan_id
+                          << ": " << status << std::endl;
+                return false;
+            }
+            member = it->second.members.erase(member);
+            state_version_++;
+        }
+        
         sai_status_t status = vlan_api_->remove_vlan(it->second.vlan_oid);
         if (status != SAI_STATUS_SUCCESS) {
             std::cerr << "Failed to delete VLAN " << vlan_id << ": " << status << std::endl;
@@ -224,6 +358,7 @@ bool OrchAgent::deleteVLAN(uint16_t vlan_id) {
         }
         
         vlans_.erase(it);
+        state_version_++;
         
         // Update Redis state
         updateVLANState(vlan_id, "deleted");
@@ -237,41 +372,161 @@ bool OrchAgent::deleteVLAN(uint16_t vlan_id) {
     }
 }
 
-bool OrchAgent::addRoute(const std::string& prefix, const std::string& next_hop) {
+bool OrchAgent::addVLANMember(uint16_t vlan_id, const std::string& port_name, bool tagged) {
     try {
-        // Parse prefix and next-hop
-        // In a real implementation, this would use proper IP address parsing
+        std::lock_guard<std::mutex> lock(vlan_mutex_);
+        auto it = vlans_.find(vlan_id);
+        if (it == vlans_.end()) {
+            std::cerr << "VLAN " << vlan_id << " not found" << std::endl;
+            return false;
+        }
+        
+        common::PortId port_id = common::portRegistry().findPort(port_name);
+        sai_object_id_t port_oid = getPortOID(port_id);
+        if (port_oid == SAI_NULL_OBJECT_ID) {
+            std::cerr << "Cannot add unknown port " << port_name << " to VLAN " << vlan_id << std::endl;
+            return false;
+        }
         
-        RouteEntry route_entry;
-        route_entry.prefix = prefix;
-        route_entry.next_hop = next_hop;
-        route_entry.created_at = getCurrentTimestamp();
+        auto existing = it->second.members.find(port_id);
+        if (existing != it->second.members.end() && existing->second.tagged == tagged) {
+            return true;
+        }
+        if (existing != it->second.members.end()) {
+            // The tagging mode is CREATE_AND_SET, so the member is changed in place; a
+            // failed set leaves the old membership untouched rather than none at all
+            sai_attribute_t mode;
+            mode.id = SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE;
+            mode.value.s32 = tagged ? SAI_VLAN_TAGGING_MODE_TAGGED : SAI_VLAN_TAGGING_MODE_UNTAGGED;
+            sai_status_t status = vlan_api_->set_vlan_member_attribute
+                ? vlan_api_->set_vlan_member_attribute(existing->second.member_oid, &mode)
+                : SAI_STATUS_NOT_IMPLEMENTED;
+            if (status != SAI_STATUS_SUCCESS) {
+                std::cerr << "Failed to update " << port_name << " in VLAN " << vlan_id << ": " << status << std::endl;
+                return false;
+            }
+            existing->second.tagged = tagged;
+            state_version_++;
+            std::cout << "Port " << port_name << " in VLAN " << vlan_id << " is now"
+                      << (tagged ? " tagged" : " untagged") << std::endl;
+            return true;
+        }
         
-        // Create route via SAI
-        sai_attribute_t route_attrs[2];
+        // No bridge port objects are modelled; the port OID stands in for one
+        sai_attribute_t attrs[3];
+        attrs[0].id = SAI_VLAN_MEMBER_ATTR_VLAN_ID;
+        attrs[0].value.oid = it->second.vlan_oid;
+        attrs[1].id = SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID;
+        attrs[1].value.oid = port_oid;
+        attrs[2].id = SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE;
+        attrs[2].value.s32 = tagged ? SAI_VLAN_TAGGING_MODE_TAGGED : SAI_VLAN_TAGGING_MODE_UNTAGGED;
         
-        // Set destination prefix (simplified)
-        route_attrs[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
-        route_attrs[0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+        sai_object_id_t member_oid;
+        sai_status_t status = vlan_api_->create_vlan_member(&member_oid, switch_id_, 3, attrs);
+        if (status != SAI_STATUS_SUCCESS) {
+            std::cerr << "Failed to add " << port_name << " to VLAN " << vlan_id << ": " << status << std::endl;
+            return false;
+        }
+        it->second.members[port_id] = {member_oid, tagged};
+        state_version_++;
         
-        // Set next hop (simplified)
-        route_attrs[1].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
-        route_attrs[1].value.oid = getNextHopOID(next_hop);
+        std::cout << "Port " << port_name << " added to VLAN " << vlan_id
+                  << (tagged ? " (tagged)" : " (untagged)") << std::endl;
+        return true;
         
-        sai_route_entry_t route_entry_sai;
-        // Initialize route entry structure (simplified)
-        route_entry_sai.switch_id = switch_id_;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception adding " << port_name << " to VLAN " << vlan_id << ": " << e.what() << std::endl;
+        return false;
+    }
+}
+
+bool OrchAgent::removeVLANMember(uint16_t vlan_id, const std::string& port_name) {
+    try {
+        std::lock_guard<std::mutex> lock(vlan_mutex_);
+        auto it = vlans_.find(vlan_id);
+        if (it == vlans_.end()) {
+            std::cerr << "VLAN " << vlan_id << " not found" << std::endl;
+            return false;
+        }
+        common::PortId port_id = common::INVALID_PORT_ID;
+        common::portNames().find(port_name, port_id);
+        auto member = it->second.members.find(port_id);
+        if (member == it->second.members.end()) {
+            std::cerr << "Port " << port_name << " is not a member of VLAN " << vlan_id << std::endl;
+            return false;
+        }
         
-        sai_status_t status = route_api_->create_route_entry(&route_entry_sai, 2, route_attrs);
+        sai_status_t status = vlan_api_->remove_vlan_member(member->second.member_oid);
         if (status != SAI_STATUS_SUCCESS) {
-            std::cerr << "Failed to create route " << prefix << " via " << next_hop << ": " << status << std::endl;
+            std::cerr << "Failed to remove " << port_name << " from VLAN " << vlan_id << ": " << status << std::endl;
+            return false;
+        }
+        it->second.members.erase(member);
+        state_version_++;
+        
+        std::cout << "Port " << port_name << " removed from VLAN " << vlan_id << std::endl;
+        return true;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "Exception removing " << port_name << " from VLAN " << vlan_id << ": " << e.what() << std::endl;
+        return false;
+    }
+}
+
+bool OrchAgent::hasVLANMember(uint16_t vlan_id, const std::string& port_name) const {
+    common::PortId port_id;
+    if (!common::portNames().find(port_name, port_id)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(vlan_mutex_);
+    auto it = vlans_.find(vlan_id);
+    return it != vlans_.end() && it->second.members.count(port_id) > 0;
+}
+
+std::vector<uint16_t> OrchAgent::getVLANIds() const {
+    std::lock_guard<std::mutex> lock(vlan_mutex_);
+    std::vector<uint16_t> ids;
+    for (const auto& vlan : vlans_) {
+        ids.push_back(vlan.first);
+    }
+    return ids;
+}
+
+std::vector<std::pair<uint16_t, std::string>> OrchAgent::getVLANMembers() const {
+    std::lock_guard<std::mutex> lock(vlan_mutex_);
+    std::vector<std::pair<uint16_t, std::string>> members;
+    for (const auto& vlan : vlans_) {
+        for (const auto& member : vlan.second.members) {
+            members.emplace_back(vlan.first, common::portNames().name(member.first));
+        }
+    }
+    return members;
+}
+
+bool OrchAgent::addRoute(const std::string& prefix, const std::string& next_hop) {
+    try {
+        common::IpPrefix parsed_prefix;
+        if (!common::IpPrefix::parse(prefix, parsed_prefix)) {
+            std::cerr << "Invalid route prefix: " << prefix << std::endl;
             return false;
         }
         
-        routes_[prefix] = route_entry;
+        RouteSyncReport report;
+        {
+            std::lock_guard<std::mutex> lock(route_mutex_);
+            RouteOp op;
+            if (diffRoute(parsed_prefix, false, next_hop, op)) {
+                applyRouteOps({op}, report);
+            }
+        }
+        if (report.failed > 0) {
+            std::cerr << "Failed to create route " << prefix << " via " << next_hop << ": "
+                      << report.statuses[0].status << std::endl;
+            return false;
+        }
         
         // Update Redis state
-        updateRouteState(prefix, next_hop, "created");
+        updateRouteState(parsed_prefix.toString(), next_hop, "created");
         
         std::cout << "Route " << prefix << " via " << next_hop << " created successfully" << std::endl;
         return true;
@@ -282,6 +537,658 @@ bool OrchAgent::addRoute(const std::string& prefix, const std::string& next_hop)
     }
 }
 
+bool OrchAgent::syncRoutes(const std::map<std::string, std::string>& desired, RouteSyncReport& report) {
+    auto start = std::chrono::steady_clock::now();
+    report = RouteSyncReport();
+
+    try {
+        // Parse once into a trie so both directions of the diff are prefix lookups
+        common::RouteTable<const std::string*> wanted;
+        for (const auto& route : desired) {
+            common::IpPrefix prefix;
+            if (!common::IpPrefix::parse(route.first, prefix)) {
+                std::cerr << "Invalid route prefix: " << route.first << std::endl;
+                report.statuses.push_back({route.first, RouteSyncOp::ADD, SAI_STATUS_INVALID_PARAMETER});
+                report.failed++;
+                continue;
+            }
+            if (!wanted.insert(prefix, &route.second)) {
+                report.coalesced++;     // Same prefix spelled with host bits set
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(route_mutex_);
+        std::vector<RouteOp> ops;
+        routes_.forEach([&](const common::IpPrefix& prefix, const RouteEntry& route) {
+            (void)route;
+            if (!wanted.find(prefix)) {
+                ops.push_back({prefix, RouteSyncOp::REMOVE, ""});
+            }
+        });
+        wanted.forEach([&](const common::IpPrefix& prefix, const std::string* next_hop) {
+            RouteOp op;
+            if (diffRoute(prefix, false, *next_hop, op)) {
+                ops.push_back(std::move(op));
+            } else {
+                report.unchanged++;
+            }
+        });
+
+        applyRouteOps(ops, report);
+        report.convergence_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        last_route_report_ = report;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception syncing routes: " << e.what() << std::endl;
+        return false;
+    }
+
+    std::cout << "Route sync: " << report.added << " added, " << report.removed << " removed, "
+              << report.replaced << " replaced, " << report.unchanged << " unchanged, " << report.failed
+              << " failed in " << report.convergence_ms << " ms (" << report.sai_calls << " SAI calls)" << std::endl;
+    return report.failed == 0;
+}
+
+bool OrchAgent::queueRouteUpdate(const std::string& prefix, const std::string& next_hop) {
+    common::IpPrefix parsed_prefix;
+    if (!common::IpPrefix::parse(prefix, parsed_prefix)) {
+        std::cerr << "Invalid route prefix: " << prefix << std::endl;
+        return false;
+    }
+
+    PendingRoute pending;
+    pending.next_hop = next_hop;
+
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    if (pending_routes_.empty()) {
+        pending_since_ = std::chrono::steady_clock::now();
+        event_loop_.wakeup();   // Let the loop arm the batching timer
+    }
+    if (!pending_routes_.insert(parsed_prefix, std::move(pending))) {
+        pending_coalesced_++;
+    }
+    return true;
+}
+
+bool OrchAgent::queueRouteDelete(const std::string& prefix) {
+    common::IpPrefix parsed_prefix;
+    if (!common::IpPrefix::parse(prefix, parsed_prefix)) {
+        std::cerr << "Invalid route prefix: " << prefix << std::endl;
+        return false;
+    }
+
+    PendingRoute pending;
+    pending.remove = true;
+
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    if (pending_routes_.empty()) {
+        pending_since_ = std::chrono::steady_clock::now();
+        event_loop_.wakeup();   // Let the loop arm the batching timer
+    }
+    if (!pending_routes_.insert(parsed_prefix, std::move(pending))) {
+        pending_coalesced_++;
+    }
+    return true;
+}
+
+bool OrchAgent::flushRouteUpdates(RouteSyncReport& report) {
+    report = RouteSyncReport();
+
+    common::RouteTable<PendingRoute> pending;
+    std::chrono::steady_clock::time_point since;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        if (pending_routes_.empty()) {
+            return true;
+        }
+        std::swap(pending, pending_routes_);
+        report.coalesced = pending_coalesced_;
+        pending_coalesced_ = 0;
+        since = pending_since_;
+    }
+
+    try {
+        std::lock_guard<std::mutex> lock(route_mutex_);
+        std::vector<RouteOp> ops;
+        ops.reserve(pending.size());
+        pending.forEach([&](const common::IpPrefix& prefix, const PendingRoute& route) {
+            RouteOp op;
+            if (diffRoute(prefix, route.remove, route.next_hop, op)) {
+                ops.push_back(std::move(op));
+            } else {
+                report.unchanged++;
+            }
+        });
+
+        applyRouteOps(ops, report);
+        report.convergence_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - since).count();
+        last_route_report_ = report;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception programming route batch: " << e.what() << std::endl;
+        return false;
+    }
+
+    std::cout << "Route batch: " << report.added << " added, " << report.removed << " removed, "
+              << report.replaced << " replaced, " << report.coalesced << " coalesced, " << report.failed
+              << " failed in " << report.convergence_ms << " ms (" << report.sai_calls << " SAI calls)" << std::endl;
+    return report.failed == 0;
+}
+
+void OrchAgent::postRouteUpdates() {
+    if (routeBatchDueMs() != 0 || route_flush_posted_.exchange(true)) {
+        return;
+    }
+    scheduler_.post([this] {
+        route_flush_posted_ = false;
+        processRouteUpdates();
+        event_loop_.wakeup();   // Re-arm the batching timer for updates queued meanwhile
+    });
+}
+
+void OrchAgent::processRouteUpdates() {
+    SONIC_SCOPED_TIMER("sonic_swss_route_batch_seconds", "Time to program one batch of route updates");
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        if (pending_routes_.empty() ||
+            std::chrono::steady_clock::now() - pending_since_ < std::chrono::milliseconds(route_batch_window_ms_.load())) {
+            return;
+        }
+    }
+
+    RouteSyncReport report;
+    flushRouteUpdates(report);
+}
+
+int OrchAgent::checkpointDueMs() const {
+    int64_t interval_s = warm_checkpoint_interval_s_.load();
+    if (warm_restart_file_.empty() || interval_s <= 0 || state_version_ == saved_version_) {
+        return -1;
+    }
+    auto due = last_checkpoint_ + std::chrono::seconds(interval_s);
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(due - std::chrono::steady_clock::now());
+    return remaining.count() > 0 ? static_cast<int>(remaining.count()) : 0;
+}
+
+void OrchAgent::postCheckpoint() {
+    if (checkpointDueMs() != 0 || checkpoint_posted_.exchange(true)) {
+        return;
+    }
+    last_checkpoint_ = std::chrono::steady_clock::now();
+    scheduler_.post([this] {
+        saveWarmSnapshot();
+        checkpoint_posted_ = false;
+        event_loop_.wakeup();   // Re-arm the checkpoint timer for changes made meanwhile
+    });
+}
+
+namespace {
+
+const uint32_t WARM_SNAPSHOT_KIND = common::snapshotTag("ORCH");
+const uint32_t SECTION_PORTS = common::snapshotTag("PORT");
+const uint32_t SECTION_VLANS = common::snapshotTag("VLAN");
+const uint32_t SECTION_NEXT_HOPS = common::snapshotTag("NHOP");
+const uint32_t SECTION_ROUTES = common::snapshotTag("ROUT");
+
+} // anonymous namespace
+
+bool OrchAgent::saveWarmSnapshot() {
+    if (warm_restart_file_.empty()) {
+        return false;
+    }
+    
+    try {
+        common::SnapshotWriter writer(WARM_SNAPSHOT_KIND, WARM_SNAPSHOT_VERSION);
+        uint64_t version = state_version_;
+        
+        auto ports = common::portRegistry().snapshot();
+        writer.beginSection(SECTION_PORTS);
+        writer.putU32(static_cast<uint32_t>(ports->by_name.size()));
+        for (const auto& port : ports->by_name) {
+            writer.putString(*port.first);
+            writer.putU64(ports->getOID(port.second));
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(vlan_mutex_);
+            writer.beginSection(SECTION_VLANS);
+            writer.putU32(static_cast<uint32_t>(vlans_.size()));
+            for (const auto& vlan : vlans_) {
+                writer.putU16(vlan.second.vlan_id);
+                writer.putU64(vlan.second.vlan_oid);
+                writer.putString(vlan.second.created_at);
+                writer.putU32(static_cast<uint32_t>(vlan.second.members.size()));
+                for (const auto& member : vlan.second.members) {
+                    writer.putString(common::portNames().name(member.first));
+                    writer.putU64(member.second.member_oid);
+                    writer.putU8(member.second.tagged ? 1 : 0);
+                }
+            }
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(route_mutex_);
+            writer.beginSection(SECTION_NEXT_HOPS);
+            next_hops_.save(writer);
+            writer.beginSection(SECTION_ROUTES);
+            writer.putU32(static_cast<uint32_t>(routes_.size()));
+            routes_.forEach([&writer](const common::IpPrefix& prefix, const RouteEntry& route) {
+                writer.putString(prefix.toString());
+                writer.putString(route.next_hop);
+                writer.putU64(route.next_hop_oid);
+                writer.putString(route.created_at);
+            });
+        }
+        writer.endSection();
+        
+        if (!writer.writeFile(warm_restart_file_)) {
+            return false;
+        }
+        saved_version_ = version;
+        std::cout << "Warm-restart snapshot written to " << warm_restart_file_ << " (" << writer.size()
+                  << " bytes)" << std::endl;
+        return true;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "Exception writing warm-restart snapshot: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+bool OrchAgent::restoreWarmSnapshot() {
+    common::SnapshotReader reader;
+    if (warm_restart_file_.empty() || !reader.open(warm_restart_file_, WARM_SNAPSHOT_KIND, WARM_SNAPSHOT_VERSION)) {
+        return false;
+    }
+    if (!peer_asics_.empty()) {
+        // The snapshot holds ASIC 0 only; peers would come back without their routes
+        std::cerr << "Warm restart is single-ASIC only, starting cold" << std::endl;
+        return false;
+    }
+    
+    try {
+        common::SnapshotCursor cursor;
+        
+        // Port OIDs change when the ASIC is reset, which invalidates everything else
+        std::vector<std::pair<std::string, uint64_t>> ports;
+        uint32_t count = 0;
+        if (!reader.section(SECTION_PORTS, cursor) || !cursor.getU32(count)) {
+            std::cerr << "Warm-restart snapshot has no port section" << std::endl;
+            return false;
+        }
+        for (uint32_t i = 0; i < count && cursor.ok(); ++i) {
+            std::string name;
+            uint64_t oid = 0;
+            cursor.getString(name);
+            cursor.getU64(oid);
+            uint64_t current = common::portRegistry().getOID(name);
+            if (current != 0 && current != oid) {
+                std::cerr << "Port " << name << " changed OID since the snapshot, starting cold" << std::endl;
+                return false;
+            }
+            ports.emplace_back(std::move(name), oid);
+        }
+        
+        std::map<uint16_t, VLANEntry> vlans;
+        count = 0;
+        if (!cursor.ok() || !reader.section(SECTION_VLANS, cursor) || !cursor.getU32(count)) {
+            std::cerr << "Warm-restart snapshot has no VLAN section" << std::endl;
+            return false;
+        }
+        bool valid = true;
+        for (uint32_t i = 0; i < count && cursor.ok() && valid; ++i) {
+            VLANEntry vlan;
+            uint32_t member_count = 0;
+            cursor.getU16(vlan.vlan_id);
+            cursor.getU64(vlan.vlan_oid);
+            cursor.getString(vlan.created_at);
+            cursor.getU32(member_count);
+            valid = sai_object_type_query(vlan.vlan_oid) == SAI_OBJECT_TYPE_VLAN;
+            for (uint32_t j = 0; j < member_count && cursor.ok(); ++j) {
+                std::string port_name;
+                VLANPortMember member;
+                uint8_t tagged = 0;
+                cursor.getString(port_name);
+                cursor.getU64(member.member_oid);
+                cursor.getU8(tagged);
+                member.tagged = tagged != 0;
+                valid = valid && sai_object_type_query(member.member_oid) == SAI_OBJECT_TYPE_VLAN_MEMBER;
+                vlan.members[common::portNames().intern(port_name)] = member;
+            }
+            vlans[vlan.vlan_id] = std::move(vlan);
+        }
+        if (!cursor.ok() || !valid) {
+            std::cerr << "Warm-restart VLAN state does not match SAI, starting cold" << std::endl;
+            return false;
+        }
+        
+        std::lock_guard<std::mutex> vlan_lock(vlan_mutex_);
+        std::lock_guard<std::mutex> route_lock(route_mutex_);
+        if (!vlans_.empty() || !routes_.empty()) {
+            std::cerr << "Not restoring warm-restart snapshot over existing state" << std::endl;
+            return false;
+        }
+        
+        if (!reader.section(SECTION_NEXT_HOPS, cursor) || !next_hops_.restore(cursor)) {
+            std::cerr << "Warm-restart next hop state does not match SAI, starting cold" << std::endl;
+            return false;
+        }
+        
+        common::RouteTable<RouteEntry> routes;
+        count = 0;
+        valid = reader.section(SECTION_ROUTES, cursor) && cursor.getU32(count);
+        for (uint32_t i = 0; i < count && valid; ++i) {
+            RouteEntry route;
+            std::string prefix;
+            common::IpPrefix parsed;
+            cursor.getString(prefix);
+            cursor.getString(route.next_hop);
+            cursor.getU64(route.next_hop_oid);
+            cursor.getString(route.created_at);
+            route.prefix = prefix;
+            route.route_oid = SAI_NULL_OBJECT_ID;
+            valid = cursor.ok() && common::IpPrefix::parse(prefix, parsed) && next_hops_.refCount(route.next_hop_oid) > 0;
+            routes.insert(parsed, std::move(route));
+        }
+        if (!valid) {
+            std::cerr << "Warm-restart route state is inconsistent, starting cold" << std::endl;
+            next_hops_.reset();
+            return false;
+        }
+        
+        // Seed ports not yet in the registry so members resolve before COUNTERS_DB is read
+        for (const auto& port : ports) {
+            if (common::portRegistry().getOID(port.first) == 0) {
+                common::portRegistry().addPort(port.first, port.second);
+            }
+        }
+        vlans_ = std::move(vlans);
+        routes_ = std::move(routes);
+        saved_version_ = state_version_.load();
+        
+        std::cout << "Warm restart: restored " << vlans_.size() << " VLANs, " << routes_.size() << " routes and "
+                  << next_hops_.saiObjectCount() << " next hop objects from " << warm_restart_file_ << std::endl;
+        return true;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "Exception restoring warm-restart snapshot: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+RouteSyncReport OrchAgent::getLastRouteSyncReport() const {
+    std::lock_guard<std::mutex> lock(route_mutex_);
+    return last_route_report_;
+}
+
+size_t OrchAgent::getRouteCount() const {
+    std::lock_guard<std::mutex> lock(route_mutex_);
+    return routes_.size();
+}
+
+std::vector<std::string> OrchAgent::getRoutePrefixes() const {
+    std::lock_guard<std::mutex> lock(route_mutex_);
+    std::vector<std::string> prefixes;
+    prefixes.reserve(routes_.size());
+    routes_.forEach([&prefixes](const common::IpPrefix& prefix, const RouteEntry&) {
+        prefixes.push_back(prefix.toString());
+    });
+    return prefixes;
+}
+
+size_t OrchAgent::getNextHopObjectCount() const {
+    std::lock_guard<std::mutex> lock(route_mutex_);
+    return next_hops_.saiObjectCount();
+}
+
+bool OrchAgent::diffRoute(const common::IpPrefix& prefix, bool remove, const std::string& next_hop,
+                          RouteOp& op) const {
+    const RouteEntry* current = routes_.find(prefix);
+    op.prefix = prefix;
+    op.next_hop = next_hop;
+    if (remove) {
+        op.op = RouteSyncOp::REMOVE;
+        return current != nullptr;
+    }
+    if (!current) {
+        op.op = RouteSyncOp::ADD;
+        return true;
+    }
+    op.op = RouteSyncOp::REPLACE;
+    return current->next_hop != next_hop;
+}
+
+void OrchAgent::applyRouteOps(const std::vector<RouteOp>& ops, RouteSyncReport& report) {
+    if (peer_asics_.empty()) {
+        applyPrimaryRouteOps(ops, report);
+        return;
+    }
+    
+    sai::SAIAdapter::getInstance()->forEachAsic([&](const sai::SAISwitchContext& asic) {
+        if (asic.index == 0) {
+            applyPrimaryRouteOps(ops, report);
+        } else {
+            applyPeerRouteOps(*peer_asics_[asic.index - 1], ops);
+        }
+    });
+    
+    for (auto& peer : peer_asics_) {
+        report.sai_calls += peer->sai_calls;
+        report.failed += peer->failures.size();
+        report.statuses.insert(report.statuses.end(), peer->failures.begin(), peer->failures.end());
+        peer->failures.clear();
+    }
+}
+
+void OrchAgent::applyPrimaryRouteOps(const std::vector<RouteOp>& ops, RouteSyncReport& report) {
+    // Removes go first so a batch that moves a route between prefixes never
+    // needs both entries in the ASIC at once. Next hops for adds and replaces
+    // are resolved up front; routes sharing a next-hop set share one object.
+    std::vector<const RouteOp*> groups[3];
+    std::vector<RouteProgram> programs[3];
+    for (const auto& op : ops) {
+        sai_object_id_t next_hop_oid = SAI_NULL_OBJECT_ID;
+        if (op.op != RouteSyncOp::REMOVE) {
+            next_hop_oid = next_hops_.acquire(op.next_hop);
+            if (next_hop_oid == SAI_NULL_OBJECT_ID) {
+                report.statuses.push_back({op.prefix.toString(), op.op, SAI_STATUS_INVALID_PARAMETER});
+                report.failed++;
+                continue;
+            }
+        }
+        groups[static_cast<int>(op.op)].push_back(&op);
+        programs[static_cast<int>(op.op)].push_back({&op.prefix, next_hop_oid});
+    }
+
+    std::string timestamp = getCurrentTimestamp();
+    std::vector<sai_status_t> statuses;
+    const RouteSyncOp order[] = {RouteSyncOp::REMOVE, RouteSyncOp::ADD, RouteSyncOp::REPLACE};
+    for (RouteSyncOp kind : order) {
+        const std::vector<const RouteOp*>& group = groups[static_cast<int>(kind)];
+        const std::vector<RouteProgram>& program = programs[static_cast<int>(kind)];
+        report.sai_calls += programRoutes(route_api_, switch_id_, kind, program, statuses);
+
+        for (size_t j = 0; j < group.size(); ++j) {
+            const RouteOp& op = *group[j];
+            sai_object_id_t next_hop_oid = program[j].next_hop_oid;
+            report.statuses.push_back({op.prefix.toString(), kind, statuses[j]});
+            if (statuses[j] != SAI_STATUS_SUCCESS) {
+                if (kind != RouteSyncOp::REMOVE) {
+                    next_hops_.release(next_hop_oid);
+                }
+                report.failed++;
+                continue;
+            }
+            if (kind == RouteSyncOp::REMOVE) {
+                next_hops_.release(routes_.find(op.prefix)->next_hop_oid);
+                routes_.erase(op.prefix);
+                report.removed++;
+                state_version_++;
+            } else if (kind == RouteSyncOp::REPLACE) {
+                RouteEntry* current = routes_.find(op.prefix);
+                next_hops_.release(current->next_hop_oid);
+                current->next_hop = op.next_hop;
+                current->next_hop_oid = next_hop_oid;
+                report.replaced++;
+                state_version_++;
+            } else {
+                RouteEntry route_entry;
+                route_entry.prefix = report.statuses.back().prefix;
+                route_entry.next_hop = op.next_hop;
+                route_entry.route_oid = SAI_NULL_OBJECT_ID;     // Route entries are keyed, not OIDs
+                route_entry.next_hop_oid = next_hop_oid;
+                route_entry.created_at = timestamp;
+                routes_.insert(op.prefix, std::move(route_entry));
+                report.added++;
+                state_version_++;
+            }
+        }
+    }
+}
+
+void OrchAgent::applyPeerRouteOps(PeerAsic& peer, const std::vector<RouteOp>& ops) const {
+    // The ops were diffed against ASIC 0; map each onto what this ASIC holds
+    std::vector<const RouteOp*> groups[3];
+    std::vector<RouteProgram> programs[3];
+    for (const auto& op : ops) {
+        bool present = peer.routes.find(op.prefix) != nullptr;
+        RouteSyncOp kind = RouteSyncOp::REMOVE;
+        if (op.op != RouteSyncOp::REMOVE) {
+            kind = present ? RouteSyncOp::REPLACE : RouteSyncOp::ADD;
+        } else if (!present) {
+            continue;
+        }
+        sai_object_id_t next_hop_oid = SAI_NULL_OBJECT_ID;
+        if (kind != RouteSyncOp::REMOVE) {
+            next_hop_oid = peer.next_hops.acquire(op.next_hop);
+            if (next_hop_oid == SAI_NULL_OBJECT_ID) {
+                peer.failures.push_back({op.prefix.toString(), op.op, SAI_STATUS_INVALID_PARAMETER, peer.asic->index});
+                continue;
+            }
+        }
+        groups[static_cast<int>(kind)].push_back(&op);
+        programs[static_cast<int>(kind)].push_back({&op.prefix, next_hop_oid});
+    }
+
+    peer.sai_calls = 0;
+    std::vector<sai_status_t> statuses;
+    const RouteSyncOp order[] = {RouteSyncOp::REMOVE, RouteSyncOp::ADD, RouteSyncOp::REPLACE};
+    for (RouteSyncOp kind : order) {
+        const std::vector<const RouteOp*>& group = groups[static_cast<int>(kind)];
+        const std::vector<RouteProgram>& program = programs[static_cast<int>(kind)];
+        peer.sai_calls += programRoutes(peer.asic->route_api, peer.asic->switch_id, kind, program, statuses);
+
+        for (size_t j = 0; j < group.size(); ++j) {
+            const RouteOp& op = *group[j];
+            if (statuses[j] != SAI_STATUS_SUCCESS) {
+                if (kind != RouteSyncOp::REMOVE) {
+                    peer.next_hops.release(program[j].next_hop_oid);
+                }
+                peer.failures.push_back({op.prefix.toString(), op.op, statuses[j], peer.asic->index});
+                continue;
+            }
+            if (kind == RouteSyncOp::REMOVE) {
+                peer.next_hops.release(*peer.routes.find(op.prefix));
+                peer.routes.erase(op.prefix);
+            } else if (kind == RouteSyncOp::REPLACE) {
+                sai_object_id_t* current = peer.routes.find(op.prefix);
+                peer.next_hops.release(*current);
+                *current = program[j].next_hop_oid;
+            } else {
+                peer.routes.insert(op.prefix, program[j].next_hop_oid);
+            }
+        }
+    }
+}
+
+size_t OrchAgent::programRoutes(sai_route_api_t* route_api, sai_object_id_t switch_id, RouteSyncOp kind,
+                                const std::vector<RouteProgram>& routes, std::vector<sai_status_t>& statuses) const {
+    statuses.assign(routes.size(), SAI_STATUS_NOT_EXECUTED);
+    bool use_bulk = (kind == RouteSyncOp::ADD && route_api->create_route_entries) ||
+                    (kind == RouteSyncOp::REMOVE && route_api->remove_route_entries) ||
+                    (kind == RouteSyncOp::REPLACE && route_api->set_route_entries_attribute);
+    size_t sai_calls = 0;
+
+    for (size_t offset = 0; offset < routes.size(); offset += ROUTE_BULK_CHUNK_SIZE) {
+        size_t count = std::min(ROUTE_BULK_CHUNK_SIZE, routes.size() - offset);
+        std::vector<sai_route_entry_t> entries(count);
+        std::vector<sai_attribute_t> attrs(count * 2);   // packet action, next hop
+        sai_status_t* chunk_statuses = &statuses[offset];
+        for (size_t j = 0; j < count; ++j) {
+            toSAIRouteEntry(*routes[offset + j].prefix, entries[j]);
+            entries[j].switch_id = switch_id;
+            attrs[j * 2].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+            attrs[j * 2].value.s32 = SAI_PACKET_ACTION_FORWARD;
+            attrs[j * 2 + 1].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+            attrs[j * 2 + 1].value.oid = routes[offset + j].next_hop_oid;
+        }
+
+        if (use_bulk) {
+            sai_status_t status = SAI_STATUS_SUCCESS;
+            uint32_t object_count = static_cast<uint32_t>(count);
+            if (kind == RouteSyncOp::ADD) {
+                std::vector<uint32_t> attr_counts(count, 2);
+                std::vector<const sai_attribute_t*> attr_lists(count);
+                for (size_t j = 0; j < count; ++j) {
+                    attr_lists[j] = &attrs[j * 2];
+                }
+                status = route_api->create_route_entries(object_count, entries.data(), attr_counts.data(),
+                                                         attr_lists.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                         chunk_statuses);
+            } else if (kind == RouteSyncOp::REMOVE) {
+                status = route_api->remove_route_entries(object_count, entries.data(),
+                                                         SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, chunk_statuses);
+            } else {
+                std::vector<sai_attribute_t> next_hops(count);
+                for (size_t j = 0; j < count; ++j) {
+                    next_hops[j] = attrs[j * 2 + 1];
+                }
+                status = route_api->set_route_entries_attribute(object_count, entries.data(), next_hops.data(),
+                                                                SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                                chunk_statuses);
+            }
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED) {
+                std::cout << "SAI bulk route API not supported, using per-route calls" << std::endl;
+                use_bulk = false;
+            } else {
+                sai_calls++;
+            }
+        }
+        if (!use_bulk) {
+            for (size_t j = 0; j < count; ++j) {
+                if (kind == RouteSyncOp::ADD) {
+                    chunk_statuses[j] = route_api->create_route_entry(&entries[j], 2, &attrs[j * 2]);
+                } else if (kind == RouteSyncOp::REMOVE) {
+                    chunk_statuses[j] = route_api->remove_route_entry(&entries[j]);
+                } else {
+                    chunk_statuses[j] = route_api->set_route_entry_attribute(&entries[j], &attrs[j * 2 + 1]);
+                }
+            }
+            sai_calls += count;
+        }
+    }
+    return sai_calls;
+}
+
+void OrchAgent::toSAIRouteEntry(const common::IpPrefix& prefix, sai_route_entry_t& entry) const {
+    std::memset(&entry, 0, sizeof(entry));
+    entry.switch_id = switch_id_;
+    entry.vr_id = SAI_NULL_OBJECT_ID;       // Default virtual router
+
+    common::uint128 mask = common::IpPrefix::mask(~common::uint128(0), prefix.length);
+    if (prefix.v6) {
+        entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV6;
+        for (size_t i = 0; i < 16; ++i) {
+            entry.destination.addr.ip6[i] = static_cast<uint8_t>(prefix.address >> (120 - 8 * i));
+            entry.destination.mask.ip6[i] = static_cast<uint8_t>(mask >> (120 - 8 * i));
+        }
+    } else {
+        entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        entry.destination.addr.ip4 = htonl(static_cast<uint32_t>(prefix.address >> 96));
+        entry.destination.mask.ip4 = htonl(static_cast<uint32_t>(mask >> 96));
+    }
+}
+
 void OrchAgent::updateVLANState(uint16_t vlan_id, const std::string& state) {
     // In a real implementation, this would update Redis
     std::cout << "Updating VLAN " << vlan_id << " state to: " << state << std::endl;
@@ -292,16 +1199,8 @@ void OrchAgent::updateRouteState(const std::string& prefix, const std::string& n
     std::cout << "Updating route " << prefix << " via " << next_hop << " state to: " << state << std::endl;
 }
 
-sai_object_id_t OrchAgent::getNextHopOID(const std::string& next_hop) {
-    // In a real implementation, this would resolve next-hop to OID
-    // For simulation, return a mock OID
-    static std::map<std::string, sai_object_id_t> next_hop_oids;
-    
-    if (next_hop_oids.find(next_hop) == next_hop_oids.end()) {
-        next_hop_oids[next_hop] = 0x2000000000000000ULL + next_hop_oids.size();
-    }
-    
-    return next_hop_oids[next_hop];
+sai_object_id_t OrchAgent::getPortOID(common::PortId port_id) const {
+    return common::portRegistry().getOID(port_id);
 }
 
 std::string OrchAgent::getCurrentTimestamp() {
@@ -316,7 +1215,7 @@ std::string OrchAgent::getCurrentTimestamp() {
 void OrchAgent::cleanup() {
     // Clean up SAI resources
     if (switch_api_) {
-        sai_api_uninitialize();
+        sai::SAIAdapter::getInstance()->uninitialize();
     }
     
     // Clean up Redis connection
@@ -10,9 +10,18 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <memory>
 #include <thread>
 #include <atomic>
+#include <mutex>
+#include <chrono>
+#include "../common/route_table.h"
+#include "../common/string_interner.h"
+#include "nexthop_registry.h"
+#include "orch.h"
+#include "orch_scheduler.h"
+#include "../common/event_loop.h"
 
 // Real SAI headers
 extern "C" {
@@ -24,14 +33,27 @@ extern "C" {
 }
 
 namespace sonic {
+namespace sai {
+struct SAISwitchContext;
+}
+
 namespace swss {
 
+/**
+ * @brief Port membership of a VLAN
+ */
+struct VLANPortMember {
+    sai_object_id_t member_oid;
+    bool tagged;
+};
+
 /**
  * @brief VLAN entry structure
  */
 struct VLANEntry {
     uint16_t vlan_id;
     sai_object_id_t vlan_oid;
+    std::map<common::PortId, VLANPortMember> members;    ///< Keyed by common::portNames() ID
     std::string created_at;
 };
 
@@ -42,9 +64,44 @@ struct RouteEntry {
     std::string prefix;
     std::string next_hop;
     sai_object_id_t route_oid;
+    sai_object_id_t next_hop_oid;   ///< NEXT_HOP or NEXT_HOP_GROUP held in the registry
     std::string created_at;
 };
 
+/**
+ * @brief Route change issued by the route-sync stage
+ */
+enum class RouteSyncOp {
+    ADD,
+    REMOVE,
+    REPLACE
+};
+
+/**
+ * @brief Outcome of one route in a sync batch
+ */
+struct RouteSyncStatus {
+    std::string prefix;
+    RouteSyncOp op;
+    sai_status_t status;
+    size_t asic = 0;        ///< ASIC that reported status
+};
+
+/**
+ * @brief Summary of one programmed route batch
+ */
+struct RouteSyncReport {
+    size_t added = 0;
+    size_t removed = 0;
+    size_t replaced = 0;
+    size_t unchanged = 0;   ///< Desired state already programmed
+    size_t coalesced = 0;   ///< Queued updates superseded within the batching window
+    size_t failed = 0;      ///< Per ASIC: a route failing on two ASICs counts twice
+    size_t sai_calls = 0;   ///< Summed over ASICs
+    double convergence_ms = 0;  ///< First queued update (or sync call) to last SAI reply
+    std::vector<RouteSyncStatus> statuses;
+};
+
 /**
  * @brief Mock Redis client class
  */
@@ -110,6 +167,56 @@ public:
      * @return true if successful, false otherwise
      */
     bool deleteVLAN(uint16_t vlan_id);
+
+    /**
+     * @brief Check whether a VLAN has been created
+     */
+    bool hasVLAN(uint16_t vlan_id) const;
+
+    /**
+     * @brief Add a port to a VLAN, or change its tagging mode
+     * @param vlan_id Existing VLAN
+     * @param port_name Port known to the port registry
+     * @param tagged true for tagged, false for untagged
+     * @return true if successful, false otherwise
+     */
+    bool addVLANMember(uint16_t vlan_id, const std::string& port_name, bool tagged);
+
+    /**
+     * @brief Remove a port from a VLAN
+     * @return true if successful, false otherwise
+     */
+    bool removeVLANMember(uint16_t vlan_id, const std::string& port_name);
+
+    /**
+     * @brief Check whether a port is a member of a VLAN
+     */
+    bool hasVLANMember(uint16_t vlan_id, const std::string& port_name) const;
+
+    /**
+     * @brief IDs of every created VLAN, ascending
+     */
+    std::vector<uint16_t> getVLANIds() const;
+
+    /**
+     * @brief Every (VLAN ID, port name) membership
+     */
+    std::vector<std::pair<uint16_t, std::string>> getVLANMembers() const;
+
+    /**
+     * @brief Add a table consumer to the event loop; call before start()
+     */
+    void registerOrch(std::unique_ptr<Orch> orch);
+
+    /**
+     * @brief Limit on changes one Orch applies before a worker moves on
+     */
+    void setOrchBatchSize(size_t batch_size) { scheduler_.setBatchSize(batch_size); }
+
+    /**
+     * @brief Block until every queued table change has been applied
+     */
+    void waitOrchsIdle() { scheduler_.waitIdle(); }
     
     /**
      * @brief Add a route
@@ -119,6 +226,96 @@ public:
      */
     bool addRoute(const std::string& prefix, const std::string& next_hop);
 
+    /**
+     * @brief Make the programmed routes exactly match a desired set
+     *
+     * Only the difference against the current table is sent to SAI, using
+     * bulk create/remove/set calls.
+     * @param desired Prefix to next hop for every route that should exist
+     * @param report Per-route status and convergence time
+     * @return true if every route was programmed
+     */
+    bool syncRoutes(const std::map<std::string, std::string>& desired, RouteSyncReport& report);
+
+    /**
+     * @brief Queue an add or replace for the next route batch
+     *
+     * Updates to the same prefix within the batching window are coalesced;
+     * only the last one is programmed.
+     * @return false if the prefix cannot be parsed
+     */
+    bool queueRouteUpdate(const std::string& prefix, const std::string& next_hop);
+
+    /**
+     * @brief Queue a route removal for the next route batch
+     * @return false if the prefix cannot be parsed
+     */
+    bool queueRouteDelete(const std::string& prefix);
+
+    /**
+     * @brief Program all queued route updates now
+     * @return true if every route was programmed
+     */
+    bool flushRouteUpdates(RouteSyncReport& report);
+
+    /**
+     * @brief Set how long queued route updates are held before the orchestration loop programs them
+     */
+    void setRouteBatchWindow(std::chrono::milliseconds window) { route_batch_window_ms_ = window.count(); }
+
+    /**
+     * @brief Report of the last batch programmed by the orchestration loop
+     */
+    RouteSyncReport getLastRouteSyncReport() const;
+
+    /**
+     * @brief Number of programmed routes
+     */
+    size_t getRouteCount() const;
+
+    /**
+     * @brief Every programmed prefix, in canonical "address/length" form
+     */
+    std::vector<std::string> getRoutePrefixes() const;
+
+    /**
+     * @brief Enable warm restart: state is restored from path by start() and saved to it by stop()
+     */
+    void setWarmRestartFile(const std::string& path) { warm_restart_file_ = path; }
+
+    /**
+     * @brief Minimum time between checkpoints written while running (0 disables checkpoints)
+     */
+    void setWarmCheckpointInterval(std::chrono::seconds interval) { warm_checkpoint_interval_s_ = interval.count(); }
+
+    /**
+     * @brief Write VLANs, routes, next-hop objects and port OIDs to the warm-restart file
+     * @return true if successful, false otherwise
+     */
+    bool saveWarmSnapshot();
+
+    /**
+     * @brief Load state written by saveWarmSnapshot() instead of reprogramming it
+     *
+     * Every restored SAI object must still exist; otherwise nothing is
+     * restored and startup proceeds cold. Entries gone from the database are
+     * removed once the consumers subscribe.
+     * @return true if state was restored
+     */
+    bool restoreWarmSnapshot();
+
+    /**
+     * @brief SAI next-hop, next-hop-group and group-member objects held for routes
+     */
+    size_t getNextHopObjectCount() const;
+
+    /**
+     * @brief Get port OID via the shared port registry
+     * @param port_id common::portNames() ID of the port
+     * @return SAI object ID, SAI_NULL_OBJECT_ID if the port is unknown
+     */
+    sai_object_id_t getPortOID(common::PortId port_id) const;
+
 private:
     /**
      * @brief Initialize Redis connection
@@ -131,27 +328,134 @@ private:
      * @return true if successful, false otherwise
      */
     bool initializeSAI();
+
+    /**
+     * @brief Load the shared port name/OID registry from COUNTERS_DB
+     * @return true if successful, false otherwise
+     */
+    bool initializePortRegistry();
     
     /**
-     * @brief Main orchestration loop
+     * @brief Main orchestration loop: block in the event loop until a
+     * consumer table changes, a route batch is due or stop() is called
      */
     void orchestrationLoop();
     
     /**
-     * @brief Process configuration changes from Redis
+     * @brief Subscribe to every Orch table and queue their current contents
+     * @return true if successful, false otherwise
      */
-    void processConfigurationChanges();
+    bool subscribeConsumers();
     
     /**
-     * @brief Process state updates
+     * @brief Read pending keyspace notifications and queue them on their Orchs
      */
-    void processStateUpdates();
+    void readTableChanges();
     
     /**
-     * @brief Synchronize with hardware via SAI
+     * @brief Time until the pending route batch is due, -1 if none is pending
      */
-    void synchronizeWithHardware();
+    int routeBatchDueMs();
     
+    /**
+     * @brief Program queued route updates once the batching window has elapsed
+     */
+    void processRouteUpdates();
+
+    /**
+     * @brief Hand a due route batch to the scheduler unless one is already queued
+     */
+    void postRouteUpdates();
+
+    /**
+     * @brief Time until the next checkpoint is due, -1 if nothing changed since the last one
+     */
+    int checkpointDueMs() const;
+
+    /**
+     * @brief Hand a due checkpoint to the scheduler unless one is already queued
+     */
+    void postCheckpoint();
+
+    /**
+     * @brief One route change computed by diffing against routes_
+     */
+    struct RouteOp {
+        common::IpPrefix prefix;
+        RouteSyncOp op;
+        std::string next_hop;
+    };
+
+    /**
+     * @brief Queued route update; remove == true for deletes
+     */
+    struct PendingRoute {
+        bool remove = false;
+        std::string next_hop;
+    };
+
+    /**
+     * @brief Diff one desired route against routes_ (caller holds route_mutex_)
+     * @return false if nothing needs to change
+     */
+    bool diffRoute(const common::IpPrefix& prefix, bool remove, const std::string& next_hop, RouteOp& op) const;
+
+    /**
+     * @brief Route state of one ASIC other than ASIC 0
+     *
+     * Batches are diffed against routes_ (ASIC 0); each peer maps them onto
+     * its own table, so a route a peer failed to program is added again by
+     * the next update for that prefix.
+     */
+    struct PeerAsic {
+        const sai::SAISwitchContext* asic = nullptr;
+        NextHopRegistry next_hops;
+        common::RouteTable<sai_object_id_t> routes;     ///< Prefix -> next-hop object on this ASIC
+        size_t sai_calls = 0;                           ///< For the batch in progress
+        std::vector<RouteSyncStatus> failures;          ///< For the batch in progress
+    };
+
+    /**
+     * @brief One route handed to programRoutes()
+     */
+    struct RouteProgram {
+        const common::IpPrefix* prefix;
+        sai_object_id_t next_hop_oid;
+    };
+
+    /**
+     * @brief Program a batch of route changes via SAI bulk calls and update routes_
+     * (caller holds route_mutex_)
+     *
+     * With more than one ASIC the batch is mirrored to every peer ASIC on its
+     * worker while ASIC 0 is programmed; peer failures are reported with
+     * their ASIC index.
+     */
+    void applyRouteOps(const std::vector<RouteOp>& ops, RouteSyncReport& report);
+
+    /**
+     * @brief ASIC 0 part of applyRouteOps()
+     */
+    void applyPrimaryRouteOps(const std::vector<RouteOp>& ops, RouteSyncReport& report);
+
+    /**
+     * @brief Mirror a batch onto one peer ASIC, recording failures in peer.failures
+     */
+    void applyPeerRouteOps(PeerAsic& peer, const std::vector<RouteOp>& ops) const;
+
+    /**
+     * @brief Issue one kind of route change on one ASIC, in bulk where supported
+     * @param statuses One per route
+     * @return SAI calls made
+     */
+    size_t programRoutes(sai_route_api_t* route_api, sai_object_id_t switch_id, RouteSyncOp kind,
+                         const std::vector<RouteProgram>& routes, std::vector<sai_status_t>& statuses) const;
+
+    /**
+     * @brief Fill a SAI route entry for prefix in the default virtual router
+     */
+    void toSAIRouteEntry(const common::IpPrefix& prefix, sai_route_entry_t& entry) const;
+
     /**
      * @brief Update VLAN state in Redis
      * @param vlan_id VLAN ID
@@ -167,13 +471,6 @@ private:
      */
     void updateRouteState(const std::string& prefix, const std::string& next_hop, const std::string& state);
     
-    /**
-     * @brief Get next-hop OID from address
-     * @param next_hop Next hop address
-     * @return SAI object ID
-     */
-    sai_object_id_t getNextHopOID(const std::string& next_hop);
-    
     /**
      * @brief Get current timestamp
      * @return Formatted timestamp string
@@ -189,6 +486,22 @@ private:
     std::atomic<bool> running_;
     std::unique_ptr<std::thread> orch_thread_;
     
+    // Event loop and table consumers, sorted by descending priority
+    common::EventLoop event_loop_;
+    std::vector<std::unique_ptr<Orch>> orchs_;
+    std::unique_ptr<common::RedisTableWatcher> watcher_;
+    std::vector<std::pair<Orch*, size_t>> table_owners_;   // Watcher table index -> Orch, local index
+    OrchScheduler scheduler_;
+    std::atomic<bool> route_flush_posted_{false};
+
+    // Warm restart
+    std::string warm_restart_file_;
+    std::atomic<int64_t> warm_checkpoint_interval_s_{60};
+    std::atomic<uint64_t> state_version_{0};       // Bumped on every VLAN or route change
+    std::atomic<uint64_t> saved_version_{0};
+    std::chrono::steady_clock::time_point last_checkpoint_;
+    std::atomic<bool> checkpoint_posted_{false};
+    
     // Redis connection
     std::unique_ptr<RedisClient> redis_client_;
     
@@ -201,7 +514,25 @@ private:
     
     // State storage
     std::map<uint16_t, VLANEntry> vlans_;
-    std::map<std::string, RouteEntry> routes_;
+    mutable std::mutex vlan_mutex_;     // Guards vlans_
+    common::RouteTable<RouteEntry> routes_;
+    mutable std::mutex route_mutex_;    // Guards routes_, next_hops_ and last_route_report_
+    NextHopRegistry next_hops_;
+    RouteSyncReport last_route_report_;
+    std::vector<std::unique_ptr<PeerAsic>> peer_asics_;     // Guarded by route_mutex_
+
+    // Route updates waiting for the next batch
+    std::mutex pending_mutex_;
+    common::RouteTable<PendingRoute> pending_routes_;
+    size_t pending_coalesced_ = 0;
+    std::chrono::steady_clock::time_point pending_since_;
+    std::atomic<int64_t> route_batch_window_ms_{50};
+
+    /// Upper bound on routes per SAI bulk call
+    static constexpr size_t ROUTE_BULK_CHUNK_SIZE = 1024;
+
+    /// Bump when the warm-restart snapshot layout changes
+    static constexpr uint32_t WARM_SNAPSHOT_VERSION = 1;
     
     // Disable copy constructor and assignment operator
     OrchAgent(const OrchAgent&) = delete;
@@ -0,0 +1,40 @@
+/**
+ * @file portsorch.cpp
+ * @brief SONiC SwSS Ports Orch Implementation
+ */
+
+#include "portsorch.h"
+#include "../common/port_registry.h"
+#include <iostream>
+
+namespace sonic {
+namespace swss {
+
+// Ports come first: VLAN members and routes refer to them
+PortsOrch::PortsOrch() : Orch("PortsOrch", 3, {{CONFIG_DB, "PORT|"}}) {
+}
+
+bool PortsOrch::getPortConfig(const std::string& port_name, std::map<std::string, std::string>& fields) const {
+    auto it = ports_.find(port_name);
+    if (it == ports_.end()) {
+        return false;
+    }
+    fields = it->second;
+    return true;
+}
+
+void PortsOrch::doTask(const common::TableChange& change) {
+    if (change.deleted) {
+        ports_.erase(change.key);
+        return;
+    }
+
+    bool is_new = ports_.find(change.key) == ports_.end();
+    ports_[change.key] = change.fields;
+    if (is_new && common::portRegistry().getOID(change.key) == 0) {
+        std::cerr << "PortsOrch: port " << change.key << " has no SAI OID in COUNTERS_DB yet" << std::endl;
+    }
+}
+
+} // namespace swss
+} // namespace sonic
@@ -0,0 +1,39 @@
+/**
+ * @file portsorch.h
+ * @brief SONiC SwSS Ports Orch Header
+ */
+
+#ifndef SONIC_SWSS_PORTSORCH_H
+#define SONIC_SWSS_PORTSORCH_H
+
+#include "orch.h"
+#include <map>
+
+namespace sonic {
+namespace swss {
+
+/**
+ * @brief Tracks CONFIG_DB PORT|<name> configuration and checks ports against the port registry
+ */
+class PortsOrch : public Orch {
+public:
+    PortsOrch();
+
+    /**
+     * @brief Configured attributes of a port
+     * @return false if the port is not configured
+     */
+    bool getPortConfig(const std::string& port_name, std::map<std::string, std::string>& fields) const;
+    size_t getPortCount() const { return ports_.size(); }
+
+protected:
+    void doTask(const common::TableChange& change) override;
+
+private:
+    std::map<std::string, std::map<std::string, std::string>> ports_;
+};
+
+} // namespace swss
+} // namespace sonic
+
+#endif // SONIC_SWSS_PORTSORCH_H
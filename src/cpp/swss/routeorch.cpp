@@ -0,0 +1,79 @@
+/**
+ * @file routeorch.cpp
+ * @brief SONiC SwSS Route Orch Implementation
+ */
+
+#include "routeorch.h"
+#include "orchagent.h"
+#include <iostream>
+#include <sstream>
+
+namespace sonic {
+namespace swss {
+
+namespace {
+
+std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        items.push_back(item);
+    }
+    return items;
+}
+
+std::string fieldOr(const std::map<std::string, std::string>& fields, const std::string& field) {
+    auto it = fields.find(field);
+    return it == fields.end() ? "" : it->second;
+}
+
+} // anonymous namespace
+
+RouteOrch::RouteOrch(OrchAgent& agent)
+    : Orch("RouteOrch", 1, {{APPL_DB, "ROUTE_TABLE:"}}), agent_(agent) {
+    // Routes resolve next hops over ports, so port changes land first
+    addDependency("PortsOrch");
+}
+
+std::string RouteOrch::joinNextHops(const std::string& next_hops, const std::string& interfaces) {
+    std::vector<std::string> addresses = splitList(next_hops);
+    std::vector<std::string> names = splitList(interfaces);
+    std::string joined;
+    for (size_t i = 0; i < addresses.size(); ++i) {
+        if (i > 0) {
+            joined += ',';
+        }
+        joined += addresses[i];
+        if (i < names.size() && !names[i].empty()) {
+            joined += '@' + names[i];
+        }
+    }
+    return joined;
+}
+
+std::vector<std::string> RouteOrch::getAppliedKeys(size_t) const {
+    return agent_.getRoutePrefixes();
+}
+
+void RouteOrch::doTask(const common::TableChange& change) {
+    // "Vrf-<name>:<prefix>" keys belong to non-default VRFs, which OrchAgent does not program
+    if (change.key.compare(0, 3, "Vrf") == 0) {
+        return;
+    }
+
+    if (change.deleted) {
+        agent_.queueRouteDelete(change.key);
+        return;
+    }
+
+    std::string next_hops = joinNextHops(fieldOr(change.fields, "nexthop"), fieldOr(change.fields, "ifname"));
+    if (next_hops.empty()) {
+        std::cerr << "RouteOrch: route " << change.key << " has no next hop, skipping" << std::endl;
+        return;
+    }
+    agent_.queueRouteUpdate(change.key, next_hops);
+}
+
+} // namespace swss
+} // namespace sonic
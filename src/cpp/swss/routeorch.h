@@ -0,0 +1,39 @@
+/**
+ * @file routeorch.h
+ * @brief SONiC SwSS Route Orch Header
+ */
+
+#ifndef SONIC_SWSS_ROUTEORCH_H
+#define SONIC_SWSS_ROUTEORCH_H
+
+#include "orch.h"
+
+namespace sonic {
+namespace swss {
+
+class OrchAgent;
+
+/**
+ * @brief Feeds APPL_DB ROUTE_TABLE into OrchAgent's batched route pipeline
+ */
+class RouteOrch : public Orch {
+public:
+    explicit RouteOrch(OrchAgent& agent);
+
+    /**
+     * @brief Combine ROUTE_TABLE "nexthop" and "ifname" lists into "ip@ifname,..."
+     */
+    static std::string joinNextHops(const std::string& next_hops, const std::string& interfaces);
+
+protected:
+    std::vector<std::string> getAppliedKeys(size_t table) const override;
+    void doTask(const common::TableChange& change) override;
+
+private:
+    OrchAgent& agent_;
+};
+
+} // namespace swss
+} // namespace sonic
+
+#endif // SONIC_SWSS_ROUTEORCH_H
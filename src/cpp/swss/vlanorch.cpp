@@ -0,0 +1,96 @@
+/**
+ * @file vlanorch.cpp
+ * @brief SONiC SwSS VLAN Orch Implementation
+ */
+
+#include "vlanorch.h"
+#include "orchagent.h"
+#include <iostream>
+#include <cstdlib>
+
+namespace sonic {
+namespace swss {
+
+VLANOrch::VLANOrch(OrchAgent& agent)
+    : Orch("VLANOrch", 2, {{CONFIG_DB, "VLAN|"}}), agent_(agent) {
+}
+
+namespace {
+
+// "Vlan100" -> 100; false for anything outside 1..4094
+bool parseVLANName(const std::string& name, uint16_t& id) {
+    static const std::string prefix = "Vlan";
+    char* end = nullptr;
+    unsigned long vlan_id = name.compare(0, prefix.size(), prefix) == 0
+                                ? std::strtoul(name.c_str() + prefix.size(), &end, 10) : 0;
+    if (vlan_id < 1 || vlan_id > 4094 || (end && *end != '\0')) {
+        return false;
+    }
+    id = static_cast<uint16_t>(vlan_id);
+    return true;
+}
+
+} // anonymous namespace
+
+std::vector<std::string> VLANOrch::getAppliedKeys(size_t) const {
+    std::vector<std::string> keys;
+    for (uint16_t id : agent_.getVLANIds()) {
+        keys.push_back("Vlan" + std::to_string(id));
+    }
+    return keys;
+}
+
+void VLANOrch::doTask(const common::TableChange& change) {
+    uint16_t id = 0;
+    if (!parseVLANName(change.key, id)) {
+        std::cerr << "VLANOrch: ignoring invalid VLAN key " << change.key << std::endl;
+        return;
+    }
+
+    if (change.deleted) {
+        if (agent_.hasVLAN(id)) {
+            agent_.deleteVLAN(id);
+        }
+    } else if (!agent_.hasVLAN(id)) {
+        agent_.createVLAN(id);
+    }
+}
+
+VLANMemberOrch::VLANMemberOrch(OrchAgent& agent)
+    : Orch("VLANMemberOrch", 2, {{CONFIG_DB, "VLAN_MEMBER|"}}), agent_(agent) {
+    addDependency("VLANOrch");
+    addDependency("PortsOrch");
+}
+
+std::vector<std::string> VLANMemberOrch::getAppliedKeys(size_t) const {
+    std::vector<std::string> keys;
+    for (const auto& member : agent_.getVLANMembers()) {
+        keys.push_back("Vlan" + std::to_string(member.first) + "|" + member.second);
+    }
+    return keys;
+}
+
+void VLANMemberOrch::doTask(const common::TableChange& change) {
+    size_t separator = change.key.find('|');
+    uint16_t id = 0;
+    if (separator == std::string::npos || !parseVLANName(change.key.substr(0, separator), id) ||
+        separator + 1 == change.key.size()) {
+        std::cerr << "VLANMemberOrch: ignoring invalid VLAN member key " << change.key << std::endl;
+        return;
+    }
+
+    std::string port_name = change.key.substr(separator + 1);
+    if (change.deleted) {
+        if (agent_.hasVLANMember(id, port_name)) {
+            agent_.removeVLANMember(id, port_name);
+        }
+        return;
+    }
+
+    auto mode = change.fields.find("tagging_mode");
+    bool tagged = mode != change.fields.end() && mode->second == "tagged";
+    agent_.addVLANMember(id, port_name, tagged);
+}
+
+} // namespace swss
+} // namespace sonic
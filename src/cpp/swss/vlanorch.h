@@ -0,0 +1,51 @@
+/**
+ * @file vlanorch.h
+ * @brief SONiC SwSS VLAN Orch Header
+ */
+
+#ifndef SONIC_SWSS_VLANORCH_H
+#define SONIC_SWSS_VLANORCH_H
+
+#include "orch.h"
+
+namespace sonic {
+namespace swss {
+
+class OrchAgent;
+
+/**
+ * @brief Creates and removes VLANs from CONFIG_DB VLAN|Vlan<id>
+ */
+class VLANOrch : public Orch {
+public:
+    explicit VLANOrch(OrchAgent& agent);
+
+protected:
+    std::vector<std::string> getAppliedKeys(size_t table) const override;
+    void doTask(const common::TableChange& change) override;
+
+private:
+    OrchAgent& agent_;
+};
+
+/**
+ * @brief Adds and removes ports from VLANs from CONFIG_DB VLAN_MEMBER|Vlan<id>|<port>
+ *
+ * Runs after VLANOrch and PortsOrch so the VLAN and port already exist.
+ */
+class VLANMemberOrch : public Orch {
+public:
+    explicit VLANMemberOrch(OrchAgent& agent);
+
+protected:
+    std::vector<std::string> getAppliedKeys(size_t table) const override;
+    void doTask(const common::TableChange& change) override;
+
+private:
+    OrchAgent& agent_;
+};
+
+} // namespace swss
+} // namespace sonic
+
+#endif // SONIC_SWSS_VLANORCH_H
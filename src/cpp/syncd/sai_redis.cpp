@@ -0,0 +1,495 @@
+/**
+ * @file sai_redis.cpp
+ * @brief SONiC Syncd ASIC_DB Wire Format and Producer Implementation
+ */
+
+#include "sai_redis.h"
+#include "../common/logger.h"
+#include <cstring>
+#include <chrono>
+#include <random>
+#include <unistd.h>
+
+namespace sonic {
+namespace syncd {
+
+const char* const ASIC_STATE_QUEUE = "ASIC_STATE_QUEUE";
+const char* const VID_COUNTER_KEY = "VIDCOUNTER";
+
+namespace {
+
+constexpr uint32_t BATCH_MAGIC = 0x31424453;    // "SDB1"
+constexpr uint32_t REPLY_MAGIC = 0x31524453;    // "SDR1"
+
+constexpr sai_object_id_t VID_MARKER = 1ULL << 63;
+constexpr int VID_TYPE_SHIFT = 48;
+constexpr sai_object_id_t VID_TYPE_MASK = 0xFF;
+constexpr sai_object_id_t VID_INDEX_MASK = (1ULL << VID_TYPE_SHIFT) - 1;
+
+struct AttrKindEntry {
+    sai_object_type_t object_type;
+    int32_t attr_id;
+    AttrValueKind kind;
+};
+
+// Attributes the orchestration code sets; anything else is UNSUPPORTED
+const AttrKindEntry ATTR_KINDS[] = {
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_VLAN_ID, AttrValueKind::U16},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES, AttrValueKind::U32},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_STP_INSTANCE, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_LEARN_DISABLE, AttrValueKind::BOOL},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_IPV4_MCAST_LOOKUP_KEY_TYPE, AttrValueKind::S32},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_IPV6_MCAST_LOOKUP_KEY_TYPE, AttrValueKind::S32},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_UNKNOWN_NON_IP_MCAST_OUTPUT_GROUP_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_UNKNOWN_IPV4_MCAST_OUTPUT_GROUP_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_UNKNOWN_IPV6_MCAST_OUTPUT_GROUP_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_UNKNOWN_LINKLOCAL_MCAST_OUTPUT_GROUP_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_INGRESS_ACL, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_EGRESS_ACL, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_META_DATA, AttrValueKind::U32},
+    {SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE, AttrValueKind::S32},
+    {SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION, AttrValueKind::S32},
+    {SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_USER_TRAP_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_META_DATA, AttrValueKind::U32},
+    {SAI_OBJECT_TYPE_NEXT_HOP, SAI_NEXT_HOP_ATTR_TYPE, AttrValueKind::S32},
+    {SAI_OBJECT_TYPE_NEXT_HOP, SAI_NEXT_HOP_ATTR_IP, AttrValueKind::IPADDR},
+    {SAI_OBJECT_TYPE_NEXT_HOP, SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_NEXT_HOP_GROUP, SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_COUNT, AttrValueKind::U32},
+    {SAI_OBJECT_TYPE_NEXT_HOP_GROUP, SAI_NEXT_HOP_GROUP_ATTR_TYPE, AttrValueKind::S32},
+    {SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID, AttrValueKind::OID},
+    {SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, SAI_NEXT_HOP_GROUP_MEMBER_ATTR_WEIGHT, AttrValueKind::U32},
+};
+
+template <typename T>
+void put(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void putIpAddr(std::string& out, sai_ip_addr_family_t family, const sai_ip_addr_t& addr) {
+    put<uint8_t>(out, static_cast<uint8_t>(family));
+    if (family == SAI_IP_ADDR_FAMILY_IPV4) {
+        put(out, addr.ip4);
+    } else {
+        out.append(reinterpret_cast<const char*>(addr.ip6), sizeof(addr.ip6));
+    }
+}
+
+/**
+ * @brief Bounds-checked cursor over a frame; any short read fails the whole decode
+ */
+class FrameReader {
+public:
+    explicit FrameReader(const std::string& frame) : data_(frame.data()), size_(frame.size()), pos_(0) {}
+
+    template <typename T>
+    bool get(T& value) {
+        if (size_ - pos_ < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    bool getBytes(void* out, size_t count) {
+        if (size_ - pos_ < count) {
+            return false;
+        }
+        std::memcpy(out, data_ + pos_, count);
+        pos_ += count;
+        return true;
+    }
+
+    bool getString(std::string& out, size_t count) {
+        if (size_ - pos_ < count) {
+            return false;
+        }
+        out.assign(data_ + pos_, count);
+        pos_ += count;
+        return true;
+    }
+
+    bool getIpAddr(sai_ip_addr_family_t& family, sai_ip_addr_t& addr) {
+        uint8_t raw_family = 0;
+        if (!get(raw_family)) {
+            return false;
+        }
+        std::memset(&addr, 0, sizeof(addr));
+        family = static_cast<sai_ip_addr_family_t>(raw_family);
+        if (family == SAI_IP_ADDR_FAMILY_IPV4) {
+            return get(addr.ip4);
+        }
+        return family == SAI_IP_ADDR_FAMILY_IPV6 && getBytes(addr.ip6, sizeof(addr.ip6));
+    }
+
+    bool atEnd() const { return pos_ == size_; }
+
+private:
+    const char* data_;
+    size_t size_;
+    size_t pos_;
+};
+
+void encodeAttr(sai_object_type_t object_type, const sai_attribute_t& attr, std::string& out) {
+    AttrValueKind kind = attrValueKind(object_type, attr.id);
+    put(out, attr.id);
+    put<uint8_t>(out, static_cast<uint8_t>(kind));
+    const sai_attribute_value_t& value = attr.value;
+    switch (kind) {
+        case AttrValueKind::BOOL:   put<uint8_t>(out, value.booldata ? 1 : 0); break;
+        case AttrValueKind::U8:     put(out, value.u8); break;
+        case AttrValueKind::S8:     put(out, value.s8); break;
+        case AttrValueKind::U16:    put(out, value.u16); break;
+        case AttrValueKind::S16:    put(out, value.s16); break;
+        case AttrValueKind::U32:    put(out, value.u32); break;
+        case AttrValueKind::S32:    put(out, value.s32); break;
+        case AttrValueKind::U64:    put(out, value.u64); break;
+        case AttrValueKind::S64:    put(out, value.s64); break;
+        case AttrValueKind::OID:    put(out, value.oid); break;
+        case AttrValueKind::IPADDR: putIpAddr(out, value.ipaddr.addr_family, value.ipaddr.addr); break;
+        case AttrValueKind::UNSUPPORTED: break;     // SaiRedis refuses these before queueing
+    }
+}
+
+bool decodeAttr(FrameReader& reader, sai_attribute_t& attr) {
+    uint8_t raw_kind = 0;
+    if (!reader.get(attr.id) || !reader.get(raw_kind)) {
+        return false;
+    }
+    std::memset(&attr.value, 0, sizeof(attr.value));
+    sai_attribute_value_t& value = attr.value;
+    switch (static_cast<AttrValueKind>(raw_kind)) {
+        case AttrValueKind::BOOL: {
+            uint8_t flag = 0;
+            if (!reader.get(flag)) {
+                return false;
+            }
+            value.booldata = (flag != 0);
+            return true;
+        }
+        case AttrValueKind::U8:     return reader.get(value.u8);
+        case AttrValueKind::S8:     return reader.get(value.s8);
+        case AttrValueKind::U16:    return reader.get(value.u16);
+        case AttrValueKind::S16:    return reader.get(value.s16);
+        case AttrValueKind::U32:    return reader.get(value.u32);
+        case AttrValueKind::S32:    return reader.get(value.s32);
+        case AttrValueKind::U64:    return reader.get(value.u64);
+        case AttrValueKind::S64:    return reader.get(value.s64);
+        case AttrValueKind::OID:    return reader.get(value.oid);
+        case AttrValueKind::IPADDR: return reader.getIpAddr(value.ipaddr.addr_family, value.ipaddr.addr);
+        case AttrValueKind::UNSUPPORTED: return false;
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+AttrValueKind attrValueKind(sai_object_type_t object_type, int32_t attr_id) {
+    for (const auto& entry : ATTR_KINDS) {
+        if (entry.object_type == object_type && entry.attr_id == attr_id) {
+            return entry.kind;
+        }
+    }
+    return AttrValueKind::UNSUPPORTED;
+}
+
+bool isVirtualOid(sai_object_id_t oid) {
+    return (oid & VID_MARKER) != 0;
+}
+
+sai_object_type_t virtualOidType(sai_object_id_t vid) {
+    return static_cast<sai_object_type_t>((vid >> VID_TYPE_SHIFT) & VID_TYPE_MASK);
+}
+
+sai_object_id_t makeVirtualOid(sai_object_type_t object_type, uint64_t index) {
+    return VID_MARKER | ((static_cast<sai_object_id_t>(object_type) & VID_TYPE_MASK) << VID_TYPE_SHIFT) |
+           (index & VID_INDEX_MASK);
+}
+
+sai_object_id_t switchVirtualOid() {
+    return makeVirtualOid(SAI_OBJECT_TYPE_SWITCH, 0);
+}
+
+void AsicBatchCodec::encode(const AsicBatch& batch, std::string& out) {
+    out.clear();
+    put(out, BATCH_MAGIC);
+    put(out, batch.sequence);
+    put(out, static_cast<uint16_t>(batch.reply_key.size()));
+    out.append(batch.reply_key);
+    put(out, static_cast<uint32_t>(batch.ops.size()));
+    for (const auto& op : batch.ops) {
+        put<uint8_t>(out, static_cast<uint8_t>(op.op));
+        put<uint8_t>(out, 0);
+        put(out, static_cast<uint16_t>(op.object_type));
+        if (op.object_type == SAI_OBJECT_TYPE_ROUTE_ENTRY) {
+            const sai_ip_prefix_t& prefix = op.route_entry.destination;
+            put(out, op.route_entry.vr_id);
+            putIpAddr(out, prefix.addr_family, prefix.addr);
+            putIpAddr(out, prefix.addr_family, prefix.mask);
+        } else {
+            put(out, op.object_id);
+        }
+        put(out, static_cast<uint16_t>(op.attrs.size()));
+        for (const auto& attr : op.attrs) {
+            encodeAttr(op.object_type, attr, out);
+        }
+    }
+}
+
+bool AsicBatchCodec::decode(const std::string& frame, AsicBatch& batch) {
+    FrameReader reader(frame);
+    uint32_t magic = 0;
+    uint16_t key_length = 0;
+    uint32_t op_count = 0;
+    if (!reader.get(magic) || magic != BATCH_MAGIC || !reader.get(batch.sequence) ||
+        !reader.get(key_length) || !reader.getString(batch.reply_key, key_length) || !reader.get(op_count)) {
+        return false;
+    }
+    // Every op takes at least 14 bytes, which bounds the reserve against a corrupt count
+    if (op_count > frame.size() / 14) {
+        return false;
+    }
+    batch.ops.resize(op_count);
+    for (auto& op : batch.ops) {
+        uint8_t raw_op = 0;
+        uint8_t reserved = 0;
+        uint16_t object_type = 0;
+        uint16_t attr_count = 0;
+        if (!reader.get(raw_op) || !reader.get(reserved) || !reader.get(object_type)) {
+            return false;
+        }
+        if (raw_op < static_cast<uint8_t>(AsicOp::CREATE) || raw_op > static_cast<uint8_t>(AsicOp::SET)) {
+            return false;
+        }
+        op.op = static_cast<AsicOp>(raw_op);
+        op.object_type = static_cast<sai_object_type_t>(object_type);
+        op.object_id = SAI_NULL_OBJECT_ID;
+        if (op.object_type == SAI_OBJECT_TYPE_ROUTE_ENTRY) {
+            sai_ip_prefix_t& prefix = op.route_entry.destination;
+            sai_ip_addr_family_t mask_family;
+            op.route_entry.switch_id = SAI_NULL_OBJECT_ID;
+            if (!reader.get(op.route_entry.vr_id) || !reader.getIpAddr(prefix.addr_family, prefix.addr) ||
+                !reader.getIpAddr(mask_family, prefix.mask) || mask_family != prefix.addr_family) {
+                return false;
+            }
+        } else if (!reader.get(op.object_id)) {
+            return false;
+        }
+        if (!reader.get(attr_count)) {
+            return false;
+        }
+        op.attrs.resize(attr_count);
+        for (auto& attr : op.attrs) {
+            if (!decodeAttr(reader, attr)) {
+                return false;
+            }
+        }
+    }
+    return reader.atEnd();
+}
+
+void AsicBatchCodec::encodeReply(const AsicBatchReply& reply, std::string& out) {
+    out.clear();
+    put(out, REPLY_MAGIC);
+    put(out, reply.sequence);
+    put(out, static_cast<uint32_t>(reply.statuses.size()));
+    for (sai_status_t status : reply.statuses) {
+        put(out, static_cast<int32_t>(status));
+    }
+}
+
+bool AsicBatchCodec::decodeReply(const std::string& frame, AsicBatchReply& reply) {
+    FrameReader reader(frame);
+    uint32_t magic = 0;
+    uint32_t count = 0;
+    if (!reader.get(magic) || magic != REPLY_MAGIC || !reader.get(reply.sequence) || !reader.get(count) ||
+        count > frame.size() / sizeof(int32_t)) {
+        return false;
+    }
+    reply.statuses.resize(count);
+    for (auto& status : reply.statuses) {
+        int32_t value = 0;
+        if (!reader.get(value)) {
+            return false;
+        }
+        status = static_cast<sai_status_t>(value);
+    }
+    return reader.atEnd();
+}
+
+SaiRedis::SaiRedis(const common::RedisConfig& config)
+    : config_(config), next_sequence_(1), next_vid_index_(0), vid_block_end_(0) {
+    // Distinct per producer, so concurrent producers never read each other's replies
+    std::random_device rd;
+    reply_prefix_ = "ASIC_STATE_REPLY:" + std::to_string(getpid()) + ":" + std::to_string(rd()) + ":";
+}
+
+SaiRedis::~SaiRedis() = default;
+
+bool SaiRedis::sendable(sai_object_type_t object_type, uint32_t attr_count, const sai_attribute_t* attr_list) {
+    for (uint32_t i = 0; i < attr_count; ++i) {
+        if (attrValueKind(object_type, attr_list[i].id) == AttrValueKind::UNSUPPORTED) {
+            SONIC_LOG_ERROR("SYNCD", "Attribute " << attr_list[i].id << " of object type " << object_type
+                            << " cannot be sent to syncd");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SaiRedis::reserveVid(uint64_t& index) {
+    if (next_vid_index_ == vid_block_end_) {
+        if (!ensureConnected()) {
+            SONIC_LOG_ERROR("SYNCD", "Cannot reach ASIC_DB to reserve VIDs");
+            return false;
+        }
+        common::RedisReply reply;
+        if (!connection_->execute({"INCRBY", VID_COUNTER_KEY, std::to_string(VID_BLOCK_SIZE)}, reply) ||
+            reply.isError() || reply.integer < static_cast<long long>(VID_BLOCK_SIZE)) {
+            SONIC_LOG_ERROR("SYNCD", "Failed to reserve VIDs from " << VID_COUNTER_KEY << ": " << reply.str);
+            return false;
+        }
+        // The counter holds the last index handed out; index 0 is the switch VID
+        vid_block_end_ = static_cast<uint64_t>(reply.integer) + 1;
+        next_vid_index_ = vid_block_end_ - VID_BLOCK_SIZE;
+    }
+    index = next_vid_index_++;
+    return true;
+}
+
+sai_object_id_t SaiRedis::create(sai_object_type_t object_type, uint32_t attr_count,
+                                 const sai_attribute_t* attr_list) {
+    uint64_t index = 0;
+    if (!sendable(object_type, attr_count, attr_list) || !reserveVid(index)) {
+        return SAI_NULL_OBJECT_ID;
+    }
+    AsicOperation op;
+    op.op = AsicOp::CREATE;
+    op.object_type = object_type;
+    op.object_id = makeVirtualOid(object_type, index);
+    op.attrs.assign(attr_list, attr_list + attr_count);
+    batch_.ops.push_back(std::move(op));
+    return batch_.ops.back().object_id;
+}
+
+void SaiRedis::remove(sai_object_id_t vid) {
+    AsicOperation op;
+    op.op = AsicOp::REMOVE;
+    op.object_type = virtualOidType(vid);
+    op.object_id = vid;
+    batch_.ops.push_back(std::move(op));
+}
+
+bool SaiRedis::set(sai_object_id_t vid, const sai_attribute_t& attr) {
+    if (!sendable(virtualOidType(vid), 1, &attr)) {
+        return false;
+    }
+    AsicOperation op;
+    op.op = AsicOp::SET;
+    op.object_type = virtualOidType(vid);
+    op.object_id = vid;
+    op.attrs.push_back(attr);
+    batch_.ops.push_back(std::move(op));
+    return true;
+}
+
+bool SaiRedis::createRoute(const sai_route_entry_t& entry, uint32_t attr_count, const sai_attribute_t* attr_list) {
+    if (!sendable(SAI_OBJECT_TYPE_ROUTE_ENTRY, attr_count, attr_list)) {
+        return false;
+    }
+    AsicOperation op;
+    op.op = AsicOp::CREATE;
+    op.object_type = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+    op.route_entry = entry;
+    op.attrs.assign(attr_list, attr_list + attr_count);
+    batch_.ops.push_back(std::move(op));
+    return true;
+}
+
+void SaiRedis::removeRoute(const sai_route_entry_t& entry) {
+    AsicOperation op;
+    op.op = AsicOp::REMOVE;
+    op.object_type = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+    op.route_entry = entry;
+    batch_.ops.push_back(std::move(op));
+}
+
+bool SaiRedis::setRoute(const sai_route_entry_t& entry, const sai_attribute_t& attr) {
+    if (!sendable(SAI_OBJECT_TYPE_ROUTE_ENTRY, 1, &attr)) {
+        return false;
+    }
+    AsicOperation op;
+    op.op = AsicOp::SET;
+    op.object_type = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+    op.route_entry = entry;
+    op.attrs.push_back(attr);
+    batch_.ops.push_back(std::move(op));
+    return true;
+}
+
+bool SaiRedis::ensureConnected() {
+    if (!connection_) {
+        connection_.reset(new common::RedisConnection(config_, ASIC_DB));
+    }
+    return connection_->isConnected() || connection_->connect();
+}
+
+bool SaiRedis::flush(std::vector<sai_status_t>* statuses, int timeout_s) {
+    if (batch_.ops.empty()) {
+        if (statuses) {
+            statuses->clear();
+        }
+        return true;
+    }
+    // Frames are binary, so there is no redis-cli fallback here
+    if (!ensureConnected()) {
+        SONIC_LOG_ERROR("SYNCD", "Cannot reach ASIC_DB; " << batch_.ops.size() << " operations not sent");
+        return false;
+    }
+
+    batch_.sequence = next_sequence_++;
+    batch_.reply_key = statuses ? reply_prefix_ + std::to_string(batch_.sequence) : std::string();
+    AsicBatchCodec::encode(batch_, frame_);
+    size_t op_count = batch_.ops.size();
+    batch_.ops.clear();
+
+    common::RedisReply reply;
+    if (!connection_->execute({"LPUSH", ASIC_STATE_QUEUE, frame_}, reply) || reply.isError()) {
+        SONIC_LOG_ERROR("SYNCD", "Failed to queue batch " << batch_.sequence << ": " << reply.str);
+        return false;
+    }
+    if (!statuses) {
+        return true;
+    }
+
+    // One-second BRPOPs stay inside the connection's I/O timeout
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout_s);
+    for (;;) {
+        if (!connection_->execute({"BRPOP", batch_.reply_key, "1"}, reply)) {
+            SONIC_LOG_ERROR("SYNCD", "Lost ASIC_DB connection waiting for batch " << batch_.sequence);
+            return false;
+        }
+        if (!reply.isNil() && reply.elements.size() == 2) {
+            break;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            SONIC_LOG_WARN("SYNCD", "No reply from syncd for batch " << batch_.sequence);
+            return false;
+        }
+    }
+    AsicBatchReply batch_reply;
+    if (!AsicBatchCodec::decodeReply(reply.elements[1].str, batch_reply) ||
+        batch_reply.sequence != batch_.sequence || batch_reply.statuses.size() != op_count) {
+        SONIC_LOG_ERROR("SYNCD", "Malformed reply for batch " << batch_.sequence);
+        return false;
+    }
+    statuses->swap(batch_reply.statuses);
+    return true;
+}
+
+} // namespace syncd
+} // namespace sonic
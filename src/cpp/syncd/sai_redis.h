@@ -0,0 +1,196 @@
+/**
+ * @file sai_redis.h
+ * @brief SONiC Syncd ASIC_DB Wire Format and Producer Header
+ *
+ * Orchestration code above syncd does not call SAI itself: it queues
+ * create/remove/set operations on ASIC_DB and syncd applies them. Operations
+ * travel as binary batch frames LPUSHed to ASIC_STATE_QUEUE, so a batch of
+ * thousands of routes is one Redis round trip and no attribute is ever
+ * formatted as or parsed from text. All integers are in host byte order;
+ * producer and syncd share the host.
+ *
+ *   batch   u32 magic "SDB1", u64 sequence, u16 reply key length, reply key, u32 op count, ops
+ *   op      u8 op, u8 reserved, u16 object type, key, u16 attr count, attrs
+ *   key     u64 VID, or for ROUTE_ENTRY: u64 VR VID, prefix
+ *   attr    i32 id, u8 value kind, value (1/2/4/8 bytes or IP address)
+ *   reply   u32 magic "SDR1", u64 sequence, u32 count, i32 status per op
+ *
+ * Objects are named by virtual OIDs (VIDs); syncd maps them to the real OIDs
+ * (RIDs) the SAI returns. VID indexes come from one counter in ASIC_DB
+ * (VIDCOUNTER), which producers reserve in blocks, so VIDs stay unique across
+ * concurrent producers and producer restarts. OID
+ * values without the VID marker are passed through unchanged, so objects
+ * created outside syncd (bridge ports from the port manager) can be
+ * referenced by their RID.
+ *
+ * Only attributes listed in the value-kind table can be sent. Other
+ * sai_attribute_value_t members (object and integer lists, ACL fields) hold
+ * pointers into the producer's memory, so they are refused, never copied.
+ */
+
+#ifndef SONIC_SYNCD_SAI_REDIS_H
+#define SONIC_SYNCD_SAI_REDIS_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include "../common/redis_client.h"
+
+extern "C" {
+#include "sai.h"
+#include "saivlan.h"
+#include "sairoute.h"
+#include "sainexthop.h"
+#include "sainexthopgroup.h"
+}
+
+namespace sonic {
+namespace syncd {
+
+constexpr int ASIC_DB = 1;
+extern const char* const ASIC_STATE_QUEUE;
+extern const char* const VID_COUNTER_KEY;     ///< ASIC_DB counter VID indexes are reserved from
+
+/**
+ * @brief Operation carried in a batch frame
+ */
+enum class AsicOp : uint8_t {
+    CREATE = 1,
+    REMOVE = 2,
+    SET = 3
+};
+
+/**
+ * @brief Which member of sai_attribute_value_t an attribute uses
+ *
+ * OID values are the ones syncd translates from VID to RID.
+ */
+enum class AttrValueKind : uint8_t {
+    BOOL = 0,
+    U8,
+    S8,
+    U16,
+    S16,
+    U32,
+    S32,
+    U64,
+    S64,
+    OID,
+    IPADDR,
+    UNSUPPORTED     ///< Attribute missing from the table; refused by the producer and the decoder
+};
+
+/**
+ * @brief Look up the value kind of an attribute of an object type
+ */
+AttrValueKind attrValueKind(sai_object_type_t object_type, int32_t attr_id);
+
+/**
+ * @brief One ASIC_DB operation; OIDs in key and attributes are VIDs
+ */
+struct AsicOperation {
+    AsicOp op = AsicOp::CREATE;
+    sai_object_type_t object_type = SAI_OBJECT_TYPE_NULL;
+    sai_object_id_t object_id = SAI_NULL_OBJECT_ID;     ///< OID objects
+    sai_route_entry_t route_entry{};                    ///< ROUTE_ENTRY; switch_id is ignored
+    std::vector<sai_attribute_t> attrs;                 ///< SET carries exactly one
+};
+
+struct AsicBatch {
+    uint64_t sequence = 0;
+    std::string reply_key;      ///< Where syncd pushes the reply; empty for fire-and-forget
+    std::vector<AsicOperation> ops;
+};
+
+struct AsicBatchReply {
+    uint64_t sequence = 0;
+    std::vector<sai_status_t> statuses;     ///< One per op, in batch order
+};
+
+/**
+ * @brief Binary codec for batch and reply frames
+ */
+class AsicBatchCodec {
+public:
+    /**
+     * @param out Overwritten; its capacity is reused across calls
+     */
+    static void encode(const AsicBatch& batch, std::string& out);
+    static bool decode(const std::string& frame, AsicBatch& batch);
+
+    static void encodeReply(const AsicBatchReply& reply, std::string& out);
+    static bool decodeReply(const std::string& frame, AsicBatchReply& reply);
+};
+
+/**
+ * @brief VID helpers; a VID is (marker | object type << 48 | index)
+ */
+bool isVirtualOid(sai_object_id_t oid);
+sai_object_type_t virtualOidType(sai_object_id_t vid);
+sai_object_id_t makeVirtualOid(sai_object_type_t object_type, uint64_t index);
+
+/**
+ * @brief VID syncd binds to the switch it initialized
+ */
+sai_object_id_t switchVirtualOid();
+
+/**
+ * @brief Producer side: queues operations and ships them to syncd as one frame (not thread-safe)
+ */
+class SaiRedis {
+public:
+    explicit SaiRedis(const common::RedisConfig& config);
+    ~SaiRedis();
+
+    SaiRedis(const SaiRedis&) = delete;
+    SaiRedis& operator=(const SaiRedis&) = delete;
+
+    /**
+     * @brief Queue an OID object create
+     * @return The VID naming the object in later operations; SAI_NULL_OBJECT_ID when an
+     *         attribute cannot be sent or no VID can be reserved from ASIC_DB
+     */
+    sai_object_id_t create(sai_object_type_t object_type, uint32_t attr_count, const sai_attribute_t* attr_list);
+    void remove(sai_object_id_t vid);
+
+    /**
+     * @return false, queueing nothing, when an attribute cannot be sent
+     */
+    bool set(sai_object_id_t vid, const sai_attribute_t& attr);
+    bool createRoute(const sai_route_entry_t& entry, uint32_t attr_count, const sai_attribute_t* attr_list);
+    void removeRoute(const sai_route_entry_t& entry);
+    bool setRoute(const sai_route_entry_t& entry, const sai_attribute_t& attr);
+
+    size_t pending() const { return batch_.ops.size(); }
+
+    /**
+     * @brief Push the queued operations as one batch
+     * @param statuses When not null, wait for syncd's reply and fill one status per operation
+     * @param timeout_s How long to wait for the reply
+     * @return false if the batch was not delivered or no reply arrived in time; when ASIC_DB
+     *         cannot be reached at all the operations stay queued for the next flush
+     */
+    bool flush(std::vector<sai_status_t>* statuses = nullptr, int timeout_s = 5);
+
+private:
+    static constexpr uint64_t VID_BLOCK_SIZE = 1024;
+
+    bool ensureConnected();
+    bool reserveVid(uint64_t& index);
+    static bool sendable(sai_object_type_t object_type, uint32_t attr_count, const sai_attribute_t* attr_list);
+
+    common::RedisConfig config_;
+    std::unique_ptr<common::RedisConnection> connection_;
+    AsicBatch batch_;
+    std::string frame_;
+    std::string reply_prefix_;
+    uint64_t next_sequence_;
+    uint64_t next_vid_index_;       ///< Next unused index of the reserved block
+    uint64_t vid_block_end_;        ///< One past the reserved block
+};
+
+} // namespace syncd
+} // namespace sonic
+
+#endif // SONIC_SYNCD_SAI_REDIS_H
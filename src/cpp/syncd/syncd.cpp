@@ -0,0 +1,496 @@
+/**
+ * @file syncd.cpp
+ * @brief SONiC Syncd ASIC_DB Consumer Implementation
+ */
+
+#include "syncd.h"
+#include "../sai/sai_adapter.h"
+#include "../common/logger.h"
+#include "../common/metrics.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+
+namespace sonic {
+namespace syncd {
+
+namespace {
+
+bool bulkUnsupported(sai_status_t status) {
+    return status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED;
+}
+
+} // anonymous namespace
+
+Syncd::Syncd(const common::RedisConfig& config)
+    : config_(config), rpop_count_supported_(true), initialized_(false), switch_id_(SAI_NULL_OBJECT_ID),
+      route_api_(nullptr), running_(false) {
+    config_.io_timeout_ms = std::max(config_.io_timeout_ms, (BLOCK_TIMEOUT_SECONDS + 1) * 1000);
+}
+
+Syncd::~Syncd() {
+    stop();
+}
+
+bool Syncd::initialize() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (initialized_) {
+        return true;
+    }
+
+    auto* sai_adapter = sai::SAIAdapter::getInstance();
+    if (!sai_adapter || !sai_adapter->initialize()) {
+        SONIC_LOG_ERROR("SYNCD", "Failed to initialize SAI adapter");
+        return false;
+    }
+    switch_id_ = sai_adapter->getSwitchId();
+    route_api_ = sai_adapter->getRouteAPI();
+
+    sai_vlan_api_t* vlan_api = sai_adapter->getVLANAPI();
+    if (vlan_api) {
+        vlan_api_.create = vlan_api->create_vlan;
+        vlan_api_.remove = vlan_api->remove_vlan;
+        vlan_api_.set = vlan_api->set_vlan_attribute;
+        vlan_member_api_.create = vlan_api->create_vlan_member;
+        vlan_member_api_.remove = vlan_api->remove_vlan_member;
+        vlan_member_api_.set = vlan_api->set_vlan_member_attribute;
+        vlan_member_api_.bulk_create = vlan_api->create_vlan_members;
+        vlan_member_api_.bulk_remove = vlan_api->remove_vlan_members;
+    }
+
+    // The adapter has no next-hop accessors; query them the way the next-hop registry does
+    sai_next_hop_api_t* next_hop_api = nullptr;
+    if (sai_api_query(SAI_API_NEXT_HOP, (void**)&next_hop_api) == SAI_STATUS_SUCCESS && next_hop_api) {
+        next_hop_api_.create = next_hop_api->create_next_hop;
+        next_hop_api_.remove = next_hop_api->remove_next_hop;
+        next_hop_api_.set = next_hop_api->set_next_hop_attribute;
+    } else {
+        SONIC_LOG_WARN("SYNCD", "Next Hop API unavailable; NEXT_HOP operations will fail");
+    }
+    sai_next_hop_group_api_t* group_api = nullptr;
+    if (sai_api_query(SAI_API_NEXT_HOP_GROUP, (void**)&group_api) == SAI_STATUS_SUCCESS && group_api) {
+        next_hop_group_api_.create = group_api->create_next_hop_group;
+        next_hop_group_api_.remove = group_api->remove_next_hop_group;
+        next_hop_group_api_.set = group_api->set_next_hop_group_attribute;
+        next_hop_group_member_api_.create = group_api->create_next_hop_group_member;
+        next_hop_group_member_api_.remove = group_api->remove_next_hop_group_member;
+        next_hop_group_member_api_.set = group_api->set_next_hop_group_member_attribute;
+        next_hop_group_member_api_.bulk_create = group_api->create_next_hop_group_members;
+        next_hop_group_member_api_.bulk_remove = group_api->remove_next_hop_group_members;
+    } else {
+        SONIC_LOG_WARN("SYNCD", "Next Hop Group API unavailable; NEXT_HOP_GROUP operations will fail");
+    }
+
+    vid_to_rid_[switchVirtualOid()] = switch_id_;
+    initialized_ = true;
+    SONIC_LOG_INFO("SYNCD", "Syncd initialized on switch 0x" << std::hex << switch_id_ << std::dec);
+    return true;
+}
+
+bool Syncd::start() {
+    if (running_) {
+        return true;
+    }
+    if (!initialize()) {
+        return false;
+    }
+    connection_.reset(new common::RedisConnection(config_, ASIC_DB));
+    running_ = true;
+    thread_ = std::thread(&Syncd::consumeLoop, this);
+    SONIC_LOG_INFO("SYNCD", "Consuming " << ASIC_STATE_QUEUE);
+    return true;
+}
+
+void Syncd::stop() {
+    if (running_) {
+        running_ = false;
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        connection_.reset();
+        SONIC_LOG_INFO("SYNCD", "Syncd stopped");
+    }
+}
+
+void Syncd::consumeLoop() {
+    std::vector<std::string> frames;
+    std::vector<std::vector<std::string>> replies;
+    std::vector<common::RedisReply> results;
+    std::string reply_key;
+    std::string reply_frame;
+    while (running_) {
+        try {
+            frames.clear();
+            popFrames(frames);
+
+            replies.clear();
+            for (const auto& frame : frames) {
+                if (!processFrame(frame, reply_key, reply_frame)) {
+                    SONIC_LOG_WARN("SYNCD", "Dropped malformed ASIC_DB frame of " << frame.size() << " bytes");
+                    continue;
+                }
+                if (!reply_key.empty()) {
+                    replies.push_back({"LPUSH", reply_key, reply_frame});
+                    replies.push_back({"EXPIRE", reply_key, std::to_string(REPLY_TTL_SECONDS)});
+                }
+            }
+            if (!replies.empty() && !connection_->executePipeline(replies, results)) {
+                SONIC_LOG_WARN("SYNCD", "Failed to send " << replies.size() / 2 << " batch replies");
+            }
+
+        } catch (const std::exception& e) {
+            SONIC_LOG_ERROR("SYNCD", "Error in ASIC_DB consumer: " << e.what());
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+    }
+}
+
+void Syncd::popFrames(std::vector<std::string>& frames) {
+    // Frames are binary, so unlike the command processor there is no redis-cli fallback
+    if (!connection_->isConnected() && !connection_->connect()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        return;
+    }
+
+    common::RedisReply reply;
+    if (!connection_->execute({"BRPOP", ASIC_STATE_QUEUE, std::to_string(BLOCK_TIMEOUT_SECONDS)}, reply)) {
+        SONIC_LOG_WARN("SYNCD", "Lost ASIC_DB connection, reconnecting");
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        return;
+    }
+    if (reply.isNil() || reply.elements.size() != 2) {
+        return; // Timed out
+    }
+    frames.push_back(std::move(reply.elements[1].str));
+
+    // LPUSH + RPOP keeps FIFO order; RPOP <count> needs Redis 6.2
+    const std::string remaining = std::to_string(MAX_FRAMES_PER_POLL - 1);
+    if (rpop_count_supported_) {
+        if (!connection_->execute({"RPOP", ASIC_STATE_QUEUE, remaining}, reply)) {
+            return;
+        }
+        if (!reply.isError()) {
+            for (auto& element : reply.elements) {
+                frames.push_back(std::move(element.str));
+            }
+            return;
+        }
+        rpop_count_supported_ = false;
+    }
+
+    std::vector<std::vector<std::string>> pops(MAX_FRAMES_PER_POLL - 1, {"RPOP", ASIC_STATE_QUEUE});
+    std::vector<common::RedisReply> replies;
+    if (connection_->executePipeline(pops, replies)) {
+        for (auto& popped : replies) {
+            if (popped.isNil()) {
+                break;
+            }
+            frames.push_back(std::move(popped.str));
+        }
+    }
+}
+
+bool Syncd::processFrame(const std::string& frame, std::string& reply_key, std::string& reply_frame) {
+    AsicBatch batch;
+    reply_key.clear();
+    if (!AsicBatchCodec::decode(frame, batch)) {
+        SONIC_COUNTER_INC("sonic_syncd_malformed_frames_total", "ASIC_DB frames that failed to decode");
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.malformed_frames++;
+        return false;
+    }
+
+    AsicBatchReply reply;
+    reply.sequence = batch.sequence;
+    applyBatch(batch, reply.statuses);
+    if (!batch.reply_key.empty()) {
+        reply_key = batch.reply_key;
+        AsicBatchCodec::encodeReply(reply, reply_frame);
+    }
+    return true;
+}
+
+void Syncd::applyBatch(const AsicBatch& batch, std::vector<sai_status_t>& statuses) {
+    SONIC_SCOPED_TIMER("sonic_syncd_batch_apply_seconds", "Time to apply one ASIC_DB batch through SAI");
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::vector<AsicOperation>& ops = batch.ops;
+    statuses.assign(ops.size(), initialized_ ? SAI_STATUS_NOT_EXECUTED : SAI_STATUS_UNINITIALIZED);
+    if (!initialized_) {
+        stats_.failed_operations += ops.size();
+        return;
+    }
+
+    size_t begin = 0;
+    while (begin < ops.size()) {
+        size_t end = begin + 1;
+        while (end < ops.size() && end - begin < BULK_CHUNK_SIZE && ops[end].op == ops[begin].op &&
+               ops[end].object_type == ops[begin].object_type) {
+            ++end;
+        }
+        applyRun(ops, begin, end, statuses);
+        begin = end;
+    }
+
+    stats_.batches++;
+    stats_.operations += ops.size();
+    for (sai_status_t status : statuses) {
+        if (status != SAI_STATUS_SUCCESS) {
+            stats_.failed_operations++;
+        }
+    }
+    SONIC_LOG_DEBUG("SYNCD", "Applied batch " << batch.sequence << " with " << ops.size() << " operations");
+}
+
+const Syncd::ObjectApi* Syncd::objectApi(sai_object_type_t object_type) const {
+    switch (object_type) {
+        case SAI_OBJECT_TYPE_VLAN:                  return &vlan_api_;
+        case SAI_OBJECT_TYPE_VLAN_MEMBER:           return &vlan_member_api_;
+        case SAI_OBJECT_TYPE_NEXT_HOP:              return &next_hop_api_;
+        case SAI_OBJECT_TYPE_NEXT_HOP_GROUP:        return &next_hop_group_api_;
+        case SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER: return &next_hop_group_member_api_;
+        default:                                    return nullptr;
+    }
+}
+
+bool Syncd::translateOid(sai_object_id_t vid, sai_object_id_t& rid) const {
+    if (!isVirtualOid(vid)) {
+        rid = vid;      // Null, or the RID of an object syncd did not create
+        return true;
+    }
+    auto it = vid_to_rid_.find(vid);
+    if (it == vid_to_rid_.end()) {
+        return false;
+    }
+    rid = it->second;
+    return true;
+}
+
+bool Syncd::translateAttrs(const AsicOperation& op, size_t offset) {
+    attrs_.resize(offset + op.attrs.size());
+    for (size_t i = 0; i < op.attrs.size(); ++i) {
+        sai_attribute_t& attr = attrs_[offset + i];
+        attr = op.attrs[i];
+        if (attrValueKind(op.object_type, attr.id) == AttrValueKind::OID &&
+            !translateOid(attr.value.oid, attr.value.oid)) {
+            attrs_.resize(offset);
+            return false;
+        }
+    }
+    return true;
+}
+
+void Syncd::applyRun(const std::vector<AsicOperation>& ops, size_t begin, size_t end,
+                     std::vector<sai_status_t>& statuses) {
+    run_ops_.clear();
+    attrs_.clear();
+    attr_offsets_.clear();
+    attr_counts_.clear();
+    oids_.clear();
+    routes_.clear();
+
+    bool is_route = (ops[begin].object_type == SAI_OBJECT_TYPE_ROUTE_ENTRY);
+    for (size_t i = begin; i < end; ++i) {
+        const AsicOperation& op = ops[i];
+        if (op.op == AsicOp::SET && op.attrs.size() != 1) {
+            statuses[i] = SAI_STATUS_INVALID_PARAMETER;
+            continue;
+        }
+
+        sai_object_id_t rid = SAI_NULL_OBJECT_ID;
+        sai_route_entry_t entry;
+        if (is_route) {
+            entry = op.route_entry;
+            entry.switch_id = switch_id_;
+            if (!translateOid(op.route_entry.vr_id, entry.vr_id)) {
+                statuses[i] = SAI_STATUS_INVALID_PARAMETER;
+                continue;
+            }
+        } else if (op.op == AsicOp::CREATE) {
+            if (!isVirtualOid(op.object_id) || virtualOidType(op.object_id) != op.object_type) {
+                statuses[i] = SAI_STATUS_INVALID_PARAMETER;
+                continue;
+            }
+            if (vid_to_rid_.count(op.object_id)) {
+                statuses[i] = SAI_STATUS_ITEM_ALREADY_EXISTS;
+                continue;
+            }
+        } else {
+            auto it = vid_to_rid_.find(op.object_id);
+            if (it == vid_to_rid_.end()) {
+                statuses[i] = SAI_STATUS_ITEM_NOT_FOUND;
+                continue;
+            }
+            rid = it->second;
+        }
+
+        size_t offset = attrs_.size();
+        if (!translateAttrs(op, offset)) {
+            statuses[i] = SAI_STATUS_INVALID_PARAMETER;
+            continue;
+        }
+        run_ops_.push_back(i);
+        attr_offsets_.push_back(static_cast<uint32_t>(offset));
+        attr_counts_.push_back(static_cast<uint32_t>(op.attrs.size()));
+        oids_.push_back(rid);
+        if (is_route) {
+            routes_.push_back(entry);
+        }
+    }
+    if (run_ops_.empty()) {
+        return;
+    }
+
+    // attrs_ is complete, so pointers into it are stable now
+    attr_lists_.resize(run_ops_.size());
+    for (size_t j = 0; j < run_ops_.size(); ++j) {
+        attr_lists_[j] = attrs_.data() + attr_offsets_[j];
+    }
+    run_statuses_.assign(run_ops_.size(), SAI_STATUS_NOT_EXECUTED);
+
+    if (is_route) {
+        applyRouteRun(ops, statuses);
+    } else {
+        applyObjectRun(ops, statuses);
+    }
+}
+
+void Syncd::applyObjectRun(const std::vector<AsicOperation>& ops, std::vector<sai_status_t>& statuses) {
+    const AsicOperation& first = ops[run_ops_.front()];
+    const ObjectApi* api = objectApi(first.object_type);
+    uint32_t count = static_cast<uint32_t>(run_ops_.size());
+
+    bool supported = false;
+    if (api) {
+        switch (first.op) {
+            case AsicOp::CREATE: supported = api->create || api->bulk_create; break;
+            case AsicOp::REMOVE: supported = api->remove || api->bulk_remove; break;
+            case AsicOp::SET:    supported = api->set != nullptr; break;
+        }
+    }
+    if (!supported) {
+        for (size_t index : run_ops_) {
+            statuses[index] = SAI_STATUS_NOT_IMPLEMENTED;
+        }
+        return;
+    }
+
+    if (first.op == AsicOp::SET) {
+        // Each SET carries exactly one attribute; an object that rejects it does not stop the run
+        for (uint32_t j = 0; j < count; ++j) {
+            statuses[run_ops_[j]] = api->set(oids_[j], attr_lists_[j]);
+        }
+        stats_.sai_calls += count;
+        return;
+    }
+
+    if (first.op == AsicOp::CREATE) {
+        bool use_bulk = api->bulk_create && (count > 1 || !api->create);
+        if (use_bulk) {
+            sai_status_t status = api->bulk_create(switch_id_, count, attr_counts_.data(), attr_lists_.data(),
+                                                   SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, oids_.data(),
+                                                   run_statuses_.data());
+            use_bulk = !bulkUnsupported(status) || !api->create;
+            stats_.sai_calls += use_bulk ? 1 : 0;
+        }
+        if (!use_bulk) {
+            for (uint32_t j = 0; j < count; ++j) {
+                run_statuses_[j] = api->create(&oids_[j], switch_id_, attr_counts_[j], attr_lists_[j]);
+            }
+            stats_.sai_calls += count;
+        }
+        for (uint32_t j = 0; j < count; ++j) {
+            statuses[run_ops_[j]] = run_statuses_[j];
+            if (run_statuses_[j] == SAI_STATUS_SUCCESS) {
+                vid_to_rid_[ops[run_ops_[j]].object_id] = oids_[j];
+            }
+        }
+        return;
+    }
+
+    bool use_bulk = api->bulk_remove && (count > 1 || !api->remove);
+    if (use_bulk) {
+        sai_status_t status = api->bulk_remove(count, oids_.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                               run_statuses_.data());
+        use_bulk = !bulkUnsupported(status) || !api->remove;
+        stats_.sai_calls += use_bulk ? 1 : 0;
+    }
+    if (!use_bulk) {
+        for (uint32_t j = 0; j < count; ++j) {
+            run_statuses_[j] = api->remove(oids_[j]);
+        }
+        stats_.sai_calls += count;
+    }
+    for (uint32_t j = 0; j < count; ++j) {
+        statuses[run_ops_[j]] = run_statuses_[j];
+        if (run_statuses_[j] == SAI_STATUS_SUCCESS) {
+            vid_to_rid_.erase(ops[run_ops_[j]].object_id);
+        }
+    }
+}
+
+void Syncd::applyRouteRun(const std::vector<AsicOperation>& ops, std::vector<sai_status_t>& statuses) {
+    AsicOp kind = ops[run_ops_.front()].op;
+    uint32_t count = static_cast<uint32_t>(run_ops_.size());
+    if (!route_api_) {
+        for (size_t index : run_ops_) {
+            statuses[index] = SAI_STATUS_NOT_IMPLEMENTED;
+        }
+        return;
+    }
+
+    bool use_bulk = (kind == AsicOp::CREATE && route_api_->create_route_entries) ||
+                    (kind == AsicOp::REMOVE && route_api_->remove_route_entries) ||
+                    (kind == AsicOp::SET && route_api_->set_route_entries_attribute);
+    use_bulk = use_bulk && count > 1;
+    if (use_bulk) {
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        if (kind == AsicOp::CREATE) {
+            status = route_api_->create_route_entries(count, routes_.data(), attr_counts_.data(), attr_lists_.data(),
+                                                      SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, run_statuses_.data());
+        } else if (kind == AsicOp::REMOVE) {
+            status = route_api_->remove_route_entries(count, routes_.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                      run_statuses_.data());
+        } else {
+            // SET carries one attribute per route, so attrs_ is already the per-route list
+            status = route_api_->set_route_entries_attribute(count, routes_.data(), attrs_.data(),
+                                                             SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                             run_statuses_.data());
+        }
+        use_bulk = !bulkUnsupported(status);
+        stats_.sai_calls += use_bulk ? 1 : 0;
+    }
+    if (!use_bulk) {
+        for (uint32_t j = 0; j < count; ++j) {
+            if (kind == AsicOp::CREATE) {
+                run_statuses_[j] = route_api_->create_route_entry(&routes_[j], attr_counts_[j], attr_lists_[j]);
+            } else if (kind == AsicOp::REMOVE) {
+                run_statuses_[j] = route_api_->remove_route_entry(&routes_[j]);
+            } else {
+                run_statuses_[j] = route_api_->set_route_entry_attribute(&routes_[j], attr_lists_[j]);
+            }
+        }
+        stats_.sai_calls += count;
+    }
+    for (uint32_t j = 0; j < count; ++j) {
+        statuses[run_ops_[j]] = run_statuses_[j];
+    }
+}
+
+sai_object_id_t Syncd::translateVid(sai_object_id_t vid) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = vid_to_rid_.find(vid);
+    return it == vid_to_rid_.end() ? SAI_NULL_OBJECT_ID : it->second;
+}
+
+size_t Syncd::objectCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return vid_to_rid_.size();
+}
+
+Syncd::Stats Syncd::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+} // namespace syncd
+} // namespace sonic
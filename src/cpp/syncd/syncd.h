@@ -0,0 +1,144 @@
+/**
+ * @file syncd.h
+ * @brief SONiC Syncd ASIC_DB Consumer Header
+ *
+ * Pops batch frames (see sai_redis.h) from ASIC_STATE_QUEUE and applies them
+ * through the SAI adapter. Consecutive operations of the same kind on the
+ * same object type form a run; each run becomes one SAI bulk call where the
+ * API has one (VLAN members, routes, next-hop-group members) and per-object
+ * calls otherwise, so operation order within a batch is kept. SAI has no
+ * bulk set for OID objects, so their SETs go one call per object. Statuses
+ * go back to the producer as one binary reply per batch.
+ */
+
+#ifndef SONIC_SYNCD_SYNCD_H
+#define SONIC_SYNCD_SYNCD_H
+
+#include "sai_redis.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace sonic {
+namespace syncd {
+
+/**
+ * @brief ASIC_DB consumer: VID to RID translation plus batched SAI calls
+ */
+class Syncd {
+public:
+    struct Stats {
+        uint64_t batches = 0;
+        uint64_t operations = 0;
+        uint64_t failed_operations = 0;
+        uint64_t sai_calls = 0;             ///< Bulk calls count once
+        uint64_t malformed_frames = 0;
+    };
+
+    explicit Syncd(const common::RedisConfig& config);
+    ~Syncd();
+
+    Syncd(const Syncd&) = delete;
+    Syncd& operator=(const Syncd&) = delete;
+
+    /**
+     * @brief Initialize the SAI adapter, look up the APIs and bind the switch VID
+     */
+    bool initialize();
+
+    /**
+     * @brief Start consuming ASIC_STATE_QUEUE; initializes first if needed
+     */
+    bool start();
+    void stop();
+    bool isRunning() const { return running_; }
+
+    /**
+     * @brief Apply one batch
+     * @param statuses One per operation, in batch order
+     */
+    void applyBatch(const AsicBatch& batch, std::vector<sai_status_t>& statuses);
+
+    /**
+     * @brief Decode and apply one frame, encoding the reply when the batch asked for one
+     * @param reply_key Empty when no reply is wanted
+     * @return false if the frame is malformed
+     */
+    bool processFrame(const std::string& frame, std::string& reply_key, std::string& reply_frame);
+
+    /**
+     * @brief RID bound to a VID, SAI_NULL_OBJECT_ID if unknown
+     */
+    sai_object_id_t translateVid(sai_object_id_t vid) const;
+
+    size_t objectCount() const;
+    Stats stats() const;
+
+private:
+    static constexpr int BLOCK_TIMEOUT_SECONDS = 1;     ///< Bounds how long stop() waits
+    static constexpr size_t MAX_FRAMES_PER_POLL = 16;
+    static constexpr size_t BULK_CHUNK_SIZE = 1024;
+    static constexpr int REPLY_TTL_SECONDS = 30;
+
+    /**
+     * @brief Entry points for one OID object type; bulk ones may be null
+     */
+    struct ObjectApi {
+        sai_generic_create_fn create = nullptr;
+        sai_generic_remove_fn remove = nullptr;
+        sai_generic_set_fn set = nullptr;
+        sai_bulk_object_create_fn bulk_create = nullptr;
+        sai_bulk_object_remove_fn bulk_remove = nullptr;
+    };
+
+    void consumeLoop();
+    void popFrames(std::vector<std::string>& frames);
+
+    const ObjectApi* objectApi(sai_object_type_t object_type) const;
+    bool translateOid(sai_object_id_t vid, sai_object_id_t& rid) const;
+    bool translateAttrs(const AsicOperation& op, size_t offset);
+
+    void applyRun(const std::vector<AsicOperation>& ops, size_t begin, size_t end,
+                  std::vector<sai_status_t>& statuses);
+    void applyObjectRun(const std::vector<AsicOperation>& ops, std::vector<sai_status_t>& statuses);
+    void applyRouteRun(const std::vector<AsicOperation>& ops, std::vector<sai_status_t>& statuses);
+
+    common::RedisConfig config_;
+    std::unique_ptr<common::RedisConnection> connection_;      ///< Consumer thread only
+    bool rpop_count_supported_;
+
+    bool initialized_;
+    sai_object_id_t switch_id_;
+    sai_route_api_t* route_api_;
+    ObjectApi vlan_api_;
+    ObjectApi vlan_member_api_;
+    ObjectApi next_hop_api_;
+    ObjectApi next_hop_group_api_;
+    ObjectApi next_hop_group_member_api_;
+
+    mutable std::mutex mutex_;      ///< Serializes batches; guards everything below
+    std::unordered_map<sai_object_id_t, sai_object_id_t> vid_to_rid_;
+    Stats stats_;
+
+    // Scratch for the run in progress, reused across runs
+    std::vector<size_t> run_ops_;               ///< Batch index of each operation sent to SAI
+    std::vector<sai_attribute_t> attrs_;
+    std::vector<uint32_t> attr_offsets_;
+    std::vector<uint32_t> attr_counts_;
+    std::vector<const sai_attribute_t*> attr_lists_;
+    std::vector<sai_object_id_t> oids_;
+    std::vector<sai_route_entry_t> routes_;
+    std::vector<sai_status_t> run_statuses_;
+
+    std::atomic<bool> running_;
+    std::thread thread_;
+};
+
+} // namespace syncd
+} // namespace sonic
+
+#endif // SONIC_SYNCD_SYNCD_H
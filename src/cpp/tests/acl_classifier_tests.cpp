@@ -0,0 +1,143 @@
+/**
+ * @file acl_classifier_tests.cpp
+ * @brief ACLClassifier rule compilation, tuple-space lookup and conflict unit tests
+ */
+
+#include "acl_classifier.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace sonic {
+namespace sai {
+namespace {
+
+CompiledACLRule compile(const std::string& name, const std::map<std::string, std::string>& fields) {
+    CompiledACLRule rule;
+    std::string error;
+    EXPECT_TRUE(ACLClassifier::compileRule(name, fields, rule, error)) << name << ": " << error;
+    return rule;
+}
+
+ACLPacket packet(uint32_t src_ip, uint32_t dst_ip, uint8_t protocol, uint16_t dst_port) {
+    ACLPacket p;
+    p.src_ip = src_ip;
+    p.dst_ip = dst_ip;
+    p.protocol = protocol;
+    p.src_port = 40000;
+    p.dst_port = dst_port;
+    return p;
+}
+
+const uint32_t HOST_10_0_0_1 = 0x0A000001;
+const uint32_t HOST_10_1_0_1 = 0x0A010001;
+const uint32_t HOST_192_168_0_1 = 0xC0A80001;
+
+} // anonymous namespace
+
+TEST(ACLClassifierTest, CompilesSONiCRuleFields) {
+    CompiledACLRule rule = compile("RULE_1", {{"PRIORITY", "100"}, {"PACKET_ACTION", "REDIRECT:Ethernet4"},
+                                              {"SRC_IP", "10.0.0.0/8"}, {"IP_PROTOCOL", "TCP"},
+                                              {"L4_DST_PORT_RANGE", "1000-2000"}, {"IP_TYPE", "IPV4ANY"}});
+    EXPECT_EQ(rule.priority, 100u);
+    EXPECT_EQ(rule.action, ACLAction::REDIRECT);
+    EXPECT_EQ(rule.redirect_target, "Ethernet4");
+    EXPECT_EQ(rule.src_ip, 0x0A000000u);
+    EXPECT_EQ(rule.src_prefix_length, 8);
+    EXPECT_TRUE(rule.match_protocol);
+    EXPECT_EQ(rule.protocol, 6);
+    EXPECT_EQ(rule.dst_port_min, 1000);
+    EXPECT_EQ(rule.dst_port_max, 2000);
+}
+
+TEST(ACLClassifierTest, RejectsRulesItCannotModel) {
+    CompiledACLRule rule;
+    std::string error;
+    EXPECT_FALSE(ACLClassifier::compileRule("R", {{"PRIORITY", "1"}}, rule, error));
+    EXPECT_EQ(error, "no PACKET_ACTION");
+    EXPECT_FALSE(ACLClassifier::compileRule("R", {{"PACKET_ACTION", "DROP"}, {"SRC_IP", "2001:db8::/32"}}, rule, error));
+    EXPECT_FALSE(ACLClassifier::compileRule("R", {{"PACKET_ACTION", "DROP"}, {"L4_DST_PORT_RANGE", "20-10"}}, rule, error));
+    EXPECT_FALSE(ACLClassifier::compileRule("R", {{"PACKET_ACTION", "DROP"}, {"IP_PROTOCOL", "256"}}, rule, error));
+    EXPECT_FALSE(ACLClassifier::compileRule("R", {{"PACKET_ACTION", "DROP"}, {"TCP_FLAGS", "0x02/0x02"}}, rule, error));
+    EXPECT_EQ(error, "unsupported qualifier TCP_FLAGS");
+}
+
+TEST(ACLClassifierTest, HighestPriorityMatchWins) {
+    ACLClassifier classifier({
+        compile("DENY_ALL", {{"PRIORITY", "1"}, {"PACKET_ACTION", "DROP"}}),
+        compile("ALLOW_SSH", {{"PRIORITY", "100"}, {"PACKET_ACTION", "FORWARD"}, {"SRC_IP", "10.0.0.0/8"},
+                              {"IP_PROTOCOL", "TCP"}, {"L4_DST_PORT", "22"}}),
+        compile("ALLOW_NET", {{"PRIORITY", "50"}, {"PACKET_ACTION", "FORWARD"}, {"SRC_IP", "10.1.0.0/16"}}),
+    });
+    EXPECT_EQ(classifier.rules().front().name, "ALLOW_SSH");
+    EXPECT_EQ(classifier.tupleCount(), 3u);
+
+    const CompiledACLRule* hit = classifier.match(packet(HOST_10_0_0_1, HOST_192_168_0_1, 6, 22));
+    ASSERT_NE(hit, nullptr);
+    EXPECT_EQ(hit->name, "ALLOW_SSH");
+    EXPECT_EQ(classifier.match(packet(HOST_10_0_0_1, HOST_192_168_0_1, 6, 23))->name, "DENY_ALL");
+    EXPECT_EQ(classifier.match(packet(HOST_10_1_0_1, HOST_192_168_0_1, 17, 53))->name, "ALLOW_NET");
+
+    ACLClassifier empty({});
+    EXPECT_EQ(empty.match(packet(HOST_10_0_0_1, HOST_192_168_0_1, 6, 22)), nullptr);
+}
+
+TEST(ACLClassifierTest, MatchesALinearScan) {
+    // Many rules share a tuple and a bucket, so the per-bucket priority order matters
+    std::mt19937 rng(3);
+    std::vector<CompiledACLRule> rules;
+    for (int i = 0; i < 200; ++i) {
+        CompiledACLRule rule;
+        rule.name = "RULE_" + std::to_string(i);
+        rule.priority = rng() % 50;
+        rule.src_prefix_length = static_cast<uint8_t>((rng() % 3) * 8);
+        rule.src_ip = (0x0A000000u | (rng() % 4) << 16) & (rule.src_prefix_length ? ~0u << (32 - rule.src_prefix_length) : 0);
+        rule.match_protocol = rng() % 2;
+        rule.protocol = rng() % 2 ? 6 : 17;
+        rule.dst_port_min = static_cast<uint16_t>(rng() % 100);
+        rule.dst_port_max = static_cast<uint16_t>(rule.dst_port_min + rng() % 100);
+        rule.action = rng() % 2 ? ACLAction::PERMIT : ACLAction::DENY;
+        rules.push_back(rule);
+    }
+    ACLClassifier classifier(rules);
+
+    for (int i = 0; i < 5000; ++i) {
+        ACLPacket p = packet(0x0A000000u | (rng() % 4) << 16 | (rng() & 0xFF), HOST_192_168_0_1,
+                             rng() % 2 ? 6 : 17, static_cast<uint16_t>(rng() % 200));
+        const CompiledACLRule* expected = nullptr;
+        for (const auto& rule : classifier.rules()) {
+            if (rule.matches(p)) {
+                expected = &rule;
+                break;
+            }
+        }
+        ASSERT_EQ(classifier.match(p), expected) << "packet " << i;
+    }
+}
+
+TEST(ACLClassifierTest, ReportsShadowedRedundantAndOverlappingRules) {
+    ACLClassifier classifier({
+        compile("DROP_NET", {{"PRIORITY", "100"}, {"PACKET_ACTION", "DROP"}, {"SRC_IP", "10.0.0.0/8"}}),
+        compile("ALLOW_HOST", {{"PRIORITY", "90"}, {"PACKET_ACTION", "FORWARD"}, {"SRC_IP", "10.1.0.1/32"}}),
+        compile("DROP_SUBNET", {{"PRIORITY", "80"}, {"PACKET_ACTION", "DROP"}, {"SRC_IP", "10.2.0.0/16"}}),
+        compile("ALLOW_WEB", {{"PRIORITY", "70"}, {"PACKET_ACTION", "FORWARD"}, {"L4_DST_PORT", "80"}}),
+    });
+
+    std::vector<ACLConflict> conflicts = classifier.findConflicts();
+    ASSERT_EQ(conflicts.size(), 2u);
+    EXPECT_EQ(conflicts[0].kind, ACLConflict::Kind::SHADOWED);
+    EXPECT_EQ(conflicts[0].rule, "ALLOW_HOST");
+    EXPECT_EQ(conflicts[0].by, "DROP_NET");
+    EXPECT_EQ(conflicts[1].kind, ACLConflict::Kind::REDUNDANT);
+    EXPECT_EQ(conflicts[1].rule, "DROP_SUBNET");
+
+    conflicts = classifier.findConflicts(true);
+    ASSERT_EQ(conflicts.size(), 3u);
+    EXPECT_EQ(conflicts[2].kind, ACLConflict::Kind::OVERLAP);
+    EXPECT_EQ(conflicts[2].rule, "ALLOW_WEB");
+    EXPECT_EQ(conflicts[2].by, "DROP_NET");
+}
+
+} // namespace sai
+} // namespace sonic
@@ -0,0 +1,138 @@
+/**
+ * @file actuator_queue_tests.cpp
+ * @brief ActuatorQueue and LEDController write-outcome unit tests
+ *
+ * The LED tests build a throwaway leds/ tree under /tmp; a node without its
+ * attribute files stands in for a write the kernel refuses.
+ */
+
+#include "actuator_queue.h"
+#include "led_controller.h"
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace sonic {
+namespace common {
+namespace {
+
+// Queue without a flusher thread; the tests flush by hand
+class ActuatorQueueTest : public ::testing::Test {
+protected:
+    ActuatorQueue queue_{[this](const ActuatorQueue::Batch& batch, std::vector<bool>& rejected) {
+        frames_.push_back(batch);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            rejected[i] = batch[i].first == reject_key_;
+        }
+        return sink_ok_;
+    }, 1000};
+
+    std::vector<ActuatorQueue::Batch> frames_;
+    std::string reject_key_;
+    bool sink_ok_ = true;
+};
+
+} // anonymous namespace
+
+TEST_F(ActuatorQueueTest, RecordsOnlyAcceptedWrites) {
+    reject_key_ = "FAN_STATUS|Fan2";
+    queue_.set("FAN_STATUS|Fan1", "60");
+    queue_.set("FAN_STATUS|Fan2", "60");
+
+    EXPECT_FALSE(queue_.flush());
+    std::string value;
+    EXPECT_TRUE(queue_.written("FAN_STATUS|Fan1", value));
+    EXPECT_EQ(value, "60");
+    EXPECT_FALSE(queue_.written("FAN_STATUS|Fan2", value));
+    EXPECT_EQ(queue_.stats().writes, 1u);
+    EXPECT_EQ(queue_.stats().rejected, 1u);
+
+    // Not retried on its own, but the same value set again is written again
+    EXPECT_EQ(queue_.pending(), 0u);
+    reject_key_.clear();
+    EXPECT_FALSE(queue_.set("FAN_STATUS|Fan1", "60"));
+    EXPECT_TRUE(queue_.set("FAN_STATUS|Fan2", "60"));
+    EXPECT_TRUE(queue_.flush());
+    EXPECT_TRUE(queue_.written("FAN_STATUS|Fan2", value));
+    EXPECT_EQ(value, "60");
+}
+
+TEST_F(ActuatorQueueTest, KeepsAFailedFrameDirty) {
+    sink_ok_ = false;
+    queue_.set("LED_STATUS|Port0", "on,green");
+    EXPECT_FALSE(queue_.flush());
+    EXPECT_EQ(queue_.pending(), 1u);
+    EXPECT_EQ(queue_.stats().failed_batches, 1u);
+
+    sink_ok_ = true;
+    EXPECT_TRUE(queue_.flush());
+    ASSERT_EQ(frames_.size(), 2u);
+    EXPECT_EQ(frames_[1], frames_[0]);
+    EXPECT_EQ(queue_.pending(), 0u);
+}
+
+} // namespace common
+
+namespace bsp {
+namespace {
+
+class LEDControllerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char pattern[] = "/tmp/sonic_led_test_XXXXXX";
+        ASSERT_NE(mkdtemp(pattern), nullptr);
+        root_ = pattern;
+        ASSERT_EQ(::mkdir((root_ + "/leds").c_str(), 0755), 0);
+    }
+
+    void TearDown() override {
+        std::string command = "rm -rf " + root_;
+        ASSERT_EQ(std::system(command.c_str()), 0);
+    }
+
+    // A node with writable attributes, or a bare directory whose writes fail
+    void addLED(const std::string& node, bool writable) {
+        std::string dir = root_ + "/leds/" + node;
+        ASSERT_EQ(::mkdir(dir.c_str(), 0755), 0);
+        if (writable) {
+            for (const char* attribute : {"brightness", "trigger", "max_brightness"}) {
+                std::ofstream(dir + "/" + attribute) << (std::string(attribute) == "max_brightness" ? "255" : "");
+            }
+        }
+    }
+
+    std::string readAttribute(const std::string& node, const std::string& attribute) const {
+        std::ifstream file(root_ + "/leds/" + node + "/" + attribute);
+        std::string value;
+        std::getline(file, value);
+        return value;
+    }
+
+    std::string root_;
+};
+
+} // anonymous namespace
+
+TEST_F(LEDControllerTest, RejectsLEDsThatCannotBeWritten) {
+    addLED("status", true);
+    addLED("fault", false);
+    LEDController leds(root_, 60000);
+
+    ASSERT_TRUE(leds.setLED("status", "on"));
+    ASSERT_TRUE(leds.setLED("fault", "on"));
+    EXPECT_FALSE(leds.flush());
+    EXPECT_EQ(readAttribute("status", "brightness"), "255");
+    EXPECT_EQ(leds.stats().writes, 1u);
+    EXPECT_EQ(leds.stats().rejected, 1u);
+
+    // The failed LED was never recorded as on, so asking again writes again
+    ASSERT_TRUE(leds.setLED("fault", "on"));
+    EXPECT_FALSE(leds.flush());
+    EXPECT_EQ(leds.stats().rejected, 2u);
+}
+
+} // namespace bsp
+} // namespace sonic
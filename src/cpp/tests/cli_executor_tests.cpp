@@ -0,0 +1,87 @@
+/**
+ * @file cli_executor_tests.cpp
+ * @brief CliExecutor read-only classification and cache invalidation unit tests
+ */
+
+#include "cli_executor.h"
+#include "redis_client.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+namespace sonic {
+namespace common {
+namespace {
+
+class CliCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = "/tmp/sonic_cli_cache_test_" + std::to_string(::getpid());
+        write("before");
+        CliExecutor::shared().invalidate();
+    }
+
+    void TearDown() override { std::remove(path_.c_str()); }
+
+    void write(const std::string& text) { std::ofstream(path_, std::ios::trunc) << text; }
+    std::string readCached() { return CliExecutor::shared().run("cat " + path_, true).output; }
+
+    std::string path_;
+};
+
+} // anonymous namespace
+
+TEST(CliExecutorTest, ReadOnlyCommandsCannotRunAnythingElse) {
+    EXPECT_TRUE(CliExecutor::isReadOnlyCommand("show interfaces status"));
+    EXPECT_TRUE(CliExecutor::isReadOnlyCommand("cat /etc/sonic/sonic_version.yml | grep build_version"));
+
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("show $(config vlan add 10)"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("show `config vlan add 10`"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("show vlan brief\nconfig vlan add 10"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("show vlan brief; config vlan add 10"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("show vlan brief > /etc/sonic/out"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("config vlan add 10"));
+    // A pipe only keeps a command read-only when every stage after it is a pure filter
+    EXPECT_TRUE(CliExecutor::isReadOnlyCommand("show interfaces status | grep Ethernet0 | head -1"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("show vlan brief | sh"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("show vlan brief | xargs config vlan add"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("show vlan brief | awk '{system(\"reboot\")}'"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("show vlan brief || config vlan add 10"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("show vlan brief |"));
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("cat <(config vlan add 10)"));
+    // The container probe must really run every time
+    EXPECT_FALSE(CliExecutor::isReadOnlyCommand("echo 'SAI_TEST'"));
+}
+
+TEST_F(CliCacheTest, InvalidateSharedDropsCachedOutput) {
+    ASSERT_EQ(readCached(), "before");
+    write("after");
+    EXPECT_EQ(readCached(), "before");
+
+    CliExecutor::invalidateShared();
+    EXPECT_EQ(readCached(), "after");
+}
+
+TEST_F(CliCacheTest, RedisWritesDropCachedOutput) {
+    // Nothing listens here; a write that may have been applied still invalidates
+    RedisConfig config;
+    config.host = "127.0.0.1";
+    config.port = 1;
+    config.connect_timeout_ms = 100;
+    config.shell_fallback = false;
+    RedisClient redis(config);
+
+    ASSERT_EQ(readCached(), "before");
+    write("after");
+    std::string value;
+    redis.get(4, "PORT|Ethernet0", value);
+    EXPECT_EQ(readCached(), "before");
+
+    redis.hset(4, "PORT|Ethernet0", "admin_status", "up");
+    EXPECT_EQ(readCached(), "after");
+}
+
+} // namespace common
+} // namespace sonic
@@ -0,0 +1,85 @@
+/**
+ * @file event_history_tests.cpp
+ * @brief EventHistory text table overflow and recycling unit tests
+ */
+
+#include "interrupts/event_history.h"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace sonic {
+namespace interrupts {
+namespace {
+
+PortEvent linkEvent(const std::string& info) {
+    PortEvent event;
+    event.port_name = "Ethernet0";
+    event.event_type = CableEvent::LINK_DOWN;
+    event.old_status = LinkStatus::UP;
+    event.new_status = LinkStatus::DOWN;
+    event.speed_mbps = 100000;
+    event.duplex = "full";
+    event.timestamp = std::chrono::system_clock::now();
+    event.additional_info = info;
+    return event;
+}
+
+} // anonymous namespace
+
+TEST(EventHistoryTest, MarksAndCountsTextsPastTheTableLimit) {
+    const size_t events = EventHistory::MAX_INFO_STRINGS + 100;
+    EventHistory history(events);
+    for (size_t i = 0; i < events; ++i) {
+        history.record(linkEvent("flap " + std::to_string(i)));
+    }
+
+    std::vector<PortEvent> recorded = history.getEvents();
+    ASSERT_EQ(recorded.size(), events);
+    EXPECT_EQ(recorded.front().additional_info, "flap 0");
+    EXPECT_EQ(recorded.back().additional_info, EventHistory::DROPPED_TEXT);
+    EXPECT_EQ(recorded.back().duplex, "full");
+    EXPECT_GE(history.droppedTexts(), 100u);
+
+    size_t marked = 0;
+    for (const auto& event : recorded) {
+        marked += event.additional_info == EventHistory::DROPPED_TEXT;
+    }
+    EXPECT_EQ(marked, history.droppedTexts());
+}
+
+TEST(EventHistoryTest, RecyclesTextsOfOverwrittenRecords) {
+    // Far more distinct texts than the table holds, but only a few retained at a time
+    EventHistory history(16);
+    const size_t events = 10 * EventHistory::MAX_INFO_STRINGS;
+    for (size_t i = 0; i < events; ++i) {
+        history.record(linkEvent("flap " + std::to_string(i)));
+    }
+
+    std::vector<PortEvent> recorded = history.getEvents();
+    ASSERT_EQ(recorded.size(), 16u);
+    EXPECT_EQ(recorded.front().additional_info, "flap " + std::to_string(events - 16));
+    EXPECT_EQ(recorded.back().additional_info, "flap " + std::to_string(events - 1));
+    EXPECT_EQ(recorded.back().duplex, "full");
+    // Only the records written just before each rebuild could have missed out
+    EXPECT_LT(history.droppedTexts(), events / 100);
+}
+
+TEST(EventHistoryTest, ClearEmptiesTheTextTable) {
+    const size_t events = EventHistory::MAX_INFO_STRINGS + 100;
+    EventHistory history(events);
+    for (size_t i = 0; i < events; ++i) {
+        history.record(linkEvent("flap " + std::to_string(i)));
+    }
+    ASSERT_GT(history.droppedTexts(), 0u);
+    uint64_t dropped = history.droppedTexts();
+
+    history.clear();
+    history.record(linkEvent("after clear"));
+    std::vector<PortEvent> recorded = history.getEvents();
+    ASSERT_EQ(recorded.size(), 1u);
+    EXPECT_EQ(recorded[0].additional_info, "after clear");
+    EXPECT_EQ(history.droppedTexts(), dropped);
+}
+
+} // namespace interrupts
+} // namespace sonic
@@ -0,0 +1,152 @@
+/**
+ * @file fdb_table_tests.cpp
+ * @brief FdbTable (open-addressing MAC table) learn, flush and rehash unit tests
+ */
+
+#include "fdb_table.h"
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <utility>
+
+namespace sonic {
+namespace common {
+namespace {
+
+const uint64_t MAC_A = 0x001122334455ULL;
+const uint64_t MAC_B = 0x001122334466ULL;
+const PortId PORT_0 = 0;
+const PortId PORT_1 = 1;
+
+size_t countOnPort(const FdbTable& table, PortId port) {
+    size_t count = 0;
+    table.forEachOnPort(port, [&count](const FdbRecord&) { count++; });
+    return count;
+}
+
+} // anonymous namespace
+
+TEST(FdbTableTest, ParsesAndFormatsMacs) {
+    uint64_t mac = 0;
+    ASSERT_TRUE(FdbTable::parseMac("00:11:22:33:44:55", mac));
+    EXPECT_EQ(mac, MAC_A);
+    ASSERT_TRUE(FdbTable::parseMac("00-11-22-33-44-66", mac));
+    EXPECT_EQ(mac, MAC_B);
+    EXPECT_EQ(FdbTable::formatMac(0xAABBCCDDEEFFULL), "aa:bb:cc:dd:ee:ff");
+    EXPECT_EQ(FdbTable::formatMac(MAC_A, '-'), "00-11-22-33-44-55");
+
+    EXPECT_FALSE(FdbTable::parseMac("00:11:22:33:44", mac));
+    EXPECT_FALSE(FdbTable::parseMac("00:11:22:33:44:5g", mac));
+}
+
+TEST(FdbTableTest, LearnMoveAndRemove) {
+    FdbTable table;
+    EXPECT_TRUE(table.learn(MAC_A, 10, PORT_0, FdbEntryType::DYNAMIC, 5));
+    // A refresh on the same port only updates last_seen
+    EXPECT_FALSE(table.learn(MAC_A, 10, PORT_0, FdbEntryType::DYNAMIC, 6));
+    // The same MAC in another VLAN is a separate entry
+    EXPECT_TRUE(table.learn(MAC_A, 20, PORT_0, FdbEntryType::DYNAMIC, 6));
+    EXPECT_EQ(table.size(), 2u);
+
+    const FdbRecord* record = table.find(MAC_A, 10);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->last_seen, 6u);
+
+    EXPECT_TRUE(table.learn(MAC_A, 10, PORT_1, FdbEntryType::DYNAMIC, 7));
+    EXPECT_EQ(table.find(MAC_A, 10)->port, PORT_1);
+    EXPECT_EQ(countOnPort(table, PORT_0), 1u);
+    EXPECT_EQ(countOnPort(table, PORT_1), 1u);
+
+    EXPECT_TRUE(table.remove(MAC_A, 10));
+    EXPECT_FALSE(table.remove(MAC_A, 10));
+    EXPECT_EQ(table.find(MAC_A, 10), nullptr);
+    EXPECT_NE(table.find(MAC_A, 20), nullptr);
+    EXPECT_EQ(countOnPort(table, PORT_1), 0u);
+
+    EXPECT_FALSE(table.learn(MAC_A, FdbTable::MAX_VLAN_ID + 1, PORT_0, FdbEntryType::DYNAMIC));
+}
+
+TEST(FdbTableTest, DynamicLearnNeverReplacesStatic) {
+    FdbTable table;
+    ASSERT_TRUE(table.learn(MAC_A, 10, PORT_0, FdbEntryType::STATIC));
+    EXPECT_FALSE(table.learn(MAC_A, 10, PORT_1, FdbEntryType::DYNAMIC));
+    EXPECT_EQ(table.find(MAC_A, 10)->port, PORT_0);
+
+    std::vector<FdbNotification> batch(1);
+    batch[0].op = FdbOp::AGE;
+    batch[0].mac = MAC_A;
+    batch[0].vlan_id = 10;
+    EXPECT_EQ(table.apply(batch), 0u);
+    batch[0].op = FdbOp::REMOVE;
+    EXPECT_EQ(table.apply(batch), 1u);
+    EXPECT_TRUE(table.empty());
+}
+
+TEST(FdbTableTest, FlushesKeepStaticEntriesUnlessAsked) {
+    FdbTable table;
+    table.learn(MAC_A, 10, PORT_0, FdbEntryType::DYNAMIC);
+    table.learn(MAC_B, 10, PORT_1, FdbEntryType::STATIC);
+    table.learn(MAC_A, 20, PORT_1, FdbEntryType::DYNAMIC);
+    table.learn(MAC_B, 20, PORT_1, FdbEntryType::DYNAMIC);
+
+    EXPECT_EQ(table.flushVLAN(10), 1u);
+    EXPECT_EQ(table.vlanSize(10), 1u);
+    EXPECT_NE(table.find(MAC_B, 10), nullptr);
+
+    EXPECT_EQ(table.flushPort(PORT_1), 2u);
+    EXPECT_EQ(countOnPort(table, PORT_1), 1u);
+    EXPECT_EQ(table.vlanSize(20), 0u);
+
+    EXPECT_EQ(table.flushAll(true), 1u);
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.flushPort(PORT_1 + 100), 0u);
+}
+
+TEST(FdbTableTest, StaysConsistentAcrossRehashAndChurn) {
+    // Keys differ only in the VLAN bits and a few MAC bits, so buckets collide
+    std::mt19937 rng(7);
+    FdbTable table;
+    std::map<std::pair<uint64_t, uint16_t>, PortId> expected;
+
+    for (int step = 0; step < 20000; ++step) {
+        uint64_t mac = 0x020000000000ULL | (rng() & 0xFF);
+        uint16_t vlan = static_cast<uint16_t>(1 + rng() % 64);
+        PortId port = rng() % 8;
+        auto key = std::make_pair(mac, vlan);
+        if (rng() % 4 == 0) {
+            EXPECT_EQ(table.remove(mac, vlan), expected.erase(key) == 1);
+        } else {
+            table.learn(mac, vlan, port, FdbEntryType::DYNAMIC);
+            expected[key] = port;
+        }
+    }
+
+    ASSERT_EQ(table.size(), expected.size());
+    for (const auto& entry : expected) {
+        const FdbRecord* record = table.find(entry.first.first, entry.first.second);
+        ASSERT_NE(record, nullptr);
+        EXPECT_EQ(record->port, entry.second);
+    }
+    size_t visited = 0;
+    table.forEach([&visited](const FdbRecord&) { visited++; });
+    EXPECT_EQ(visited, expected.size());
+
+    size_t on_ports = 0;
+    for (PortId port = 0; port < 8; ++port) {
+        on_ports += countOnPort(table, port);
+    }
+    EXPECT_EQ(on_ports, expected.size());
+}
+
+TEST(FdbTableTest, ReserveKeepsEntries) {
+    FdbTable table;
+    table.learn(MAC_A, 10, PORT_0, FdbEntryType::DYNAMIC);
+    table.reserve(100000);
+    EXPECT_NE(table.find(MAC_A, 10), nullptr);
+    EXPECT_EQ(table.size(), 1u);
+    table.clear();
+    EXPECT_EQ(table.find(MAC_A, 10), nullptr);
+}
+
+} // namespace common
+} // namespace sonic
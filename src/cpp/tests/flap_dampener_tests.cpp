@@ -0,0 +1,65 @@
+/**
+ * @file flap_dampener_tests.cpp
+ * @brief FlapDampener suppress/release notice unit tests
+ */
+
+#include "interrupts/flap_dampener.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace sonic {
+namespace interrupts {
+namespace {
+
+PortEvent linkEvent(CableEvent type) {
+    PortEvent event;
+    event.port_name = "FlapTest0";
+    event.event_type = type;
+    event.old_status = type == CableEvent::LINK_DOWN ? LinkStatus::UP : LinkStatus::DOWN;
+    event.new_status = type == CableEvent::LINK_DOWN ? LinkStatus::DOWN : LinkStatus::UP;
+    event.speed_mbps = 100000;
+    event.duplex = "full";
+    event.timestamp = std::chrono::system_clock::now();
+    return event;
+}
+
+} // anonymous namespace
+
+TEST(FlapDampenerTest, NoticesCarryNumbersOutsideTheirText) {
+    DampeningConfig config;
+    config.enabled = true;
+    FlapDampener dampener(config);
+    FlapDampener::Clock::time_point now = FlapDampener::Clock::now();
+
+    std::vector<std::string> texts;
+    for (int cycle = 0; cycle < 2; ++cycle) {
+        PortEvent notice;
+        ASSERT_EQ(dampener.process(linkEvent(CableEvent::LINK_DOWN), now, notice), FlapDampener::Action::DELIVER);
+        ASSERT_EQ(dampener.process(linkEvent(CableEvent::LINK_DOWN), now, notice), FlapDampener::Action::SUPPRESS);
+        EXPECT_EQ(notice.event_type, CableEvent::FLAP_SUPPRESSED);
+        EXPECT_EQ(notice.dampening_penalty, 2000u);
+        texts.push_back(notice.additional_info);
+
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_EQ(dampener.process(linkEvent(CableEvent::LINK_UP), now, notice), FlapDampener::Action::ABSORB);
+        }
+
+        now += std::chrono::minutes(10);
+        std::vector<PortEvent> released;
+        dampener.collectReleased(now, released);
+        ASSERT_EQ(released.size(), 1u);
+        EXPECT_EQ(released[0].event_type, CableEvent::FLAP_UNSUPPRESSED);
+        EXPECT_EQ(released[0].suppressed_events, 4u);
+        EXPECT_EQ(released[0].new_status, LinkStatus::UP);
+        texts.push_back(released[0].additional_info);
+    }
+
+    // Repeated cycles reuse the same two texts, so the event history interns them once
+    EXPECT_EQ(texts[0], texts[2]);
+    EXPECT_EQ(texts[1], texts[3]);
+    EXPECT_NE(texts[0], texts[1]);
+}
+
+} // namespace interrupts
+} // namespace sonic
@@ -0,0 +1,125 @@
+/**
+ * @file json_tests.cpp
+ * @brief JsonDocument strictness, escape decoding and number conversion unit tests
+ */
+
+#include "json.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace sonic {
+namespace common {
+namespace {
+
+bool parses(std::string_view input) {
+    JsonDocument doc;
+    return doc.parse(input);
+}
+
+} // anonymous namespace
+
+TEST(JsonDocumentTest, ParsesWellFormedDocuments) {
+    JsonDocument doc;
+    ASSERT_TRUE(doc.parse(" {\"PORT\": {\"speed\": 100000, \"mtu\": -9.1e+2, \"up\": true, \"alias\": null}} \n"));
+    JsonDocument::Value port = doc.root()["PORT"];
+    EXPECT_EQ(port["speed"].asInt(), 100000);
+    double mtu = 0;
+    EXPECT_TRUE(port["mtu"].getDouble(mtu));
+    EXPECT_DOUBLE_EQ(mtu, -910.0);
+    EXPECT_TRUE(port["up"].asBool());
+    EXPECT_EQ(port["alias"].type(), JsonType::NUL);
+    EXPECT_TRUE(parses("[0, 0.5, 1E3, \"\"]"));
+}
+
+TEST(JsonDocumentTest, RejectsTrailingCharacters) {
+    JsonDocument doc;
+    EXPECT_FALSE(doc.parse("{} x"));
+    EXPECT_NE(doc.error().find("trailing characters"), std::string::npos);
+    EXPECT_FALSE(doc.root().valid());
+
+    EXPECT_FALSE(parses("1 2"));
+    EXPECT_FALSE(parses("[1]]"));
+    EXPECT_FALSE(parses("truex"));
+    EXPECT_FALSE(parses("\"a\"\""));
+}
+
+TEST(JsonDocumentTest, RejectsMalformedNumbers) {
+    EXPECT_FALSE(parses("01"));
+    EXPECT_FALSE(parses("[1-2]"));
+    EXPECT_FALSE(parses("1."));
+    EXPECT_FALSE(parses("1e"));
+    EXPECT_FALSE(parses("1e+"));
+    EXPECT_FALSE(parses("-"));
+    EXPECT_FALSE(parses(".5"));
+    EXPECT_FALSE(parses("+1"));
+}
+
+TEST(JsonDocumentTest, RejectsMalformedEscapes) {
+    JsonDocument doc;
+    EXPECT_FALSE(doc.parse("\"\\x\""));
+    EXPECT_EQ(doc.error(), "invalid escape in string at offset 1");
+
+    EXPECT_FALSE(parses("\"\\u12\""));
+    EXPECT_FALSE(parses("\"\\u12G4\""));
+    EXPECT_FALSE(parses("\"\\u-123\""));
+    EXPECT_FALSE(parses("{\"\\q\": 1}"));
+    // A backslash cannot escape the closing quote away
+    EXPECT_FALSE(parses("\"\\\""));
+    EXPECT_FALSE(parses("\"abc\\"));
+}
+
+TEST(JsonDocumentTest, RejectsUnpairedSurrogates) {
+    EXPECT_FALSE(parses("\"\\uD800\""));
+    EXPECT_FALSE(parses("\"\\uD800x\""));
+    EXPECT_FALSE(parses("\"\\uD800\\u0041\""));
+    EXPECT_FALSE(parses("\"\\uDC00\""));
+
+    std::string out;
+    EXPECT_FALSE(JsonDocument::unescape("\\uD83D", out));
+    EXPECT_FALSE(JsonDocument::unescape("\\uDE00", out));
+}
+
+TEST(JsonDocumentTest, DecodesEscapes) {
+    JsonDocument doc;
+    ASSERT_TRUE(doc.parse("\"tab\\t\\\"q\\\" \\u00e9 \\uD83D\\uDE00 \\/\""));
+    EXPECT_EQ(doc.root().asString(), "tab\t\"q\" \xC3\xA9 \xF0\x9F\x98\x80 /");
+    EXPECT_EQ(doc.root().rawString(), "tab\\t\\\"q\\\" \\u00e9 \\uD83D\\uDE00 \\/");
+}
+
+TEST(JsonDocumentTest, GetIntRejectsFractionalAndOutOfRangeNumbers) {
+    JsonDocument doc;
+    ASSERT_TRUE(doc.parse("[1.5, -0.25, 1e19, -1e19, 9.3e18, 1e400, 1e3, -2.0e1, \"1.5\"]"));
+    int64_t out = 7;
+    EXPECT_FALSE(doc.root().at(0).getInt(out));
+    EXPECT_FALSE(doc.root().at(1).getInt(out));
+    EXPECT_FALSE(doc.root().at(2).getInt(out));
+    EXPECT_FALSE(doc.root().at(3).getInt(out));
+    EXPECT_FALSE(doc.root().at(4).getInt(out));
+    EXPECT_FALSE(doc.root().at(5).getInt(out));
+    EXPECT_EQ(out, 7);
+    EXPECT_FALSE(doc.root().at(8).getInt(out));
+
+    EXPECT_TRUE(doc.root().at(6).getInt(out));
+    EXPECT_EQ(out, 1000);
+    EXPECT_TRUE(doc.root().at(7).getInt(out));
+    EXPECT_EQ(out, -20);
+}
+
+TEST(JsonWriterTest, WritesNullForNonFiniteNumbers) {
+    JsonWriter writer;
+    writer.beginArray()
+        .value(std::numeric_limits<double>::quiet_NaN())
+        .value(std::numeric_limits<double>::infinity())
+        .value(-std::numeric_limits<double>::infinity())
+        .value(0.5)
+        .endArray();
+    EXPECT_EQ(writer.str(), "[null,null,null,0.5]");
+
+    JsonDocument doc;
+    EXPECT_TRUE(doc.parse(writer.str()));
+}
+
+} // namespace common
+} // namespace sonic
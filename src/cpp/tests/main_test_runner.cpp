@@ -1,4 +1,5 @@
 #include "sonic_functional_tests.h"
+#include "../common/logger.h"
 #include <iostream>
 #include <string>
 #include <vector>
@@ -20,6 +21,7 @@ void printUsage(const char* program_name) {
               << "  -s, --stop-on-failure   Stop on first test failure\n"
               << "  -t, --timeout SECONDS   Set test timeout (default: 30)\n"
               << "  -o, --output FILE       Save results to file\n"
+              << "  -j, --jobs N            Run independent tests on N workers (default: 1, max: 8)\n"
               << "  --hal-only              Run only HAL tests\n"
               << "  --sai-only              Run only SAI tests\n"
               << "  --interrupt-only        Run only interrupt/cable event tests\n"
@@ -36,6 +38,7 @@ void printUsage(const char* program_name) {
               << "  " << program_name << " --verbose                    # Run all tests with verbose output\n"
               << "  " << program_name << " --sai-only --output results.txt  # Run SAI tests, save to file\n"
               << "  " << program_name << " --quick --stop-on-failure    # Quick test with early exit\n"
+              << "  " << program_name << " --jobs 4                     # Run all tests on 4 workers\n"
               << std::endl;
 }
 
@@ -51,6 +54,7 @@ int main(int argc, char* argv[]) {
     bool stress_tests = false;
     bool quick_mode = false;
     int timeout = 30;
+    int jobs = 1;
     std::string output_file;
     
     // Parse command line arguments
@@ -61,6 +65,7 @@ int main(int argc, char* argv[]) {
         {"stop-on-failure", no_argument, 0, 's'},
         {"timeout", required_argument, 0, 't'},
         {"output", required_argument, 0, 'o'},
+        {"jobs", required_argument, 0, 'j'},
         {"hal-only", no_argument, 0, 1001},
         {"sai-only", no_argument, 0, 1002},
         {"interrupt-only", no_argument, 0, 1003},
@@ -73,7 +78,7 @@ int main(int argc, char* argv[]) {
     int option_index = 0;
     int c;
     
-    while ((c = getopt_long(argc, argv, "hvqst:o:", long_options, &option_index)) != -1) {
+    while ((c = getopt_long(argc, argv, "hvqst:o:j:", long_options, &option_index)) != -1) {
         switch (c) {
             case 'h':
                 printUsage(argv[0]);
@@ -93,6 +98,17 @@ int main(int argc, char* argv[]) {
             case 'o':
                 output_file = optarg;
                 break;
+            case 'j':
+                try {
+                    jobs = std::stoi(optarg);
+                } catch (const std::exception&) {
+                    jobs = 0;
+                }
+                if (jobs < 1 || jobs > TestPartition::MAX_PARTITIONS) {
+                    std::cerr << "Error: --jobs must be between 1 and " << TestPartition::MAX_PARTITIONS << std::endl;
+                    return 1;
+                }
+                break;
             case 1001:
                 hal_only = true;
                 break;
@@ -147,7 +163,8 @@ int main(int argc, char* argv[]) {
         std::cout << "Configuration:\n"
                   << "  Verbose Mode: " << (verbose ? "Enabled" : "Disabled") << "\n"
                   << "  Stop on Failure: " << (stop_on_failure ? "Enabled" : "Disabled") << "\n"
-                  << "  Timeout: " << timeout << " seconds\n";
+                  << "  Timeout: " << timeout << " seconds\n"
+                  << "  Parallel Jobs: " << jobs << "\n";
         
         if (!output_file.empty()) {
             std::cout << "  Output File: " << output_file << "\n";
@@ -161,8 +178,10 @@ int main(int argc, char* argv[]) {
     test_framework.setVerboseMode(verbose && !quiet);
     test_framework.setStopOnFirstFailure(stop_on_failure);
     test_framework.setTimeout(timeout);
+    test_framework.setJobs(jobs);
     
     if (!test_framework.initialize()) {
+        sonic::common::Logger::flush();
         std::cerr << "Failed to initialize SONiC Functional Test Framework" << std::endl;
         return 1;
     }
@@ -246,7 +265,8 @@ int main(int argc, char* argv[]) {
         overall_success = false;
     }
     
-    // Print final result
+    // Print final result after everything the tests logged
+    sonic::common::Logger::flush();
     if (!quiet) {
         std::cout << "\n"
                   << "╔══════════════════════════════════════════════════════════════╗\n"
@@ -265,6 +285,7 @@ int main(int argc, char* argv[]) {
     
     // Cleanup
     test_framework.cleanup();
+    sonic::common::Logger::flush();
     
     return overall_success ? 0 : 1;
 }
@@ -0,0 +1,112 @@
+/**
+ * @file metrics_tests.cpp
+ * @brief LatencyHistogram bucketing, percentile and registry unit tests
+ */
+
+#include "metrics.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sonic {
+namespace common {
+
+TEST(LatencyHistogramTest, BucketsAreExactBelowSixteenAndWithinBoundsAbove) {
+    for (uint64_t value = 0; value < 16; ++value) {
+        EXPECT_EQ(LatencyHistogram::bucketIndex(value), value);
+        EXPECT_EQ(LatencyHistogram::bucketUpperBound(value), value);
+    }
+
+    size_t previous = 0;
+    for (uint64_t value = 16; value < (1ULL << 40); value += value / 7 + 1) {
+        size_t index = LatencyHistogram::bucketIndex(value);
+        ASSERT_LT(index, LatencyHistogram::BUCKET_COUNT);
+        EXPECT_GE(index, previous);
+        previous = index;
+
+        uint64_t upper = LatencyHistogram::bucketUpperBound(index);
+        EXPECT_GE(upper, value);
+        // 16 sub-buckets per power of two
+        EXPECT_LE(upper - value, value / 16) << value;
+        EXPECT_EQ(LatencyHistogram::bucketIndex(upper), index);
+        EXPECT_EQ(LatencyHistogram::bucketIndex(upper + 1), index + 1);
+    }
+
+    EXPECT_EQ(LatencyHistogram::bucketIndex(UINT64_MAX), LatencyHistogram::BUCKET_COUNT - 1);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    auto histogram = std::make_unique<LatencyHistogram>();
+    EXPECT_EQ(histogram->percentile(0.5), 0u);
+
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram->record(value * 1000);
+    }
+    EXPECT_EQ(histogram->count(), 1000u);
+    EXPECT_EQ(histogram->sum(), 500500000u);
+    EXPECT_EQ(histogram->max(), 1000000u);
+
+    auto near = [](uint64_t actual, uint64_t expected) {
+        return actual >= expected && actual - expected <= expected / 16;
+    };
+    EXPECT_TRUE(near(histogram->percentile(0.5), 500000)) << histogram->percentile(0.5);
+    EXPECT_TRUE(near(histogram->percentile(0.99), 990000)) << histogram->percentile(0.99);
+    // Never beyond the largest value recorded
+    EXPECT_EQ(histogram->percentile(1.0), 1000000u);
+    EXPECT_EQ(histogram->percentile(2.0), 1000000u);
+    EXPECT_TRUE(near(histogram->percentile(0.0), 1000));
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecordsAreAllCounted) {
+    auto histogram = std::make_unique<LatencyHistogram>();
+    const int threads = 4;
+    const uint64_t per_thread = 50000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&histogram, t, per_thread]() {
+            for (uint64_t i = 0; i < per_thread; ++i) {
+                histogram->record(static_cast<uint64_t>(t + 1) * 100);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(histogram->count(), threads * per_thread);
+    EXPECT_EQ(histogram->sum(), (100 + 200 + 300 + 400) * per_thread);
+    EXPECT_EQ(histogram->max(), 400u);
+}
+
+TEST(LatencyHistogramTest, SampleRateRoundsUpToAPowerOfTwo) {
+    auto histogram = std::make_unique<LatencyHistogram>();
+    EXPECT_TRUE(histogram->shouldSample());
+
+    histogram->setSampleRate(5);
+    int sampled = 0;
+    for (int i = 0; i < 800; ++i) {
+        sampled += histogram->shouldSample() ? 1 : 0;
+    }
+    EXPECT_EQ(sampled, 100);
+
+    histogram->setSampleRate(1);
+    EXPECT_TRUE(histogram->shouldSample());
+}
+
+TEST(MetricsRegistryTest, ReturnsOneMetricPerName) {
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    LatencyHistogram& histogram = registry.histogram("sonic_test_latency_seconds", "Test latency");
+    EXPECT_EQ(&registry.histogram("sonic_test_latency_seconds", "Test latency"), &histogram);
+    EXPECT_THROW(registry.counter("sonic_test_latency_seconds", "Test latency"), std::invalid_argument);
+
+    histogram.record(2000000);
+    std::string text;
+    registry.exportPrometheus(text);
+    EXPECT_NE(text.find("# TYPE sonic_test_latency_seconds summary"), std::string::npos);
+    EXPECT_NE(text.find("sonic_test_latency_seconds_count 1\n"), std::string::npos);
+}
+
+} // namespace common
+} // namespace sonic
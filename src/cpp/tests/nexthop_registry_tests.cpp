@@ -0,0 +1,114 @@
+/**
+ * @file nexthop_registry_tests.cpp
+ * @brief NextHopRegistry parsing, dedup and reference counting unit tests
+ *
+ * Run against the mock SAI; object counts are compared with the counts at
+ * the start of each test, since other suites share the mock.
+ */
+
+#include "nexthop_registry.h"
+#include "mock_sai.h"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace sonic {
+namespace swss {
+namespace {
+
+class NextHopRegistryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        sai_api_initialize(0, nullptr);
+        ASSERT_TRUE(registry_.initialize(0x21000000000000ULL));
+        next_hops_ = mockSAIObjectCount(SAI_OBJECT_TYPE_NEXT_HOP);
+        groups_ = mockSAIObjectCount(SAI_OBJECT_TYPE_NEXT_HOP_GROUP);
+        members_ = mockSAIObjectCount(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER);
+    }
+
+    size_t createdNextHops() const { return mockSAIObjectCount(SAI_OBJECT_TYPE_NEXT_HOP) - next_hops_; }
+    size_t createdGroups() const { return mockSAIObjectCount(SAI_OBJECT_TYPE_NEXT_HOP_GROUP) - groups_; }
+    size_t createdMembers() const { return mockSAIObjectCount(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER) - members_; }
+
+    NextHopRegistry registry_;
+    size_t next_hops_ = 0;
+    size_t groups_ = 0;
+    size_t members_ = 0;
+};
+
+} // anonymous namespace
+
+TEST(NextHopParseTest, SortsAndDedupsMembers) {
+    NextHopSet set;
+    ASSERT_TRUE(NextHopRegistry::parse("10.0.0.2, 10.0.0.1@Ethernet0,10.0.0.2,fc00::1", set));
+    ASSERT_EQ(set.size(), 3u);
+    EXPECT_EQ(set[0].toString(), "10.0.0.1@Ethernet0");
+    EXPECT_EQ(set[1].toString(), "10.0.0.2");
+    EXPECT_EQ(set[2].toString(), "fc00::1");
+
+    EXPECT_FALSE(NextHopRegistry::parse("", set));
+    EXPECT_FALSE(NextHopRegistry::parse("10.0.0.1,", set));
+    EXPECT_FALSE(NextHopRegistry::parse("10.0.0.0/24", set));
+    EXPECT_FALSE(NextHopRegistry::parse("10.0.0.256", set));
+}
+
+TEST_F(NextHopRegistryTest, SharesOneObjectPerMemberSet) {
+    sai_object_id_t single = registry_.acquire("10.0.0.1");
+    ASSERT_NE(single, SAI_NULL_OBJECT_ID);
+    EXPECT_EQ(registry_.acquire(" 10.0.0.1"), single);
+    EXPECT_EQ(registry_.refCount(single), 2u);
+
+    // Different spellings of the same ECMP set resolve to one group
+    sai_object_id_t group = registry_.acquire("10.0.0.1,10.0.0.2");
+    ASSERT_NE(group, SAI_NULL_OBJECT_ID);
+    EXPECT_NE(group, single);
+    EXPECT_EQ(registry_.acquire("10.0.0.2,10.0.0.1"), group);
+    EXPECT_EQ(registry_.acquire("10.0.0.2,10.0.0.1,10.0.0.2"), group);
+    EXPECT_EQ(registry_.refCount(group), 3u);
+
+    // The group holds a reference on each member next hop
+    EXPECT_EQ(registry_.refCount(single), 3u);
+    EXPECT_EQ(registry_.nextHopCount(), 2u);
+    EXPECT_EQ(registry_.groupCount(), 1u);
+    EXPECT_EQ(registry_.saiObjectCount(), 5u);
+    EXPECT_EQ(createdNextHops(), 2u);
+    EXPECT_EQ(createdGroups(), 1u);
+    EXPECT_EQ(createdMembers(), 2u);
+
+    EXPECT_EQ(registry_.acquire("not-an-address"), SAI_NULL_OBJECT_ID);
+    EXPECT_EQ(registry_.saiObjectCount(), 5u);
+}
+
+TEST_F(NextHopRegistryTest, LastReleaseRemovesTheSAIObjects) {
+    sai_object_id_t group = registry_.acquire("10.0.0.1,10.0.0.2");
+    sai_object_id_t single = registry_.acquire("10.0.0.1");
+    ASSERT_NE(group, SAI_NULL_OBJECT_ID);
+    ASSERT_NE(single, SAI_NULL_OBJECT_ID);
+    EXPECT_EQ(registry_.acquire("10.0.0.2,10.0.0.1"), group);
+
+    registry_.release(group);
+    EXPECT_EQ(registry_.refCount(group), 1u);
+    EXPECT_EQ(createdGroups(), 1u);
+
+    registry_.release(group);
+    EXPECT_EQ(registry_.refCount(group), 0u);
+    EXPECT_EQ(createdGroups(), 0u);
+    EXPECT_EQ(createdMembers(), 0u);
+    // 10.0.0.1 is still referenced by the route that asked for it directly
+    EXPECT_EQ(registry_.refCount(single), 1u);
+    EXPECT_EQ(createdNextHops(), 1u);
+
+    registry_.release(single);
+    EXPECT_EQ(registry_.saiObjectCount(), 0u);
+    EXPECT_EQ(createdNextHops(), 0u);
+
+    // Releasing an unknown object is harmless, and a new acquire starts over
+    registry_.release(single);
+    sai_object_id_t again = registry_.acquire("10.0.0.1,10.0.0.2");
+    EXPECT_NE(again, SAI_NULL_OBJECT_ID);
+    EXPECT_EQ(registry_.refCount(again), 1u);
+    registry_.release(again);
+    EXPECT_EQ(createdGroups(), 0u);
+}
+
+} // namespace swss
+} // namespace sonic
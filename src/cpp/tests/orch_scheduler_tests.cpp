@@ -0,0 +1,118 @@
+/**
+ * @file orch_scheduler_tests.cpp
+ * @brief OrchScheduler dependency ordering and fairness unit tests
+ *
+ * Work is queued before start() and drained on one worker with small
+ * batches, so the order changes are applied in is deterministic.
+ */
+
+#include "orch_scheduler.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sonic {
+namespace swss {
+namespace {
+
+// Appends "<orch>:<key>" to a shared log for every change applied
+class RecordingOrch : public Orch {
+public:
+    RecordingOrch(const std::string& name, int priority, std::vector<std::string>& log, std::mutex& mutex)
+        : Orch(name, priority, {{CONFIG_DB, name + "|"}}), log_(log), mutex_(mutex) {}
+
+    void dependOn(const std::string& name) { addDependency(name); }
+
+    void queue(const std::string& key) {
+        common::TableChange change;
+        change.table = 0;
+        change.key = key;
+        change.deleted = false;
+        enqueue(change);
+    }
+
+protected:
+    void doTask(const common::TableChange& change) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        log_.push_back(getName() + ":" + change.key);
+    }
+
+private:
+    std::vector<std::string>& log_;
+    std::mutex& mutex_;
+};
+
+class OrchSchedulerTest : public ::testing::Test {
+protected:
+    void run(const std::vector<Orch*>& orchs) {
+        OrchScheduler scheduler(1);
+        ASSERT_TRUE(scheduler.setOrchs(orchs));
+        scheduler.setBatchSize(BATCH);
+        scheduler.start();
+        scheduler.waitIdle();
+        scheduler.stop();
+    }
+
+    size_t position(const std::string& entry) const {
+        return std::find(log_.begin(), log_.end(), entry) - log_.begin();
+    }
+
+    static constexpr size_t BATCH = 16;
+
+    std::vector<std::string> log_;
+    std::mutex mutex_;
+};
+
+} // anonymous namespace
+
+TEST_F(OrchSchedulerTest, DependentWaitsOnlyForOlderDependencyWork) {
+    RecordingOrch ports("PortsOrch", 3, log_, mutex_);
+    RecordingOrch members("VLANMemberOrch", 2, log_, mutex_);
+    members.dependOn("PortsOrch");
+
+    ports.queue("Ethernet0");
+    members.queue("Vlan100|Ethernet0");
+    for (int i = 0; i < 1000; ++i) {
+        ports.queue("Flood" + std::to_string(i));
+    }
+    run({&ports, &members});
+
+    ASSERT_EQ(log_.size(), 1002u);
+    EXPECT_LT(position("PortsOrch:Ethernet0"), position("VLANMemberOrch:Vlan100|Ethernet0"));
+    // The member only waits for the port queued before it, not for the flood behind it
+    EXPECT_LT(position("VLANMemberOrch:Vlan100|Ethernet0"), 1000u);
+}
+
+TEST_F(OrchSchedulerTest, RequeuedKeyWaitsForDependencyWorkQueuedBeforeIt) {
+    RecordingOrch vlans("VLANOrch", 2, log_, mutex_);
+    RecordingOrch members("VLANMemberOrch", 2, log_, mutex_);
+    members.dependOn("VLANOrch");
+
+    members.queue("Vlan200|Ethernet4");
+    vlans.queue("Vlan200");
+    members.queue("Vlan200|Ethernet4");
+    run({&vlans, &members});
+
+    ASSERT_EQ(log_.size(), 2u);
+    EXPECT_EQ(log_[0], "VLANOrch:Vlan200");
+    EXPECT_EQ(log_[1], "VLANMemberOrch:Vlan200|Ethernet4");
+}
+
+TEST_F(OrchSchedulerTest, LowerPriorityOrchGetsABoundedShare) {
+    RecordingOrch ports("PortsOrch", 3, log_, mutex_);
+    RecordingOrch routes("RouteOrch", 1, log_, mutex_);
+    for (int i = 0; i < 2000; ++i) {
+        ports.queue("Ethernet" + std::to_string(i));
+    }
+    routes.queue("10.0.0.0/24");
+    run({&ports, &routes});
+
+    // Two priority levels behind, the route waits about 2 * AGING_RUNS batches
+    ASSERT_EQ(log_.size(), 2001u);
+    EXPECT_LT(position("RouteOrch:10.0.0.0/24"), (2 * OrchScheduler::AGING_RUNS + 2) * BATCH);
+}
+
+} // namespace swss
+} // namespace sonic
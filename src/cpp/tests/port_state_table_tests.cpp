@@ -0,0 +1,165 @@
+/**
+ * @file port_state_table_tests.cpp
+ * @brief PortStateTable (per-port seqlock) read/update and concurrency unit tests
+ */
+
+#include "interrupts/port_state_table.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sonic {
+namespace interrupts {
+namespace {
+
+// Port names are interned process-wide, so each test uses its own
+bool setOper(PortStateTable& table, const std::string& port, LinkStatus status) {
+    return table.update(port, [status](LinkState& state, bool) {
+        state.oper_status = status;
+        return true;
+    });
+}
+
+} // anonymous namespace
+
+TEST(PortStateTableTest, UpdateStartsFromTheDefaultState) {
+    PortStateTable table;
+    LinkState state;
+    EXPECT_FALSE(table.get("PstBasic0", state));
+    EXPECT_FALSE(table.contains("PstBasic0"));
+
+    bool was_present = true;
+    ASSERT_TRUE(table.update("PstBasic0", [&was_present](LinkState& current, bool present) {
+        was_present = present;
+        current.speed_mbps = 100000;
+        current.duplex = "full";
+        return true;
+    }));
+    EXPECT_FALSE(was_present);
+
+    ASSERT_TRUE(table.get("PstBasic0", state));
+    EXPECT_EQ(state.port_name, "PstBasic0");
+    EXPECT_EQ(state.speed_mbps, 100000u);
+    EXPECT_EQ(state.duplex, "full");
+    EXPECT_EQ(state.mtu, 1500u);
+    EXPECT_EQ(state.oper_status, LinkStatus::UNKNOWN);
+
+    LinkState by_id;
+    ASSERT_TRUE(table.get(state.port_id, by_id));
+    EXPECT_EQ(by_id.port_name, "PstBasic0");
+    EXPECT_EQ(by_id.speed_mbps, 100000u);
+}
+
+TEST(PortStateTableTest, RejectedMutationLeavesTheSlotAlone) {
+    PortStateTable table;
+    ASSERT_TRUE(setOper(table, "PstBasic1", LinkStatus::UP));
+    ASSERT_TRUE(table.update("PstBasic1", [](LinkState& state, bool present) {
+        EXPECT_TRUE(present);
+        state.oper_status = LinkStatus::DOWN;
+        return false;
+    }));
+    LinkState state;
+    ASSERT_TRUE(table.get("PstBasic1", state));
+    EXPECT_EQ(state.oper_status, LinkStatus::UP);
+
+    // A rejected first update does not create the port
+    ASSERT_TRUE(table.update("PstBasic2", [](LinkState&, bool) { return false; }));
+    EXPECT_FALSE(table.contains("PstBasic2"));
+}
+
+TEST(PortStateTableTest, ReplaceAllKeepsOnlyTheGivenPorts) {
+    PortStateTable table;
+    setOper(table, "PstReplaceB", LinkStatus::UP);
+    setOper(table, "PstReplaceA", LinkStatus::UP);
+    EXPECT_EQ(table.names(), (std::vector<std::string>{"PstReplaceA", "PstReplaceB"}));
+
+    LinkState c = PortStateTable::defaultState("PstReplaceC");
+    c.oper_status = LinkStatus::DOWN;
+    LinkState a = PortStateTable::defaultState("PstReplaceA");
+    a.mtu = 9100;
+    ASSERT_TRUE(table.replaceAll({c, a}));
+
+    EXPECT_EQ(table.names(), (std::vector<std::string>{"PstReplaceA", "PstReplaceC"}));
+    EXPECT_EQ(table.size(), 2u);
+    std::vector<LinkState> all = table.getAll();
+    ASSERT_EQ(all.size(), 2u);
+    EXPECT_EQ(all[0].mtu, 9100u);
+    EXPECT_EQ(all[1].oper_status, LinkStatus::DOWN);
+
+    table.clear();
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_FALSE(table.contains("PstReplaceA"));
+}
+
+TEST(PortStateTableTest, ReadersNeverSeeATornRecord) {
+    // Writers keep three fields equal; a reader that copied a half-written slot would see them differ
+    PortStateTable table;
+    const std::vector<std::string> ports = {"PstRace0", "PstRace1"};
+    const uint64_t updates_per_writer = 20000;
+    for (const auto& port : ports) {
+        table.update(port, [](LinkState& state, bool) {
+            state.mac_address = "0";
+            return true;
+        });
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> torn{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&]() {
+            LinkState state;
+            std::vector<uint64_t> last(ports.size(), 0);
+            while (!done.load()) {
+                for (size_t p = 0; p < ports.size(); ++p) {
+                    if (!table.get(ports[p], state)) {
+                        torn++;
+                        continue;
+                    }
+                    if (state.link_up_count != state.link_down_count || state.speed_mbps != state.link_up_count ||
+                        state.mac_address != std::to_string(state.link_up_count) || state.link_up_count < last[p]) {
+                        torn++;
+                    }
+                    last[p] = state.link_up_count;
+                }
+            }
+        });
+    }
+
+    // Two writers per port, so the per-slot writer lock is contended too
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 4; ++w) {
+        const std::string& port = ports[w % ports.size()];
+        writers.emplace_back([&table, &port, updates_per_writer]() {
+            for (uint64_t i = 0; i < updates_per_writer; ++i) {
+                table.update(port, [](LinkState& state, bool) {
+                    state.link_up_count++;
+                    state.link_down_count = state.link_up_count;
+                    state.speed_mbps = static_cast<uint32_t>(state.link_up_count);
+                    state.mac_address = std::to_string(state.link_up_count);
+                    return true;
+                });
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0u);
+    for (const auto& port : ports) {
+        LinkState state;
+        ASSERT_TRUE(table.get(port, state));
+        // No update was lost to a racing writer
+        EXPECT_EQ(state.link_up_count, 2 * updates_per_writer);
+    }
+}
+
+} // namespace interrupts
+} // namespace sonic
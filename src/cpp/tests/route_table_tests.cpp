@@ -0,0 +1,163 @@
+/**
+ * @file route_table_tests.cpp
+ * @brief RouteTable (Patricia trie) insert, erase and longest-prefix-match unit tests
+ */
+
+#include "route_table.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace sonic {
+namespace common {
+namespace {
+
+IpPrefix prefix(const std::string& text) {
+    IpPrefix parsed;
+    EXPECT_TRUE(IpPrefix::parse(text, parsed)) << text;
+    return parsed;
+}
+
+// Value of the longest prefix covering address in a plain list, -1 when none does
+int linearLookup(const std::vector<std::pair<IpPrefix, int>>& routes, const IpPrefix& address) {
+    int best = -1;
+    int best_length = -1;
+    for (const auto& route : routes) {
+        if (route.first.v6 == address.v6 && route.first.length > best_length &&
+            IpPrefix::mask(address.address, route.first.length) == route.first.address) {
+            best = route.second;
+            best_length = route.first.length;
+        }
+    }
+    return best;
+}
+
+} // anonymous namespace
+
+TEST(RouteTableTest, LongestPrefixMatch) {
+    RouteTable<int> table;
+    EXPECT_TRUE(table.insert(prefix("0.0.0.0/0"), 0));
+    EXPECT_TRUE(table.insert(prefix("10.0.0.0/8"), 8));
+    EXPECT_TRUE(table.insert(prefix("10.1.0.0/16"), 16));
+    EXPECT_TRUE(table.insert(prefix("10.1.2.0/24"), 24));
+    EXPECT_TRUE(table.insert(prefix("2001:db8::/32"), 32));
+    EXPECT_EQ(table.size(), 5u);
+
+    IpPrefix matched;
+    ASSERT_NE(table.lookup(prefix("10.1.2.3"), &matched), nullptr);
+    EXPECT_EQ(*table.lookup(prefix("10.1.2.3")), 24);
+    EXPECT_EQ(matched, prefix("10.1.2.0/24"));
+    EXPECT_EQ(*table.lookup(prefix("10.1.3.1")), 16);
+    EXPECT_EQ(*table.lookup(prefix("10.200.0.1")), 8);
+    EXPECT_EQ(*table.lookup(prefix("192.168.0.1")), 0);
+    // A prefix is matched by its most specific cover, not by longer routes inside it
+    EXPECT_EQ(*table.lookup(prefix("10.1.0.0/20")), 16);
+
+    // The families do not share a default route
+    EXPECT_EQ(*table.lookup(prefix("2001:db8::1")), 32);
+    EXPECT_EQ(table.lookup(prefix("2001:db9::1")), nullptr);
+}
+
+TEST(RouteTableTest, InsertReplacesAndFindIsExact) {
+    RouteTable<int> table;
+    EXPECT_TRUE(table.insert(prefix("10.1.0.0/16"), 1));
+    EXPECT_FALSE(table.insert(prefix("10.1.0.0/16"), 2));
+    EXPECT_EQ(table.size(), 1u);
+    ASSERT_NE(table.find(prefix("10.1.0.0/16")), nullptr);
+    EXPECT_EQ(*table.find(prefix("10.1.0.0/16")), 2);
+
+    EXPECT_EQ(table.find(prefix("10.1.0.0/17")), nullptr);
+    EXPECT_EQ(table.find(prefix("10.0.0.0/8")), nullptr);
+    // Host bits are cleared on parse, so this names the same route
+    EXPECT_NE(table.find(prefix("10.1.9.9/16")), nullptr);
+}
+
+TEST(RouteTableTest, EraseSplicesOutGlueNodes) {
+    RouteTable<int> table;
+    const size_t roots = table.nodeCount();
+    table.insert(prefix("10.0.0.0/24"), 1);
+    table.insert(prefix("10.0.1.0/24"), 2);
+    // Two leaves under a glue node at 10.0.0.0/23
+    EXPECT_EQ(table.nodeCount(), roots + 3);
+
+    EXPECT_FALSE(table.erase(prefix("10.0.0.0/23")));
+    EXPECT_TRUE(table.erase(prefix("10.0.0.0/24")));
+    EXPECT_FALSE(table.erase(prefix("10.0.0.0/24")));
+    EXPECT_EQ(table.nodeCount(), roots + 1);
+    EXPECT_EQ(table.lookup(prefix("10.0.0.1")), nullptr);
+    EXPECT_EQ(*table.lookup(prefix("10.0.1.1")), 2);
+
+    EXPECT_TRUE(table.erase(prefix("10.0.1.0/24")));
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.nodeCount(), roots);
+}
+
+TEST(RouteTableTest, ErasingAnInnerRouteKeepsTheRoutesBelowIt) {
+    RouteTable<int> table;
+    table.insert(prefix("10.0.0.0/8"), 8);
+    table.insert(prefix("10.1.0.0/16"), 16);
+    table.insert(prefix("10.2.0.0/16"), 17);
+
+    EXPECT_TRUE(table.erase(prefix("10.0.0.0/8")));
+    EXPECT_EQ(*table.lookup(prefix("10.1.0.1")), 16);
+    EXPECT_EQ(*table.lookup(prefix("10.2.0.1")), 17);
+    EXPECT_EQ(table.lookup(prefix("10.3.0.1")), nullptr);
+}
+
+TEST(RouteTableTest, ForEachVisitsInOrder) {
+    RouteTable<int> table;
+    table.insert(prefix("2001:db8::/32"), 4);
+    table.insert(prefix("10.1.0.0/16"), 2);
+    table.insert(prefix("10.0.0.0/8"), 1);
+    table.insert(prefix("192.168.0.0/16"), 3);
+
+    std::vector<std::string> visited;
+    table.forEach([&visited](const IpPrefix& route, int) { visited.push_back(route.toString()); });
+    EXPECT_EQ(visited, (std::vector<std::string>{"10.0.0.0/8", "10.1.0.0/16", "192.168.0.0/16", "2001:db8::/32"}));
+}
+
+TEST(RouteTableTest, MatchesALinearScanUnderChurn) {
+    std::mt19937 rng(42);
+    RouteTable<int> table;
+    std::vector<std::pair<IpPrefix, int>> routes;
+
+    auto randomPrefix = [&rng]() {
+        // A narrow address range so prefixes nest and share glue nodes
+        IpPrefix route;
+        route.address = uint128(0x0A000000u | (rng() & 0x00FF0F00u)) << 96;
+        route.length = static_cast<uint8_t>(8 + rng() % 17);
+        route.address = IpPrefix::mask(route.address, route.length);
+        return route;
+    };
+
+    for (int step = 0; step < 4000; ++step) {
+        IpPrefix route = randomPrefix();
+        auto it = std::find_if(routes.begin(), routes.end(),
+                               [&route](const std::pair<IpPrefix, int>& entry) { return entry.first == route; });
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(table.erase(route), it != routes.end());
+            if (it != routes.end()) {
+                routes.erase(it);
+            }
+        } else {
+            EXPECT_EQ(table.insert(route, step), it == routes.end());
+            if (it == routes.end()) {
+                routes.emplace_back(route, step);
+            } else {
+                it->second = step;
+            }
+        }
+
+        IpPrefix probe;
+        probe.address = uint128(0x0A000000u | (rng() & 0x00FF0FFFu)) << 96;
+        probe.length = 32;
+        const int* found = table.lookup(probe);
+        ASSERT_EQ(found ? *found : -1, linearLookup(routes, probe)) << "step " << step;
+    }
+    EXPECT_EQ(table.size(), routes.size());
+}
+
+} // namespace common
+} // namespace sonic
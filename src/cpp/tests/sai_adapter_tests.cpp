@@ -0,0 +1,103 @@
+/**
+ * @file sai_adapter_tests.cpp
+ * @brief SAIAdapter multi-ASIC start-up and worker unit tests
+ *
+ * Run against the mock SAI. Each test leaves the adapter uninitialized with
+ * one ASIC configured, so the next user brings it up from scratch.
+ */
+
+#include "sai_adapter.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+namespace sonic {
+namespace sai {
+namespace {
+
+// The mock hands out one mutable switch API table; the tests swap entries in it
+sai_switch_api_t* mockSwitchAPI() {
+    sai_switch_api_t* api = nullptr;
+    sai_api_initialize(0, nullptr);
+    sai_api_query(SAI_API_SWITCH, reinterpret_cast<void**>(&api));
+    return api;
+}
+
+int g_creates_allowed = 0;
+std::vector<sai_object_id_t> g_created;
+std::vector<sai_object_id_t> g_removed;
+sai_create_switch_fn g_real_create = nullptr;
+
+sai_status_t failingCreateSwitch(sai_object_id_t* switch_id, uint32_t attr_count, const sai_attribute_t* attr_list) {
+    if (g_creates_allowed-- <= 0) {
+        return SAI_STATUS_FAILURE;
+    }
+    sai_status_t status = g_real_create(switch_id, attr_count, attr_list);
+    g_created.push_back(*switch_id);
+    return status;
+}
+
+sai_status_t recordingRemoveSwitch(sai_object_id_t switch_id) {
+    g_removed.push_back(switch_id);
+    return SAI_STATUS_SUCCESS;
+}
+
+class SAIAdapterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        adapter_ = SAIAdapter::getInstance();
+        adapter_->uninitialize();
+        ASSERT_TRUE(adapter_->setAsicCount(2));
+    }
+
+    void TearDown() override {
+        adapter_->uninitialize();
+        adapter_->setAsicCount(1);
+    }
+
+    SAIAdapter* adapter_ = nullptr;
+};
+
+} // anonymous namespace
+
+TEST_F(SAIAdapterTest, RemovesCreatedSwitchesWhenALaterAsicFails) {
+    sai_switch_api_t* api = mockSwitchAPI();
+    ASSERT_NE(api, nullptr);
+    sai_switch_api_t saved = *api;
+    g_real_create = saved.create_switch;
+    g_creates_allowed = 1;
+    g_created.clear();
+    g_removed.clear();
+    api->create_switch = failingCreateSwitch;
+    api->remove_switch = recordingRemoveSwitch;
+
+    bool initialized = adapter_->initialize();
+    *api = saved;
+
+    EXPECT_FALSE(initialized);
+    EXPECT_FALSE(adapter_->isInitialized());
+    EXPECT_EQ(adapter_->getAsicCount(), 0u);
+    ASSERT_EQ(g_created.size(), 1u);
+    EXPECT_EQ(g_removed, g_created);
+
+    // Nothing is left behind that would stop a clean retry
+    EXPECT_TRUE(adapter_->initialize());
+    EXPECT_EQ(adapter_->getAsicCount(), 2u);
+}
+
+TEST_F(SAIAdapterTest, WorkerSurvivesAThrowingTask) {
+    ASSERT_TRUE(adapter_->initialize());
+
+    ASSERT_TRUE(adapter_->submit(1, [](const SAISwitchContext&) { throw std::runtime_error("task failed"); }));
+    std::promise<size_t> ran;
+    ASSERT_TRUE(adapter_->submit(1, [&ran](const SAISwitchContext& context) { ran.set_value(context.index); }));
+
+    std::future<size_t> index = ran.get_future();
+    ASSERT_EQ(index.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(index.get(), 1u);
+}
+
+} // namespace sai
+} // namespace sonic
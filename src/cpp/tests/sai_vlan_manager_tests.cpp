@@ -0,0 +1,119 @@
+/**
+ * @file sai_vlan_manager_tests.cpp
+ * @brief SAIVLANManager multi-ASIC member placement unit tests
+ *
+ * Run against the mock SAI on two ASICs. The manager brings the adapter up
+ * and leaves it uninitialized when it is destroyed.
+ */
+
+#include "sai_vlan_manager.h"
+#include "sai_adapter.h"
+#include "../common/port_registry.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sonic {
+namespace sai {
+namespace {
+
+class SAIVLANManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        adapter_ = SAIAdapter::getInstance();
+        ASSERT_TRUE(adapter_->setAsicCount(2));
+        manager_.reset(new SAIVLANManager());
+        ASSERT_EQ(adapter_->getAsicCount(), 2u);
+        ASSERT_TRUE(manager_->createVLAN(100, "Vlan100"));
+    }
+
+    void TearDown() override {
+        manager_.reset();
+        adapter_->setAsicCount(1);
+    }
+
+    // Any object created on the ASIC stands in for a bridge port it owns
+    sai_object_id_t registerPortOn(size_t asic_index, const std::string& name) {
+        const SAISwitchContext* asic = adapter_->getSwitch(asic_index);
+        sai_attribute_t attr;
+        attr.id = SAI_VLAN_ATTR_VLAN_ID;
+        attr.value.u16 = static_cast<uint16_t>(4000 + asic_index);
+        sai_object_id_t oid = SAI_NULL_OBJECT_ID;
+        EXPECT_EQ(asic->vlan_api->create_vlan(&oid, asic->switch_id, 1, &attr), SAI_STATUS_SUCCESS);
+        common::portRegistry().addPort(name, oid);
+        return oid;
+    }
+
+    size_t membersOn(size_t asic_index) const {
+        sai_object_id_t switch_id = adapter_->getSwitch(asic_index)->switch_id;
+        size_t count = 0;
+        for (const auto& member : manager_->getVLANInfo(100).members) {
+            count += sai_switch_id_query(member.member_oid) == switch_id ? 1 : 0;
+        }
+        return count;
+    }
+
+    SAIAdapter* adapter_ = nullptr;
+    std::unique_ptr<SAIVLANManager> manager_;
+};
+
+} // anonymous namespace
+
+TEST_F(SAIVLANManagerTest, CreatesMembersOnlyOnThePortsAsic) {
+    size_t members_before = mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN_MEMBER);
+    registerPortOn(1, "EthernetAsic1");
+    ASSERT_TRUE(manager_->addPortToVLAN(100, "EthernetAsic1", false));
+
+    EXPECT_EQ(mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN_MEMBER), members_before + 1);
+    EXPECT_EQ(membersOn(1), 1u);
+    EXPECT_EQ(membersOn(0), 0u);
+
+    ASSERT_TRUE(manager_->removePortFromVLAN(100, "EthernetAsic1"));
+    EXPECT_EQ(mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN_MEMBER), members_before);
+}
+
+TEST_F(SAIVLANManagerTest, BulkAddSplitsMembersByOwningAsic) {
+    size_t members_before = mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN_MEMBER);
+    registerPortOn(0, "EthernetBulk0");
+    registerPortOn(1, "EthernetBulk1");
+    std::vector<VLANMemberRequest> requests(2);
+    requests[0].vlan_id = 100;
+    requests[0].port_name = "EthernetBulk0";
+    requests[0].tagged = true;
+    requests[1].vlan_id = 100;
+    requests[1].port_name = "EthernetBulk1";
+    requests[1].tagged = false;
+
+    std::vector<sai_status_t> statuses = manager_->addPortsToVLANs(requests);
+    ASSERT_EQ(statuses.size(), 2u);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN_MEMBER), members_before + 2);
+    EXPECT_EQ(membersOn(0), 1u);
+    EXPECT_EQ(membersOn(1), 1u);
+
+    statuses = manager_->removePortsFromVLANs(requests);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN_MEMBER), members_before);
+}
+
+TEST_F(SAIVLANManagerTest, MockRefusesListAttributes) {
+    const SAISwitchContext* asic = adapter_->getSwitch(0);
+    sai_attribute_t list;
+    list.id = SAI_VLAN_ATTR_MEMBER_LIST;
+    list.value.u64 = 0;
+    size_t vlans_before = mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN);
+
+    // The store copies attributes by value, so a list would dangle
+    sai_object_id_t oid = SAI_NULL_OBJECT_ID;
+    EXPECT_EQ(asic->vlan_api->create_vlan(&oid, asic->switch_id, 1, &list), SAI_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN), vlans_before);
+
+    sai_object_id_t vlan_oid = registerPortOn(0, "EthernetListAttr");
+    EXPECT_EQ(asic->vlan_api->set_vlan_attribute(vlan_oid, &list), SAI_STATUS_NOT_SUPPORTED);
+}
+
+} // namespace sai
+} // namespace sonic
@@ -0,0 +1,32 @@
+/**
+ * @file sfp_info_cache_tests.cpp
+ * @brief SfpInfoCache record round-trip unit tests
+ */
+
+#include "interrupts/sfp_info_cache.h"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace sonic {
+namespace interrupts {
+
+TEST(SfpInfoCacheTest, KeepsFullSff8024ConnectorNames) {
+    SfpInfoCache cache;
+    const char* names[] = {"No separable connector", "CS optical connector",
+                           "SN (previously Mini CS) optical connector"};
+    int index = 0;
+    for (const char* name : names) {
+        SFPInfo info;
+        info.port_name = "EthernetSfp" + std::to_string(index++);
+        info.is_present = true;
+        info.connector_type = name;
+        ASSERT_TRUE(cache.insert(info));
+
+        SFPInfo stored;
+        ASSERT_TRUE(cache.get(info.port_name, stored));
+        EXPECT_EQ(stored.connector_type, name);
+    }
+}
+
+} // namespace interrupts
+} // namespace sonic
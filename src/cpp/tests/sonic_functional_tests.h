@@ -7,6 +7,9 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <functional>
 
 namespace sonic {
 namespace tests {
@@ -31,6 +34,31 @@ struct TestSuiteResult {
     std::vector<TestResult> test_results;
 };
 
+// Ports and VLAN IDs one test case may touch. Cases running in parallel get
+// disjoint partitions, so they never write the same CONFIG_DB keys.
+// Partition 0 is the layout the serial run has always used.
+struct TestPartition {
+    static constexpr int MAX_PARTITIONS = 8;
+    static constexpr int PORTS_PER_PARTITION = 4;
+    static constexpr uint16_t VLAN_STRIDE = 500;    // Tests name VLANs 100-594, so 8 partitions end below 4095
+
+    int index = 0;
+    std::vector<std::string> ports;
+    uint16_t vlan_base = 0;
+
+    static TestPartition make(int index);
+
+    // Partition-local VLAN for the ID a test names
+    uint16_t vlan(uint16_t vlan_id) const { return static_cast<uint16_t>(vlan_base + vlan_id); }
+};
+
+// One schedulable test case
+struct TestCase {
+    std::string suite_name;
+    std::function<TestResult()> run;
+    bool exclusive;     // Touches state outside its partition (e.g. global handlers); runs alone
+};
+
 // Main Functional Test Class
 class SONiCFunctionalTests {
 public:
@@ -43,6 +71,13 @@ public:
 
     // Run all functional tests
     bool runAllTests();
+
+    // Schedule cases on up to jobs workers, one partition each, then run the
+    // exclusive cases alone. Results are grouped per suite in first-seen order.
+    std::vector<TestSuiteResult> runTestCases(const std::vector<TestCase>& cases);
+    std::vector<TestCase> halTestCases();
+    std::vector<TestCase> saiTestCases();
+    std::vector<TestCase> interruptTestCases();
     
     // HAL Functional Tests
     TestSuiteResult runHALTests();
@@ -61,6 +96,8 @@ public:
     TestResult testPortStatusControl();
     TestResult testMultipleVLANOperations();
     TestResult testVLANPortInteraction();
+    TestResult testConfigTransactionPartialFailure();
+    TestResult testLAGMemberLinkEvents();
 
     // Advanced SAI Tests
     TestResult testFDBManagement();
@@ -108,6 +145,7 @@ public:
     void setVerboseMode(bool verbose);
     void setStopOnFirstFailure(bool stop);
     void setTimeout(int timeout_seconds);
+    void setJobs(int jobs);     // 1 = serial; clamped to TestPartition::MAX_PARTITIONS
 
 private:
     std::unique_ptr<hal::SONiCHALController> m_hal_controller;
@@ -118,6 +156,7 @@ private:
     bool m_verbose_mode;
     bool m_stop_on_failure;
     int m_timeout_seconds;
+    int m_jobs;
     
     // Test execution helpers
     TestResult executeTest(const std::string& test_name, 
@@ -129,6 +168,15 @@ private:
     void logTestError(const std::string& error);
     void logTestWarning(const std::string& warning);
     void logTestInfo(const std::string& info);
+    std::string logTag() const;
+
+    // Resources of the partition the calling thread's test runs in
+    const TestPartition& partition() const;
+    std::vector<std::string> testPorts(int count) const;
+    uint16_t testVLAN(uint16_t vlan_id) const { return partition().vlan(vlan_id); }
+
+    TestSuiteResult runSuite(const std::string& suite_name, const std::vector<TestCase>& cases);
+    static void tallySuite(TestSuiteResult& suite_result);
     
     // Test data management
     void setupTestEnvironment();
@@ -148,15 +196,23 @@ private:
     void startTimer();
     double getElapsedTimeMs();
     
-    // Test state tracking
+    // Test state tracking (shared by parallel cases)
+    void trackVLAN(uint16_t vlan_id);
+    void untrackVLAN(uint16_t vlan_id);
+    void trackVLANPort(uint16_t vlan_id, const std::string& port_name);
+    void untrackVLANPort(uint16_t vlan_id, const std::string& port_name);
+    void trackPort(const std::string& port_name);
+
+    std::mutex m_tracking_mutex;
     std::vector<uint16_t> m_created_vlans;
     std::vector<std::string> m_modified_ports;
     std::vector<std::pair<uint16_t, std::string>> m_vlan_port_associations;
+    TestPartition m_default_partition;
     
     // Test statistics
-    int m_total_tests_run;
-    int m_total_tests_passed;
-    int m_total_tests_failed;
+    std::atomic<int> m_total_tests_run;
+    std::atomic<int> m_total_tests_passed;
+    std::atomic<int> m_total_tests_failed;
     double m_total_execution_time_ms;
     
     // Test results storage
@@ -0,0 +1,88 @@
+/**
+ * @file string_interner_tests.cpp
+ * @brief StringInterner ID assignment, capacity and concurrency unit tests
+ */
+
+#include "string_interner.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sonic {
+namespace common {
+
+TEST(StringInternerTest, AssignsDenseStableIds) {
+    StringInterner interner;
+    EXPECT_EQ(interner.intern("Ethernet0"), 0u);
+    EXPECT_EQ(interner.intern("Ethernet4"), 1u);
+    EXPECT_EQ(interner.intern("Ethernet0"), 0u);
+    EXPECT_EQ(interner.size(), 2u);
+
+    InternId id = INVALID_INTERN_ID;
+    EXPECT_TRUE(interner.find("Ethernet4", id));
+    EXPECT_EQ(id, 1u);
+    EXPECT_FALSE(interner.find("Ethernet8", id));
+    EXPECT_EQ(interner.size(), 2u);
+
+    EXPECT_EQ(interner.name(1), "Ethernet4");
+    EXPECT_EQ(interner.name(2), "");
+    EXPECT_EQ(interner.name(INVALID_INTERN_ID), "");
+}
+
+TEST(StringInternerTest, RefusesNewNamesWhenFull) {
+    StringInterner interner(2);
+    EXPECT_EQ(interner.intern("a"), 0u);
+    EXPECT_EQ(interner.intern("b"), 1u);
+    EXPECT_EQ(interner.intern("c"), INVALID_INTERN_ID);
+    // Names already present still resolve
+    EXPECT_EQ(interner.intern("a"), 0u);
+    EXPECT_EQ(interner.size(), 2u);
+}
+
+TEST(StringInternerTest, NameReferencesSurviveGrowth) {
+    StringInterner interner;
+    const std::string& first = interner.name(interner.intern("Ethernet0"));
+    // Cross several chunk boundaries
+    for (size_t i = 1; i < 3 * StringInterner::CHUNK_SIZE + 1; ++i) {
+        ASSERT_EQ(interner.intern("Ethernet" + std::to_string(i * 4)), i);
+    }
+    EXPECT_EQ(first, "Ethernet0");
+    EXPECT_EQ(interner.name(StringInterner::CHUNK_SIZE), "Ethernet" + std::to_string(StringInterner::CHUNK_SIZE * 4));
+}
+
+TEST(StringInternerTest, ConcurrentInternsAgree) {
+    StringInterner interner;
+    const size_t names = 2048;
+    const int threads = 4;
+    std::vector<std::vector<InternId>> ids(threads, std::vector<InternId>(names));
+    std::atomic<bool> failed_lookup{false};
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            // Each thread walks the names in its own (odd-stride) order and reads them back without the lock
+            for (size_t n = 0; n < names; ++n) {
+                size_t i = (n * (2 * t + 1)) % names;
+                InternId id = interner.intern("port" + std::to_string(i));
+                ids[t][i] = id;
+                if (interner.name(id) != "port" + std::to_string(i)) {
+                    failed_lookup = true;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_FALSE(failed_lookup.load());
+    EXPECT_EQ(interner.size(), names);
+    for (int t = 1; t < threads; ++t) {
+        EXPECT_EQ(ids[t], ids[0]);
+    }
+}
+
+} // namespace common
+} // namespace sonic
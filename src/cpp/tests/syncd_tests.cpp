@@ -0,0 +1,265 @@
+/**
+ * @file syncd_tests.cpp
+ * @brief Syncd wire format and request/reply unit tests
+ *
+ * Codec and Syncd::processFrame tests run against the mock SAI only; the
+ * producer tests that reserve VIDs or round-trip through ASIC_STATE_QUEUE
+ * skip when ASIC_DB is unreachable.
+ */
+
+#include "syncd.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <set>
+
+namespace sonic {
+namespace syncd {
+namespace {
+
+common::RedisConfig testRedisConfig() {
+    common::RedisConfig config = common::RedisConfig::fromEnvironment("localhost");
+    config.shell_fallback = false;
+    return config;
+}
+
+bool asicDbReachable() {
+    common::RedisConnection connection(testRedisConfig(), ASIC_DB);
+    return connection.connect();
+}
+
+sai_attribute_t u16Attr(int32_t id, uint16_t value) {
+    sai_attribute_t attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.id = id;
+    attr.value.u16 = value;
+    return attr;
+}
+
+sai_attribute_t u32Attr(int32_t id, uint32_t value) {
+    sai_attribute_t attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.id = id;
+    attr.value.u32 = value;
+    return attr;
+}
+
+AsicOperation vlanOp(AsicOp op, sai_object_id_t vid, std::vector<sai_attribute_t> attrs = {}) {
+    AsicOperation operation;
+    operation.op = op;
+    operation.object_type = SAI_OBJECT_TYPE_VLAN;
+    operation.object_id = vid;
+    operation.attrs = std::move(attrs);
+    return operation;
+}
+
+/**
+ * @brief Encode a batch, run it through processFrame and decode the reply
+ */
+std::vector<sai_status_t> roundTrip(Syncd& syncd, const AsicBatch& batch) {
+    std::string frame, reply_key, reply_frame;
+    AsicBatchCodec::encode(batch, frame);
+    EXPECT_TRUE(syncd.processFrame(frame, reply_key, reply_frame));
+    EXPECT_EQ(batch.reply_key, reply_key);
+
+    AsicBatchReply reply;
+    EXPECT_TRUE(AsicBatchCodec::decodeReply(reply_frame, reply));
+    EXPECT_EQ(batch.sequence, reply.sequence);
+    return reply.statuses;
+}
+
+} // anonymous namespace
+
+TEST(AsicBatchCodecTest, RoundTripsOperationsAndReply) {
+    AsicBatch batch;
+    batch.sequence = 42;
+    batch.reply_key = "REPLY:test";
+    batch.ops.push_back(vlanOp(AsicOp::CREATE, makeVirtualOid(SAI_OBJECT_TYPE_VLAN, 7),
+                               {u16Attr(SAI_VLAN_ATTR_VLAN_ID, 100)}));
+    batch.ops.push_back(vlanOp(AsicOp::SET, makeVirtualOid(SAI_OBJECT_TYPE_VLAN, 7),
+                               {u32Attr(SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES, 512)}));
+    batch.ops.push_back(vlanOp(AsicOp::REMOVE, makeVirtualOid(SAI_OBJECT_TYPE_VLAN, 7)));
+
+    std::string frame;
+    AsicBatchCodec::encode(batch, frame);
+    AsicBatch decoded;
+    ASSERT_TRUE(AsicBatchCodec::decode(frame, decoded));
+    EXPECT_EQ(42u, decoded.sequence);
+    EXPECT_EQ("REPLY:test", decoded.reply_key);
+    ASSERT_EQ(3u, decoded.ops.size());
+    EXPECT_EQ(AsicOp::CREATE, decoded.ops[0].op);
+    EXPECT_EQ(batch.ops[0].object_id, decoded.ops[0].object_id);
+    ASSERT_EQ(1u, decoded.ops[0].attrs.size());
+    EXPECT_EQ(100, decoded.ops[0].attrs[0].value.u16);
+    ASSERT_EQ(1u, decoded.ops[1].attrs.size());
+    EXPECT_EQ(512u, decoded.ops[1].attrs[0].value.u32);
+    EXPECT_TRUE(decoded.ops[2].attrs.empty());
+
+    AsicBatchReply reply;
+    reply.sequence = 42;
+    reply.statuses = {SAI_STATUS_SUCCESS, SAI_STATUS_ITEM_NOT_FOUND};
+    std::string reply_frame;
+    AsicBatchCodec::encodeReply(reply, reply_frame);
+    AsicBatchReply decoded_reply;
+    ASSERT_TRUE(AsicBatchCodec::decodeReply(reply_frame, decoded_reply));
+    EXPECT_EQ(reply.statuses, decoded_reply.statuses);
+}
+
+TEST(AsicBatchCodecTest, RejectsTruncatedFrames) {
+    AsicBatch batch;
+    batch.sequence = 1;
+    batch.ops.push_back(vlanOp(AsicOp::CREATE, makeVirtualOid(SAI_OBJECT_TYPE_VLAN, 1),
+                               {u16Attr(SAI_VLAN_ATTR_VLAN_ID, 10)}));
+    std::string frame;
+    AsicBatchCodec::encode(batch, frame);
+
+    AsicBatch decoded;
+    for (size_t length = 0; length < frame.size(); ++length) {
+        EXPECT_FALSE(AsicBatchCodec::decode(frame.substr(0, length), decoded)) << "length " << length;
+    }
+    EXPECT_FALSE(AsicBatchCodec::decode(frame + "x", decoded));
+}
+
+TEST(AsicBatchCodecTest, RejectsUnsupportedAttributes) {
+    // MEMBER_LIST is an object list: its value holds a pointer, so it has no wire form
+    EXPECT_EQ(AttrValueKind::UNSUPPORTED, attrValueKind(SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_MEMBER_LIST));
+
+    AsicBatch batch;
+    batch.ops.push_back(vlanOp(AsicOp::SET, makeVirtualOid(SAI_OBJECT_TYPE_VLAN, 1),
+                               {u32Attr(SAI_VLAN_ATTR_MEMBER_LIST, 0)}));
+    std::string frame;
+    AsicBatchCodec::encode(batch, frame);
+    AsicBatch decoded;
+    EXPECT_FALSE(AsicBatchCodec::decode(frame, decoded));
+}
+
+TEST(SaiRedisTest, RefusesUnsupportedAttributes) {
+    SaiRedis producer(testRedisConfig());
+    sai_attribute_t list = u32Attr(SAI_VLAN_ATTR_MEMBER_LIST, 0);
+    EXPECT_EQ(SAI_NULL_OBJECT_ID, producer.create(SAI_OBJECT_TYPE_VLAN, 1, &list));
+    EXPECT_FALSE(producer.set(makeVirtualOid(SAI_OBJECT_TYPE_VLAN, 1), list));
+    EXPECT_EQ(0u, producer.pending());
+}
+
+TEST(SaiRedisTest, ProducersGetDisjointVids) {
+    if (!asicDbReachable()) {
+        GTEST_SKIP() << "ASIC_DB unreachable";
+    }
+    sai_attribute_t attr = u16Attr(SAI_VLAN_ATTR_VLAN_ID, 10);
+    std::set<sai_object_id_t> seen;
+    {
+        SaiRedis first(testRedisConfig());
+        SaiRedis second(testRedisConfig());
+        for (int i = 0; i < 8; ++i) {
+            sai_object_id_t a = first.create(SAI_OBJECT_TYPE_VLAN, 1, &attr);
+            sai_object_id_t b = second.create(SAI_OBJECT_TYPE_VLAN, 1, &attr);
+            ASSERT_NE(SAI_NULL_OBJECT_ID, a);
+            ASSERT_NE(SAI_NULL_OBJECT_ID, b);
+            EXPECT_TRUE(seen.insert(a).second);
+            EXPECT_TRUE(seen.insert(b).second);
+        }
+    }
+
+    // A restarted producer must not reuse the VIDs of the one before it
+    SaiRedis restarted(testRedisConfig());
+    sai_object_id_t vid = restarted.create(SAI_OBJECT_TYPE_VLAN, 1, &attr);
+    ASSERT_NE(SAI_NULL_OBJECT_ID, vid);
+    EXPECT_EQ(0u, seen.count(vid));
+    EXPECT_NE(switchVirtualOid(), vid);
+}
+
+class SyncdTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        syncd_.reset(new Syncd(testRedisConfig()));
+        ASSERT_TRUE(syncd_->initialize());
+    }
+
+    std::unique_ptr<Syncd> syncd_;
+};
+
+TEST_F(SyncdTest, AppliesCreateSetRemoveAndRepliesPerObject) {
+    sai_object_id_t first = makeVirtualOid(SAI_OBJECT_TYPE_VLAN, 0x100001);
+    sai_object_id_t second = makeVirtualOid(SAI_OBJECT_TYPE_VLAN, 0x100002);
+    sai_object_id_t unknown = makeVirtualOid(SAI_OBJECT_TYPE_VLAN, 0x100003);
+
+    AsicBatch create;
+    create.sequence = 1;
+    create.reply_key = "REPLY:create";
+    create.ops.push_back(vlanOp(AsicOp::CREATE, first, {u16Attr(SAI_VLAN_ATTR_VLAN_ID, 3001)}));
+    create.ops.push_back(vlanOp(AsicOp::CREATE, second, {u16Attr(SAI_VLAN_ATTR_VLAN_ID, 3002)}));
+    size_t vlans_before = mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN);
+    std::vector<sai_status_t> statuses = roundTrip(*syncd_, create);
+    ASSERT_EQ(2u, statuses.size());
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[1]);
+    EXPECT_EQ(vlans_before + 2, mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN));
+    EXPECT_NE(SAI_NULL_OBJECT_ID, syncd_->translateVid(first));
+
+    AsicBatch duplicate;
+    duplicate.sequence = 2;
+    duplicate.reply_key = "REPLY:duplicate";
+    duplicate.ops.push_back(vlanOp(AsicOp::CREATE, first, {u16Attr(SAI_VLAN_ATTR_VLAN_ID, 3001)}));
+    statuses = roundTrip(*syncd_, duplicate);
+    ASSERT_EQ(1u, statuses.size());
+    EXPECT_EQ(SAI_STATUS_ITEM_ALREADY_EXISTS, statuses[0]);
+
+    // One SET run with a miss in the middle: the objects around it still apply
+    AsicBatch set;
+    set.sequence = 3;
+    set.reply_key = "REPLY:set";
+    set.ops.push_back(vlanOp(AsicOp::SET, first, {u32Attr(SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES, 64)}));
+    set.ops.push_back(vlanOp(AsicOp::SET, unknown, {u32Attr(SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES, 64)}));
+    set.ops.push_back(vlanOp(AsicOp::SET, second, {u32Attr(SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES, 128)}));
+    set.ops.push_back(vlanOp(AsicOp::SET, second, {}));
+    statuses = roundTrip(*syncd_, set);
+    ASSERT_EQ(4u, statuses.size());
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+    EXPECT_EQ(SAI_STATUS_ITEM_NOT_FOUND, statuses[1]);
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[2]);
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, statuses[3]);
+
+    AsicBatch remove;
+    remove.sequence = 4;
+    remove.reply_key = "REPLY:remove";
+    remove.ops.push_back(vlanOp(AsicOp::REMOVE, first));
+    remove.ops.push_back(vlanOp(AsicOp::REMOVE, second));
+    remove.ops.push_back(vlanOp(AsicOp::REMOVE, unknown));
+    statuses = roundTrip(*syncd_, remove);
+    ASSERT_EQ(3u, statuses.size());
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[1]);
+    EXPECT_EQ(SAI_STATUS_ITEM_NOT_FOUND, statuses[2]);
+    EXPECT_EQ(SAI_NULL_OBJECT_ID, syncd_->translateVid(first));
+    EXPECT_EQ(vlans_before, mockSAIObjectCount(SAI_OBJECT_TYPE_VLAN));
+}
+
+TEST_F(SyncdTest, CountsMalformedFrames) {
+    std::string reply_key, reply_frame;
+    EXPECT_FALSE(syncd_->processFrame("garbage", reply_key, reply_frame));
+    EXPECT_TRUE(reply_key.empty());
+    EXPECT_EQ(1u, syncd_->stats().malformed_frames);
+}
+
+TEST_F(SyncdTest, ProducerRoundTripsThroughAsicDb) {
+    if (!asicDbReachable()) {
+        GTEST_SKIP() << "ASIC_DB unreachable";
+    }
+    ASSERT_TRUE(syncd_->start());
+
+    SaiRedis producer(testRedisConfig());
+    sai_attribute_t vlan_id = u16Attr(SAI_VLAN_ATTR_VLAN_ID, 3010);
+    sai_object_id_t vid = producer.create(SAI_OBJECT_TYPE_VLAN, 1, &vlan_id);
+    ASSERT_NE(SAI_NULL_OBJECT_ID, vid);
+    ASSERT_TRUE(producer.set(vid, u32Attr(SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES, 32)));
+    producer.remove(vid);
+
+    std::vector<sai_status_t> statuses;
+    ASSERT_TRUE(producer.flush(&statuses));
+    EXPECT_EQ(std::vector<sai_status_t>(3, SAI_STATUS_SUCCESS), statuses);
+    EXPECT_EQ(0u, producer.pending());
+    syncd_->stop();
+}
+
+} // namespace syncd
+} // namespace sonic